@@ -0,0 +1,39 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// LatencyRecorderBench.hpp
+// Robert M. Baker | Created : 17OCT26 | Last Modified : 17OCT26 by Robert M. Baker
+// Version : 2.3.0
+// This is a header file for 'QMXStdLibBench'; it defines a set of benchmarks for the 'QMXStdLib::LatencyRecorder' class.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+//
+// This file is part of 'QMXStdLib'.
+//
+// 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option) any later version.
+//
+// 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __QMX_QMXSTDLIBBENCH_LATENCYRECORDERBENCH_HPP_
+#define __QMX_QMXSTDLIBBENCH_LATENCYRECORDERBENCH_HPP_
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Header Files
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <vector>
+#include <benchmark/benchmark.h>
+
+#include "../../include/LatencyRecorder.hpp"
+#include "../../include/Utility.hpp"
+#include "../../include/RAII/ScopedLatency.hpp"
+
+#endif // __QMX_QMXSTDLIBBENCH_LATENCYRECORDERBENCH_HPP_
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of 'LatencyRecorderBench.hpp'
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,116 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// ConsoleIOBench.cpp
+// Robert M. Baker | Created : 17OCT26 | Last Modified : 17OCT26 by Robert M. Baker
+// Version : 2.3.0
+// This is a source file for 'QMXStdLibBench'; it defines a set of benchmarks for the 'QMXStdLib::ConsoleIO' class.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+//
+// This file is part of 'QMXStdLib'.
+//
+// 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option) any later version.
+//
+// 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Header Files
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../include/ConsoleIOBench.hpp"
+
+using namespace std;
+using namespace QMXStdLib;
+using namespace benchmark;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Start of the 'ConsoleIOBench' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ConsoleIOBench
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Global Variables
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int descriptorBackup = -1;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Global Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void setUp( const State& state )
+{
+	// Create local variables.
+
+		int nullDescriptor = open( "/dev/null", O_WRONLY );
+
+	// Send standard error to the null device, so the benchmark measures the library rather than the terminal, and start the writer if asked to.
+
+		clog.flush();
+		descriptorBackup = dup( STDERR_FILENO );
+		dup2( nullDescriptor, STDERR_FILENO );
+		close( nullDescriptor );
+
+		if( state.range( 0 ) )
+			ConsoleIO::startAsync( CONSOLEIO_QUEUE_CAPACITY, ConsoleIO::BLOCK );
+}
+
+void tearDown( const State& state )
+{
+	// Stop the writer, if it was started, and restore standard error.
+
+		if( state.range( 0 ) )
+			ConsoleIO::stopAsync();
+
+		clog.flush();
+		dup2( descriptorBackup, STDERR_FILENO );
+		close( descriptorBackup );
+}
+
+} // 'ConsoleIOBench' Namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of the 'ConsoleIOBench' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// 'QMXStdLib::ConsoleIO' Benchmark Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void ConsoleIOBench_Log( State& state )
+{
+	// Perform benchmark for writing a typical log line, one value at a time, through 'CLOG'.
+
+		for( auto iteration : state )
+			CLOG << "Worker " << state.thread_index() << " processed request " << state.iterations() << " in " << 12.5 << " ms\n";
+
+		state.SetItemsProcessed( state.iterations() );
+}
+
+void ConsoleIOBench_Log_Disabled( State& state )
+{
+	// Perform benchmark for writing the same line through 'CLOG' while the log stream is disabled.
+
+		ConsoleIO::setStreamDisabled( ConsoleIO::LOG_STREAM, true );
+
+		for( auto iteration : state )
+			CLOG << "Worker " << state.thread_index() << " processed request " << state.iterations() << " in " << 12.5 << " ms\n";
+
+		ConsoleIO::setStreamDisabled( ConsoleIO::LOG_STREAM, false );
+}
+
+BENCHMARK( ConsoleIOBench_Log )->ArgName( "async" )->Arg( 0 )->Arg( 1 )->ThreadRange( 1, 4 )->UseRealTime()->Setup( ConsoleIOBench::setUp )->Teardown(
+	ConsoleIOBench::tearDown
+);
+
+BENCHMARK( ConsoleIOBench_Log_Disabled )->ArgName( "async" )->Arg( 0 );
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of 'ConsoleIOBench.cpp'
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
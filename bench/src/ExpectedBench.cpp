@@ -0,0 +1,100 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// ExpectedBench.cpp
+// Robert M. Baker | Created : 17OCT26 | Last Modified : 17OCT26 by Robert M. Baker
+// Version : 2.3.0
+// This is a source file for 'QMXStdLibBench'; it defines a set of benchmarks for the 'QMXStdLib::Expected' class.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+//
+// This file is part of 'QMXStdLib'.
+//
+// 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option) any later version.
+//
+// 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Header Files
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../include/ExpectedBench.hpp"
+
+using namespace std;
+using namespace QMXStdLib;
+using namespace benchmark;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// 'QMXStdLib::Expected' Benchmark Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void ExpectedBench_JoinMissingThrow( State& state )
+{
+	// Create local variables.
+
+		ThreadManager::InstancePtr instance = ThreadManager::create();
+		string groupID = "MissingGroup";
+		string threadID = "MissingThread";
+
+	// Perform benchmark for 'join' on a missing group, which reports the failure by throwing.
+
+		for( auto iteration : state )
+		{
+			try
+			{
+				THREAD_MANAGER.join( groupID, threadID );
+			}
+			catch( const QMXException& except )
+			{
+				DoNotOptimize( except.getEventIndex() );
+			}
+		}
+}
+
+void ExpectedBench_JoinMissingTry( State& state )
+{
+	// Create local variables.
+
+		ThreadManager::InstancePtr instance = ThreadManager::create();
+		string groupID = "MissingGroup";
+		string threadID = "MissingThread";
+
+	// Perform benchmark for 'tryJoin' on a missing group, which reports the failure through its result.
+
+		for( auto iteration : state )
+		{
+			Expected< void > result = THREAD_MANAGER.tryJoin( groupID, threadID );
+
+			DoNotOptimize( result );
+		}
+}
+
+void ExpectedBench_JoinAllEmptyTry( State& state )
+{
+	// Create local variables.
+
+		ThreadManager::InstancePtr instance = ThreadManager::create();
+		string groupID = "EmptyGroup";
+
+	// Perform benchmark for 'tryJoinAll' on an existing group, which is the success path.
+
+		THREAD_MANAGER.createGroup( groupID );
+
+		for( auto iteration : state )
+		{
+			Expected< void > result = THREAD_MANAGER.tryJoinAll( groupID );
+
+			DoNotOptimize( result );
+		}
+}
+
+BENCHMARK( ExpectedBench_JoinMissingThrow );
+BENCHMARK( ExpectedBench_JoinMissingTry );
+BENCHMARK( ExpectedBench_JoinAllEmptyTry );
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of 'ExpectedBench.cpp'
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
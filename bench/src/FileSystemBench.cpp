@@ -0,0 +1,141 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// FileSystemBench.cpp
+// Robert M. Baker | Created : 17OCT26 | Last Modified : 17OCT26 by Robert M. Baker
+// Version : 2.3.0
+// This is a source file for 'QMXStdLibBench'; it defines a set of benchmarks for the 'QMXStdLib::FileSystem' functions.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+//
+// This file is part of 'QMXStdLib'.
+//
+// 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option) any later version.
+//
+// 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Header Files
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../include/FileSystemBench.hpp"
+
+using namespace std;
+using namespace QMXStdLib;
+using namespace benchmark;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Start of the 'FileSystemBench' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace FileSystemBench
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Global Variables
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const size_t DIRECTORY_COUNT = 16;
+const size_t FILE_COUNT = 64;
+const size_t FILE_SIZE = 65536;
+Path sourcePath;
+Path destinationPath;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Global Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void setUp( const State& state )
+{
+	// Create local variables.
+
+		string contents( FILE_SIZE, 'Q' );
+		Path directory;
+
+	// Create a tree of directories holding files of patterned bytes in the temporary directory.
+
+		sourcePath = ( boost::filesystem::temp_directory_path() / boost::filesystem::unique_path( "QMXStdLibCopy-%%%%-%%%%" ) );
+		destinationPath = ( sourcePath.string() + "Copy" );
+
+		for( size_t index = 0; index < DIRECTORY_COUNT; index++ )
+		{
+			directory = ( sourcePath / ( "Directory" + to_string( index ) ) );
+			boost::filesystem::create_directories( directory );
+
+			for( size_t subindex = 0; subindex < FILE_COUNT; subindex++ )
+				boost::filesystem::ofstream( ( directory / ( to_string( subindex ) + ".bin" ) ), ( ios::out | ios::binary ) ) << contents;
+		}
+}
+
+void tearDown( const State& state )
+{
+	// Remove both trees.
+
+		boost::filesystem::remove_all( destinationPath );
+		boost::filesystem::remove_all( sourcePath );
+}
+
+} // 'FileSystemBench' Namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of the 'FileSystemBench' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// 'QMXStdLib::FileSystem' Benchmark Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void FileSystemBench_Copy_Boost( State& state )
+{
+	// Create local variables.
+
+		Path target;
+		boost::filesystem::recursive_directory_iterator end;
+
+	// Perform benchmark for copying the tree on one thread, one 'boost::filesystem' call per entry.
+
+		for( auto iteration : state )
+		{
+			boost::filesystem::remove_all( FileSystemBench::destinationPath );
+			boost::filesystem::create_directory( FileSystemBench::destinationPath );
+
+			for( boost::filesystem::recursive_directory_iterator index( FileSystemBench::sourcePath ); index != end; ++index )
+			{
+				target = ( FileSystemBench::destinationPath / boost::filesystem::relative( index->path(), FileSystemBench::sourcePath ) );
+
+				if( boost::filesystem::is_directory( index->status() ) )
+					boost::filesystem::create_directory( target );
+				else
+					boost::filesystem::copy_file( index->path(), target );
+			}
+		}
+
+		state.SetBytesProcessed( state.iterations() * FileSystemBench::DIRECTORY_COUNT * FileSystemBench::FILE_COUNT * FileSystemBench::FILE_SIZE );
+}
+
+void FileSystemBench_Copy_Engine( State& state )
+{
+	// Create local variables.
+
+		FileSystem::CopyStatistics statistics;
+
+	// Perform benchmark for copying the tree with 'FileSystem::copy'.
+
+		for( auto iteration : state )
+		{
+			boost::filesystem::remove_all( FileSystemBench::destinationPath );
+			FileSystem::copy( FileSystemBench::sourcePath, FileSystemBench::destinationPath, true, FileSystem::SKIP_IF_EXISTS, &statistics );
+		}
+
+		state.SetBytesProcessed( state.iterations() * statistics.byteCount );
+}
+
+BENCHMARK( FileSystemBench_Copy_Boost )->Unit( kMillisecond )->UseRealTime()->Setup( FileSystemBench::setUp )->Teardown( FileSystemBench::tearDown );
+BENCHMARK( FileSystemBench_Copy_Engine )->Unit( kMillisecond )->UseRealTime()->Setup( FileSystemBench::setUp )->Teardown( FileSystemBench::tearDown );
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of 'FileSystemBench.cpp'
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,182 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// LatencyRecorderBench.cpp
+// Robert M. Baker | Created : 17OCT26 | Last Modified : 17OCT26 by Robert M. Baker
+// Version : 2.3.0
+// This is a source file for 'QMXStdLibBench'; it defines a set of benchmarks for the 'QMXStdLib::LatencyRecorder' class.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+//
+// This file is part of 'QMXStdLib'.
+//
+// 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option) any later version.
+//
+// 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Header Files
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../include/LatencyRecorderBench.hpp"
+
+using namespace std;
+using namespace QMXStdLib;
+using namespace benchmark;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Start of the 'LatencyRecorderBench' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace LatencyRecorderBench
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Global Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+vector< int64_t > createSamples( const size_t count )
+{
+	// Create local variables.
+
+		vector< int64_t > result( count );
+
+	// Fill vector with latencies spread from a microsecond to ten milliseconds.
+
+		Utility::setRandomSeed( 1 );
+		Utility::fill( result, int64_t( 1000 ), int64_t( 10000000 ) );
+
+	// Return result to calling routine.
+
+		return result;
+}
+
+} // 'LatencyRecorderBench' Namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of the 'LatencyRecorderBench' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// 'QMXStdLib::LatencyRecorder' Benchmark Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void LatencyRecorderBench_Record( State& state )
+{
+	// Create local variables.
+
+		static LatencyRecorder::InstancePtr instance;
+		vector< int64_t > samples = LatencyRecorderBench::createSamples( 4096 );
+		size_t index = UNSET;
+
+	// Perform benchmark for 'record' method, with every thread recording into one recorder.
+
+		if( state.thread_index() == 0 )
+			instance = LatencyRecorder::create();
+
+		for( auto iteration : state )
+			instance->record( samples[ index++ & 4095 ] );
+
+		state.SetItemsProcessed( state.iterations() );
+}
+
+void LatencyRecorderBench_Record_Raw( State& state )
+{
+	// Create local variables.
+
+		vector< int64_t > samples = LatencyRecorderBench::createSamples( 4096 );
+		vector< int64_t > target;
+		size_t index = UNSET;
+
+	// Perform benchmark for keeping every raw sample, as was done before, for comparison.
+
+		for( auto iteration : state )
+		{
+			target.push_back( samples[ index++ & 4095 ] );
+
+			if( target.size() == ( 1 << 20 ) )
+				target.clear();
+		}
+
+		state.SetItemsProcessed( state.iterations() );
+}
+
+void LatencyRecorderBench_ScopedLatency( State& state )
+{
+	// Create local variables.
+
+		LatencyRecorder::InstancePtr instance = LatencyRecorder::create();
+
+	// Perform benchmark for timing an empty scope with 'ScopedLatency'.
+
+		for( auto iteration : state )
+			SCOPED_LATENCY( *instance, 0000 );
+}
+
+void LatencyRecorderBench_GetPercentiles( State& state )
+{
+	// Create local variables.
+
+		LatencyRecorder::InstancePtr instance = LatencyRecorder::create();
+
+	// Perform benchmark for 'getPercentiles' method, reading the median and tail from the specified number of samples.
+
+		for( auto sample : LatencyRecorderBench::createSamples( state.range( 0 ) ) )
+			instance->record( sample );
+
+		for( auto iteration : state )
+			DoNotOptimize( instance->getPercentiles( { 50.0l, 99.0l, 99.9l } ) );
+}
+
+void LatencyRecorderBench_GetPercentiles_Raw( State& state )
+{
+	// Create local variables.
+
+		vector< int64_t > samples = LatencyRecorderBench::createSamples( state.range( 0 ) );
+		vector< int64_t > target;
+
+	// Perform benchmark for selecting the median and tail from raw samples, as was done before, for comparison.
+
+		for( auto iteration : state )
+		{
+			target = samples;
+
+			for( auto percentile : { 0.5, 0.99, 0.999 } )
+			{
+				nth_element( target.begin(), ( target.begin() + static_cast< size_t >( percentile * ( target.size() - 1 ) ) ), target.end() );
+				DoNotOptimize( target[ static_cast< size_t >( percentile * ( target.size() - 1 ) ) ] );
+			}
+		}
+}
+
+void LatencyRecorderBench_Dump( State& state )
+{
+	// Create local variables.
+
+		LatencyRecorder::InstancePtr instance = LatencyRecorder::create();
+
+	// Perform benchmark for 'dump' method, reporting the size of the result against that of the raw samples.
+
+		for( auto sample : LatencyRecorderBench::createSamples( state.range( 0 ) ) )
+			instance->record( sample );
+
+		for( auto iteration : state )
+			DoNotOptimize( instance->dump() );
+
+		state.counters[ "dump_bytes" ] = instance->dump().size();
+		state.counters[ "raw_bytes" ] = ( state.range( 0 ) * sizeof( int64_t ) );
+}
+
+BENCHMARK( LatencyRecorderBench_Record )->ThreadRange( 1, 4 );
+BENCHMARK( LatencyRecorderBench_Record_Raw );
+BENCHMARK( LatencyRecorderBench_ScopedLatency );
+BENCHMARK( LatencyRecorderBench_GetPercentiles )->ArgName( "samples" )->Arg( 10000 )->Arg( 1000000 );
+BENCHMARK( LatencyRecorderBench_GetPercentiles_Raw )->ArgName( "samples" )->Arg( 10000 )->Arg( 1000000 );
+BENCHMARK( LatencyRecorderBench_Dump )->ArgName( "samples" )->Arg( 10000 )->Arg( 1000000 );
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of 'LatencyRecorderBench.cpp'
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
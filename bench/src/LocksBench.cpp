@@ -0,0 +1,107 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// LocksBench.cpp
+// Robert M. Baker | Created : 16OCT26 | Last Modified : 16OCT26 by Robert M. Baker
+// Version : 2.3.0
+// This is a source file for 'QMXStdLibBench'; it defines a set of benchmarks for the lock policy classes.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+//
+// This file is part of 'QMXStdLib'.
+//
+// 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option) any later version.
+//
+// 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Header Files
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../include/LocksBench.hpp"
+
+using namespace std;
+using namespace QMXStdLib;
+using namespace benchmark;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Start of the 'LocksBench' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace LocksBench
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Global Variables
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+boost::shared_mutex sharedMutex;
+SpinLock spinLock;
+SharedLock sharedLock;
+
+} // 'LocksBench' Namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of the 'LocksBench' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// 'QMXStdLib::Locks' Benchmark Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void LocksBench_BoostSharedMutexRead( State& state )
+{
+	// Perform benchmark for a shared lock on a 'boost::shared_mutex', which is what 'ScopedLock' previously used.
+
+		for( auto iteration : state )
+		{
+			LocksBench::sharedMutex.lock_shared();
+			ClobberMemory();
+			LocksBench::sharedMutex.unlock_shared();
+		}
+}
+
+void LocksBench_SpinLockWrite( State& state )
+{
+	// Perform benchmark for an exclusive lock on a 'SpinLock'.
+
+		for( auto iteration : state )
+		{
+			ScopedLock writeLock( ScopedLock::WRITE, LocksBench::spinLock );
+			ClobberMemory();
+		}
+}
+
+void LocksBench_SharedLockRead( State& state )
+{
+	// Perform benchmark for a shared lock on a 'SharedLock'.
+
+		for( auto iteration : state )
+		{
+			ScopedLock readLock( ScopedLock::READ, LocksBench::sharedLock );
+			ClobberMemory();
+		}
+}
+
+void LocksBench_SharedLockWrite( State& state )
+{
+	// Perform benchmark for an exclusive lock on a 'SharedLock', which revokes the read bias on first use.
+
+		for( auto iteration : state )
+		{
+			ScopedLock writeLock( ScopedLock::WRITE, LocksBench::sharedLock );
+			ClobberMemory();
+		}
+}
+
+BENCHMARK( LocksBench_BoostSharedMutexRead )->ThreadRange( 1, 8 );
+BENCHMARK( LocksBench_SpinLockWrite )->ThreadRange( 1, 8 );
+BENCHMARK( LocksBench_SharedLockRead )->ThreadRange( 1, 8 );
+BENCHMARK( LocksBench_SharedLockWrite );
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of 'LocksBench.cpp'
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
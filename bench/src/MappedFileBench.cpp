@@ -0,0 +1,134 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// MappedFileBench.cpp
+// Robert M. Baker | Created : 17OCT26 | Last Modified : 17OCT26 by Robert M. Baker
+// Version : 2.3.0
+// This is a source file for 'QMXStdLibBench'; it defines a set of benchmarks for the 'QMXStdLib::MappedFile' class.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+//
+// This file is part of 'QMXStdLib'.
+//
+// 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option) any later version.
+//
+// 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Header Files
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../include/MappedFileBench.hpp"
+
+using namespace std;
+using namespace QMXStdLib;
+using namespace benchmark;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Start of the 'MappedFileBench' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace MappedFileBench
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Global Variables
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const size_t FILE_SIZE = ( 64 * 1024 * 1024 );
+Path path;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Global Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void setUp( const State& state )
+{
+	// Create local variables.
+
+		vector< char > block( 1048576 );
+		ofstream file;
+
+	// Write a file of patterned bytes in the temporary directory.
+
+		path = ( boost::filesystem::temp_directory_path() / boost::filesystem::unique_path( "QMXStdLibMapped-%%%%-%%%%.bin" ) );
+		iota( block.begin(), block.end(), 0 );
+		file.open( path.string(), ( ios::out | ios::binary | ios::trunc ) );
+
+		for( size_t offset = 0; offset < FILE_SIZE; offset += block.size() )
+			file.write( block.data(), block.size() );
+}
+
+void tearDown( const State& state )
+{
+	// Remove the file.
+
+		boost::filesystem::remove( path );
+}
+
+} // 'MappedFileBench' Namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of the 'MappedFileBench' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// 'QMXStdLib::MappedFile' Benchmark Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MappedFileBench_Sum_Stream( State& state )
+{
+	// Create local variables.
+
+		vector< char > buffer( 65536 );
+		uint64_t total = UNSET;
+
+	// Perform benchmark for summing every byte of the file, read through a stream into a buffer.
+
+		for( auto iteration : state )
+		{
+			ifstream file( MappedFileBench::path.string(), ( ios::in | ios::binary ) );
+
+			total = UNSET;
+
+			while( file.read( buffer.data(), buffer.size() ) || file.gcount() )
+				total = accumulate( buffer.begin(), ( buffer.begin() + file.gcount() ), total );
+
+			DoNotOptimize( total );
+		}
+
+		state.SetBytesProcessed( state.iterations() * MappedFileBench::FILE_SIZE );
+}
+
+void MappedFileBench_Sum_Mapped( State& state )
+{
+	// Create local variables.
+
+		MappedFile::InstancePtr file = MappedFile::create();
+		MappedFile::View< const char > view;
+		uint64_t total = UNSET;
+
+	// Perform benchmark for summing every byte of the file in place through a mapping.
+
+		for( auto iteration : state )
+		{
+			file->open( MappedFileBench::path );
+			file->advise( MappedFile::SEQUENTIAL_ACCESS );
+			view = file->getView();
+			total = accumulate( view.begin(), view.end(), uint64_t( UNSET ) );
+			DoNotOptimize( total );
+			file->close();
+		}
+
+		state.SetBytesProcessed( state.iterations() * MappedFileBench::FILE_SIZE );
+}
+
+BENCHMARK( MappedFileBench_Sum_Stream )->Unit( kMillisecond )->Setup( MappedFileBench::setUp )->Teardown( MappedFileBench::tearDown );
+BENCHMARK( MappedFileBench_Sum_Mapped )->Unit( kMillisecond )->Setup( MappedFileBench::setUp )->Teardown( MappedFileBench::tearDown );
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of 'MappedFileBench.cpp'
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,267 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// NumericBench.cpp
+// Robert M. Baker | Created : 17OCT26 | Last Modified : 17OCT26 by Robert M. Baker
+// Version : 2.3.0
+// This is a source file for 'QMXStdLibBench'; it defines a set of benchmarks for the 'QMXStdLib::Numeric' functions.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+//
+// This file is part of 'QMXStdLib'.
+//
+// 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option) any later version.
+//
+// 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Header Files
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../include/NumericBench.hpp"
+
+using namespace std;
+using namespace QMXStdLib;
+using namespace benchmark;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Start of the 'NumericBench' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace NumericBench
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Global Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template< typename NType > string toStringStream( NType value, Stringizable::NumericBase base )
+{
+	// Create local variables.
+
+		ostringstream result;
+		Stringizable::StringFormat format;
+
+	// Construct a string representation of the specified value, the way 'toString' used to.
+
+		Stringizable::setStringFormat( format, base );
+
+		if( format.usePrefix && ( format.base != Stringizable::DECIMAL ) )
+			result << ( ( format.base == Stringizable::BINARY ) ? "0b" : ( ( format.base == Stringizable::OCTAL ) ? "0" : "0x" ) );
+
+		result << ( format.useUpperCase ? uppercase : nouppercase );
+
+		if( format.filler )
+			result << setfill( format.filler ) << setw( format.width );
+		else
+			result << setw( 0 );
+
+		if( format.base == Stringizable::DECIMAL )
+			result << dec << setprecision( format.precision ) << fixed;
+		else if( format.base != Stringizable::BINARY )
+			result << ( ( format.base == Stringizable::OCTAL ) ? oct : hex );
+
+		if( format.base == Stringizable::BINARY )
+			result << bitset< ( sizeof( NType ) * 8 ) >( static_cast< unsigned long long >( value ) ).to_string();
+		else
+			result << value;
+
+	// Return result to calling routine.
+
+		return result.str();
+}
+
+template< typename NType > const vector< NType >& getValues()
+{
+	// Create local variables.
+
+		static vector< NType > result;
+		mt19937_64 generator( 1 );
+
+	// Build a batch of values of mixed magnitude, on first use.
+
+		while( result.size() < 1024 )
+		{
+			if( is_floating_point< NType >::value )
+				result.push_back( static_cast< NType >( static_cast< int64_t >( generator() >> ( generator() % 48 ) ) ) / 1024 );
+			else
+				result.push_back( static_cast< NType >( generator() >> ( generator() % 64 ) ) );
+		}
+
+	// Return result to calling routine.
+
+		return result;
+}
+
+template< typename NType, typename FType > void format( State& state, FType function )
+{
+	// Create local variables.
+
+		const vector< NType >& values = getValues< NType >();
+
+	// Format every value in the batch.
+
+		for( auto iteration : state )
+		{
+			for( NType value : values )
+				DoNotOptimize( function( value, static_cast< Stringizable::NumericBase >( state.range( 0 ) ) ) );
+		}
+
+		state.SetItemsProcessed( state.iterations() * values.size() );
+}
+
+template< typename NType > void formatBatch( State& state, bool isBatch )
+{
+	// Create local variables.
+
+		const vector< NType >& values = getValues< NType >();
+		Stringizable::NumericBase base = static_cast< Stringizable::NumericBase >( state.range( 0 ) );
+		Stringizable::StringFormat format;
+		string result;
+
+	// Serialize the whole batch, either one value at a time with concatenation or in a single call.
+
+		Stringizable::setStringFormat( format, base );
+
+		for( auto iteration : state )
+		{
+			result.clear();
+
+			if( isBatch )
+				Numeric::toStringBatch( values.data(), values.size(), format, ",", result );
+			else
+			{
+				for( size_t index = 0; index < values.size(); index++ )
+				{
+					if( index )
+						result += ',';
+
+					result += Numeric::toString( values[ index ], base );
+				}
+			}
+
+			DoNotOptimize( result.data() );
+		}
+
+		state.SetItemsProcessed( state.iterations() * values.size() );
+		state.SetBytesProcessed( state.iterations() * result.size() );
+}
+
+void applyBases( internal::Benchmark* benchmark )
+{
+	// Register one run per numeric base.
+
+		benchmark->ArgName( "base" )->Arg( Stringizable::BINARY )->Arg( Stringizable::OCTAL )->Arg( Stringizable::DECIMAL )->Arg( Stringizable::HEXIDECIMAL );
+}
+
+} // 'NumericBench' Namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of the 'NumericBench' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// 'QMXStdLib::Numeric' Benchmark Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void NumericBench_ToString_Stream_Int( State& state )
+{
+	// Perform benchmark for the stream-based conversion 'toString' used to be built on, for comparison.
+
+		NumericBench::format< int64_t >( state, NumericBench::toStringStream< int64_t > );
+}
+
+void NumericBench_ToString_Int( State& state )
+{
+	// Perform benchmark for 'toString' function on integers.
+
+		NumericBench::format< int64_t >( state, []( int64_t value, Stringizable::NumericBase base ) { return Numeric::toString( value, base ); } );
+}
+
+void NumericBench_ToString_Buffer_Int( State& state )
+{
+	// Create local variables.
+
+		char buffer[ 128 ];
+
+	// Perform benchmark for the buffer variant of the 'toString' function on integers.
+
+		NumericBench::format< int64_t >(
+			state,
+			[ &buffer ]( int64_t value, Stringizable::NumericBase base ) { return Numeric::toString( value, buffer, sizeof( buffer ), base ).getValueOr( 0 ); }
+		);
+}
+
+void NumericBench_ToString_Stream_Real( State& state )
+{
+	// Perform benchmark for the stream-based conversion of floating point values, for comparison.
+
+		NumericBench::format< double >( state, NumericBench::toStringStream< double > );
+}
+
+void NumericBench_ToString_Real( State& state )
+{
+	// Perform benchmark for 'toString' function on floating point values.
+
+		NumericBench::format< double >( state, []( double value, Stringizable::NumericBase base ) { return Numeric::toString( value, base ); } );
+}
+
+void NumericBench_ToString_Buffer_Real( State& state )
+{
+	// Create local variables.
+
+		char buffer[ 128 ];
+
+	// Perform benchmark for the buffer variant of the 'toString' function on floating point values.
+
+		NumericBench::format< double >(
+			state,
+			[ &buffer ]( double value, Stringizable::NumericBase base ) { return Numeric::toString( value, buffer, sizeof( buffer ), base ).getValueOr( 0 ); }
+		);
+}
+
+void NumericBench_ToStringConcat_Int( State& state )
+{
+	// Perform benchmark for serializing integers one 'toString' call at a time, for comparison.
+
+		NumericBench::formatBatch< uint64_t >( state, false );
+}
+
+void NumericBench_ToStringBatch_Int( State& state )
+{
+	// Perform benchmark for 'toStringBatch' function on integers.
+
+		NumericBench::formatBatch< uint64_t >( state, true );
+}
+
+void NumericBench_ToStringConcat_Real( State& state )
+{
+	// Perform benchmark for serializing floating point values one 'toString' call at a time, for comparison.
+
+		NumericBench::formatBatch< double >( state, false );
+}
+
+void NumericBench_ToStringBatch_Real( State& state )
+{
+	// Perform benchmark for 'toStringBatch' function on floating point values.
+
+		NumericBench::formatBatch< double >( state, true );
+}
+
+BENCHMARK( NumericBench_ToString_Stream_Int )->Apply( NumericBench::applyBases );
+BENCHMARK( NumericBench_ToString_Int )->Apply( NumericBench::applyBases );
+BENCHMARK( NumericBench_ToString_Buffer_Int )->Apply( NumericBench::applyBases );
+BENCHMARK( NumericBench_ToString_Stream_Real )->ArgName( "base" )->Arg( Stringizable::DECIMAL );
+BENCHMARK( NumericBench_ToString_Real )->ArgName( "base" )->Arg( Stringizable::DECIMAL );
+BENCHMARK( NumericBench_ToString_Buffer_Real )->ArgName( "base" )->Arg( Stringizable::DECIMAL );
+BENCHMARK( NumericBench_ToStringConcat_Int )->Apply( NumericBench::applyBases );
+BENCHMARK( NumericBench_ToStringBatch_Int )->Apply( NumericBench::applyBases );
+BENCHMARK( NumericBench_ToStringConcat_Real )->ArgName( "base" )->Arg( Stringizable::DECIMAL );
+BENCHMARK( NumericBench_ToStringBatch_Real )->ArgName( "base" )->Arg( Stringizable::DECIMAL );
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of 'NumericBench.cpp'
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,137 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// QMXExceptionBench.cpp
+// Robert M. Baker | Created : 16OCT26 | Last Modified : 16OCT26 by Robert M. Baker
+// Version : 2.3.0
+// This is a source file for 'QMXStdLibBench'; it defines a set of benchmarks for the 'QMXStdLib::QMXException' class.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+//
+// This file is part of 'QMXStdLib'.
+//
+// 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option) any later version.
+//
+// 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Header Files
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../include/QMXExceptionBench.hpp"
+
+using namespace std;
+using namespace QMXStdLib;
+using namespace benchmark;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Start of the 'QMXExceptionBench' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace QMXExceptionBench
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Global Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void throwWithoutStackTrace( const size_t value )
+{
+	// Throw an exception with formatted event data, as most library errors do.
+
+		QMX_THROW_X( "QMXStdLib", "QMXExceptionBench::throwWithoutStackTrace", "00000000", "value = " << value );
+}
+
+void throwWithStackTrace( const size_t value )
+{
+	// Create scoped stack traces.
+
+		SCOPED_STACK_TRACE( "QMXExceptionBench::throwWithStackTrace", 0000 );
+
+	// Throw an exception with formatted event data and the current stack trace.
+
+		QMX_THROW( "QMXStdLib", "QMXExceptionBench::throwWithStackTrace", "00000000", "value = " << value );
+}
+
+} // 'QMXExceptionBench' Namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of the 'QMXExceptionBench' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// 'QMXStdLib::QMXException' Benchmark Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void QMXExceptionBench_ThrowCatch( State& state )
+{
+	// Perform benchmark for throwing and catching an exception whose message is never inspected.
+
+		for( auto iteration : state )
+		{
+			try
+			{
+				QMXExceptionBench::throwWithoutStackTrace( state.iterations() );
+			}
+			catch( const QMXException& except )
+			{
+				DoNotOptimize( &except );
+			}
+		}
+}
+
+void QMXExceptionBench_ThrowCatchWhat( State& state )
+{
+	// Perform benchmark for throwing and catching an exception, then formatting its message.
+
+		for( auto iteration : state )
+		{
+			try
+			{
+				QMXExceptionBench::throwWithoutStackTrace( state.iterations() );
+			}
+			catch( const QMXException& except )
+			{
+				DoNotOptimize( except.what() );
+			}
+		}
+}
+
+void QMXExceptionBench_ThrowCatchStackTrace( State& state )
+{
+	// Prepare stack tracer for benchmarking.
+
+		StackTracer::setEnabled( true );
+		StackTracer::setThreadID( "QMXExceptionBench" );
+		StackTracer::addThread( "QMXExceptionBench_ThrowCatchStackTrace" );
+
+	// Perform benchmark for throwing and catching an exception which records the current stack trace.
+
+		for( auto iteration : state )
+		{
+			try
+			{
+				QMXExceptionBench::throwWithStackTrace( state.iterations() );
+			}
+			catch( const QMXException& except )
+			{
+				DoNotOptimize( &except );
+			}
+		}
+
+	// Cleanup stack tracer.
+
+		StackTracer::removeThread();
+		StackTracer::setEnabled( false );
+}
+
+BENCHMARK( QMXExceptionBench_ThrowCatch );
+BENCHMARK( QMXExceptionBench_ThrowCatchWhat );
+BENCHMARK( QMXExceptionBench_ThrowCatchStackTrace );
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of 'QMXExceptionBench.cpp'
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,164 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// SequencerBench.cpp
+// Robert M. Baker | Created : 16OCT26 | Last Modified : 16OCT26 by Robert M. Baker
+// Version : 2.3.0
+// This is a source file for 'QMXStdLibBench'; it defines a set of benchmarks for the 'QMXStdLib::Sequencer' class.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+//
+// This file is part of 'QMXStdLib'.
+//
+// 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option) any later version.
+//
+// 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Header Files
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../include/SequencerBench.hpp"
+
+using namespace std;
+using namespace QMXStdLib;
+using namespace benchmark;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Start of the 'SequencerBench' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace SequencerBench
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Global Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template< typename LType > void incrementSequencer( State& state )
+{
+	// Create local variables.
+
+		typename Sequencer< int, LType >::InstancePtr instance = Sequencer< int, LType >::create();
+
+	// Step a looped linear sequencer, which is the typical animation hot loop.
+
+		instance->set( { true, Sequencer< int, LType >::LINEAR, 0, 1023, 1, 0 } );
+
+		for( auto iteration : state )
+		{
+			(*instance)++;
+			DoNotOptimize( instance->getValue() );
+		}
+
+		state.SetItemsProcessed( state.iterations() );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Global Variables
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Sequencer< int >::InstancePtr sharedSequencer;
+AtomicSequencer< int >::InstancePtr atomicSequencer;
+
+} // 'SequencerBench' Namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of the 'SequencerBench' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// 'QMXStdLib::Sequencer' Benchmark Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void SequencerBench_IncrementNullLock( State& state )
+{
+	// Perform benchmark for 'operator++( int )' using the 'NullLock' policy.
+
+		SequencerBench::incrementSequencer< NullLock >( state );
+}
+
+void SequencerBench_IncrementSpinLock( State& state )
+{
+	// Perform benchmark for 'operator++( int )' using the 'SpinLock' policy.
+
+		SequencerBench::incrementSequencer< SpinLock >( state );
+}
+
+void SequencerBench_IncrementSharedLock( State& state )
+{
+	// Perform benchmark for 'operator++( int )' using the default 'SharedLock' policy.
+
+		SequencerBench::incrementSequencer< SharedLock >( state );
+}
+
+void SequencerBench_SharedSelectSharedLock( State& state )
+{
+	// Perform setup for all threads.
+
+		if( state.thread_index() == 0 )
+		{
+			SequencerBench::sharedSequencer = Sequencer< int >::create();
+			SequencerBench::sharedSequencer->set( { true, Sequencer< int >::LINEAR, 0, 1023, 1, 0 } );
+		}
+
+	// Perform benchmark for a round-robin selector shared by all threads, which must read and step under the write lock.
+
+		for( auto iteration : state )
+		{
+			ScopedLock writeLock( ScopedLock::WRITE, SequencerBench::sharedSequencer->getMutex() );
+
+			DoNotOptimize( SequencerBench::sharedSequencer->getValue() );
+			(*SequencerBench::sharedSequencer)++;
+		}
+
+		state.SetItemsProcessed( state.iterations() );
+}
+
+void SequencerBench_SharedSelectAtomic( State& state )
+{
+	// Perform setup for all threads.
+
+		if( state.thread_index() == 0 )
+		{
+			SequencerBench::atomicSequencer = AtomicSequencer< int >::create();
+			SequencerBench::atomicSequencer->set( { true, AtomicSequencer< int >::LINEAR, 0, 1023, 1, 0 } );
+		}
+
+	// Perform benchmark for a round-robin selector shared by all threads, using a single 'fetchAdvance' per selection.
+
+		for( auto iteration : state )
+			DoNotOptimize( SequencerBench::atomicSequencer->fetchAdvance( 1 ) );
+
+		state.SetItemsProcessed( state.iterations() );
+}
+
+void SequencerBench_FetchAdvanceBulk( State& state )
+{
+	// Create local variables.
+
+		AtomicSequencer< int >::InstancePtr instance = AtomicSequencer< int >::create();
+
+	// Perform benchmark for reserving a large range of an oscillating sequence in one operation.
+
+		instance->set( { true, AtomicSequencer< int >::OSCILLATE, 0, 1023, 3, 0 } );
+
+		for( auto iteration : state )
+			DoNotOptimize( instance->fetchAdvance( 1000003 ) );
+
+		state.SetItemsProcessed( state.iterations() );
+}
+
+BENCHMARK( SequencerBench_IncrementNullLock );
+BENCHMARK( SequencerBench_IncrementSpinLock );
+BENCHMARK( SequencerBench_IncrementSharedLock );
+BENCHMARK( SequencerBench_SharedSelectSharedLock )->ThreadRange( 1, 8 );
+BENCHMARK( SequencerBench_SharedSelectAtomic )->ThreadRange( 1, 8 );
+BENCHMARK( SequencerBench_FetchAdvanceBulk );
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of 'SequencerBench.cpp'
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,140 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// StackTracerBench.cpp
+// Robert M. Baker | Created : 16OCT26 | Last Modified : 16OCT26 by Robert M. Baker
+// Version : 2.3.0
+// This is a source file for 'QMXStdLibBench'; it defines a set of benchmarks for the 'QMXStdLib::StackTracer' class.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+//
+// This file is part of 'QMXStdLib'.
+//
+// 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option) any later version.
+//
+// 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Header Files
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../include/StackTracerBench.hpp"
+
+using namespace std;
+using namespace QMXStdLib;
+using namespace benchmark;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Start of the 'StackTracerBench' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace StackTracerBench
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Global Variables
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+atomic< uint32_t > threadCount( 0 );
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Function Definitions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+__attribute__(( noinline )) void untracedCall()
+{
+	// Do nothing, which is what 'SCOPED_STACK_TRACE' compiles to when 'QMXSTDLIB_NO_STACK_TRACE' is defined.
+
+		ClobberMemory();
+}
+
+__attribute__(( noinline )) void tracedCall()
+{
+	// Create local variables.
+
+		SCOPED_STACK_TRACE( "StackTracerBench::tracedCall", 0000 );
+
+	// Do nothing.
+
+		ClobberMemory();
+}
+
+__attribute__(( noinline )) void stringCall()
+{
+	// Create local variables.
+
+		string entry( "StackTracerBench::stringCall" );
+
+	// Construct a heap entry, which is what every scoped trace previously paid for even when the stack tracer was disabled.
+
+		DoNotOptimize( entry );
+		ClobberMemory();
+}
+
+} // 'StackTracerBench' Namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of the 'StackTracerBench' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// 'QMXStdLib::StackTracer' Benchmark Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void StackTracerBench_CompiledOut( State& state )
+{
+	// Perform benchmark for a scope with no stack trace.
+
+		for( auto iteration : state )
+			StackTracerBench::untracedCall();
+}
+
+void StackTracerBench_StringEntry( State& state )
+{
+	// Perform benchmark for a scope which only constructs a string entry.
+
+		for( auto iteration : state )
+			StackTracerBench::stringCall();
+}
+
+void StackTracerBench_Disabled( State& state )
+{
+	// Prepare stack tracer for benchmarking.
+
+		StackTracer::setEnabled( false );
+
+	// Perform benchmark for a scoped stack trace with the stack tracer disabled.
+
+		for( auto iteration : state )
+			StackTracerBench::tracedCall();
+}
+
+void StackTracerBench_Enabled( State& state )
+{
+	// Prepare stack tracer for benchmarking.
+
+		StackTracer::setEnabled( true );
+		StackTracer::setThreadID( "Thread" + std::to_string( StackTracerBench::threadCount++ ) );
+		StackTracer::addThread( ( StackTracer::getThreadID() + "Main" ) );
+
+	// Perform benchmark for a scoped stack trace with the stack tracer enabled.
+
+		for( auto iteration : state )
+			StackTracerBench::tracedCall();
+
+	// Cleanup stack tracer.
+
+		StackTracer::removeThread();
+}
+
+BENCHMARK( StackTracerBench_CompiledOut );
+BENCHMARK( StackTracerBench_StringEntry );
+BENCHMARK( StackTracerBench_Disabled );
+BENCHMARK( StackTracerBench_Enabled )->ThreadRange( 1, 8 );
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of 'StackTracerBench.cpp'
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
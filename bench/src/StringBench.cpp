@@ -0,0 +1,601 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// StringBench.cpp
+// Robert M. Baker | Created : 17OCT26 | Last Modified : 17OCT26 by Robert M. Baker
+// Version : 2.3.0
+// This is a source file for 'QMXStdLibBench'; it defines a set of benchmarks for the 'QMXStdLib::String' namespace.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+//
+// This file is part of 'QMXStdLib'.
+//
+// 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option) any later version.
+//
+// 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Header Files
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../include/StringBench.hpp"
+
+using namespace std;
+using namespace QMXStdLib;
+using namespace benchmark;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Start of the 'StringBench' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace StringBench
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Global Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const u32string& getPayload( bool isCJK )
+{
+	// Create local variables.
+
+		static const u32string prose = U"The quick brown fox jumps over the lazy dog; café crème brûlée costs €5. ";
+		static const u32string cjk = U"统一码联盟的目标是，为每个字符提供唯一的编号 2024。";
+		static u32string payloads[ 2 ];
+		u32string& result = payloads[ isCJK ];
+
+	// Build an ASCII-heavy or a CJK-heavy payload of 'PAYLOAD_LENGTH' code points, on first use.
+
+		while( result.size() < PAYLOAD_LENGTH )
+			result += ( isCJK ? cjk : prose );
+
+		result.resize( PAYLOAD_LENGTH );
+
+	// Return result to calling routine.
+
+		return result;
+}
+
+template< typename SType, typename TType, typename FType > void transcode( State& state, const SType& source, FType function )
+{
+	// Create local variables.
+
+		String::TranscoderISA isa = String::getTranscoderISA();
+		vector< TType > buffer( ( source.size() * 4 ) );
+
+	// Convert the payload into a reusable buffer with the requested instruction set, reporting throughput in source bytes.
+
+		if( String::setTranscoderISA( static_cast< String::TranscoderISA >( state.range( 0 ) ) ) != state.range( 0 ) )
+			state.SkipWithError( "Instruction set not supported." );
+
+		for( auto iteration : state )
+		{
+			Expected< size_t > result = function( source, buffer.data(), buffer.size() );
+
+			DoNotOptimize( result );
+			ClobberMemory();
+		}
+
+		String::setTranscoderISA( isa );
+		state.SetBytesProcessed( state.iterations() * source.size() * sizeof( typename SType::value_type ) );
+}
+
+void fromUTF8( State& state, bool isCJK, bool isUTF16 )
+{
+	// Create local variables.
+
+		string source = String::toUTF8( getPayload( isCJK ) );
+
+	// Perform UTF-8 transcoding benchmark.
+
+		if( isUTF16 )
+		{
+			transcode< string, char16_t >(
+				state, source, []( const string& value, char16_t* target, size_t size ) { return String::toUTF16( value, target, size ); }
+			);
+		}
+		else
+		{
+			transcode< string, char32_t >(
+				state, source, []( const string& value, char32_t* target, size_t size ) { return String::toUTF32( value, target, size ); }
+			);
+		}
+}
+
+void toUTF8( State& state, bool isCJK, bool isUTF16 )
+{
+	// Perform UTF-16/UTF-32 transcoding benchmark.
+
+		if( isUTF16 )
+		{
+			transcode< u16string, char >(
+				state,
+				String::toUTF16( String::toUTF8( getPayload( isCJK ) ) ),
+				[]( const u16string& value, char* target, size_t size ) { return String::toUTF8( u16string_view( value ), target, size ); }
+			);
+		}
+		else
+		{
+			transcode< u32string, char >(
+				state,
+				getPayload( isCJK ),
+				[]( const u32string& value, char* target, size_t size ) { return String::toUTF8( u32string_view( value ), target, size ); }
+			);
+		}
+}
+
+string getText( size_t size )
+{
+	// Create local variables.
+
+		static const string sentence = "The quick brown fox jumps over the lazy dog, then naps in the sun. ";
+		string result;
+
+	// Build an ASCII payload of the specified size.
+
+		result.reserve( size );
+
+		while( result.size() < size )
+			result += sentence;
+
+		result.resize( size );
+
+	// Return result to calling routine.
+
+		return result;
+}
+
+template< typename FType > void transform( State& state, FType function )
+{
+	// Create local variables.
+
+		string source = getText( state.range( 0 ) );
+		string target = source;
+		boost::locale::generator localeGenerator;
+
+	// Set global locale.
+
+		locale::global( localeGenerator( "en_US.UTF-8" ) );
+
+	// Restore the target string from the payload and transform it, so every iteration sees the same input.
+
+		for( auto iteration : state )
+		{
+			target.assign( source );
+			function( target );
+			DoNotOptimize( target.data() );
+			ClobberMemory();
+		}
+
+		state.SetBytesProcessed( state.iterations() * source.size() );
+}
+
+const vector< string >& getLogLines()
+{
+	// Create local variables.
+
+		static vector< string > result;
+		mt19937 generator( 1 );
+
+	// Build a batch of log lines with a mix of field lengths, on first use.
+
+		while( result.size() < 1024 )
+		{
+			result.push_back(
+				"2026-10-17 12:" + to_string( generator() % 60 ) + ":" + to_string( generator() % 60 ) + " INFO  worker-" + to_string( generator() % 16 ) +
+				"  request=" + to_string( generator() ) + " path=/api/v1/items/" + to_string( generator() % 1000 ) + " status=200 bytes=" +
+				to_string( generator() % 65536 ) + "\tlatency_us=" + to_string( generator() % 10000 )
+			);
+		}
+
+	// Return result to calling routine.
+
+		return result;
+}
+
+template< typename NType > NType toValueStream( const string& source, Stringizable::NumericBase base )
+{
+	// Create local variables.
+
+		NType result = UNSET;
+		istringstream value( source );
+
+	// Convert the specified string to a numerical value, the way 'toValue' used to.
+
+		value >> ( ( base == Stringizable::OCTAL ) ? oct : ( ( base == Stringizable::HEXIDECIMAL ) ? hex : dec ) ) >> result;
+
+	// Return result to calling routine.
+
+		return result;
+}
+
+const vector< string >& getFields( Stringizable::NumericBase base, bool isReal )
+{
+	// Create local variables.
+
+		static vector< string > results[ 3 ];
+		vector< string >& result = results[ isReal ? 2 : ( base == Stringizable::HEXIDECIMAL ) ];
+		mt19937 generator( 1 );
+		ostringstream field;
+
+	// Build a batch of numeric fields of mixed length, on first use.
+
+		while( result.size() < 1024 )
+		{
+			field.str( "" );
+
+			if( isReal )
+				field << ( static_cast< double >( generator() ) / 1000.0 );
+			else if( base == Stringizable::HEXIDECIMAL )
+				field << "0x" << hex << ( generator() >> ( generator() % 32 ) );
+			else
+				field << static_cast< int32_t >( generator() >> ( generator() % 32 ) );
+
+			result.push_back( field.str() );
+		}
+
+	// Return result to calling routine.
+
+		return result;
+}
+
+template< typename NType, typename FType > void parse( State& state, Stringizable::NumericBase base, FType function )
+{
+	// Create local variables.
+
+		const vector< string >& fields = getFields( base, is_floating_point< NType >::value );
+
+	// Convert every field in the batch.
+
+		for( auto iteration : state )
+		{
+			for( const auto& field : fields )
+				DoNotOptimize( function( field, base ) );
+		}
+
+		state.SetItemsProcessed( state.iterations() * fields.size() );
+}
+
+void applyISAs( internal::Benchmark* benchmark )
+{
+	// Register one run per transcoder instruction set.
+
+		benchmark->ArgName( "isa" )->Arg( String::SCALAR )->Arg( String::SSE2 )->Arg( String::AVX2 );
+}
+
+void applySizes( internal::Benchmark* benchmark )
+{
+	// Register one run per payload size, from 1 KiB to 1 MiB.
+
+		benchmark->RangeMultiplier( 32 )->Range( ( 1 << 10 ), ( 1 << 20 ) );
+}
+
+} // 'StringBench' Namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of the 'StringBench' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// 'QMXStdLib::String' Benchmark Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void StringBench_ToUTF16_ASCII( State& state )
+{
+	// Perform benchmark for UTF-8 to UTF-16 conversion of ASCII-heavy text.
+
+		StringBench::fromUTF8( state, false, true );
+}
+
+void StringBench_ToUTF16_CJK( State& state )
+{
+	// Perform benchmark for UTF-8 to UTF-16 conversion of CJK-heavy text.
+
+		StringBench::fromUTF8( state, true, true );
+}
+
+void StringBench_ToUTF32_ASCII( State& state )
+{
+	// Perform benchmark for UTF-8 to UTF-32 conversion of ASCII-heavy text.
+
+		StringBench::fromUTF8( state, false, false );
+}
+
+void StringBench_ToUTF32_CJK( State& state )
+{
+	// Perform benchmark for UTF-8 to UTF-32 conversion of CJK-heavy text.
+
+		StringBench::fromUTF8( state, true, false );
+}
+
+void StringBench_ToUTF8FromUTF16_ASCII( State& state )
+{
+	// Perform benchmark for UTF-16 to UTF-8 conversion of ASCII-heavy text.
+
+		StringBench::toUTF8( state, false, true );
+}
+
+void StringBench_ToUTF8FromUTF16_CJK( State& state )
+{
+	// Perform benchmark for UTF-16 to UTF-8 conversion of CJK-heavy text.
+
+		StringBench::toUTF8( state, true, true );
+}
+
+void StringBench_ToUTF8FromUTF32_ASCII( State& state )
+{
+	// Perform benchmark for UTF-32 to UTF-8 conversion of ASCII-heavy text.
+
+		StringBench::toUTF8( state, false, false );
+}
+
+void StringBench_ToUTF8FromUTF32_CJK( State& state )
+{
+	// Perform benchmark for UTF-32 to UTF-8 conversion of CJK-heavy text.
+
+		StringBench::toUTF8( state, true, false );
+}
+
+void StringBench_ToUTF16_Codecvt( State& state )
+{
+	// Create local variables.
+
+		string source = String::toUTF8( StringBench::getPayload( state.range( 0 ) ) );
+
+	// Perform benchmark for the 'std::wstring_convert' conversion which 'toUTF16' used to be built on, for comparison.
+
+		for( auto iteration : state )
+		{
+			wstring_convert< codecvt_utf8_utf16< char16_t >, char16_t > convert;
+			u16string result = convert.from_bytes( source );
+
+			DoNotOptimize( result.data() );
+		}
+
+		state.SetBytesProcessed( state.iterations() * source.size() );
+}
+
+void StringBench_Strip_Copy( State& state )
+{
+	// Perform benchmark for the copying 'strip' implementation this library used to have, for comparison.
+
+		StringBench::transform( state, []( string& target ) { target = boost::algorithm::erase_all_copy( target, string( " " ) ); } );
+}
+
+void StringBench_Strip_InPlace( State& state )
+{
+	// Perform benchmark for 'stripInPlace' function.
+
+		StringBench::transform( state, []( string& target ) { String::stripInPlace( target, " " ); } );
+}
+
+void StringBench_ToUpper_Copy( State& state )
+{
+	// Perform benchmark for the copying 'toUpper' implementation this library used to have, for comparison.
+
+		StringBench::transform( state, []( string& target ) { target = boost::locale::to_upper( target ); } );
+}
+
+void StringBench_ToUpper_InPlace( State& state )
+{
+	// Perform benchmark for 'toUpperInPlace' function.
+
+		StringBench::transform( state, []( string& target ) { String::toUpperInPlace( target ); } );
+}
+
+void StringBench_ToLower_Copy( State& state )
+{
+	// Perform benchmark for the copying 'toLower' implementation this library used to have, for comparison.
+
+		StringBench::transform( state, []( string& target ) { target = boost::locale::to_lower( target ); } );
+}
+
+void StringBench_ToLower_InPlace( State& state )
+{
+	// Perform benchmark for 'toLowerInPlace' function.
+
+		StringBench::transform( state, []( string& target ) { String::toLowerInPlace( target ); } );
+}
+
+void StringBench_FindReplace_Copy( State& state )
+{
+	// Perform benchmark for the copying 'findReplace' implementation this library used to have, for comparison.
+
+		StringBench::transform( state, []( string& target ) { target = boost::algorithm::replace_all_copy( target, string( "fox" ), string( "wolf" ) ); } );
+}
+
+void StringBench_FindReplace_InPlace( State& state )
+{
+	// Perform benchmark for 'findReplaceInPlace' function.
+
+		StringBench::transform( state, []( string& target ) { String::findReplaceInPlace( target, "fox", "wolf" ); } );
+}
+
+void StringBench_Tokenize_Deque( State& state )
+{
+	// Create local variables.
+
+		const vector< string >& lines = StringBench::getLogLines();
+		StringDeque tokens;
+		size_t bytes = 0;
+
+	// Perform benchmark for the copying 'tokenize' function, for comparison.
+
+		for( auto iteration : state )
+		{
+			for( const auto& line : lines )
+			{
+				tokens.clear();
+				String::tokenize( tokens, line );
+				DoNotOptimize( tokens.back().data() );
+				bytes += line.size();
+			}
+		}
+
+		state.SetBytesProcessed( bytes );
+		state.SetItemsProcessed( state.iterations() * lines.size() );
+}
+
+void StringBench_Tokenize_Views( State& state )
+{
+	// Create local variables.
+
+		const vector< string >& lines = StringBench::getLogLines();
+		vector< string_view > tokens;
+		size_t bytes = 0;
+
+	// Perform benchmark for the 'string_view' 'tokenize' function, reusing one vector.
+
+		for( auto iteration : state )
+		{
+			for( const auto& line : lines )
+			{
+				String::tokenize( tokens, line );
+				DoNotOptimize( tokens.back().data() );
+				bytes += line.size();
+			}
+		}
+
+		state.SetBytesProcessed( bytes );
+		state.SetItemsProcessed( state.iterations() * lines.size() );
+}
+
+void StringBench_Tokenize_Range( State& state )
+{
+	// Create local variables.
+
+		const vector< string >& lines = StringBench::getLogLines();
+		size_t bytes = 0;
+
+	// Perform benchmark for iterating over a 'Tokenizer' range without storing the tokens.
+
+		for( auto iteration : state )
+		{
+			for( const auto& line : lines )
+			{
+				for( string_view token : String::Tokenizer( line ) )
+					DoNotOptimize( token.data() );
+
+				bytes += line.size();
+			}
+		}
+
+		state.SetBytesProcessed( bytes );
+		state.SetItemsProcessed( state.iterations() * lines.size() );
+}
+
+void StringBench_ToValue_Stream( State& state )
+{
+	// Perform benchmark for the stream-based conversion 'toValue' used to be built on, for comparison.
+
+		StringBench::parse< int32_t >(
+			state,
+			Stringizable::DECIMAL,
+			[]( const string& field, Stringizable::NumericBase base ) { return StringBench::toValueStream< int32_t >( field, base ); }
+		);
+}
+
+void StringBench_ToValue( State& state )
+{
+	// Perform benchmark for 'toValue' function on decimal integers.
+
+		StringBench::parse< int32_t >(
+			state,
+			Stringizable::DECIMAL,
+			[]( const string& field, Stringizable::NumericBase base ) { return String::toValue< int32_t >( field, base ); }
+		);
+}
+
+void StringBench_ToValue_Hex_Stream( State& state )
+{
+	// Perform benchmark for the stream-based conversion of hexadecimal integers, for comparison.
+
+		StringBench::parse< uint32_t >(
+			state,
+			Stringizable::HEXIDECIMAL,
+			[]( const string& field, Stringizable::NumericBase base ) { return StringBench::toValueStream< uint32_t >( field, base ); }
+		);
+}
+
+void StringBench_ToValue_Hex( State& state )
+{
+	// Perform benchmark for 'toValue' function on hexadecimal integers.
+
+		StringBench::parse< uint32_t >(
+			state,
+			Stringizable::HEXIDECIMAL,
+			[]( const string& field, Stringizable::NumericBase base ) { return String::toValue< uint32_t >( field, base ); }
+		);
+}
+
+void StringBench_ToValue_Real_Stream( State& state )
+{
+	// Perform benchmark for the stream-based conversion of floating point values, for comparison.
+
+		StringBench::parse< double >(
+			state, Stringizable::DECIMAL, []( const string& field, Stringizable::NumericBase base ) { return StringBench::toValueStream< double >( field, base ); }
+		);
+}
+
+void StringBench_ToValue_Real( State& state )
+{
+	// Perform benchmark for 'toValue' function on floating point values.
+
+		StringBench::parse< double >(
+			state, Stringizable::DECIMAL, []( const string& field, Stringizable::NumericBase base ) { return String::toValue< double >( field, base ); }
+		);
+}
+
+void StringBench_ToValues( State& state )
+{
+	// Create local variables.
+
+		const vector< string >& fields = StringBench::getFields( Stringizable::DECIMAL, false );
+		vector< string_view > sources( fields.begin(), fields.end() );
+		vector< int32_t > values( sources.size() );
+
+	// Perform benchmark for 'toValues' function on decimal integers.
+
+		for( auto iteration : state )
+		{
+			DoNotOptimize( String::toValues( sources.data(), sources.size(), values.data() ) );
+			ClobberMemory();
+		}
+
+		state.SetItemsProcessed( state.iterations() * sources.size() );
+}
+
+BENCHMARK( StringBench_ToUTF16_ASCII )->Apply( StringBench::applyISAs );
+BENCHMARK( StringBench_ToUTF16_CJK )->Apply( StringBench::applyISAs );
+BENCHMARK( StringBench_ToUTF32_ASCII )->Apply( StringBench::applyISAs );
+BENCHMARK( StringBench_ToUTF32_CJK )->Apply( StringBench::applyISAs );
+BENCHMARK( StringBench_ToUTF8FromUTF16_ASCII )->Apply( StringBench::applyISAs );
+BENCHMARK( StringBench_ToUTF8FromUTF16_CJK )->Apply( StringBench::applyISAs );
+BENCHMARK( StringBench_ToUTF8FromUTF32_ASCII )->Apply( StringBench::applyISAs );
+BENCHMARK( StringBench_ToUTF8FromUTF32_CJK )->Apply( StringBench::applyISAs );
+BENCHMARK( StringBench_ToUTF16_Codecvt )->ArgName( "cjk" )->Arg( 0 )->Arg( 1 );
+BENCHMARK( StringBench_Strip_Copy )->Apply( StringBench::applySizes );
+BENCHMARK( StringBench_Strip_InPlace )->Apply( StringBench::applySizes );
+BENCHMARK( StringBench_ToUpper_Copy )->Apply( StringBench::applySizes );
+BENCHMARK( StringBench_ToUpper_InPlace )->Apply( StringBench::applySizes );
+BENCHMARK( StringBench_ToLower_Copy )->Apply( StringBench::applySizes );
+BENCHMARK( StringBench_ToLower_InPlace )->Apply( StringBench::applySizes );
+BENCHMARK( StringBench_FindReplace_Copy )->Apply( StringBench::applySizes );
+BENCHMARK( StringBench_FindReplace_InPlace )->Apply( StringBench::applySizes );
+BENCHMARK( StringBench_Tokenize_Deque );
+BENCHMARK( StringBench_Tokenize_Views );
+BENCHMARK( StringBench_Tokenize_Range );
+BENCHMARK( StringBench_ToValue_Stream );
+BENCHMARK( StringBench_ToValue );
+BENCHMARK( StringBench_ToValue_Hex_Stream );
+BENCHMARK( StringBench_ToValue_Hex );
+BENCHMARK( StringBench_ToValue_Real_Stream );
+BENCHMARK( StringBench_ToValue_Real );
+BENCHMARK( StringBench_ToValues );
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of 'StringBench.cpp'
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,159 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// TimerBench.cpp
+// Robert M. Baker | Created : 17OCT26 | Last Modified : 17OCT26 by Robert M. Baker
+// Version : 2.3.0
+// This is a source file for 'QMXStdLibBench'; it defines a set of benchmarks for the 'QMXStdLib::Timer' class.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+//
+// This file is part of 'QMXStdLib'.
+//
+// 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option) any later version.
+//
+// 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Header Files
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../include/TimerBench.hpp"
+
+using namespace std;
+using namespace QMXStdLib;
+using namespace benchmark;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Start of the 'TimerBench' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace TimerBench
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Global Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void applyClockSources( internal::Benchmark* benchmark )
+{
+	// Register one run per clock source.
+
+		benchmark->ArgName( "source" )->Arg( Timer::STEADY )->Arg( Timer::TSC );
+}
+
+Timer::InstancePtr createRunningTimer( State& state, const bool isCpuTimeEnabled )
+{
+	// Create local variables.
+
+		Timer::InstancePtr result = Timer::create();
+
+	// Start a timer reading the clock selected by the argument.
+
+		result->setClockSource( static_cast< Timer::ClockSource >( state.range( 0 ) ) );
+		result->setCpuTimeEnabled( isCpuTimeEnabled );
+		result->toggle();
+
+	// Return result to calling routine.
+
+		return result;
+}
+
+} // 'TimerBench' Namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of the 'TimerBench' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// 'QMXStdLib::Timer' Benchmark Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void TimerBench_Now( State& state )
+{
+	// Create local variables.
+
+		Timer::ClockSource source = static_cast< Timer::ClockSource >( state.range( 0 ) );
+
+	// Perform benchmark for 'now' method.
+
+		for( auto iteration : state )
+			DoNotOptimize( Timer::now( source ) );
+}
+
+void TimerBench_GetNanoseconds( State& state )
+{
+	// Create local variables.
+
+		Timer::InstancePtr instance = TimerBench::createRunningTimer( state, false );
+
+	// Perform benchmark for 'getNanoseconds' method on a running timer.
+
+		for( auto iteration : state )
+			DoNotOptimize( instance->getNanoseconds() );
+}
+
+void TimerBench_GetNanoseconds_Contended( State& state )
+{
+	// Create local variables.
+
+		static Timer::InstancePtr instance;
+
+	// Perform benchmark for 'getNanoseconds' method with several threads reading one timer.
+
+		if( state.thread_index() == 0 )
+			instance = TimerBench::createRunningTimer( state, false );
+
+		for( auto iteration : state )
+			DoNotOptimize( instance->getNanoseconds() );
+}
+
+void TimerBench_GetTime( State& state )
+{
+	// Create local variables.
+
+		Timer::InstancePtr instance = TimerBench::createRunningTimer( state, false );
+
+	// Perform benchmark for 'getTime' method on a running timer.
+
+		for( auto iteration : state )
+			DoNotOptimize( instance->getTime( Timer::MICROSECONDS ) );
+}
+
+void TimerBench_GetCpuNanoseconds( State& state )
+{
+	// Create local variables.
+
+		Timer::InstancePtr instance = TimerBench::createRunningTimer( state, true );
+
+	// Perform benchmark for 'getCpuNanoseconds' method, which costs a system call per read, as every read did before CPU time became opt-in.
+
+		for( auto iteration : state )
+			DoNotOptimize( instance->getCpuNanoseconds() );
+}
+
+void TimerBench_Toggle( State& state )
+{
+	// Create local variables.
+
+		Timer::InstancePtr instance = TimerBench::createRunningTimer( state, false );
+
+	// Perform benchmark for 'toggle' method.
+
+		for( auto iteration : state )
+			instance->toggle();
+}
+
+BENCHMARK( TimerBench_Now )->Apply( TimerBench::applyClockSources );
+BENCHMARK( TimerBench_GetNanoseconds )->Apply( TimerBench::applyClockSources );
+BENCHMARK( TimerBench_GetNanoseconds_Contended )->Apply( TimerBench::applyClockSources )->ThreadRange( 1, 4 );
+BENCHMARK( TimerBench_GetTime )->Apply( TimerBench::applyClockSources );
+BENCHMARK( TimerBench_GetCpuNanoseconds )->Apply( TimerBench::applyClockSources );
+BENCHMARK( TimerBench_Toggle )->Apply( TimerBench::applyClockSources );
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of 'TimerBench.cpp'
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,100 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// TraceLogBench.cpp
+// Robert M. Baker | Created : 17OCT26 | Last Modified : 17OCT26 by Robert M. Baker
+// Version : 2.3.0
+// This is a source file for 'QMXStdLibBench'; it defines a set of benchmarks for the 'QMXStdLib::TraceLog' class.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+//
+// This file is part of 'QMXStdLib'.
+//
+// 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option) any later version.
+//
+// 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Header Files
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../include/TraceLogBench.hpp"
+
+using namespace std;
+using namespace QMXStdLib;
+using namespace benchmark;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Start of the 'TraceLogBench' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace TraceLogBench
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Global Variables
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+string path;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Global Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void setUp( const State& state )
+{
+	// Open a trace log file in the temporary directory.
+
+		path = ( boost::filesystem::temp_directory_path() / boost::filesystem::unique_path( "QMXStdLibTrace-%%%%-%%%%.bin" ) ).string();
+		TraceLog::open( path );
+}
+
+void tearDown( const State& state )
+{
+	// Close and remove the trace log file.
+
+		TraceLog::close();
+		boost::filesystem::remove( path );
+}
+
+} // 'TraceLogBench' Namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of the 'TraceLogBench' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// 'QMXStdLib::TraceLog' Benchmark Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void TraceLogBench_Write( State& state )
+{
+	// Perform benchmark for writing the record equivalent of the typical log line of 'ConsoleIOBench_Log'.
+
+		for( auto iteration : state )
+			TRACE_LOG( INFO_LEVEL, "Worker {} processed request {} in {} ms", state.thread_index(), state.iterations(), 12.5 );
+
+		state.SetItemsProcessed( state.iterations() );
+}
+
+void TraceLogBench_Write_Filtered( State& state )
+{
+	// Perform benchmark for writing the same record while its level is below the minimum level.
+
+		TraceLog::setMinimumLevel( TraceLog::WARNING_LEVEL );
+
+		for( auto iteration : state )
+			TRACE_LOG( INFO_LEVEL, "Worker {} processed request {} in {} ms", state.thread_index(), state.iterations(), 12.5 );
+
+		TraceLog::setMinimumLevel( TraceLog::DEBUG_LEVEL );
+}
+
+BENCHMARK( TraceLogBench_Write )->ThreadRange( 1, 4 )->UseRealTime()->Setup( TraceLogBench::setUp )->Teardown( TraceLogBench::tearDown );
+BENCHMARK( TraceLogBench_Write_Filtered )->Setup( TraceLogBench::setUp )->Teardown( TraceLogBench::tearDown );
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of 'TraceLogBench.cpp'
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
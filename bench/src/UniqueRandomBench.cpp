@@ -0,0 +1,219 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// UniqueRandomBench.cpp
+// Robert M. Baker | Created : 17OCT26 | Last Modified : 17OCT26 by Robert M. Baker
+// Version : 2.3.0
+// This is a source file for 'QMXStdLibBench'; it defines a set of benchmarks for the 'QMXStdLib::UniqueRandom' functions.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+//
+// This file is part of 'QMXStdLib'.
+//
+// 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option) any later version.
+//
+// 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Header Files
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../include/UniqueRandomBench.hpp"
+
+using namespace std;
+using namespace QMXStdLib;
+using namespace benchmark;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Start of the 'UniqueRandomBench' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace UniqueRandomBench
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Global Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template< typename NType > void generateRejection( vector< NType >& target, size_t quantity, NType min, NType max )
+{
+	// Create local variables.
+
+		NType value = UNSET;
+
+	// Generate unique values by rejecting repeats with a linear search, the way 'generateInt' and 'generateFloat' used to.
+
+		target.clear();
+
+		while( target.size() < quantity )
+		{
+			if constexpr( is_floating_point< NType >::value )
+				value = Utility::randFloat< NType >( min, max );
+			else
+				value = Utility::randInt< NType >( min, max );
+
+			if( find( target.begin(), target.end(), value ) == target.end() )
+				target.push_back( value );
+		}
+}
+
+template< typename FType > void generate( State& state, FType function )
+{
+	// Create local variables.
+
+		size_t quantity = state.range( 0 );
+		int64_t max = ( ( static_cast< int64_t >( quantity ) * 1000 ) / state.range( 1 ) - 1 );
+		vector< int64_t > result;
+
+	// Draw 'quantity' unique values from a range 'quantity / ratio' values wide, where the ratio is given in thousandths.
+
+		Utility::setRandomSeed( 1 );
+
+		for( auto iteration : state )
+		{
+			function( result, quantity, 0, max );
+			DoNotOptimize( result.data() );
+		}
+
+		state.SetItemsProcessed( state.iterations() * quantity );
+}
+
+void applyRatios( internal::Benchmark* benchmark, int64_t maxQuantity )
+{
+	// Register one run per quantity and quantity-to-range ratio, from 0.001 to 1.0.
+
+		benchmark->ArgNames( { "quantity", "ratio_permille" } );
+
+		for( int64_t quantity = 1000; quantity <= maxQuantity; quantity *= 100 )
+		{
+			for( int64_t ratio : { 1, 10, 100, 250, 500, 1000 } )
+				benchmark->Args( { quantity, ratio } );
+		}
+}
+
+void applyAllRatios( internal::Benchmark* benchmark )
+{
+	// Register runs for small and large quantities.
+
+		applyRatios( benchmark, 100000 );
+}
+
+void applySmallRatios( internal::Benchmark* benchmark )
+{
+	// Register runs for small quantities only, for the quadratic algorithm.
+
+		applyRatios( benchmark, 1000 );
+}
+
+} // 'UniqueRandomBench' Namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of the 'UniqueRandomBench' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// 'QMXStdLib::UniqueRandom' Benchmark Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void UniqueRandomBench_GenerateInt_Rejection( State& state )
+{
+	// Perform benchmark for the linear-search rejection 'generateInt' used to be built on, for comparison.
+
+		UniqueRandomBench::generate( state, UniqueRandomBench::generateRejection< int64_t > );
+}
+
+void UniqueRandomBench_GenerateInt_Automatic( State& state )
+{
+	// Perform benchmark for 'generateInt' function, letting it choose an algorithm.
+
+		UniqueRandomBench::generate(
+			state, []( Int64Vector& target, size_t quantity, int64_t min, int64_t max ) { UniqueRandom::generateInt( target, quantity, min, max ); }
+		);
+}
+
+void UniqueRandomBench_GenerateInt_Shuffle( State& state )
+{
+	// Perform benchmark for 'generateInt' function using a partial Fisher-Yates shuffle, which falls back to Floyd's algorithm below a ratio of 0.0625.
+
+		UniqueRandomBench::generate(
+			state,
+			[]( Int64Vector& target, size_t quantity, int64_t min, int64_t max ) {
+				UniqueRandom::generateInt( target, quantity, min, max, UniqueRandom::SHUFFLE );
+			}
+		);
+}
+
+void UniqueRandomBench_GenerateInt_Floyd( State& state )
+{
+	// Perform benchmark for 'generateInt' function using Floyd's algorithm.
+
+		UniqueRandomBench::generate(
+			state,
+			[]( Int64Vector& target, size_t quantity, int64_t min, int64_t max ) {
+				UniqueRandom::generateInt( target, quantity, min, max, UniqueRandom::FLOYD );
+			}
+		);
+}
+
+void UniqueRandomBench_GenerateInt_Selection( State& state )
+{
+	// Perform benchmark for 'generateInt' function using selection sampling.
+
+		UniqueRandomBench::generate(
+			state,
+			[]( Int64Vector& target, size_t quantity, int64_t min, int64_t max ) {
+				UniqueRandom::generateInt( target, quantity, min, max, UniqueRandom::SELECTION );
+			}
+		);
+}
+
+void UniqueRandomBench_GenerateFloat_Rejection( State& state )
+{
+	// Create local variables.
+
+		size_t quantity = state.range( 0 );
+		RealVector result;
+
+	// Perform benchmark for the linear-search rejection 'generateFloat' used to be built on, for comparison.
+
+		for( auto iteration : state )
+		{
+			UniqueRandomBench::generateRejection< real_t >( result, quantity, 0.0, 1.0 );
+			DoNotOptimize( result.data() );
+		}
+
+		state.SetItemsProcessed( state.iterations() * quantity );
+}
+
+void UniqueRandomBench_GenerateFloat( State& state )
+{
+	// Create local variables.
+
+		size_t quantity = state.range( 0 );
+		RealVector result;
+
+	// Perform benchmark for 'generateFloat' function.
+
+		for( auto iteration : state )
+		{
+			UniqueRandom::generateFloat< real_t >( result, quantity, 0.0, 1.0 );
+			DoNotOptimize( result.data() );
+		}
+
+		state.SetItemsProcessed( state.iterations() * quantity );
+}
+
+BENCHMARK( UniqueRandomBench_GenerateInt_Rejection )->Apply( UniqueRandomBench::applySmallRatios );
+BENCHMARK( UniqueRandomBench_GenerateInt_Automatic )->Apply( UniqueRandomBench::applyAllRatios );
+BENCHMARK( UniqueRandomBench_GenerateInt_Shuffle )->Apply( UniqueRandomBench::applyAllRatios );
+BENCHMARK( UniqueRandomBench_GenerateInt_Floyd )->Apply( UniqueRandomBench::applyAllRatios );
+BENCHMARK( UniqueRandomBench_GenerateInt_Selection )->Apply( UniqueRandomBench::applyAllRatios );
+BENCHMARK( UniqueRandomBench_GenerateFloat_Rejection )->ArgName( "quantity" )->Arg( 1000 );
+BENCHMARK( UniqueRandomBench_GenerateFloat )->ArgName( "quantity" )->Arg( 1000 )->Arg( 100000 );
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of 'UniqueRandomBench.cpp'
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
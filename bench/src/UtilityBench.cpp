@@ -0,0 +1,173 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// UtilityBench.cpp
+// Robert M. Baker | Created : 17OCT26 | Last Modified : 17OCT26 by Robert M. Baker
+// Version : 2.3.0
+// This is a source file for 'QMXStdLibBench'; it defines a set of benchmarks for the 'QMXStdLib::Utility' class.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+//
+// This file is part of 'QMXStdLib'.
+//
+// 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option) any later version.
+//
+// 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Header Files
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../include/UtilityBench.hpp"
+
+using namespace std;
+using namespace QMXStdLib;
+using namespace benchmark;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Start of the 'UtilityBench' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace UtilityBench
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Global Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template< typename NType, typename FType > void generate( State& state, FType function )
+{
+	// Create local variables.
+
+		vector< NType > result( 4096 );
+
+	// Generate a batch of random numbers with the engine selected by the argument.
+
+		if( state.thread_index() == 0 )
+		{
+			Utility::setRandomEngine( static_cast< Utility::RandomEngine >( state.range( 0 ) ) );
+			Utility::setRandomSeed( 1 );
+		}
+
+		for( auto iteration : state )
+		{
+			function( result );
+			DoNotOptimize( result.data() );
+		}
+
+		state.SetItemsProcessed( state.iterations() * result.size() );
+}
+
+void applyEngines( internal::Benchmark* benchmark )
+{
+	// Register one run per engine.
+
+		benchmark->ArgName( "engine" )->Arg( Utility::MERSENNE_TWISTER )->Arg( Utility::XOSHIRO )->Arg( Utility::PCG );
+}
+
+void applyPauses( internal::Benchmark* benchmark )
+{
+	// Register one run per waiting strategy and interval, in microseconds.
+
+		benchmark->ArgNames( { "mode", "interval_us" } )->UseRealTime();
+
+		for( int64_t mode : { Utility::HYBRID, Utility::SLEEP, Utility::SPIN } )
+		{
+			for( int64_t interval : { 10, 100, 1000 } )
+				benchmark->Args( { mode, interval } );
+		}
+}
+
+} // 'UtilityBench' Namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of the 'UtilityBench' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// 'QMXStdLib::Utility' Benchmark Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void UtilityBench_RandInt( State& state )
+{
+	// Perform benchmark for 'randInt' method, one value at a time.
+
+		UtilityBench::generate< int32_t >( state, []( vector< int32_t >& target ) {
+			for( auto& value : target )
+				value = Utility::randInt< int32_t >( 0, 999 );
+		} );
+}
+
+void UtilityBench_Fill_Int( State& state )
+{
+	// Perform benchmark for 'fill' method on integers.
+
+		UtilityBench::generate< int32_t >( state, []( vector< int32_t >& target ) { Utility::fill< int32_t >( target, 0, 999 ); } );
+}
+
+void UtilityBench_RandFloat( State& state )
+{
+	// Perform benchmark for 'randFloat' method, one value at a time.
+
+		UtilityBench::generate< double >( state, []( vector< double >& target ) {
+			for( auto& value : target )
+				value = Utility::randFloat< double >( -1.0, 1.0 );
+		} );
+}
+
+void UtilityBench_Fill_Double( State& state )
+{
+	// Perform benchmark for 'fill' method on floating point values.
+
+		UtilityBench::generate< double >( state, []( vector< double >& target ) { Utility::fill< double >( target, -1.0, 1.0 ); } );
+}
+
+void UtilityBench_Pause_Timer( State& state )
+{
+	// Create local variables.
+
+		Timer::InstancePtr delayTimer;
+
+	// Perform benchmark for the timer-based busy wait 'pause' used to be built on, for comparison.
+
+		for( auto iteration : state )
+		{
+			delayTimer = Timer::create();
+			delayTimer->toggle();
+
+			while( delayTimer->getTime( Timer::MICROSECONDS ) < state.range( 0 ) );
+				// Empty Loop
+		}
+}
+
+void UtilityBench_Pause( State& state )
+{
+	// Create local variables.
+
+		Utility::PauseStatistics statistics;
+
+	// Perform benchmark for 'pause' method, reporting its wake-up jitter; CPU time shows how much of the wait was spent spinning.
+
+		Utility::resetPauseStatistics();
+
+		for( auto iteration : state )
+			Utility::pause( state.range( 1 ), Timer::MICROSECONDS, static_cast< Utility::PauseMode >( state.range( 0 ) ) );
+
+		statistics = Utility::getPauseStatistics();
+		state.counters[ "jitter_mean_ns" ] = ( static_cast< double >( statistics.total ) / statistics.count );
+		state.counters[ "jitter_max_ns" ] = statistics.maximum;
+}
+
+BENCHMARK( UtilityBench_RandInt )->Apply( UtilityBench::applyEngines )->ThreadRange( 1, 4 );
+BENCHMARK( UtilityBench_Fill_Int )->Apply( UtilityBench::applyEngines )->ThreadRange( 1, 4 );
+BENCHMARK( UtilityBench_RandFloat )->Apply( UtilityBench::applyEngines );
+BENCHMARK( UtilityBench_Fill_Double )->Apply( UtilityBench::applyEngines );
+BENCHMARK( UtilityBench_Pause_Timer )->ArgName( "interval_us" )->Arg( 10 )->Arg( 100 )->Arg( 1000 )->UseRealTime();
+BENCHMARK( UtilityBench_Pause )->Apply( UtilityBench::applyPauses );
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of 'UtilityBench.cpp'
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,35 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/debug.dir/src/ConsoleIO.cpp.o"
+  "CMakeFiles/debug.dir/src/ConsoleIO.cpp.o.d"
+  "CMakeFiles/debug.dir/src/DynamicLibrary.cpp.o"
+  "CMakeFiles/debug.dir/src/DynamicLibrary.cpp.o.d"
+  "CMakeFiles/debug.dir/src/FileSystem.cpp.o"
+  "CMakeFiles/debug.dir/src/FileSystem.cpp.o.d"
+  "CMakeFiles/debug.dir/src/LatencyRecorder.cpp.o"
+  "CMakeFiles/debug.dir/src/LatencyRecorder.cpp.o.d"
+  "CMakeFiles/debug.dir/src/MappedFile.cpp.o"
+  "CMakeFiles/debug.dir/src/MappedFile.cpp.o.d"
+  "CMakeFiles/debug.dir/src/ProgramOptions.cpp.o"
+  "CMakeFiles/debug.dir/src/ProgramOptions.cpp.o.d"
+  "CMakeFiles/debug.dir/src/QMXException.cpp.o"
+  "CMakeFiles/debug.dir/src/QMXException.cpp.o.d"
+  "CMakeFiles/debug.dir/src/String.cpp.o"
+  "CMakeFiles/debug.dir/src/String.cpp.o.d"
+  "CMakeFiles/debug.dir/src/TaskPool.cpp.o"
+  "CMakeFiles/debug.dir/src/TaskPool.cpp.o.d"
+  "CMakeFiles/debug.dir/src/ThreadManager.cpp.o"
+  "CMakeFiles/debug.dir/src/ThreadManager.cpp.o.d"
+  "CMakeFiles/debug.dir/src/Timer.cpp.o"
+  "CMakeFiles/debug.dir/src/Timer.cpp.o.d"
+  "CMakeFiles/debug.dir/src/TraceLog.cpp.o"
+  "CMakeFiles/debug.dir/src/TraceLog.cpp.o.d"
+  "libqmxstdlib_d.pdb"
+  "libqmxstdlib_d.so"
+  "libqmxstdlib_d.so.2"
+  "libqmxstdlib_d.so.2.3.0"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/debug.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
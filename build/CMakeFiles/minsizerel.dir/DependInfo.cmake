@@ -0,0 +1,37 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/ConsoleIO.cpp" "CMakeFiles/minsizerel.dir/src/ConsoleIO.cpp.o" "gcc" "CMakeFiles/minsizerel.dir/src/ConsoleIO.cpp.o.d"
+  "/root/repo/src/DynamicLibrary.cpp" "CMakeFiles/minsizerel.dir/src/DynamicLibrary.cpp.o" "gcc" "CMakeFiles/minsizerel.dir/src/DynamicLibrary.cpp.o.d"
+  "/root/repo/src/FileSystem.cpp" "CMakeFiles/minsizerel.dir/src/FileSystem.cpp.o" "gcc" "CMakeFiles/minsizerel.dir/src/FileSystem.cpp.o.d"
+  "/root/repo/src/LatencyRecorder.cpp" "CMakeFiles/minsizerel.dir/src/LatencyRecorder.cpp.o" "gcc" "CMakeFiles/minsizerel.dir/src/LatencyRecorder.cpp.o.d"
+  "/root/repo/src/MappedFile.cpp" "CMakeFiles/minsizerel.dir/src/MappedFile.cpp.o" "gcc" "CMakeFiles/minsizerel.dir/src/MappedFile.cpp.o.d"
+  "/root/repo/src/ProgramOptions.cpp" "CMakeFiles/minsizerel.dir/src/ProgramOptions.cpp.o" "gcc" "CMakeFiles/minsizerel.dir/src/ProgramOptions.cpp.o.d"
+  "/root/repo/src/QMXException.cpp" "CMakeFiles/minsizerel.dir/src/QMXException.cpp.o" "gcc" "CMakeFiles/minsizerel.dir/src/QMXException.cpp.o.d"
+  "/root/repo/src/String.cpp" "CMakeFiles/minsizerel.dir/src/String.cpp.o" "gcc" "CMakeFiles/minsizerel.dir/src/String.cpp.o.d"
+  "/root/repo/src/TaskPool.cpp" "CMakeFiles/minsizerel.dir/src/TaskPool.cpp.o" "gcc" "CMakeFiles/minsizerel.dir/src/TaskPool.cpp.o.d"
+  "/root/repo/src/ThreadManager.cpp" "CMakeFiles/minsizerel.dir/src/ThreadManager.cpp.o" "gcc" "CMakeFiles/minsizerel.dir/src/ThreadManager.cpp.o.d"
+  "/root/repo/src/Timer.cpp" "CMakeFiles/minsizerel.dir/src/Timer.cpp.o" "gcc" "CMakeFiles/minsizerel.dir/src/Timer.cpp.o.d"
+  "/root/repo/src/TraceLog.cpp" "CMakeFiles/minsizerel.dir/src/TraceLog.cpp.o" "gcc" "CMakeFiles/minsizerel.dir/src/TraceLog.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/build/libqmxstdlib.so" "/root/repo/build/libqmxstdlib.so.2.3.0"
+  "/root/repo/build/libqmxstdlib.so.2" "/root/repo/build/libqmxstdlib.so.2.3.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
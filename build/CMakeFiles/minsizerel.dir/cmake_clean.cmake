@@ -0,0 +1,35 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/minsizerel.dir/src/ConsoleIO.cpp.o"
+  "CMakeFiles/minsizerel.dir/src/ConsoleIO.cpp.o.d"
+  "CMakeFiles/minsizerel.dir/src/DynamicLibrary.cpp.o"
+  "CMakeFiles/minsizerel.dir/src/DynamicLibrary.cpp.o.d"
+  "CMakeFiles/minsizerel.dir/src/FileSystem.cpp.o"
+  "CMakeFiles/minsizerel.dir/src/FileSystem.cpp.o.d"
+  "CMakeFiles/minsizerel.dir/src/LatencyRecorder.cpp.o"
+  "CMakeFiles/minsizerel.dir/src/LatencyRecorder.cpp.o.d"
+  "CMakeFiles/minsizerel.dir/src/MappedFile.cpp.o"
+  "CMakeFiles/minsizerel.dir/src/MappedFile.cpp.o.d"
+  "CMakeFiles/minsizerel.dir/src/ProgramOptions.cpp.o"
+  "CMakeFiles/minsizerel.dir/src/ProgramOptions.cpp.o.d"
+  "CMakeFiles/minsizerel.dir/src/QMXException.cpp.o"
+  "CMakeFiles/minsizerel.dir/src/QMXException.cpp.o.d"
+  "CMakeFiles/minsizerel.dir/src/String.cpp.o"
+  "CMakeFiles/minsizerel.dir/src/String.cpp.o.d"
+  "CMakeFiles/minsizerel.dir/src/TaskPool.cpp.o"
+  "CMakeFiles/minsizerel.dir/src/TaskPool.cpp.o.d"
+  "CMakeFiles/minsizerel.dir/src/ThreadManager.cpp.o"
+  "CMakeFiles/minsizerel.dir/src/ThreadManager.cpp.o.d"
+  "CMakeFiles/minsizerel.dir/src/Timer.cpp.o"
+  "CMakeFiles/minsizerel.dir/src/Timer.cpp.o.d"
+  "CMakeFiles/minsizerel.dir/src/TraceLog.cpp.o"
+  "CMakeFiles/minsizerel.dir/src/TraceLog.cpp.o.d"
+  "libqmxstdlib.pdb"
+  "libqmxstdlib.so"
+  "libqmxstdlib.so.2"
+  "libqmxstdlib.so.2.3.0"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/minsizerel.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
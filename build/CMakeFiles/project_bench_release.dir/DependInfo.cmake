@@ -0,0 +1,35 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/bench/src/ConsoleIOBench.cpp" "CMakeFiles/project_bench_release.dir/bench/src/ConsoleIOBench.cpp.o" "gcc" "CMakeFiles/project_bench_release.dir/bench/src/ConsoleIOBench.cpp.o.d"
+  "/root/repo/bench/src/ExpectedBench.cpp" "CMakeFiles/project_bench_release.dir/bench/src/ExpectedBench.cpp.o" "gcc" "CMakeFiles/project_bench_release.dir/bench/src/ExpectedBench.cpp.o.d"
+  "/root/repo/bench/src/FileSystemBench.cpp" "CMakeFiles/project_bench_release.dir/bench/src/FileSystemBench.cpp.o" "gcc" "CMakeFiles/project_bench_release.dir/bench/src/FileSystemBench.cpp.o.d"
+  "/root/repo/bench/src/LatencyRecorderBench.cpp" "CMakeFiles/project_bench_release.dir/bench/src/LatencyRecorderBench.cpp.o" "gcc" "CMakeFiles/project_bench_release.dir/bench/src/LatencyRecorderBench.cpp.o.d"
+  "/root/repo/bench/src/LocksBench.cpp" "CMakeFiles/project_bench_release.dir/bench/src/LocksBench.cpp.o" "gcc" "CMakeFiles/project_bench_release.dir/bench/src/LocksBench.cpp.o.d"
+  "/root/repo/bench/src/Main.cpp" "CMakeFiles/project_bench_release.dir/bench/src/Main.cpp.o" "gcc" "CMakeFiles/project_bench_release.dir/bench/src/Main.cpp.o.d"
+  "/root/repo/bench/src/MappedFileBench.cpp" "CMakeFiles/project_bench_release.dir/bench/src/MappedFileBench.cpp.o" "gcc" "CMakeFiles/project_bench_release.dir/bench/src/MappedFileBench.cpp.o.d"
+  "/root/repo/bench/src/NumericBench.cpp" "CMakeFiles/project_bench_release.dir/bench/src/NumericBench.cpp.o" "gcc" "CMakeFiles/project_bench_release.dir/bench/src/NumericBench.cpp.o.d"
+  "/root/repo/bench/src/ObjectPoolBench.cpp" "CMakeFiles/project_bench_release.dir/bench/src/ObjectPoolBench.cpp.o" "gcc" "CMakeFiles/project_bench_release.dir/bench/src/ObjectPoolBench.cpp.o.d"
+  "/root/repo/bench/src/QMXExceptionBench.cpp" "CMakeFiles/project_bench_release.dir/bench/src/QMXExceptionBench.cpp.o" "gcc" "CMakeFiles/project_bench_release.dir/bench/src/QMXExceptionBench.cpp.o.d"
+  "/root/repo/bench/src/SequencerBench.cpp" "CMakeFiles/project_bench_release.dir/bench/src/SequencerBench.cpp.o" "gcc" "CMakeFiles/project_bench_release.dir/bench/src/SequencerBench.cpp.o.d"
+  "/root/repo/bench/src/StackTracerBench.cpp" "CMakeFiles/project_bench_release.dir/bench/src/StackTracerBench.cpp.o" "gcc" "CMakeFiles/project_bench_release.dir/bench/src/StackTracerBench.cpp.o.d"
+  "/root/repo/bench/src/StringBench.cpp" "CMakeFiles/project_bench_release.dir/bench/src/StringBench.cpp.o" "gcc" "CMakeFiles/project_bench_release.dir/bench/src/StringBench.cpp.o.d"
+  "/root/repo/bench/src/TimerBench.cpp" "CMakeFiles/project_bench_release.dir/bench/src/TimerBench.cpp.o" "gcc" "CMakeFiles/project_bench_release.dir/bench/src/TimerBench.cpp.o.d"
+  "/root/repo/bench/src/TraceLogBench.cpp" "CMakeFiles/project_bench_release.dir/bench/src/TraceLogBench.cpp.o" "gcc" "CMakeFiles/project_bench_release.dir/bench/src/TraceLogBench.cpp.o.d"
+  "/root/repo/bench/src/UniqueRandomBench.cpp" "CMakeFiles/project_bench_release.dir/bench/src/UniqueRandomBench.cpp.o" "gcc" "CMakeFiles/project_bench_release.dir/bench/src/UniqueRandomBench.cpp.o.d"
+  "/root/repo/bench/src/UtilityBench.cpp" "CMakeFiles/project_bench_release.dir/bench/src/UtilityBench.cpp.o" "gcc" "CMakeFiles/project_bench_release.dir/bench/src/UtilityBench.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
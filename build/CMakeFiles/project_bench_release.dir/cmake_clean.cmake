@@ -0,0 +1,43 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/project_bench_release.dir/bench/src/ConsoleIOBench.cpp.o"
+  "CMakeFiles/project_bench_release.dir/bench/src/ConsoleIOBench.cpp.o.d"
+  "CMakeFiles/project_bench_release.dir/bench/src/ExpectedBench.cpp.o"
+  "CMakeFiles/project_bench_release.dir/bench/src/ExpectedBench.cpp.o.d"
+  "CMakeFiles/project_bench_release.dir/bench/src/FileSystemBench.cpp.o"
+  "CMakeFiles/project_bench_release.dir/bench/src/FileSystemBench.cpp.o.d"
+  "CMakeFiles/project_bench_release.dir/bench/src/LatencyRecorderBench.cpp.o"
+  "CMakeFiles/project_bench_release.dir/bench/src/LatencyRecorderBench.cpp.o.d"
+  "CMakeFiles/project_bench_release.dir/bench/src/LocksBench.cpp.o"
+  "CMakeFiles/project_bench_release.dir/bench/src/LocksBench.cpp.o.d"
+  "CMakeFiles/project_bench_release.dir/bench/src/Main.cpp.o"
+  "CMakeFiles/project_bench_release.dir/bench/src/Main.cpp.o.d"
+  "CMakeFiles/project_bench_release.dir/bench/src/MappedFileBench.cpp.o"
+  "CMakeFiles/project_bench_release.dir/bench/src/MappedFileBench.cpp.o.d"
+  "CMakeFiles/project_bench_release.dir/bench/src/NumericBench.cpp.o"
+  "CMakeFiles/project_bench_release.dir/bench/src/NumericBench.cpp.o.d"
+  "CMakeFiles/project_bench_release.dir/bench/src/ObjectPoolBench.cpp.o"
+  "CMakeFiles/project_bench_release.dir/bench/src/ObjectPoolBench.cpp.o.d"
+  "CMakeFiles/project_bench_release.dir/bench/src/QMXExceptionBench.cpp.o"
+  "CMakeFiles/project_bench_release.dir/bench/src/QMXExceptionBench.cpp.o.d"
+  "CMakeFiles/project_bench_release.dir/bench/src/SequencerBench.cpp.o"
+  "CMakeFiles/project_bench_release.dir/bench/src/SequencerBench.cpp.o.d"
+  "CMakeFiles/project_bench_release.dir/bench/src/StackTracerBench.cpp.o"
+  "CMakeFiles/project_bench_release.dir/bench/src/StackTracerBench.cpp.o.d"
+  "CMakeFiles/project_bench_release.dir/bench/src/StringBench.cpp.o"
+  "CMakeFiles/project_bench_release.dir/bench/src/StringBench.cpp.o.d"
+  "CMakeFiles/project_bench_release.dir/bench/src/TimerBench.cpp.o"
+  "CMakeFiles/project_bench_release.dir/bench/src/TimerBench.cpp.o.d"
+  "CMakeFiles/project_bench_release.dir/bench/src/TraceLogBench.cpp.o"
+  "CMakeFiles/project_bench_release.dir/bench/src/TraceLogBench.cpp.o.d"
+  "CMakeFiles/project_bench_release.dir/bench/src/UniqueRandomBench.cpp.o"
+  "CMakeFiles/project_bench_release.dir/bench/src/UniqueRandomBench.cpp.o.d"
+  "CMakeFiles/project_bench_release.dir/bench/src/UtilityBench.cpp.o"
+  "CMakeFiles/project_bench_release.dir/bench/src/UtilityBench.cpp.o.d"
+  "qmxstdlib_bench"
+  "qmxstdlib_bench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/project_bench_release.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
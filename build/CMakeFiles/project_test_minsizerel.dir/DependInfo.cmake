@@ -0,0 +1,40 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/src/AtomicSequencerTest.cpp" "CMakeFiles/project_test_minsizerel.dir/test/src/AtomicSequencerTest.cpp.o" "gcc" "CMakeFiles/project_test_minsizerel.dir/test/src/AtomicSequencerTest.cpp.o.d"
+  "/root/repo/test/src/ConsoleIOTest.cpp" "CMakeFiles/project_test_minsizerel.dir/test/src/ConsoleIOTest.cpp.o" "gcc" "CMakeFiles/project_test_minsizerel.dir/test/src/ConsoleIOTest.cpp.o.d"
+  "/root/repo/test/src/DynamicLibraryTest.cpp" "CMakeFiles/project_test_minsizerel.dir/test/src/DynamicLibraryTest.cpp.o" "gcc" "CMakeFiles/project_test_minsizerel.dir/test/src/DynamicLibraryTest.cpp.o.d"
+  "/root/repo/test/src/ExpectedTest.cpp" "CMakeFiles/project_test_minsizerel.dir/test/src/ExpectedTest.cpp.o" "gcc" "CMakeFiles/project_test_minsizerel.dir/test/src/ExpectedTest.cpp.o.d"
+  "/root/repo/test/src/FileSystemTest.cpp" "CMakeFiles/project_test_minsizerel.dir/test/src/FileSystemTest.cpp.o" "gcc" "CMakeFiles/project_test_minsizerel.dir/test/src/FileSystemTest.cpp.o.d"
+  "/root/repo/test/src/LatencyRecorderTest.cpp" "CMakeFiles/project_test_minsizerel.dir/test/src/LatencyRecorderTest.cpp.o" "gcc" "CMakeFiles/project_test_minsizerel.dir/test/src/LatencyRecorderTest.cpp.o.d"
+  "/root/repo/test/src/LocksTest.cpp" "CMakeFiles/project_test_minsizerel.dir/test/src/LocksTest.cpp.o" "gcc" "CMakeFiles/project_test_minsizerel.dir/test/src/LocksTest.cpp.o.d"
+  "/root/repo/test/src/Main.cpp" "CMakeFiles/project_test_minsizerel.dir/test/src/Main.cpp.o" "gcc" "CMakeFiles/project_test_minsizerel.dir/test/src/Main.cpp.o.d"
+  "/root/repo/test/src/MappedFileTest.cpp" "CMakeFiles/project_test_minsizerel.dir/test/src/MappedFileTest.cpp.o" "gcc" "CMakeFiles/project_test_minsizerel.dir/test/src/MappedFileTest.cpp.o.d"
+  "/root/repo/test/src/NumericTest.cpp" "CMakeFiles/project_test_minsizerel.dir/test/src/NumericTest.cpp.o" "gcc" "CMakeFiles/project_test_minsizerel.dir/test/src/NumericTest.cpp.o.d"
+  "/root/repo/test/src/ObjectPoolTest.cpp" "CMakeFiles/project_test_minsizerel.dir/test/src/ObjectPoolTest.cpp.o" "gcc" "CMakeFiles/project_test_minsizerel.dir/test/src/ObjectPoolTest.cpp.o.d"
+  "/root/repo/test/src/ProgramOptionsTest.cpp" "CMakeFiles/project_test_minsizerel.dir/test/src/ProgramOptionsTest.cpp.o" "gcc" "CMakeFiles/project_test_minsizerel.dir/test/src/ProgramOptionsTest.cpp.o.d"
+  "/root/repo/test/src/QMXExceptionTest.cpp" "CMakeFiles/project_test_minsizerel.dir/test/src/QMXExceptionTest.cpp.o" "gcc" "CMakeFiles/project_test_minsizerel.dir/test/src/QMXExceptionTest.cpp.o.d"
+  "/root/repo/test/src/SequencerTest.cpp" "CMakeFiles/project_test_minsizerel.dir/test/src/SequencerTest.cpp.o" "gcc" "CMakeFiles/project_test_minsizerel.dir/test/src/SequencerTest.cpp.o.d"
+  "/root/repo/test/src/StackTracerTest.cpp" "CMakeFiles/project_test_minsizerel.dir/test/src/StackTracerTest.cpp.o" "gcc" "CMakeFiles/project_test_minsizerel.dir/test/src/StackTracerTest.cpp.o.d"
+  "/root/repo/test/src/StringTest.cpp" "CMakeFiles/project_test_minsizerel.dir/test/src/StringTest.cpp.o" "gcc" "CMakeFiles/project_test_minsizerel.dir/test/src/StringTest.cpp.o.d"
+  "/root/repo/test/src/TaskPoolTest.cpp" "CMakeFiles/project_test_minsizerel.dir/test/src/TaskPoolTest.cpp.o" "gcc" "CMakeFiles/project_test_minsizerel.dir/test/src/TaskPoolTest.cpp.o.d"
+  "/root/repo/test/src/ThreadManagerTest.cpp" "CMakeFiles/project_test_minsizerel.dir/test/src/ThreadManagerTest.cpp.o" "gcc" "CMakeFiles/project_test_minsizerel.dir/test/src/ThreadManagerTest.cpp.o.d"
+  "/root/repo/test/src/TimerTest.cpp" "CMakeFiles/project_test_minsizerel.dir/test/src/TimerTest.cpp.o" "gcc" "CMakeFiles/project_test_minsizerel.dir/test/src/TimerTest.cpp.o.d"
+  "/root/repo/test/src/TraceLogTest.cpp" "CMakeFiles/project_test_minsizerel.dir/test/src/TraceLogTest.cpp.o" "gcc" "CMakeFiles/project_test_minsizerel.dir/test/src/TraceLogTest.cpp.o.d"
+  "/root/repo/test/src/UniqueRandomTest.cpp" "CMakeFiles/project_test_minsizerel.dir/test/src/UniqueRandomTest.cpp.o" "gcc" "CMakeFiles/project_test_minsizerel.dir/test/src/UniqueRandomTest.cpp.o.d"
+  "/root/repo/test/src/UtilityTest.cpp" "CMakeFiles/project_test_minsizerel.dir/test/src/UtilityTest.cpp.o" "gcc" "CMakeFiles/project_test_minsizerel.dir/test/src/UtilityTest.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
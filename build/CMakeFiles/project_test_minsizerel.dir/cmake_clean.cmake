@@ -0,0 +1,53 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/project_test_minsizerel.dir/test/src/AtomicSequencerTest.cpp.o"
+  "CMakeFiles/project_test_minsizerel.dir/test/src/AtomicSequencerTest.cpp.o.d"
+  "CMakeFiles/project_test_minsizerel.dir/test/src/ConsoleIOTest.cpp.o"
+  "CMakeFiles/project_test_minsizerel.dir/test/src/ConsoleIOTest.cpp.o.d"
+  "CMakeFiles/project_test_minsizerel.dir/test/src/DynamicLibraryTest.cpp.o"
+  "CMakeFiles/project_test_minsizerel.dir/test/src/DynamicLibraryTest.cpp.o.d"
+  "CMakeFiles/project_test_minsizerel.dir/test/src/ExpectedTest.cpp.o"
+  "CMakeFiles/project_test_minsizerel.dir/test/src/ExpectedTest.cpp.o.d"
+  "CMakeFiles/project_test_minsizerel.dir/test/src/FileSystemTest.cpp.o"
+  "CMakeFiles/project_test_minsizerel.dir/test/src/FileSystemTest.cpp.o.d"
+  "CMakeFiles/project_test_minsizerel.dir/test/src/LatencyRecorderTest.cpp.o"
+  "CMakeFiles/project_test_minsizerel.dir/test/src/LatencyRecorderTest.cpp.o.d"
+  "CMakeFiles/project_test_minsizerel.dir/test/src/LocksTest.cpp.o"
+  "CMakeFiles/project_test_minsizerel.dir/test/src/LocksTest.cpp.o.d"
+  "CMakeFiles/project_test_minsizerel.dir/test/src/Main.cpp.o"
+  "CMakeFiles/project_test_minsizerel.dir/test/src/Main.cpp.o.d"
+  "CMakeFiles/project_test_minsizerel.dir/test/src/MappedFileTest.cpp.o"
+  "CMakeFiles/project_test_minsizerel.dir/test/src/MappedFileTest.cpp.o.d"
+  "CMakeFiles/project_test_minsizerel.dir/test/src/NumericTest.cpp.o"
+  "CMakeFiles/project_test_minsizerel.dir/test/src/NumericTest.cpp.o.d"
+  "CMakeFiles/project_test_minsizerel.dir/test/src/ObjectPoolTest.cpp.o"
+  "CMakeFiles/project_test_minsizerel.dir/test/src/ObjectPoolTest.cpp.o.d"
+  "CMakeFiles/project_test_minsizerel.dir/test/src/ProgramOptionsTest.cpp.o"
+  "CMakeFiles/project_test_minsizerel.dir/test/src/ProgramOptionsTest.cpp.o.d"
+  "CMakeFiles/project_test_minsizerel.dir/test/src/QMXExceptionTest.cpp.o"
+  "CMakeFiles/project_test_minsizerel.dir/test/src/QMXExceptionTest.cpp.o.d"
+  "CMakeFiles/project_test_minsizerel.dir/test/src/SequencerTest.cpp.o"
+  "CMakeFiles/project_test_minsizerel.dir/test/src/SequencerTest.cpp.o.d"
+  "CMakeFiles/project_test_minsizerel.dir/test/src/StackTracerTest.cpp.o"
+  "CMakeFiles/project_test_minsizerel.dir/test/src/StackTracerTest.cpp.o.d"
+  "CMakeFiles/project_test_minsizerel.dir/test/src/StringTest.cpp.o"
+  "CMakeFiles/project_test_minsizerel.dir/test/src/StringTest.cpp.o.d"
+  "CMakeFiles/project_test_minsizerel.dir/test/src/TaskPoolTest.cpp.o"
+  "CMakeFiles/project_test_minsizerel.dir/test/src/TaskPoolTest.cpp.o.d"
+  "CMakeFiles/project_test_minsizerel.dir/test/src/ThreadManagerTest.cpp.o"
+  "CMakeFiles/project_test_minsizerel.dir/test/src/ThreadManagerTest.cpp.o.d"
+  "CMakeFiles/project_test_minsizerel.dir/test/src/TimerTest.cpp.o"
+  "CMakeFiles/project_test_minsizerel.dir/test/src/TimerTest.cpp.o.d"
+  "CMakeFiles/project_test_minsizerel.dir/test/src/TraceLogTest.cpp.o"
+  "CMakeFiles/project_test_minsizerel.dir/test/src/TraceLogTest.cpp.o.d"
+  "CMakeFiles/project_test_minsizerel.dir/test/src/UniqueRandomTest.cpp.o"
+  "CMakeFiles/project_test_minsizerel.dir/test/src/UniqueRandomTest.cpp.o.d"
+  "CMakeFiles/project_test_minsizerel.dir/test/src/UtilityTest.cpp.o"
+  "CMakeFiles/project_test_minsizerel.dir/test/src/UtilityTest.cpp.o.d"
+  "qmxstdlib_test"
+  "qmxstdlib_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/project_test_minsizerel.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/project_tracedecoder_release.dir/tools/TraceDecoder.cpp.o"
+  "CMakeFiles/project_tracedecoder_release.dir/tools/TraceDecoder.cpp.o.d"
+  "qmxstdlib_tracedecoder"
+  "qmxstdlib_tracedecoder.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/project_tracedecoder_release.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
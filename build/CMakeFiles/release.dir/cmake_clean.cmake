@@ -0,0 +1,35 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/release.dir/src/ConsoleIO.cpp.o"
+  "CMakeFiles/release.dir/src/ConsoleIO.cpp.o.d"
+  "CMakeFiles/release.dir/src/DynamicLibrary.cpp.o"
+  "CMakeFiles/release.dir/src/DynamicLibrary.cpp.o.d"
+  "CMakeFiles/release.dir/src/FileSystem.cpp.o"
+  "CMakeFiles/release.dir/src/FileSystem.cpp.o.d"
+  "CMakeFiles/release.dir/src/LatencyRecorder.cpp.o"
+  "CMakeFiles/release.dir/src/LatencyRecorder.cpp.o.d"
+  "CMakeFiles/release.dir/src/MappedFile.cpp.o"
+  "CMakeFiles/release.dir/src/MappedFile.cpp.o.d"
+  "CMakeFiles/release.dir/src/ProgramOptions.cpp.o"
+  "CMakeFiles/release.dir/src/ProgramOptions.cpp.o.d"
+  "CMakeFiles/release.dir/src/QMXException.cpp.o"
+  "CMakeFiles/release.dir/src/QMXException.cpp.o.d"
+  "CMakeFiles/release.dir/src/String.cpp.o"
+  "CMakeFiles/release.dir/src/String.cpp.o.d"
+  "CMakeFiles/release.dir/src/TaskPool.cpp.o"
+  "CMakeFiles/release.dir/src/TaskPool.cpp.o.d"
+  "CMakeFiles/release.dir/src/ThreadManager.cpp.o"
+  "CMakeFiles/release.dir/src/ThreadManager.cpp.o.d"
+  "CMakeFiles/release.dir/src/Timer.cpp.o"
+  "CMakeFiles/release.dir/src/Timer.cpp.o.d"
+  "CMakeFiles/release.dir/src/TraceLog.cpp.o"
+  "CMakeFiles/release.dir/src/TraceLog.cpp.o.d"
+  "libqmxstdlib.pdb"
+  "libqmxstdlib.so"
+  "libqmxstdlib.so.2"
+  "libqmxstdlib.so.2.3.0"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/release.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,35 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/relwithdebinfo.dir/src/ConsoleIO.cpp.o"
+  "CMakeFiles/relwithdebinfo.dir/src/ConsoleIO.cpp.o.d"
+  "CMakeFiles/relwithdebinfo.dir/src/DynamicLibrary.cpp.o"
+  "CMakeFiles/relwithdebinfo.dir/src/DynamicLibrary.cpp.o.d"
+  "CMakeFiles/relwithdebinfo.dir/src/FileSystem.cpp.o"
+  "CMakeFiles/relwithdebinfo.dir/src/FileSystem.cpp.o.d"
+  "CMakeFiles/relwithdebinfo.dir/src/LatencyRecorder.cpp.o"
+  "CMakeFiles/relwithdebinfo.dir/src/LatencyRecorder.cpp.o.d"
+  "CMakeFiles/relwithdebinfo.dir/src/MappedFile.cpp.o"
+  "CMakeFiles/relwithdebinfo.dir/src/MappedFile.cpp.o.d"
+  "CMakeFiles/relwithdebinfo.dir/src/ProgramOptions.cpp.o"
+  "CMakeFiles/relwithdebinfo.dir/src/ProgramOptions.cpp.o.d"
+  "CMakeFiles/relwithdebinfo.dir/src/QMXException.cpp.o"
+  "CMakeFiles/relwithdebinfo.dir/src/QMXException.cpp.o.d"
+  "CMakeFiles/relwithdebinfo.dir/src/String.cpp.o"
+  "CMakeFiles/relwithdebinfo.dir/src/String.cpp.o.d"
+  "CMakeFiles/relwithdebinfo.dir/src/TaskPool.cpp.o"
+  "CMakeFiles/relwithdebinfo.dir/src/TaskPool.cpp.o.d"
+  "CMakeFiles/relwithdebinfo.dir/src/ThreadManager.cpp.o"
+  "CMakeFiles/relwithdebinfo.dir/src/ThreadManager.cpp.o.d"
+  "CMakeFiles/relwithdebinfo.dir/src/Timer.cpp.o"
+  "CMakeFiles/relwithdebinfo.dir/src/Timer.cpp.o.d"
+  "CMakeFiles/relwithdebinfo.dir/src/TraceLog.cpp.o"
+  "CMakeFiles/relwithdebinfo.dir/src/TraceLog.cpp.o.d"
+  "libqmxstdlib.pdb"
+  "libqmxstdlib.so"
+  "libqmxstdlib.so.2"
+  "libqmxstdlib.so.2.3.0"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/relwithdebinfo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
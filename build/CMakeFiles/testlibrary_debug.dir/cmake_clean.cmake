@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testlibrary_debug.dir/test/src/TestLibrary/TestLibrary.cpp.o"
+  "CMakeFiles/testlibrary_debug.dir/test/src/TestLibrary/TestLibrary.cpp.o.d"
+  "TestDirectory/TestLibrary/debug/TestLibrary.pdb"
+  "TestDirectory/TestLibrary/debug/TestLibrary.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testlibrary_debug.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
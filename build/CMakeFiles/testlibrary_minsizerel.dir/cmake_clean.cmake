@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testlibrary_minsizerel.dir/test/src/TestLibrary/TestLibrary.cpp.o"
+  "CMakeFiles/testlibrary_minsizerel.dir/test/src/TestLibrary/TestLibrary.cpp.o.d"
+  "TestDirectory/TestLibrary/release/TestLibrary.pdb"
+  "TestDirectory/TestLibrary/release/TestLibrary.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testlibrary_minsizerel.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
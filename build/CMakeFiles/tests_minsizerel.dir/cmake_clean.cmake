@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests_minsizerel"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/tests_minsizerel.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests_release"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/tests_release.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,93 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Config.hpp
+// Robert M. Baker | Created : 10DEC11 | Last Modified : 17OCT26 by Robert M. Baker
+// Version : 2.3.0
+// This is the platform-specific configuration header file for 'QMXStdLib'.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+//
+// This file is part of 'QMXStdLib'.
+//
+// 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option) any later version.
+//
+// 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+  * @file
+  * @author  Robert M. Baker
+  * @date    Created : 10DEC11
+  * @date    Last Modified : 17OCT26 by Robert M. Baker
+  * @version 2.3.0
+  *
+  * @brief This header file contains configuration data determined by the target platform.
+  *
+  * @section Description
+  *
+  * This header file contains configuration data determined by the target platform.
+  *
+  * @section License
+  *
+  * Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+  *
+  * This file is part of 'QMXStdLib'.
+  *
+  * 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+  * Software Foundation, either version 3 of the License, or (at your option) any later version.
+  *
+  * 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+  * A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+  *
+  * You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+  */
+
+#ifndef __QMX_QMXSTDLIB_CONFIG_HPP_
+#define __QMX_QMXSTDLIB_CONFIG_HPP_
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Control Macros
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#define QMXSTDLIB_VER_MAJOR 2ull
+#define QMXSTDLIB_VER_MINOR 3ull
+#define QMXSTDLIB_VER_PATCH 0ull
+
+/* #undef QMXSTDLIB_NO_STACK_TRACE */
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Dynamic Macros
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#define MAX_BUFFER_SIZE                      1024
+#define CONSOLEIO_DEFAULT_INPUT_TYPE         ConsoleIO::RANGE
+#define CONSOLEIO_DEFAULT_CHOICES            "A, B, C, D, or E"
+#define CONSOLEIO_QUEUE_CAPACITY             4096
+#define TRACELOG_RECORD_COUNT                65536
+#define FILESYSTEM_COPY_WORKER_COUNT         0
+#define FILESYSTEM_SYMBOL_DELIMITER_LEFT     '<'
+#define FILESYSTEM_SYMBOL_DELIMITER_RIGHT    '>'
+#define STACKTRACER_ENTRY_SEPARATOR          "->"
+#define STACKTRACER_MAX_DEPTH                256
+#define SPINLOCK_SPIN_COUNT                  128
+#define SHAREDLOCK_SLOT_COUNT                1024
+#define SHAREDLOCK_INHIBIT_FACTOR            9
+#define OBJECTPOOL_CACHE_SIZE                64
+#define OBJECTPOOL_BATCH_SIZE                32
+#define PROGRAMOPTIONS_TOGGLE_OPTION_PREFIX  '-'
+#define PROGRAMOPTIONS_COMMAND_OPTION_PREFIX "--"
+#define PROGRAMOPTIONS_GROUP_KEY_SEPARATOR   '.'
+#define PROGRAMOPTIONS_ASSIGNMENT_OPERATOR   '='
+#define PROGRAMOPTIONS_COMMENT_INITIATOR     '#'
+#define PROGRAMOPTIONS_GROUP_DELIMITER_LEFT  '['
+#define PROGRAMOPTIONS_GROUP_DELIMITER_RIGHT ']'
+#define PROGRAMOPTIONS_GROUP_DEFAULT         "Global"
+
+#endif // __QMX_QMXSTDLIB_CONFIG_HPP_
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of 'Config.hpp'
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
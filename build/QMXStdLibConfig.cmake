@@ -0,0 +1,45 @@
+################################################################################################################################################################
+# ProjectConfig.cmake
+# Robert M. Baker | Created : 27FEB16 | Last Modified : 26AUG19 by Robert M. Baker
+# Version : 2.3.0
+# This is a CMake package configuration script for 'QMXStdLib'.
+################################################################################################################################################################
+# Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+#
+# This file is part of 'QMXStdLib'.
+#
+# 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+# Software Foundation, either version 3 of the License, or (at your option) any later version.
+#
+# 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+# PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+################################################################################################################################################################
+
+set( QMXStdLib_VERSION 2.3.0 )
+set( QMXStdLib_LIB_DEBUG "qmxstdlib_d" )
+set( QMXStdLib_LIB_RELEASE "qmxstdlib" )
+
+
+####### Expanded from @PACKAGE_INIT@ by configure_package_config_file() #######
+####### Any changes to this file will be overwritten by the next CMake run ####
+####### The input file was ProjectConfig.cmake.in                            ########
+
+get_filename_component(PACKAGE_PREFIX_DIR "${CMAKE_CURRENT_LIST_DIR}/../../../" ABSOLUTE)
+
+macro(set_and_check _var _file)
+  set(${_var} "${_file}")
+  if(NOT EXISTS "${_file}")
+    message(FATAL_ERROR "File or directory ${_file} referenced by variable ${_var} does not exist !")
+  endif()
+endmacro()
+
+####################################################################################
+
+set_and_check( QMXStdLib_INCLUDE_PATH "${PACKAGE_PREFIX_DIR}/include/qmxstdlib" )
+set_and_check( QMXStdLib_LIB_PATH "${PACKAGE_PREFIX_DIR}/lib" )
+
+################################################################################################################################################################
+# End of 'ProjectConfig.cmake'
+################################################################################################################################################################
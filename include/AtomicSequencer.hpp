@@ -0,0 +1,688 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// AtomicSequencer.hpp
+// Robert M. Baker | Created : 16OCT26 | Last Modified : 17OCT26 by Robert M. Baker
+// Version : 2.3.0
+// This is a header file for 'QMXStdLib'; it defines the interface for a lock-free numeric sequencer class.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+//
+// This file is part of 'QMXStdLib'.
+//
+// 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option) any later version.
+//
+// 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+  * @file
+  * @author  Robert M. Baker
+  * @date    Created : 16OCT26
+  * @date    Last Modified : 17OCT26 by Robert M. Baker
+  * @version 2.3.0
+  *
+  * @brief This header file defines the interface for a lock-free numeric sequencer class.
+  *
+  * @section AtomicSequencerH0000 Description
+  *
+  * This header file defines the interface for a lock-free numeric sequencer class.
+  *
+  * @section AtomicSequencerH0001 License
+  *
+  * Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+  *
+  * This file is part of 'QMXStdLib'.
+  *
+  * 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+  * Software Foundation, either version 3 of the License, or (at your option) any later version.
+  *
+  * 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+  * A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+  *
+  * You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+  */
+
+#ifndef __QMX_QMXSTDLIB_ATOMICSEQUENCER_HPP_
+#define __QMX_QMXSTDLIB_ATOMICSEQUENCER_HPP_
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Header Files
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <atomic>
+#include <type_traits>
+
+#include "Base.hpp"
+#include "Locks.hpp"
+#include "Object.hpp"
+#include "QMXException.hpp"
+#include "Sequencer.hpp"
+#include "RAII/ScopedLock.hpp"
+#include "RAII/ScopedStackTrace.hpp"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Start of the 'QMXStdLib' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace QMXStdLib
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// The 'AtomicSequencer' Class
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+  * @class AtomicSequencer AtomicSequencer.hpp "include/AtomicSequencer.hpp"
+  *
+  * @brief This class defines lock-free numeric sequencing algorithms for integral types.
+  *
+  * The 'LINEAR', 'OSCILLATE', and looping semantics are identical to those of 'Sequencer', but the current value and oscillation direction are packed into
+  * a single 64-bit word which is stepped with a CAS loop, making this class suitable for shared counters and round-robin selectors.  The object lock is
+  * only taken by 'get', 'set', and 'clone'; 'set' publishes the properties under a version counter, so steps which race with it will observe either all of
+  * the old or all of the new properties, never a mix of both.
+  *
+  * Platform Independent     : Yes<br>
+  * Architecture Independent : Yes<br>
+  * Thread-Safe              : Yes
+  */
+
+template< typename NType > class AtomicSequencer : public Object< AtomicSequencer< NType >, SequencerProperties< NType >, SpinLock >
+{
+	// Compile-Time Checks
+
+		static_assert(
+			( std::is_integral< NType >::value && ( sizeof( NType ) <= sizeof( uint32_t ) ) ),
+			"AtomicSequencer requires an integral type no wider than 32 bits."
+		);
+
+	// Friend Classes
+
+		friend class Object< AtomicSequencer< NType >, SequencerProperties< NType >, SpinLock >;
+
+public:
+
+	// Public Data Types
+
+		/**
+		  * @brief This enumeration defines all valid sequencer modes.
+		  */
+
+		enum Mode
+		{
+			LINEAR,
+			OSCILLATE
+		};
+
+	// Destructor
+
+		/**
+		  * @brief This is the destructor.
+		  */
+
+		~AtomicSequencer()
+		{
+			try
+			{
+				// Perform necessary cleanup.
+
+					if( this->initialized )
+						this->deallocate();
+			}
+			catch( const std::exception& except )
+			{
+				// Do nothing.
+			}
+		}
+
+	// Public Methods
+
+		/**
+		  * @brief This is the public properties accessor for this class.
+		  *
+		  * @param target
+		  * 	This is a 'SequencerProperties' structure which will be set using the public properties of 'this'.
+		  */
+
+		void get( SequencerProperties< NType >& target ) const
+		{
+			// Obtain locks.
+
+				SCOPED_READ_LOCK;
+
+			// Set specified 'SequencerProperties' structure using the public properties of 'this'.
+
+				target = this->properties;
+				target.value = getValue();
+		}
+
+		/**
+		  * @brief This is the public properties mutator for this class.
+		  *
+		  * The oscillation direction is preserved, just as it is for 'Sequencer'.
+		  *
+		  * @param source
+		  * 	This is a 'SequencerProperties' structure which will be used to set the public properties of 'this'.
+		  *
+		  * @exception QMXException
+		  * 	If the step is not positive, or if the minimum is greater than the maximum.
+		  */
+
+		void set( const SequencerProperties< NType >& source )
+		{
+			// Obtain locks.
+
+				SCOPED_WRITE_LOCK;
+
+			// Create scoped stack traces.
+
+				SCOPED_STACK_TRACE( "AtomicSequencer::set", 0000 );
+
+			// Create local variables.
+
+				uint64_t currentState = state.load( std::memory_order_relaxed );
+
+			// Set public properties of 'this' using the specified 'SequencerProperties' structure.
+
+				QMX_ASSERT( ( source.step > 0 ), "QMXStdLib", "AtomicSequencer::set", "0000002C", static_cast< int64_t >( source.step ) );
+				QMX_ASSERT(
+					( source.minimum <= source.maximum ),
+					"QMXStdLib",
+					"AtomicSequencer::set",
+					"0000002D",
+					static_cast< int64_t >( source.minimum ) << ", " << static_cast< int64_t >( source.maximum )
+				);
+				this->properties = source;
+				version.store( ( version.load( std::memory_order_relaxed ) + 1 ), std::memory_order_relaxed );
+				std::atomic_thread_fence( std::memory_order_release );
+				isLooped.store( source.isLooped, std::memory_order_relaxed );
+				sequenceMode.store( source.sequenceMode, std::memory_order_relaxed );
+				minimum.store( source.minimum, std::memory_order_relaxed );
+				maximum.store( source.maximum, std::memory_order_relaxed );
+				step.store( source.step, std::memory_order_relaxed );
+				version.store( ( version.load( std::memory_order_relaxed ) + 1 ), std::memory_order_release );
+
+				while( !state.compare_exchange_weak(
+					currentState,
+					pack( { static_cast< int64_t >( source.value ), unpack( currentState ).oscillationFlag } ),
+					std::memory_order_release,
+					std::memory_order_relaxed
+				) );
+		}
+
+		/**
+		  * @brief This method gets the current sequencer value.
+		  *
+		  * @return
+		  * 	The current sequencer value.
+		  */
+
+		NType getValue() const
+		{
+			// Return current sequencer value to calling routine.
+
+				return static_cast< NType >( unpack( state.load( std::memory_order_acquire ) ).value );
+		}
+
+		/**
+		  * @brief This method steps the sequencer forward by the specified number of steps in a single atomic operation.
+		  *
+		  * The calling thread reserves the 'count' consecutive sequence values beginning with the returned value.  Periodic sequences are reduced modulo their
+		  * period, so the cost of this method does not depend on 'count'.
+		  *
+		  * @param count
+		  * 	This is the number of steps to advance the sequencer by.
+		  *
+		  * @return
+		  * 	The sequencer value prior to advancing.
+		  */
+
+		NType fetchAdvance( const uint64_t count )
+		{
+			// Return previous sequencer value to calling routine.
+
+				return fetchStep( count, true );
+		}
+
+	// Public Overloaded Operators
+
+		/**
+		  * @brief This is the overloaded post-increment operator, which will step the sequencer forward.
+		  *
+		  * If the 'sequenceMode' property is set to an out-of-range value, this operation will have no effect.
+		  */
+
+		void operator++( int )
+		{
+			// Perform post-increment operator logic.
+
+				fetchStep( 1, true );
+		}
+
+		/**
+		  * @brief This is the overloaded post-decrement operator, which will step the sequencer backward.
+		  *
+		  * If the 'sequenceMode' property is set to an out-of-range value, this operation will have no effect.
+		  */
+
+		void operator--( int )
+		{
+			// Perform post-decrement operator logic.
+
+				fetchStep( 1, false );
+		}
+
+private:
+
+	// Private Data Types
+
+		/**
+		  * @brief This structure holds an unpacked sequencer state, widened so that no intermediate step can overflow.
+		  */
+
+		struct State
+		{
+			int64_t value;
+			bool oscillationFlag;
+
+			bool operator==( const State& source ) const
+			{
+				return ( ( value == source.value ) && ( oscillationFlag == source.oscillationFlag ) );
+			}
+		};
+
+		/**
+		  * @brief This structure holds a consistent snapshot of the sequencer properties used while stepping.
+		  */
+
+		struct Configuration
+		{
+			bool isLooped;
+			int sequenceMode;
+			int64_t minimum;
+			int64_t maximum;
+			int64_t step;
+		};
+
+	// Private Fields
+
+		/**
+		  * @brief This is the packed state word; the low 32 bits hold the value and bit 32 holds the oscillation flag.
+		  */
+
+		std::atomic< uint64_t > state;
+
+		/**
+		  * @brief These are the stepping properties, mirrored from 'properties' so they may be read without a lock.
+		  */
+
+		std::atomic< bool > isLooped;
+		std::atomic< int > sequenceMode;
+		std::atomic< NType > minimum;
+		std::atomic< NType > maximum;
+		std::atomic< NType > step;
+
+		/**
+		  * @brief This is the version of the stepping properties, which is odd while 'set' is storing them so a torn read can be detected and retried.
+		  */
+
+		std::atomic< uint32_t > version;
+
+	// Private Constructors
+
+		/**
+		  * @brief This is the default constructor, which is made private to prevent direct instantiation.
+		  */
+
+		AtomicSequencer() :
+			state( 0 ),
+			isLooped( false ),
+			sequenceMode( LINEAR ),
+			minimum( 0 ),
+			maximum( 0 ),
+			step( 0 ),
+			version( 0 )
+		{
+			// Initialize fields.
+
+				ZERO_MEMORY( &this->properties, sizeof( SequencerProperties< NType > ) );
+		}
+
+	// Private Methods
+
+		/**
+		  * @brief This method performs the CAS loop shared by all stepping operations.
+		  *
+		  * @param count
+		  * 	This is the number of steps to take.
+		  *
+		  * @param isForward
+		  * 	This is a boolean value which determines if the sequencer is stepped forward or backward.
+		  *
+		  * @return
+		  * 	The sequencer value prior to stepping.
+		  */
+
+		NType fetchStep( const uint64_t count, const bool isForward )
+		{
+			// Create local variables.
+
+				uint64_t currentState = state.load( std::memory_order_acquire );
+				uint64_t newState = 0;
+				Configuration configuration;
+
+			// Step the sequencer, retrying with a fresh configuration if another thread stepped it or changed its properties first.
+
+				do
+				{
+					configuration = getConfiguration();
+					newState = pack( isForward ? advance( unpack( currentState ), count, configuration ) :
+					                             mirror( advance( mirror( unpack( currentState ) ), count, mirror( configuration ) ) ) );
+
+					if( newState == currentState )
+						break;
+				} while( !state.compare_exchange_weak( currentState, newState, std::memory_order_acq_rel, std::memory_order_acquire ) );
+
+			// Return previous sequencer value to calling routine.
+
+				return static_cast< NType >( unpack( currentState ).value );
+		}
+
+		/**
+		  * @brief This method gets a consistent snapshot of the stepping properties without taking a lock.
+		  *
+		  * @return
+		  * 	The stepping properties stored by the last completed 'set'.
+		  */
+
+		Configuration getConfiguration() const
+		{
+			// Create local variables.
+
+				uint32_t startVersion = UNSET;
+				Configuration result;
+
+			// Read the stepping properties, retrying while 'set' is storing them or if it stored them during the read.
+
+				do
+				{
+					startVersion = version.load( std::memory_order_acquire );
+					result = {
+						isLooped.load( std::memory_order_relaxed ),
+						sequenceMode.load( std::memory_order_relaxed ),
+						minimum.load( std::memory_order_relaxed ),
+						maximum.load( std::memory_order_relaxed ),
+						step.load( std::memory_order_relaxed )
+					};
+					std::atomic_thread_fence( std::memory_order_acquire );
+				} while( ( startVersion & 1 ) || ( startVersion != version.load( std::memory_order_relaxed ) ) );
+
+			// Return result to calling routine.
+
+				return result;
+		}
+
+		/**
+		  * @brief This is the overridden implementation for the 'Clone' method.
+		  *
+		  * @param target
+		  * 	This is the object pointer to use when setting.
+		  */
+
+		void cloneImp( typename AtomicSequencer< NType >::InstancePtr& target ) const
+		{
+			// Assign data of 'this' to specified object.
+
+				target->isLooped.store( isLooped.load( std::memory_order_relaxed ), std::memory_order_relaxed );
+				target->sequenceMode.store( sequenceMode.load( std::memory_order_relaxed ), std::memory_order_relaxed );
+				target->minimum.store( minimum.load( std::memory_order_relaxed ), std::memory_order_relaxed );
+				target->maximum.store( maximum.load( std::memory_order_relaxed ), std::memory_order_relaxed );
+				target->step.store( step.load( std::memory_order_relaxed ), std::memory_order_relaxed );
+				target->state.store( state.load( std::memory_order_acquire ), std::memory_order_release );
+		}
+
+		/**
+		  * @brief This method packs the specified state into a state word.
+		  *
+		  * @param source
+		  * 	This is the state to pack.
+		  *
+		  * @return
+		  * 	The packed state word.
+		  */
+
+		static uint64_t pack( const State& source )
+		{
+			// Return packed state word to calling routine.
+
+				return ( static_cast< uint64_t >( static_cast< uint32_t >( static_cast< NType >( source.value ) ) ) |
+				         ( static_cast< uint64_t >( source.oscillationFlag ) << 32 ) );
+		}
+
+		/**
+		  * @brief This method unpacks the specified state word.
+		  *
+		  * @param source
+		  * 	This is the state word to unpack.
+		  *
+		  * @return
+		  * 	The unpacked state.
+		  */
+
+		static State unpack( const uint64_t source )
+		{
+			// Return unpacked state to calling routine.
+
+				return { static_cast< int64_t >( static_cast< NType >( static_cast< uint32_t >( source ) ) ), ( ( source >> 32 ) != 0 ) };
+		}
+
+		/**
+		  * @brief This method negates the specified state, which turns a backward step into a forward step.
+		  *
+		  * @param source
+		  * 	This is the state to mirror.
+		  *
+		  * @return
+		  * 	The mirrored state.
+		  */
+
+		static State mirror( const State& source )
+		{
+			// Return mirrored state to calling routine.
+
+				return { -source.value, source.oscillationFlag };
+		}
+
+		/**
+		  * @brief This method negates and swaps the bounds of the specified configuration, which turns a backward step into a forward step.
+		  *
+		  * @param source
+		  * 	This is the configuration to mirror.
+		  *
+		  * @return
+		  * 	The mirrored configuration.
+		  */
+
+		static Configuration mirror( const Configuration& source )
+		{
+			// Return mirrored configuration to calling routine.
+
+				return { source.isLooped, source.sequenceMode, -source.maximum, -source.minimum, source.step };
+		}
+
+		/**
+		  * @brief This method takes a single forward step, exactly as 'Sequencer::operator++' does.
+		  *
+		  * @param source
+		  * 	This is the state to step from.
+		  *
+		  * @param configuration
+		  * 	This is the configuration to step with.
+		  *
+		  * @return
+		  * 	The stepped state.
+		  */
+
+		static State stepForward( State source, const Configuration& configuration )
+		{
+			// Perform post-increment operator logic.
+
+				switch( configuration.sequenceMode )
+				{
+					case LINEAR:
+					{
+						if( source.value < configuration.maximum )
+							source.value += configuration.step;
+						else if( configuration.isLooped && ( source.value == configuration.maximum ) )
+							source.value = configuration.minimum;
+
+						if( source.value > configuration.maximum )
+							source.value = configuration.maximum;
+
+						break;
+					}
+
+					case OSCILLATE:
+					{
+						if( !source.oscillationFlag )
+						{
+							if( source.value < configuration.maximum )
+								source.value += configuration.step;
+							else if( source.value == configuration.maximum )
+							{
+								source.value -= configuration.step;
+								source.oscillationFlag = true;
+							}
+
+							if( source.value > configuration.maximum )
+								source.value = configuration.maximum;
+						}
+						else
+						{
+							if( source.value > configuration.minimum )
+								source.value -= configuration.step;
+							else if( configuration.isLooped && ( source.value == configuration.minimum ) )
+							{
+								source.value += configuration.step;
+								source.oscillationFlag = false;
+							}
+
+							if( source.value < configuration.minimum )
+								source.value = configuration.minimum;
+						}
+
+						break;
+					}
+
+					default:
+					{
+						// Do nothing.
+					}
+				}
+
+			// Return stepped state to calling routine.
+
+				return source;
+		}
+
+		/**
+		  * @brief This method takes the specified number of forward steps.
+		  *
+		  * Runs of steps which only add or subtract the step size are taken in one jump, and boundary steps are taken with 'stepForward'.  Once a boundary
+		  * state is seen twice, the remaining count is reduced modulo the distance between the two sightings, which bounds the loop to a handful of
+		  * iterations regardless of 'count'.
+		  *
+		  * @param source
+		  * 	This is the state to step from.
+		  *
+		  * @param count
+		  * 	This is the number of steps to take.
+		  *
+		  * @param configuration
+		  * 	This is the configuration to step with.
+		  *
+		  * @return
+		  * 	The stepped state.
+		  */
+
+		static State advance( State source, uint64_t count, const Configuration& configuration )
+		{
+			// Perform abort check.
+
+				if( ( configuration.sequenceMode != LINEAR ) && ( configuration.sequenceMode != OSCILLATE ) )
+					return source;
+				else if( count == 1 )
+					return stepForward( source, configuration );
+
+			// Create local variables.
+
+				bool isAnchored = false;
+				bool isRising = false;
+				uint64_t anchorCount = 0;
+				uint64_t distance = 0;
+				State anchor = { 0, false };
+				State next = { 0, false };
+
+			// Take the requested number of steps.
+
+				while( count > 0 )
+				{
+					isRising = ( ( configuration.sequenceMode == LINEAR ) || !source.oscillationFlag );
+
+					if( isRising && ( source.value < configuration.maximum ) )
+					{
+						distance = ( ( configuration.maximum - source.value + configuration.step - 1 ) / configuration.step );
+						distance = std::min( distance, count );
+						source.value = std::min( ( source.value + ( static_cast< int64_t >( distance ) * configuration.step ) ), configuration.maximum );
+						count -= distance;
+					}
+					else if( !isRising && ( source.value > configuration.minimum ) )
+					{
+						distance = ( ( source.value - configuration.minimum + configuration.step - 1 ) / configuration.step );
+						distance = std::min( distance, count );
+						source.value = std::max( ( source.value - ( static_cast< int64_t >( distance ) * configuration.step ) ), configuration.minimum );
+						count -= distance;
+					}
+					else
+					{
+						next = stepForward( source, configuration );
+						count--;
+
+						if( next == source )
+							break;
+
+						source = next;
+
+						if( !isAnchored )
+						{
+							anchor = source;
+							anchorCount = count;
+							isAnchored = true;
+						}
+						else if( source == anchor )
+						{
+							count %= ( anchorCount - count );
+							isAnchored = false;
+						}
+					}
+				}
+
+			// Return stepped state to calling routine.
+
+				return source;
+		}
+};
+
+} // 'QMXStdLib' Namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of the 'QMXStdLib' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // __QMX_QMXSTDLIB_ATOMICSEQUENCER_HPP_
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of 'AtomicSequencer.hpp'
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
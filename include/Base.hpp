@@ -1,6 +1,6 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Base.hpp
-// Robert M. Baker | Created : 10DEC11 | Last Modified : 31AUG19 by Robert M. Baker
+// Robert M. Baker | Created : 10DEC11 | Last Modified : 16OCT26 by Robert M. Baker
 // Version : 2.3.0
 // This is the base header file for 'QMXStdLib'; it defines data common to all modules.
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -21,7 +21,7 @@
   * @file
   * @author  Robert M. Baker
   * @date    Created : 10DEC11
-  * @date    Last Modified : 29AUG19 by Robert M. Baker
+  * @date    Last Modified : 16OCT26 by Robert M. Baker
   * @version 2.3.0
   *
   * @brief This base header file defines data common to all modules.
@@ -210,7 +210,6 @@ typedef long double                              real_t;
 typedef uint64_t                                 bit_field_t;
 typedef boost::thread::id                        ThreadHash;
 typedef boost::shared_mutex                      SharedMutex;
-typedef std::pair< ThreadHash, SharedMutex >     SharedMutexPair;
 
 #ifdef QMX_32BIT
 	typedef uint32_t                              ptr_size_t;
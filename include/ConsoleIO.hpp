@@ -1,6 +1,6 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // ConsoleIO.hpp
-// Robert M. Baker | Created : 12DEC11 | Last Modified : 03SEP19 by Robert M. Baker
+// Robert M. Baker | Created : 12DEC11 | Last Modified : 17OCT26 by Robert M. Baker
 // Version : 2.3.0
 // This is a header file for 'QMXStdLib'; it defines the interface for a console I/O class.
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -21,7 +21,7 @@
   * @file
   * @author  Robert M. Baker
   * @date    Created : 12DEC11
-  * @date    Last Modified : 03SEP19 by Robert M. Baker
+  * @date    Last Modified : 17OCT26 by Robert M. Baker
   * @version 2.3.0
   *
   * @brief This header file defines the interface for a console I/O class.
@@ -52,11 +52,14 @@
 // Header Files
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include <atomic>
 #include <cctype>
+#include <ostream>
+#include <streambuf>
+#include <string>
 
 #include "Base.hpp"
 #include "Numeric.hpp"
-#include "RAII/ScopedLock.hpp"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Static Macros
@@ -83,7 +86,10 @@ namespace QMXStdLib
   *
   * @brief This class defines generic console input/output algorithms.
   *
-  * It is defined as a utility class; thus, it cannot be instantiated and contains only static members.
+  * It is defined as a utility class; thus, it cannot be instantiated and contains only static members.  Each 'SynchronizedStream' formats into a buffer of
+  * its thread without taking a lock, and the finished record is either written under the lock of its stream, or, once console streams are switched to
+  * asynchronous mode, queued for a background writer which writes queued records in batches, so logging threads never wait for each other or for the
+  * console unless the queue is full and the overflow policy is 'BLOCK'.  Records still queued when the program exits normally are written before it ends.
   *
   * Platform Independent     : Yes<br>
   * Architecture Independent : Yes<br>
@@ -125,6 +131,16 @@ public:
 			MULTIPLE_CHOICE
 		};
 
+		/**
+		  * @brief This enumeration contains all valid policies for a record arriving while the asynchronous queue is full.
+		  */
+
+		enum OverflowPolicy
+		{
+			DROP,
+			BLOCK
+		};
+
 		/**
 		  * @brief This class is a thread-safe wrapper for a console stream.
 		  */
@@ -147,6 +163,8 @@ public:
 				/**
 				  * @brief This is the constructor which accepts a stream type.
 				  *
+				  * The disabled flag of the stream type is read once here, so a record is either written whole or not at all.
+				  *
 				  * @param sourceType
 				  * 	This is the stream type to use for all operations.
 				  */
@@ -156,10 +174,15 @@ public:
 					// Initialize fields.
 
 						type = sourceType;
+						isDisabled = ConsoleIO::isStreamDisabled[ type ].load( std::memory_order_relaxed );
 
-					// Acquire lock.
+					// Mark where this record starts in the buffer of the current thread, unless the stream is disabled.
 
-						ConsoleIO::streamMutexes[ type ].lock();
+						if( !isDisabled )
+						{
+							isQueued = ConsoleIO::isAsyncEnabled.load( std::memory_order_acquire );
+							recordStart = ConsoleIO::recordBuffer.begin();
+						}
 				}
 
 			// Destructor
@@ -170,9 +193,15 @@ public:
 
 				~SynchronizedStream()
 				{
-					// Release lock.
+					// Queue the record if asynchronous mode is enabled, or write it under the stream lock otherwise.
 
-						ConsoleIO::streamMutexes[ type ].unlock();
+						if( isDisabled )
+							return;
+
+						if( isQueued )
+							ConsoleIO::submit( type, recordStart );
+						else
+							ConsoleIO::write( type, recordStart );
 				}
 
 			// Public Overloaded Operators
@@ -190,9 +219,10 @@ public:
 				SynchronizedStream& operator=( const SynchronizedStream& instance ) = delete;
 
 				/**
-				  * @brief This is the overloaded bitwise left shift operator, which redirects inputs to the specified console stream.
+				  * @brief This is the overloaded bitwise left shift operator, which formats inputs into the record buffer of the current thread.
 				  *
-				  * If the specified stream is disabled, the operation will be ignored.
+				  * No lock is taken; the record is written as a whole when this object is destroyed.  If the specified stream is disabled, the operation will be
+				  * ignored.
 				  *
 				  * @param rhs
 				  * 	This is the right-hand-side operand.
@@ -201,26 +231,34 @@ public:
 				  * 	A mutable reference to this object.
 				  */
 
-				template< typename DType > SynchronizedStream& operator<<( DType rhs )
+				template< typename DType > SynchronizedStream& operator<<( const DType& rhs )
 				{
-					// Perform abort check.
+					// Format input into the record buffer of the current thread, unless the stream is disabled.
 
-						if( ConsoleIO::isStreamDisabled[ type ] )
-							return *this;
+						if( !isDisabled )
+							ConsoleIO::recordBuffer.stream << rhs;
 
-					// Redirect input to specified console stream.
+					// Return a mutable reference to this object to calling routine.
 
-						switch( type )
-						{
-							case ConsoleIO::OUTPUT_STREAM: { std::cout << rhs;  break; }
-							case ConsoleIO::ERROR_STREAM: { std::cerr << rhs;  break; }
-							case ConsoleIO::LOG_STREAM: { std::clog << rhs;  break; }
-
-							default:
-							{
-								// Do nothing.
-							}
-						}
+						return *this;
+				}
+
+				/**
+				  * @brief This is the overloaded bitwise left shift operator for stream manipulators such as 'std::endl'.
+				  *
+				  * @param manipulator
+				  * 	This is the manipulator to apply to the record buffer.
+				  *
+				  * @return
+				  * 	A mutable reference to this object.
+				  */
+
+				SynchronizedStream& operator<<( std::ostream& ( *manipulator )( std::ostream& ) )
+				{
+					// Apply manipulator to the record buffer of the current thread, unless the stream is disabled.
+
+						if( !isDisabled )
+							manipulator( ConsoleIO::recordBuffer.stream );
 
 					// Return a mutable reference to this object to calling routine.
 
@@ -236,6 +274,24 @@ public:
 					  */
 
 					StreamType type;
+
+					/**
+					  * @brief This is the flag which determines if the stream was disabled when the record was started.
+					  */
+
+					bool isDisabled;
+
+					/**
+					  * @brief This is the flag which determines if the record is queued for the background writer.
+					  */
+
+					bool isQueued = false;
+
+					/**
+					  * @brief This is the offset of the record in the buffer of the current thread.
+					  */
+
+					size_t recordStart = 0;
 		};
 
 	// Public Methods
@@ -252,13 +308,9 @@ public:
 
 		static bool getStreamDisabled( StreamType type )
 		{
-			// Obtain locks.
-
-				ScopedLock readLock( ScopedLock::READ, localMutex );
-
 			// Return stream disabled flag for specified type to calling routine.
 
-				return isStreamDisabled[ type ];
+				return isStreamDisabled[ type ].load( std::memory_order_relaxed );
 		}
 
 		/**
@@ -273,15 +325,69 @@ public:
 
 		static void setStreamDisabled( StreamType type, bool value )
 		{
-			// Obtain locks.
+			// Set stream disabled flag of specified type to specified value.
+
+				isStreamDisabled[ type ].store( value, std::memory_order_relaxed );
+		}
 
-				ScopedLock writeLock( ScopedLock::WRITE, localMutex );
+		/**
+		  * @brief This method switches console streams to asynchronous mode and starts the background writer.
+		  *
+		  * Standard streams are flushed first, so output written before the switch is not overtaken by queued records.  While a stream still uses its standard
+		  * buffer, the writer flushes the C library's buffer for it and writes records straight to the descriptor; once a buffer is set with 'rdbuf', records of
+		  * that stream are written through the stream instead.  Output written to a standard stream directly, rather than through 'COUT', 'CERR', or 'CLOG', is
+		  * not ordered with queued records unless 'flush' is called in between.
+		  *
+		  * @param capacity
+		  * 	This is the maximum number of queued records, which is rounded up to a power of two.
+		  *
+		  * @param policy
+		  * 	This is the policy for a record arriving while the queue is full; 'DROP' discards the record and counts it, and 'BLOCK' waits for room.
+		  *
+		  * @exception QMXException
+		  * 	If asynchronous mode is already enabled.
+		  */
 
-			// Set stream disabled flag of specified type to specified value.
+		static void startAsync( const size_t capacity = CONSOLEIO_QUEUE_CAPACITY, const OverflowPolicy policy = BLOCK );
 
-				isStreamDisabled[ type ] = value;
+		/**
+		  * @brief This method writes all queued records, stops the background writer, and switches console streams back to synchronous mode.
+		  *
+		  * @exception QMXException
+		  * 	If asynchronous mode is not enabled.
+		  */
+
+		static void stopAsync();
+
+		/**
+		  * @brief This method waits until every record queued before the call has been written.
+		  */
+
+		static void flush();
+
+		/**
+		  * @brief This method gets the asynchronous mode flag.
+		  *
+		  * @return
+		  * 	A boolean value of 'true' if console streams are in asynchronous mode, and 'false' otherwise.
+		  */
+
+		static bool isAsync()
+		{
+			// Report wether or not asynchronous mode is enabled to calling routine.
+
+				return isAsyncEnabled.load( std::memory_order_acquire );
 		}
 
+		/**
+		  * @brief This method gets the number of records dropped because the queue was full.
+		  *
+		  * @return
+		  * 	The number of records dropped since the program started.
+		  */
+
+		static uint64_t getDroppedCount();
+
 		/**
 		  * @brief This method gets input based on the specified parameters.
 		  *
@@ -510,23 +616,146 @@ public:
 
 private:
 
-	// Private Fields
+	// Private Data Types
 
 		/**
-		  * @brief This is the flag array used to determine if a certain stream type is disabled.
+		  * @brief This class formats records into a string which is reused from one record to the next.
 		  */
 
-		inline static bool isStreamDisabled[] = {
-			false,
-			false,
-			false
+		class RecordBuffer : public std::streambuf
+		{
+		public:
+
+			// Public Constructors
+
+				/**
+				  * @brief This is the default constructor.
+				  */
+
+				RecordBuffer() : stream( this )
+				{
+					// Do nothing.
+				}
+
+			// Public Methods
+
+				/**
+				  * @brief This method prepares the buffer for a new record.
+				  *
+				  * The format state is reset for each outermost record, so manipulators do not carry over from one record to the next, and the error state is
+				  * cleared for every record, so one failed insertion does not silence the later records of this thread.
+				  *
+				  * @return
+				  * 	The offset at which the new record starts, which is non-zero only if another record of this thread is still open.
+				  */
+
+				size_t begin()
+				{
+					// Clear error state, then reset format state, unless another record is still open.
+
+						stream.clear();
+
+						if( data.empty() )
+						{
+							stream.flags( std::ios_base::dec | std::ios_base::skipws );
+							stream.precision( 6 );
+							stream.width( 0 );
+							stream.fill( ' ' );
+						}
+
+					// Return start of the new record to calling routine.
+
+						return data.size();
+				}
+
+			// Public Fields
+
+				/**
+				  * @brief This is the string holding the formatted records.
+				  */
+
+				std::string data;
+
+				/**
+				  * @brief This is the stream used to format into the string.
+				  */
+
+				std::ostream stream;
+
+		protected:
+
+			// Protected Methods
+
+				/**
+				  * @brief This method appends a character to the string.
+				  *
+				  * @param character
+				  * 	This is the character to append.
+				  *
+				  * @return
+				  * 	A value other than 'traits_type::eof()'.
+				  */
+
+				int_type overflow( int_type character )
+				{
+					// Append specified character, if it is not the end-of-file marker.
+
+						if( !traits_type::eq_int_type( character, traits_type::eof() ) )
+							data.push_back( traits_type::to_char_type( character ) );
+
+					// Return result to calling routine.
+
+						return traits_type::not_eof( character );
+				}
+
+				/**
+				  * @brief This method appends a sequence of characters to the string.
+				  *
+				  * @param source
+				  * 	This is the sequence to append.
+				  *
+				  * @param count
+				  * 	This is the number of characters to append.
+				  *
+				  * @return
+				  * 	The number of characters appended.
+				  */
+
+				std::streamsize xsputn( const char* source, std::streamsize count )
+				{
+					// Append specified characters.
+
+						data.append( source, count );
+
+					// Return result to calling routine.
+
+						return count;
+				}
 		};
 
+	// Private Fields
+
+		/**
+		  * @brief This is the flag which determines if console streams are in asynchronous mode.
+		  */
+
+		inline static std::atomic< bool > isAsyncEnabled = { false };
+
+		/**
+		  * @brief This is the record buffer of the current thread.
+		  */
+
+		inline static thread_local RecordBuffer recordBuffer;
+
 		/**
-		  * @brief This is the mutex used for synchronization of field manipulation.
+		  * @brief This is the flag array used to determine if a certain stream type is disabled.
 		  */
 
-		inline static SharedMutexPair localMutex;
+		inline static std::atomic< bool > isStreamDisabled[ STREAM_COUNT ] = {
+			{ false },
+			{ false },
+			{ false }
+		};
 
 		/**
 		  * @brief This is the mutex array used for synchronization of a certain stream type.
@@ -544,6 +773,34 @@ private:
 		{
 			// Do nothing.
 		}
+
+	// Private Methods
+
+		/**
+		  * @brief This method queues the record formatted by the current thread, starting at the specified offset of its buffer.
+		  *
+		  * If asynchronous mode was disabled after the record was started, it is written directly instead.
+		  *
+		  * @param type
+		  * 	This is the stream type the record is written to.
+		  *
+		  * @param recordStart
+		  * 	This is the offset of the record in the buffer of the current thread.
+		  */
+
+		static void submit( const StreamType type, const size_t recordStart );
+
+		/**
+		  * @brief This method writes the record formatted by the current thread, starting at the specified offset of its buffer, under the lock of its stream.
+		  *
+		  * @param type
+		  * 	This is the stream type the record is written to.
+		  *
+		  * @param recordStart
+		  * 	This is the offset of the record in the buffer of the current thread.
+		  */
+
+		static void write( const StreamType type, const size_t recordStart );
 };
 
 } // 'QMXStdLib' Namespace
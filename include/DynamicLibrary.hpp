@@ -1,6 +1,6 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // DynamicLibrary.hpp
-// Robert M. Baker | Created : 14APR12 | Last Modified : 27AUG19 by Robert M. Baker
+// Robert M. Baker | Created : 14APR12 | Last Modified : 17OCT26 by Robert M. Baker
 // Version : 2.3.0
 // This is a header file for 'QMXStdLib'; it defines the interface for a dynamically-loaded library class.
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -21,7 +21,7 @@
   * @file
   * @author  Robert M. Baker
   * @date    Created : 14APR12
-  * @date    Last Modified : 27AUG19 by Robert M. Baker
+  * @date    Last Modified : 17OCT26 by Robert M. Baker
   * @version 2.3.0
   *
   * @brief This header file defines the interface for a dynamically-loaded library class.
@@ -53,6 +53,7 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "Base.hpp"
+#include "Expected.hpp"
 #include "Object.hpp"
 #include "FileSystem.hpp"
 #include "RAII/ScopedLock.hpp"
@@ -181,6 +182,18 @@ public:
 
 		void* getSymbol( const std::string& symbol ) const;
 
+		/**
+		  * @brief This method retrieves the specified symbol from the dynamic library without throwing.
+		  *
+		  * @param symbol
+		  * 	This is the symbol to retrieve from the dynamic library.
+		  *
+		  * @return
+		  * 	A result holding a pointer to the retrieved symbol on success, or the error 'getSymbol' would have thrown.
+		  */
+
+		Expected< void* > tryGetSymbol( const std::string& symbol ) const;
+
 private:
 
 	// Private Fields
@@ -0,0 +1,539 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Expected.hpp
+// Robert M. Baker | Created : 17OCT26 | Last Modified : 17OCT26 by Robert M. Baker
+// Version : 2.3.0
+// This is a header file for 'QMXStdLib'; it defines the interface for a non-throwing result type.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+//
+// This file is part of 'QMXStdLib'.
+//
+// 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option) any later version.
+//
+// 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+  * @file
+  * @author  Robert M. Baker
+  * @date    Created : 17OCT26
+  * @date    Last Modified : 17OCT26 by Robert M. Baker
+  * @version 2.3.0
+  *
+  * @brief This header file defines the interface for a non-throwing result type.
+  *
+  * @section ExpectedH0000 Description
+  *
+  * This header file defines the interface for a non-throwing result type.
+  *
+  * @section ExpectedH0001 License
+  *
+  * Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+  *
+  * This file is part of 'QMXStdLib'.
+  *
+  * 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+  * Software Foundation, either version 3 of the License, or (at your option) any later version.
+  *
+  * 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+  * A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+  *
+  * You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+  */
+
+#ifndef __QMX_QMXSTDLIB_EXPECTED_HPP_
+#define __QMX_QMXSTDLIB_EXPECTED_HPP_
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Header Files
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <cstring>
+#include <utility>
+#include <variant>
+
+#include "Base.hpp"
+#include "QMXException.hpp"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Static Macros
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#define QMX_EXPECT(v,w,x,y)        SINGLE_STATEMENT( if( !v ) return QMXStdLib::Error( w, x, y ); )
+#define QMX_ASSERT_RESULT(x,z)     SINGLE_STATEMENT(\
+                                     if( !x )\
+                                       QMX_THROW( x.getError().getRootID(), x.getError().getModuleID(), x.getError().getEventIndex(), z );\
+                                   )
+#define QMX_ASSERT_RESULT_X(x,z)   SINGLE_STATEMENT(\
+                                     if( !x )\
+                                       QMX_THROW_X( x.getError().getRootID(), x.getError().getModuleID(), x.getError().getEventIndex(), z );\
+                                   )
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Start of the 'QMXStdLib' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace QMXStdLib
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// The 'Error' Class
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+  * @class Error Expected.hpp "include/Expected.hpp"
+  *
+  * @brief This class defines the error half of an expected result.
+  *
+  * An error carries the same root ID, module ID, and event index as the 'QMXException' which the throwing variant of a method would raise.  All three are
+  * expected to be string literals, so creating or copying an error never allocates.
+  *
+  * Platform Independent     : Yes<br>
+  * Architecture Independent : Yes<br>
+  * Thread-Safe              : Yes
+  */
+
+class Error
+{
+public:
+
+	// Public Constructors
+
+		/**
+		  * @brief This is the constructor which accepts the initialization data.
+		  *
+		  * @param sourceRootID
+		  * 	This is a string literal containing the root ID of the error.
+		  *
+		  * @param sourceModuleID
+		  *  	This is a string literal containing the module ID of the error.
+		  *
+		  * @param sourceEventIndex
+		  * 	This is a string literal containing the event index of the error.
+		  */
+
+		Error( const char* sourceRootID, const char* sourceModuleID, const char* sourceEventIndex ) noexcept
+		{
+			// Initialize fields.
+
+				rootID = sourceRootID;
+				moduleID = sourceModuleID;
+				eventIndex = sourceEventIndex;
+		}
+
+	// Public Methods
+
+		/**
+		  * @brief This method gets the error's root ID.
+		  *
+		  * @return
+		  * 	A string containing the error's root ID.
+		  */
+
+		const char* getRootID() const noexcept
+		{
+			// Return result to calling routine.
+
+				return rootID;
+		}
+
+		/**
+		  * @brief This method gets the error's module ID.
+		  *
+		  * @return
+		  * 	A string containing the error's module ID.
+		  */
+
+		const char* getModuleID() const noexcept
+		{
+			// Return result to calling routine.
+
+				return moduleID;
+		}
+
+		/**
+		  * @brief This method gets the error's event index.
+		  *
+		  * @return
+		  * 	A string containing the error's event index.
+		  */
+
+		const char* getEventIndex() const noexcept
+		{
+			// Return result to calling routine.
+
+				return eventIndex;
+		}
+
+		/**
+		  * @brief This method throws the 'QMXException' described by this error, with empty event data.
+		  *
+		  * @exception QMXException
+		  * 	Always.
+		  */
+
+		[[noreturn]] void raise() const
+		{
+			// Throw the described exception.
+
+				throw QMXException( rootID, moduleID, eventIndex );
+		}
+
+	// Public Overloaded Operators
+
+		/**
+		  * @brief This is the overloaded equality operator, which compares event indices and module IDs.
+		  *
+		  * @param instance
+		  * 	This is the error to compare against.
+		  *
+		  * @return
+		  * 	A boolean value of 'true' if both errors describe the same event, and 'false' otherwise.
+		  */
+
+		bool operator==( const Error& instance ) const noexcept
+		{
+			// Return result to calling routine.
+
+				return ( !std::strcmp( eventIndex, instance.eventIndex ) && !std::strcmp( moduleID, instance.moduleID ) );
+		}
+
+private:
+
+	// Private Fields
+
+		/**
+		  * @brief This is the error's root ID.
+		  */
+
+		const char* rootID;
+
+		/**
+		  * @brief This is the error's module ID.
+		  */
+
+		const char* moduleID;
+
+		/**
+		  * @brief This is the error's event index.
+		  */
+
+		const char* eventIndex;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// The 'Expected' Class
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+  * @class Expected Expected.hpp "include/Expected.hpp"
+  *
+  * @brief This class defines a result which holds either a value or an error.
+  *
+  * It is returned by the 'try*' variants of methods which would otherwise throw, for use on hot paths where failure is routine.  The value and error share
+  * storage, so neither the success path nor the failure path allocates.  The 'QMX_EXPECT' macro returns an error from a 'try*' method, and the
+  * 'QMX_ASSERT_RESULT' macros turn an error back into a 'QMXException' with event data.
+  *
+  * Platform Independent     : Yes<br>
+  * Architecture Independent : Yes<br>
+  * Thread-Safe              : No
+  */
+
+template< typename VType > class Expected
+{
+public:
+
+	// Public Constructors
+
+		/**
+		  * @brief This is the constructor which accepts a value.
+		  *
+		  * @param source
+		  * 	This is the value to hold.
+		  */
+
+		Expected( const VType& source ) : data( std::in_place_index< 0 >, source )
+		{
+			// Do nothing.
+		}
+
+		/**
+		  * @brief This is the constructor which accepts a value to move.
+		  *
+		  * @param source
+		  * 	This is the value to hold.
+		  */
+
+		Expected( VType&& source ) : data( std::in_place_index< 0 >, std::move( source ) )
+		{
+			// Do nothing.
+		}
+
+		/**
+		  * @brief This is the constructor which accepts an error.
+		  *
+		  * @param source
+		  * 	This is the error to hold.
+		  */
+
+		Expected( const Error& source ) noexcept : data( std::in_place_index< 1 >, source )
+		{
+			// Do nothing.
+		}
+
+	// Public Methods
+
+		/**
+		  * @brief This method determines if this result holds a value.
+		  *
+		  * @return
+		  * 	A boolean value of 'true' if this result holds a value, and 'false' otherwise.
+		  */
+
+		bool hasValue() const noexcept
+		{
+			// Return result to calling routine.
+
+				return ( data.index() == 0 );
+		}
+
+		/**
+		  * @brief This method gets the held value.
+		  *
+		  * @return
+		  * 	A reference to the held value.
+		  *
+		  * @exception QMXException
+		  * 	If this result holds an error, in which case the exception described by the error is thrown.
+		  */
+
+		VType& getValue()
+		{
+			// Check held alternative.
+
+				if( !hasValue() )
+					std::get< 1 >( data ).raise();
+
+			// Return result to calling routine.
+
+				return std::get< 0 >( data );
+		}
+
+		/**
+		  * @brief This method gets the held value.
+		  *
+		  * @return
+		  * 	A constant reference to the held value.
+		  *
+		  * @exception QMXException
+		  * 	If this result holds an error, in which case the exception described by the error is thrown.
+		  */
+
+		const VType& getValue() const
+		{
+			// Check held alternative.
+
+				if( !hasValue() )
+					std::get< 1 >( data ).raise();
+
+			// Return result to calling routine.
+
+				return std::get< 0 >( data );
+		}
+
+		/**
+		  * @brief This method gets the held value, or the specified default value if this result holds an error.
+		  *
+		  * @param defaultValue
+		  * 	This is the value to return if this result holds an error.
+		  *
+		  * @return
+		  * 	The held value, or the specified default value.
+		  */
+
+		VType getValueOr( VType defaultValue ) const
+		{
+			// Return result to calling routine.
+
+				return ( hasValue() ? std::get< 0 >( data ) : std::move( defaultValue ) );
+		}
+
+		/**
+		  * @brief This method gets the held error.
+		  *
+		  * @return
+		  * 	A constant reference to the held error.
+		  *
+		  * @exception QMXException
+		  * 	If this result holds a value.
+		  */
+
+		const Error& getError() const
+		{
+			// Check held alternative.
+
+				QMX_ASSERT_X( !hasValue(), "QMXStdLib", "Expected::getError", "0000002E", "" );
+
+			// Return result to calling routine.
+
+				return std::get< 1 >( data );
+		}
+
+	// Public Overloaded Operators
+
+		/**
+		  * @brief This is the overloaded boolean conversion operator.
+		  *
+		  * @return
+		  * 	A boolean value of 'true' if this result holds a value, and 'false' otherwise.
+		  */
+
+		explicit operator bool() const noexcept
+		{
+			// Return result to calling routine.
+
+				return hasValue();
+		}
+
+private:
+
+	// Private Fields
+
+		/**
+		  * @brief This is the held value or error.
+		  */
+
+		std::variant< VType, Error > data;
+};
+
+/**
+  * @brief This is the specialization of 'Expected' for results which carry no value.
+  */
+
+template<> class Expected< void >
+{
+public:
+
+	// Public Constructors
+
+		/**
+		  * @brief This is the default constructor, which creates a successful result.
+		  */
+
+		Expected() noexcept : isValue( true ), error( nullptr, nullptr, nullptr )
+		{
+			// Do nothing.
+		}
+
+		/**
+		  * @brief This is the constructor which accepts an error.
+		  *
+		  * @param source
+		  * 	This is the error to hold.
+		  */
+
+		Expected( const Error& source ) noexcept : isValue( false ), error( source )
+		{
+			// Do nothing.
+		}
+
+	// Public Methods
+
+		/**
+		  * @brief This method determines if this result is successful.
+		  *
+		  * @return
+		  * 	A boolean value of 'true' if this result is successful, and 'false' otherwise.
+		  */
+
+		bool hasValue() const noexcept
+		{
+			// Return result to calling routine.
+
+				return isValue;
+		}
+
+		/**
+		  * @brief This method checks that this result is successful.
+		  *
+		  * @exception QMXException
+		  * 	If this result holds an error, in which case the exception described by the error is thrown.
+		  */
+
+		void getValue() const
+		{
+			// Check held alternative.
+
+				if( !isValue )
+					error.raise();
+		}
+
+		/**
+		  * @brief This method gets the held error.
+		  *
+		  * @return
+		  * 	A constant reference to the held error.
+		  *
+		  * @exception QMXException
+		  * 	If this result is successful.
+		  */
+
+		const Error& getError() const
+		{
+			// Check held alternative.
+
+				QMX_ASSERT_X( !isValue, "QMXStdLib", "Expected::getError", "0000002E", "" );
+
+			// Return result to calling routine.
+
+				return error;
+		}
+
+	// Public Overloaded Operators
+
+		/**
+		  * @brief This is the overloaded boolean conversion operator.
+		  *
+		  * @return
+		  * 	A boolean value of 'true' if this result is successful, and 'false' otherwise.
+		  */
+
+		explicit operator bool() const noexcept
+		{
+			// Return result to calling routine.
+
+				return isValue;
+		}
+
+private:
+
+	// Private Fields
+
+		/**
+		  * @brief This is the boolean flag which determines if this result is successful.
+		  */
+
+		bool isValue;
+
+		/**
+		  * @brief This is the held error, which is only meaningful if this result is not successful.
+		  */
+
+		Error error;
+};
+
+} // 'QMXStdLib' Namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of the 'QMXStdLib' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // __QMX_QMXSTDLIB_EXPECTED_HPP_
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of 'Expected.hpp'
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
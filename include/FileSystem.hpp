@@ -1,6 +1,6 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // FileSystem.hpp
-// Robert M. Baker | Created : 05MAR12 | Last Modified : 31AUG19 by Robert M. Baker
+// Robert M. Baker | Created : 05MAR12 | Last Modified : 17OCT26 by Robert M. Baker
 // Version : 2.3.0
 // This is a header file for 'QMXStdLib'; it defines the interface for a set of file system functions.
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -21,7 +21,7 @@
   * @file
   * @author  Robert M. Baker
   * @date    Created : 05MAR12
-  * @date    Last Modified : 31AUG19 by Robert M. Baker
+  * @date    Last Modified : 17OCT26 by Robert M. Baker
   * @version 2.3.0
   *
   * @brief This header file defines the interface for a set of file system functions.
@@ -52,9 +52,11 @@
 // Header Files
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include <functional>
 #include <boost/filesystem.hpp>
 
 #include "Base.hpp"
+#include "Expected.hpp"
 #include "String.hpp"
 #include "RAII/ScopedStackTrace.hpp"
 
@@ -164,6 +166,94 @@ enum CopyOption
 	OVERWRITE_IF_EXISTS
 };
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// The 'CopyStatistics' Structure
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+  * @brief This structure holds the statistics of a copy operation.
+  */
+
+struct CopyStatistics
+{
+public:
+
+	// Public Constructors
+
+		/**
+		  * @brief This is the default constructor.
+		  */
+
+		CopyStatistics() : fileCount( UNSET ), directoryCount( UNSET ), symlinkCount( UNSET ), skippedCount( UNSET ), byteCount( UNSET ), elapsed( UNSET )
+		{
+			// Do nothing.
+		}
+
+	// Public Methods
+
+		/**
+		  * @brief This method retrieves the copy throughput.
+		  *
+		  * @return
+		  * 	The number of bytes copied per second, or '0' if no time has elapsed.
+		  */
+
+		double getBytesPerSecond() const
+		{
+			// Return result to calling routine.
+
+				return( elapsed ? ( ( static_cast< double >( byteCount ) * 1.0e9 ) / static_cast< double >( elapsed ) ) : 0.0 );
+		}
+
+	// Public Fields
+
+		/**
+		  * @brief This is the number of regular files copied.
+		  */
+
+		uint64_t fileCount;
+
+		/**
+		  * @brief This is the number of directories copied, or merged into existing ones.
+		  */
+
+		uint64_t directoryCount;
+
+		/**
+		  * @brief This is the number of symlinks copied.
+		  */
+
+		uint64_t symlinkCount;
+
+		/**
+		  * @brief This is the number of targets skipped because they already existed.
+		  */
+
+		uint64_t skippedCount;
+
+		/**
+		  * @brief This is the number of bytes copied.
+		  */
+
+		uint64_t byteCount;
+
+		/**
+		  * @brief This is the time elapsed since the copy operation started, in nanoseconds.
+		  */
+
+		int64_t elapsed;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Type Definitions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+  * @brief This is the type of a copy progress handler; it receives the statistics of the copy operation so far.
+  */
+
+typedef std::function< void( const CopyStatistics& ) > CopyHandler;
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Function Prototypes
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -239,6 +329,10 @@ void createLink( const Path& source, const Path& link, bool isHardlink = false )
 /**
   * @brief This function copies the specified source path to the specified destination path with optional recursion and overwriting.
   *
+  * Symlinks are copied as symlinks.  Regular files are cloned where the filesystem supports reflinks, and are otherwise copied inside the kernel, falling back
+  * to plain reads and writes only when neither is available.  A recursive copy walks and copies the source tree on a pool of 'FILESYSTEM_COPY_WORKER_COUNT'
+  * worker threads, and the first error encountered aborts the whole operation.
+  *
   * @param source
   * 	This is the path from which to copy.
   *
@@ -251,12 +345,63 @@ void createLink( const Path& source, const Path& link, bool isHardlink = false )
   * @param targetCopyOption
   * 	This value determines what actions to take if a target already exists during copying.
   *
+  * @param statistics
+  * 	This is the structure which will receive the statistics of the copy operation; if null, they are discarded.
+  *
+  * @param progressHandler
+  * 	This is the handler which is called after each target is copied or skipped; it may be called from any worker thread, though never concurrently, and it
+  * 	must not throw.
+  *
   * @exception QMXException
   * 	If the copy operation could not be performed due to an invalid source target.<br>
   * 	If the copy operation could not be completed.
   */
 
-void copy( const Path& source, const Path& destination, bool isRecursive = true, CopyOption targetCopyOption = SKIP_IF_EXISTS );
+void copy(
+	const Path& source,
+	const Path& destination,
+	bool isRecursive = true,
+	CopyOption targetCopyOption = SKIP_IF_EXISTS,
+	CopyStatistics* statistics = nullptr,
+	const CopyHandler& progressHandler = nullptr
+);
+
+/**
+  * @brief This function copies the specified source path to the specified destination path with optional recursion and overwriting, without throwing.
+  *
+  * Filesystem errors are reported through error codes rather than exceptions, so a failed copy costs no more than a successful one.
+  *
+  * @param source
+  * 	This is the path from which to copy.
+  *
+  * @param destination
+  * 	This is the path to which to copy.
+  *
+  * @param isRecursive
+  * 	This is the boolean flag which determines if the copying will be recursive.
+  *
+  * @param targetCopyOption
+  * 	This value determines what actions to take if a target already exists during copying.
+  *
+  * @param statistics
+  * 	This is the structure which will receive the statistics of the copy operation; if null, they are discarded.
+  *
+  * @param progressHandler
+  * 	This is the handler which is called after each target is copied or skipped; it may be called from any worker thread, though never concurrently, and it
+  * 	must not throw.
+  *
+  * @return
+  * 	A successful result if the copy operation was completed, or the error 'copy' would have thrown.
+  */
+
+Expected< void > tryCopy(
+	const Path& source,
+	const Path& destination,
+	bool isRecursive = true,
+	CopyOption targetCopyOption = SKIP_IF_EXISTS,
+	CopyStatistics* statistics = nullptr,
+	const CopyHandler& progressHandler = nullptr
+);
 
 /**
   * @brief This function runs the specified console command.
@@ -0,0 +1,482 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// LatencyRecorder.hpp
+// Robert M. Baker | Created : 17OCT26 | Last Modified : 17OCT26 by Robert M. Baker
+// Version : 2.3.0
+// This is a header file for 'QMXStdLib'; it defines the interface for a latency histogram class.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+//
+// This file is part of 'QMXStdLib'.
+//
+// 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option) any later version.
+//
+// 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+  * @file
+  * @author  Robert M. Baker
+  * @date    Created : 17OCT26
+  * @date    Last Modified : 17OCT26 by Robert M. Baker
+  * @version 2.3.0
+  *
+  * @brief This header file defines the interface for a latency histogram class.
+  *
+  * @section LatencyRecorderH0000 Description
+  *
+  * This header file defines the interface for a latency histogram class.
+  *
+  * @section LatencyRecorderH0001 License
+  *
+  * Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+  *
+  * This file is part of 'QMXStdLib'.
+  *
+  * 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+  * Software Foundation, either version 3 of the License, or (at your option) any later version.
+  *
+  * 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+  * A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+  *
+  * You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+  */
+
+#ifndef __QMX_QMXSTDLIB_LATENCYRECORDER_HPP_
+#define __QMX_QMXSTDLIB_LATENCYRECORDER_HPP_
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Header Files
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "Base.hpp"
+#include "Object.hpp"
+#include "Timer.hpp"
+#include "RAII/ScopedLock.hpp"
+#include "RAII/ScopedStackTrace.hpp"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Start of the 'QMXStdLib' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace QMXStdLib
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// The 'LatencyRecorder' Class
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+  * @class LatencyRecorder LatencyRecorder.hpp "include/LatencyRecorder.hpp"
+  *
+  * @brief This class defines a histogram for recording latencies.
+  *
+  * Latencies, in nanoseconds, are counted in log-linear buckets: values below 256 each have their own bucket, and every power of two above that is split into
+  * 128 buckets, so a reported value is never more than 1/128 (0.8%) above the recorded one.  Values from about 73 minutes up share the last bucket.  Each
+  * thread records into one of several shards, which are created on first use and merged when the histogram is queried, so recording takes no lock and queries
+  * cost a pass over the buckets.  A histogram may be dumped to a compact binary string and loaded into another recorder, adding its samples to those already
+  * recorded there.
+  *
+  * Platform Independent     : Yes<br>
+  * Architecture Independent : Yes<br>
+  * Thread-Safe              : Yes
+  */
+
+class LatencyRecorder : public Object< LatencyRecorder >
+{
+	// Friend Classes
+
+		friend class Object< LatencyRecorder >;
+
+public:
+
+	// Public Fields
+
+		/**
+		  * @brief This is the number of bits kept below the highest set bit of each value, which sets the precision of the histogram.
+		  */
+
+		static constexpr uint32_t PRECISION_BITS = 7;
+
+		/**
+		  * @brief This is the number of bits of the largest value the histogram can tell apart from larger ones.
+		  */
+
+		static constexpr uint32_t RANGE_BITS = 42;
+
+		/**
+		  * @brief This is the number of buckets in the histogram.
+		  */
+
+		static constexpr size_t BUCKET_COUNT = ( ( RANGE_BITS - PRECISION_BITS + 1 ) << PRECISION_BITS );
+
+		/**
+		  * @brief This is the number of shards samples are spread over.
+		  */
+
+		static constexpr size_t SHARD_COUNT = 16;
+
+	// Destructor
+
+		/**
+		  * @brief This is the destructor.
+		  */
+
+		~LatencyRecorder();
+
+	// Public Methods
+
+		/**
+		  * @brief This method records a latency.
+		  *
+		  * Negative latencies are recorded as 0.
+		  *
+		  * @param nanoseconds
+		  * 	This is the latency, in nanoseconds, to record.
+		  */
+
+		void record( int64_t nanoseconds );
+
+		/**
+		  * @brief This method records the elapsed time of a timer as a latency.
+		  *
+		  * @param timer
+		  * 	This is the timer whose elapsed time will be recorded.
+		  */
+
+		void record( const Timer& timer );
+
+		/**
+		  * @brief This method removes all recorded latencies.
+		  */
+
+		void reset();
+
+		/**
+		  * @brief This method gets the number of recorded latencies.
+		  *
+		  * @return
+		  * 	The number of recorded latencies.
+		  */
+
+		uint64_t getCount() const;
+
+		/**
+		  * @brief This method gets the smallest recorded latency.
+		  *
+		  * @return
+		  * 	The smallest recorded latency, in nanoseconds, or 0 if none were recorded.
+		  */
+
+		int64_t getMinimum() const;
+
+		/**
+		  * @brief This method gets the largest recorded latency.
+		  *
+		  * @return
+		  * 	The largest recorded latency, in nanoseconds, or 0 if none were recorded.
+		  */
+
+		int64_t getMaximum() const;
+
+		/**
+		  * @brief This method gets the mean of the recorded latencies.
+		  *
+		  * @return
+		  * 	The mean of the recorded latencies, in nanoseconds, or 0 if none were recorded.
+		  */
+
+		real_t getMean() const;
+
+		/**
+		  * @brief This method gets the latency at the specified percentile.
+		  *
+		  * The result is the largest value sharing a bucket with the latency at the specified rank, capped by the largest recorded latency.
+		  *
+		  * @param percentile
+		  * 	This is the percentile, from 0 to 100, to get.
+		  *
+		  * @return
+		  * 	The latency, in nanoseconds, at the specified percentile, or 0 if none were recorded.
+		  *
+		  * @exception QMXException
+		  * 	If the percentile is outside the range [0, 100].
+		  */
+
+		int64_t getPercentile( const real_t percentile ) const;
+
+		/**
+		  * @brief This method gets the latencies at several percentiles, merging the shards only once.
+		  *
+		  * @param percentiles
+		  * 	This is the vector of percentiles, from 0 to 100, to get.
+		  *
+		  * @return
+		  * 	A vector holding the latency, in nanoseconds, at each of the specified percentiles.
+		  *
+		  * @exception QMXException
+		  * 	If any percentile is outside the range [0, 100].
+		  */
+
+		std::vector< int64_t > getPercentiles( const std::vector< real_t >& percentiles ) const;
+
+		/**
+		  * @brief This method dumps the histogram to a compact binary string.
+		  *
+		  * Only buckets holding latencies are written, so the size of the result depends on how widely the latencies are spread rather than on their number.
+		  *
+		  * @return
+		  * 	A binary string holding the histogram.
+		  */
+
+		std::string dump() const;
+
+		/**
+		  * @brief This method adds the latencies in a dumped histogram to this one.
+		  *
+		  * @param source
+		  * 	This is the binary string, as produced by 'dump', to load.
+		  *
+		  * @exception QMXException
+		  * 	If the specified string is not a valid dump.
+		  */
+
+		void load( const std::string& source );
+
+private:
+
+	// Private Data Types
+
+		/**
+		  * @brief This structure holds the latencies recorded by the threads mapped to one shard.
+		  */
+
+		struct alignas( 64 ) Shard
+		{
+		public:
+
+			// Public Constructors
+
+				/**
+				  * @brief This is the default constructor.
+				  */
+
+				Shard() : count( UNSET ), total( UNSET ), minimum( std::numeric_limits< int64_t >::max() ), maximum( UNSET )
+				{
+					// Initialize fields.
+
+						for( auto& bucket : buckets )
+							bucket.store( UNSET, std::memory_order_relaxed );
+				}
+
+			// Public Fields
+
+				/**
+				  * @brief This is the number of latencies recorded into the shard.
+				  */
+
+				std::atomic< uint64_t > count;
+
+				/**
+				  * @brief This is the sum of the latencies recorded into the shard.
+				  */
+
+				std::atomic< uint64_t > total;
+
+				/**
+				  * @brief This is the smallest latency recorded into the shard.
+				  */
+
+				std::atomic< int64_t > minimum;
+
+				/**
+				  * @brief This is the largest latency recorded into the shard.
+				  */
+
+				std::atomic< int64_t > maximum;
+
+				/**
+				  * @brief This is the array of bucket counts.
+				  */
+
+				std::atomic< uint64_t > buckets[ BUCKET_COUNT ];
+		};
+
+		/**
+		  * @brief This structure holds the shards merged into one histogram.
+		  */
+
+		struct Summary
+		{
+		public:
+
+			// Public Constructors
+
+				/**
+				  * @brief This is the default constructor.
+				  */
+
+				Summary() : count( UNSET ), total( UNSET ), minimum( std::numeric_limits< int64_t >::max() ), maximum( UNSET ), buckets( BUCKET_COUNT, UNSET )
+				{
+					// Do nothing.
+				}
+
+			// Public Fields
+
+				/**
+				  * @brief This is the number of latencies recorded.
+				  */
+
+				uint64_t count;
+
+				/**
+				  * @brief This is the sum of the latencies recorded.
+				  */
+
+				uint64_t total;
+
+				/**
+				  * @brief This is the smallest latency recorded.
+				  */
+
+				int64_t minimum;
+
+				/**
+				  * @brief This is the largest latency recorded.
+				  */
+
+				int64_t maximum;
+
+				/**
+				  * @brief This is the vector of bucket counts.
+				  */
+
+				std::vector< uint64_t > buckets;
+		};
+
+	// Private Fields
+
+		/**
+		  * @brief This is the array of shards, each of which is created when a thread first records into it.
+		  */
+
+		std::atomic< Shard* > shards[ SHARD_COUNT ];
+
+		/**
+		  * @brief This is the counter used to give each thread its shard.
+		  */
+
+		inline static std::atomic< size_t > nextShard = { 0 };
+
+		/**
+		  * @brief This is the shard index of the current thread.
+		  */
+
+		inline static thread_local size_t shardIndex = SHARD_COUNT;
+
+	// Private Constructors
+
+		/**
+		  * @brief This is the default constructor.
+		  */
+
+		LatencyRecorder();
+
+	// Private Methods
+
+		/**
+		  * @brief This method performs the actual cloning.
+		  *
+		  * @param target
+		  * 	This is the object to use as the clone target.
+		  */
+
+		void cloneImp( InstancePtr& target ) const;
+
+		/**
+		  * @brief This method gets the shard of the current thread, creating it if necessary.
+		  *
+		  * @return
+		  * 	The shard of the current thread.
+		  */
+
+		Shard& getShard();
+
+		/**
+		  * @brief This method merges all shards into one histogram.
+		  *
+		  * @return
+		  * 	The merged histogram.
+		  */
+
+		Summary getSummary() const;
+
+		/**
+		  * @brief This method adds a merged histogram to the shard of the current thread.
+		  *
+		  * @param source
+		  * 	This is the merged histogram to add.
+		  */
+
+		void addSummary( const Summary& source );
+
+		/**
+		  * @brief This method gets the latency at the specified percentile of a merged histogram.
+		  *
+		  * @param source
+		  * 	This is the merged histogram to query.
+		  *
+		  * @param percentile
+		  * 	This is the percentile, from 0 to 100, to get.
+		  *
+		  * @return
+		  * 	The latency, in nanoseconds, at the specified percentile.
+		  */
+
+		static int64_t getPercentile( const Summary& source, const real_t percentile );
+
+		/**
+		  * @brief This method gets the bucket holding the specified value.
+		  *
+		  * @param value
+		  * 	This is the value, which must not be negative.
+		  *
+		  * @return
+		  * 	The index of the bucket holding the specified value.
+		  */
+
+		static size_t getBucketIndex( const uint64_t value );
+
+		/**
+		  * @brief This method gets the largest value held by the specified bucket.
+		  *
+		  * @param index
+		  * 	This is the index of the bucket.
+		  *
+		  * @return
+		  * 	The largest value held by the specified bucket.
+		  */
+
+		static int64_t getBucketLimit( const size_t index );
+};
+
+} // 'QMXStdLib' Namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of the 'QMXStdLib' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // __QMX_QMXSTDLIB_LATENCYRECORDER_HPP_
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of 'LatencyRecorder.hpp'
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
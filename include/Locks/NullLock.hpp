@@ -0,0 +1,134 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// NullLock.hpp
+// Robert M. Baker | Created : 16OCT26 | Last Modified : 16OCT26 by Robert M. Baker
+// Version : 2.3.0
+// This is a header file for 'QMXStdLib'; it defines the interface for a no-op lock class.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+//
+// This file is part of 'QMXStdLib'.
+//
+// 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option) any later version.
+//
+// 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+  * @file
+  * @author  Robert M. Baker
+  * @date    Created : 16OCT26
+  * @date    Last Modified : 16OCT26 by Robert M. Baker
+  * @version 2.3.0
+  *
+  * @brief This header file defines the interface for a no-op lock class.
+  *
+  * @section NullLockH0000 Description
+  *
+  * This header file defines the interface for a no-op lock class.
+  *
+  * @section NullLockH0001 License
+  *
+  * Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+  *
+  * This file is part of 'QMXStdLib'.
+  *
+  * 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+  * Software Foundation, either version 3 of the License, or (at your option) any later version.
+  *
+  * 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+  * A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+  *
+  * You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+  */
+
+#ifndef __QMX_QMXSTDLIB_NULLLOCK_HPP_
+#define __QMX_QMXSTDLIB_NULLLOCK_HPP_
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Header Files
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../Base.hpp"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Start of the 'QMXStdLib' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace QMXStdLib
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// The 'NullLock' Class
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+  * @class NullLock NullLock.hpp "include/Locks/NullLock.hpp"
+  *
+  * @brief This class defines a lock policy which performs no locking.
+  *
+  * This is useful for objects which are confined to a single thread, or which provide their own synchronization; it satisfies the same interface as
+  * 'SpinLock' and 'SharedLock', so it may be used as the lock policy of 'Lockable' and 'Object'.
+  *
+  * Platform Independent     : Yes<br>
+  * Architecture Independent : Yes<br>
+  * Thread-Safe              : No
+  */
+
+class NullLock
+{
+public:
+
+	// Public Methods
+
+		/**
+		  * @brief This method obtains an exclusive lock, which has no effect.
+		  */
+
+		void lock()
+		{
+			// Do nothing.
+		}
+
+		/**
+		  * @brief This method releases an exclusive lock, which has no effect.
+		  */
+
+		void unlock()
+		{
+			// Do nothing.
+		}
+
+		/**
+		  * @brief This method obtains a shared lock, which has no effect.
+		  */
+
+		void lockShared()
+		{
+			// Do nothing.
+		}
+
+		/**
+		  * @brief This method releases a shared lock, which has no effect.
+		  */
+
+		void unlockShared()
+		{
+			// Do nothing.
+		}
+};
+
+} // 'QMXStdLib' Namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of the 'QMXStdLib' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // __QMX_QMXSTDLIB_NULLLOCK_HPP_
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of 'NullLock.hpp'
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
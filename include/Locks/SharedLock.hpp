@@ -0,0 +1,547 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// SharedLock.hpp
+// Robert M. Baker | Created : 16OCT26 | Last Modified : 16OCT26 by Robert M. Baker
+// Version : 2.3.0
+// This is a header file for 'QMXStdLib'; it defines the interface for a reader-biased shared lock class.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+//
+// This file is part of 'QMXStdLib'.
+//
+// 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option) any later version.
+//
+// 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+  * @file
+  * @author  Robert M. Baker
+  * @date    Created : 16OCT26
+  * @date    Last Modified : 16OCT26 by Robert M. Baker
+  * @version 2.3.0
+  *
+  * @brief This header file defines the interface for a reader-biased shared lock class.
+  *
+  * @section SharedLockH0000 Description
+  *
+  * This header file defines the interface for a reader-biased shared lock class.
+  *
+  * @section SharedLockH0001 License
+  *
+  * Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+  *
+  * This file is part of 'QMXStdLib'.
+  *
+  * 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+  * Software Foundation, either version 3 of the License, or (at your option) any later version.
+  *
+  * 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+  * A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+  *
+  * You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+  */
+
+#ifndef __QMX_QMXSTDLIB_SHAREDLOCK_HPP_
+#define __QMX_QMXSTDLIB_SHAREDLOCK_HPP_
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Header Files
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+#include "../Base.hpp"
+#include "../QMXException.hpp"
+#include "SpinLock.hpp"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Start of the 'QMXStdLib' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace QMXStdLib
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// The 'SharedLock' Class
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+  * @class SharedLock SharedLock.hpp "include/Locks/SharedLock.hpp"
+  *
+  * @brief This class defines a reader-biased shared lock with a recursive writer.
+  *
+  * While the lock is read-biased, a reader claims a slot in a global, cache-line padded table chosen by hashing the lock and the calling thread; this writes
+  * only to that slot, so readers of the same lock never contend on a shared cache line.  A writer serializes on a 'SpinLock', revokes the read bias, and
+  * waits for every slot claimed for this lock to drain; the bias is then inhibited for 'SHAREDLOCK_INHIBIT_FACTOR' times as long as the revocation took,
+  * during which readers use a conventional reader count instead.  Reentrancy is tracked per thread: nested reads and writes are counted, a read nested in a
+  * write is treated as a nested write, and a write nested in a read (an upgrade) is rejected, since it can never be granted.
+  *
+  * Platform Independent     : Yes<br>
+  * Architecture Independent : Yes<br>
+  * Thread-Safe              : Yes
+  */
+
+class SharedLock
+{
+public:
+
+	// Public Constructors
+
+		/**
+		  * @brief This is the default constructor.
+		  */
+
+		SharedLock() :
+			readBias( true ),
+			inhibitUntil( 0 ),
+			readerCount( 0 ),
+			parkedCount( 0 )
+		{
+			// Do nothing.
+		}
+
+		/**
+		  * @brief This is the copy constructor, which is deleted to prevent copying.
+		  *
+		  * @param instance
+		  * 	N/A
+		  */
+
+		SharedLock( const SharedLock& instance ) = delete;
+
+	// Public Methods
+
+		/**
+		  * @brief This method obtains an exclusive lock, blocking until all other readers and writers have released the lock.
+		  *
+		  * @exception QMXException
+		  * 	If the calling thread holds a shared lock on this lock.
+		  */
+
+		void lock()
+		{
+			// Increment the recursion count, if the calling thread already owns the lock.
+
+				if( writerLock.isOwner() )
+				{
+					writerLock.lock();
+
+					return;
+				}
+
+			// Obtain lock, and wait for readers to drain.
+
+				QMX_ASSERT_X( !findReadEntry(), "QMXStdLib", "SharedLock::lock", "0000002B", this );
+				writerLock.lock();
+
+				if( readBias.load( std::memory_order_relaxed ) )
+					revokeBias();
+
+				waitForReaders();
+		}
+
+		/**
+		  * @brief This method releases an exclusive lock.
+		  *
+		  * This must only be called by the owning thread.
+		  */
+
+		void unlock()
+		{
+			// Release lock.
+
+				writerLock.unlock();
+		}
+
+		/**
+		  * @brief This method obtains a shared lock, blocking while another thread owns the exclusive lock.
+		  */
+
+		void lockShared()
+		{
+			// Create local variables.
+
+				ReadEntry* entry = findReadEntry();
+				size_t slot = NO_SLOT;
+				const SharedLock* expected = nullptr;
+
+			// Increment the read count if the calling thread already holds a shared lock, or treat it as a nested write if it owns the exclusive lock.
+
+				if( entry )
+				{
+					entry->count++;
+
+					return;
+				}
+
+				if( writerLock.isOwner() )
+				{
+					writerLock.lock();
+
+					return;
+				}
+
+			// Claim a reader slot, if the lock is read-biased.  The bias is checked again after the claim, so a revoking writer will either see the claim or
+			// this reader will see the revocation.
+
+				if( readBias.load( std::memory_order_acquire ) )
+				{
+					slot = getSlotIndex();
+
+					if( readerSlots[ slot ].lock.compare_exchange_strong( expected, this, std::memory_order_seq_cst, std::memory_order_relaxed ) )
+					{
+						if( readBias.load( std::memory_order_seq_cst ) )
+						{
+							readLedger.push_back( ReadEntry{ this, 1, slot } );
+
+							return;
+						}
+
+						readerSlots[ slot ].lock.store( nullptr, std::memory_order_release );
+					}
+				}
+
+			// Fall back to the reader count.
+
+				lockSharedSlow();
+				readLedger.push_back( ReadEntry{ this, 1, NO_SLOT } );
+		}
+
+		/**
+		  * @brief This method releases a shared lock.
+		  *
+		  * This must only be called by a thread which holds a shared lock.
+		  */
+
+		void unlockShared()
+		{
+			// Create local variables.
+
+				ReadEntry* entry = findReadEntry();
+
+			// Release nested write, if the shared lock was obtained by the owner of the exclusive lock.
+
+				if( !entry )
+				{
+					writerLock.unlock();
+
+					return;
+				}
+
+			// Decrement the read count, and release the reader slot or reader count if it reaches zero.
+
+				if( --entry->count )
+					return;
+
+				if( entry->slot != NO_SLOT )
+					readerSlots[ entry->slot ].lock.store( nullptr, std::memory_order_release );
+				else if( ( readerCount.fetch_sub( 1, std::memory_order_seq_cst ) == 1 ) && parkedCount.load( std::memory_order_seq_cst ) )
+				{
+					std::lock_guard< std::mutex > parkGuard( parkMutex );
+					parkCondition.notify_all();
+				}
+
+				*entry = readLedger.back();
+				readLedger.pop_back();
+		}
+
+		/**
+		  * @brief This method determines if the calling thread owns the exclusive lock.
+		  *
+		  * @return
+		  * 	A boolean value of 'true' if the calling thread owns the exclusive lock, and 'false' otherwise.
+		  */
+
+		bool isOwner() const
+		{
+			// Report whether or not the calling thread owns the exclusive lock to calling routine.
+
+				return writerLock.isOwner();
+		}
+
+	// Public Overloaded Operators
+
+		/**
+		  * @brief This is the default assignment-operator, which is deleted to prevent copying.
+		  *
+		  * @param instance
+		  * 	N/A
+		  *
+		  * @return
+		  * 	N/A
+		  */
+
+		SharedLock& operator=( const SharedLock& instance ) = delete;
+
+private:
+
+	// Private Data Types
+
+		/**
+		  * @brief This structure is a reader slot, padded to its own cache line.
+		  */
+
+		struct alignas( 64 ) ReaderSlot
+		{
+			/**
+			  * @brief This is the lock which has claimed the slot, or 'nullptr'.
+			  */
+
+			std::atomic< const SharedLock* > lock;
+		};
+
+		/**
+		  * @brief This structure records a shared lock held by the current thread.
+		  */
+
+		struct ReadEntry
+		{
+			/**
+			  * @brief This is the lock which is held.
+			  */
+
+			const SharedLock* lock;
+
+			/**
+			  * @brief This is the number of times the lock is held.
+			  */
+
+			size_t count;
+
+			/**
+			  * @brief This is the claimed reader slot, or 'NO_SLOT' if the reader count was used.
+			  */
+
+			size_t slot;
+		};
+
+	// Private Fields
+
+		/**
+		  * @brief This is the slot value used when no reader slot was claimed.
+		  */
+
+		static constexpr size_t NO_SLOT = std::numeric_limits< size_t >::max();
+
+		/**
+		  * @brief This is the flag which determines if readers may claim reader slots.
+		  */
+
+		std::atomic< bool > readBias;
+
+		/**
+		  * @brief This is the time (in steady clock nanoseconds) before which the read bias may not be restored.
+		  */
+
+		std::atomic< int64_t > inhibitUntil;
+
+		/**
+		  * @brief This is the number of readers which hold the lock without a reader slot.
+		  */
+
+		std::atomic< size_t > readerCount;
+
+		/**
+		  * @brief This is the number of writers parked while waiting for the reader count to drain.
+		  */
+
+		std::atomic< size_t > parkedCount;
+
+		/**
+		  * @brief This is the writer lock, which serializes writers and slow-path readers.
+		  */
+
+		SpinLock writerLock;
+
+		/**
+		  * @brief This is the mutex used when parking and waking writers.
+		  */
+
+		std::mutex parkMutex;
+
+		/**
+		  * @brief This is the condition variable used when parking and waking writers.
+		  */
+
+		std::condition_variable parkCondition;
+
+		/**
+		  * @brief This is the global table of reader slots shared by all instances.
+		  */
+
+		inline static std::array< ReaderSlot, SHAREDLOCK_SLOT_COUNT > readerSlots;
+
+		/**
+		  * @brief This is the list of shared locks held by the current thread.
+		  */
+
+		inline static thread_local std::vector< ReadEntry > readLedger;
+
+	// Private Methods
+
+		/**
+		  * @brief This method gets the current time in steady clock nanoseconds.
+		  *
+		  * @return
+		  * 	The current time.
+		  */
+
+		static int64_t getTime()
+		{
+			// Report the current time to calling routine.
+
+				return std::chrono::duration_cast< std::chrono::nanoseconds >( std::chrono::steady_clock::now().time_since_epoch() ).count();
+		}
+
+		/**
+		  * @brief This method gets the reader slot index for this lock and the calling thread.
+		  *
+		  * @return
+		  * 	The reader slot index.
+		  */
+
+		size_t getSlotIndex() const
+		{
+			// Create local variables.
+
+				uint64_t hash = ( ( SpinLock::getThreadToken() >> 4 ) ^ ( reinterpret_cast< uintptr_t >( this ) >> 6 ) );
+
+			// Report the mixed hash, reduced to the table size, to calling routine.
+
+				return( ( ( hash * 0x9E3779B97F4A7C15ull ) >> 32 ) % SHAREDLOCK_SLOT_COUNT );
+		}
+
+		/**
+		  * @brief This method finds the calling thread's entry for this lock in the read ledger.
+		  *
+		  * @return
+		  * 	A pointer to the entry, or 'nullptr' if the calling thread does not hold a shared lock on this lock.
+		  */
+
+		ReadEntry* findReadEntry() const
+		{
+			// Search the read ledger, starting with the most recently obtained lock.
+
+				for( auto index = readLedger.rbegin(); index != readLedger.rend(); index++ )
+				{
+					if( index->lock == this )
+						return &( *index );
+				}
+
+			// Report failure to calling routine.
+
+				return nullptr;
+		}
+
+		/**
+		  * @brief This method obtains a shared lock using the reader count, restoring the read bias if its inhibit window has passed.
+		  */
+
+		void lockSharedSlow()
+		{
+			// Obtain writer lock, so no writer is active while the reader count is incremented.
+
+				writerLock.lock();
+				readerCount.fetch_add( 1, std::memory_order_seq_cst );
+
+				if( !readBias.load( std::memory_order_relaxed ) && ( getTime() >= inhibitUntil.load( std::memory_order_relaxed ) ) )
+					readBias.store( true, std::memory_order_release );
+
+				writerLock.unlock();
+		}
+
+		/**
+		  * @brief This method revokes the read bias, and waits for all reader slots claimed for this lock to be released.
+		  *
+		  * This must only be called while holding the writer lock.
+		  */
+
+		void revokeBias()
+		{
+			// Create local variables.
+
+				int64_t startTime = UNSET;
+				size_t spinCount = UNSET;
+
+			// Revoke read bias, and scan all reader slots.
+
+				readBias.store( false, std::memory_order_seq_cst );
+				startTime = getTime();
+
+				for( auto& readerSlot : readerSlots )
+				{
+					for( spinCount = 0; readerSlot.lock.load( std::memory_order_seq_cst ) == this; spinCount++ )
+					{
+						if( spinCount < SPINLOCK_SPIN_COUNT )
+							SPINLOCK_PAUSE;
+						else
+							std::this_thread::yield();
+					}
+				}
+
+			// Inhibit the read bias in proportion to the cost of revoking it.
+
+				inhibitUntil.store( ( getTime() + ( ( getTime() - startTime ) * SHAREDLOCK_INHIBIT_FACTOR ) ), std::memory_order_relaxed );
+		}
+
+		/**
+		  * @brief This method waits for the reader count to drain, spinning before parking the calling thread.
+		  *
+		  * This must only be called while holding the writer lock.
+		  */
+
+		void waitForReaders()
+		{
+			// Spin while there are readers.
+
+				for( size_t index = 0; index < SPINLOCK_SPIN_COUNT; index++ )
+				{
+					if( !readerCount.load( std::memory_order_seq_cst ) )
+						return;
+
+					SPINLOCK_PAUSE;
+				}
+
+			// Park the calling thread until the reader count drains.
+
+				std::unique_lock< std::mutex > parkGuard( parkMutex );
+				parkedCount.fetch_add( 1, std::memory_order_seq_cst );
+
+				while( readerCount.load( std::memory_order_seq_cst ) )
+					parkCondition.wait( parkGuard );
+
+				parkedCount.fetch_sub( 1, std::memory_order_seq_cst );
+		}
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Type Definitions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+  * @brief This is the previous name of 'SharedLock', retained for compatibility.
+  */
+
+typedef SharedLock SharedMutexPair;
+
+} // 'QMXStdLib' Namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of the 'QMXStdLib' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // __QMX_QMXSTDLIB_SHAREDLOCK_HPP_
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of 'SharedLock.hpp'
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
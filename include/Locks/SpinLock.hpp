@@ -0,0 +1,381 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// SpinLock.hpp
+// Robert M. Baker | Created : 16OCT26 | Last Modified : 16OCT26 by Robert M. Baker
+// Version : 2.3.0
+// This is a header file for 'QMXStdLib'; it defines the interface for a recursive spin-then-park lock class.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+//
+// This file is part of 'QMXStdLib'.
+//
+// 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option) any later version.
+//
+// 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+  * @file
+  * @author  Robert M. Baker
+  * @date    Created : 16OCT26
+  * @date    Last Modified : 16OCT26 by Robert M. Baker
+  * @version 2.3.0
+  *
+  * @brief This header file defines the interface for a recursive spin-then-park lock class.
+  *
+  * @section SpinLockH0000 Description
+  *
+  * This header file defines the interface for a recursive spin-then-park lock class.
+  *
+  * @section SpinLockH0001 License
+  *
+  * Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+  *
+  * This file is part of 'QMXStdLib'.
+  *
+  * 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+  * Software Foundation, either version 3 of the License, or (at your option) any later version.
+  *
+  * 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+  * A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+  *
+  * You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+  */
+
+#ifndef __QMX_QMXSTDLIB_SPINLOCK_HPP_
+#define __QMX_QMXSTDLIB_SPINLOCK_HPP_
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Header Files
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+#include "../Base.hpp"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Static Macros
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if ( defined( __x86_64__ ) || defined( __i386__ ) )
+#	define SPINLOCK_PAUSE __builtin_ia32_pause()
+#elif defined( __aarch64__ )
+#	define SPINLOCK_PAUSE asm volatile( "yield" )
+#else
+#	define SPINLOCK_PAUSE std::this_thread::yield()
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Start of the 'QMXStdLib' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace QMXStdLib
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// The 'SpinLock' Class
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+  * @class SpinLock SpinLock.hpp "include/Locks/SpinLock.hpp"
+  *
+  * @brief This class defines a recursive, exclusive lock which spins briefly before parking the calling thread.
+  *
+  * The owning thread is tracked in a single atomic word, so an uncontended lock or unlock is one atomic operation and recursive locking by the owner never
+  * touches shared state.  After 'SPINLOCK_SPIN_COUNT' failed attempts, the calling thread is parked on a condition variable until the lock is released.
+  * Shared locks are treated as exclusive locks, which makes this the mutex policy of 'Lockable' and 'Object'.
+  *
+  * Platform Independent     : Yes<br>
+  * Architecture Independent : Yes<br>
+  * Thread-Safe              : Yes
+  */
+
+class SpinLock
+{
+public:
+
+	// Public Constructors
+
+		/**
+		  * @brief This is the default constructor.
+		  */
+
+		SpinLock() :
+			owner( NOT_OWNED ),
+			parkedCount( 0 ),
+			recursionCount( 0 )
+		{
+			// Do nothing.
+		}
+
+		/**
+		  * @brief This is the copy constructor, which is deleted to prevent copying.
+		  *
+		  * @param instance
+		  * 	N/A
+		  */
+
+		SpinLock( const SpinLock& instance ) = delete;
+
+	// Public Methods
+
+		/**
+		  * @brief This method obtains an exclusive lock, blocking if another thread owns it.
+		  *
+		  * If the calling thread already owns the lock, the recursion count is incremented instead.
+		  */
+
+		void lock()
+		{
+			// Create local variables.
+
+				uintptr_t token = getThreadToken();
+
+			// Obtain lock, or increment the recursion count if the calling thread already owns it.
+
+				if( owner.load( std::memory_order_relaxed ) == token )
+				{
+					recursionCount++;
+
+					return;
+				}
+
+				if( !tryAcquire( token ) )
+					lockSlow( token );
+
+				recursionCount = 1;
+		}
+
+		/**
+		  * @brief This method attempts to obtain an exclusive lock without blocking.
+		  *
+		  * @return
+		  * 	A boolean value of 'true' if the lock was obtained (or was already owned by the calling thread), and 'false' otherwise.
+		  */
+
+		bool tryLock()
+		{
+			// Create local variables.
+
+				uintptr_t token = getThreadToken();
+
+			// Attempt to obtain lock.
+
+				if( owner.load( std::memory_order_relaxed ) == token )
+					recursionCount++;
+				else if( tryAcquire( token ) )
+					recursionCount = 1;
+				else
+					return false;
+
+			// Report success to calling routine.
+
+				return true;
+		}
+
+		/**
+		  * @brief This method releases an exclusive lock.
+		  *
+		  * The lock is only released once the recursion count reaches zero, at which point one parked thread (if any) is woken.  This must only be called by the
+		  * owning thread.
+		  */
+
+		void unlock()
+		{
+			// Decrement the recursion count, and release lock if it reaches zero.
+
+				if( --recursionCount )
+					return;
+
+				owner.store( NOT_OWNED, std::memory_order_seq_cst );
+
+			// Wake a parked thread, if any.
+
+				if( parkedCount.load( std::memory_order_seq_cst ) )
+				{
+					std::lock_guard< std::mutex > parkGuard( parkMutex );
+					parkCondition.notify_one();
+				}
+		}
+
+		/**
+		  * @brief This method obtains a shared lock, which is identical to obtaining an exclusive lock.
+		  */
+
+		void lockShared()
+		{
+			// Obtain exclusive lock.
+
+				lock();
+		}
+
+		/**
+		  * @brief This method releases a shared lock, which is identical to releasing an exclusive lock.
+		  */
+
+		void unlockShared()
+		{
+			// Release exclusive lock.
+
+				unlock();
+		}
+
+		/**
+		  * @brief This method determines if the calling thread owns the lock.
+		  *
+		  * @return
+		  * 	A boolean value of 'true' if the calling thread owns the lock, and 'false' otherwise.
+		  */
+
+		bool isOwner() const
+		{
+			// Report whether or not the calling thread owns the lock to calling routine.
+
+				return( owner.load( std::memory_order_relaxed ) == getThreadToken() );
+		}
+
+		/**
+		  * @brief This method gets a token which uniquely identifies the calling thread among all running threads.
+		  *
+		  * @return
+		  * 	A non-zero token for the calling thread.
+		  */
+
+		static uintptr_t getThreadToken()
+		{
+			// Create local variables.
+
+				thread_local char tokenAnchor;
+
+			// Return the address of the thread-local anchor to calling routine.
+
+				return reinterpret_cast< uintptr_t >( &tokenAnchor );
+		}
+
+	// Public Overloaded Operators
+
+		/**
+		  * @brief This is the default assignment-operator, which is deleted to prevent copying.
+		  *
+		  * @param instance
+		  * 	N/A
+		  *
+		  * @return
+		  * 	N/A
+		  */
+
+		SpinLock& operator=( const SpinLock& instance ) = delete;
+
+private:
+
+	// Private Fields
+
+		/**
+		  * @brief This is the owner value used when the lock is not owned.
+		  */
+
+		static constexpr uintptr_t NOT_OWNED = 0;
+
+		/**
+		  * @brief This is the token of the owning thread, or 'NOT_OWNED'.
+		  */
+
+		std::atomic< uintptr_t > owner;
+
+		/**
+		  * @brief This is the number of threads parked while waiting for the lock.
+		  */
+
+		std::atomic< size_t > parkedCount;
+
+		/**
+		  * @brief This is the number of times the owning thread has obtained the lock; it is only accessed by the owning thread.
+		  */
+
+		size_t recursionCount;
+
+		/**
+		  * @brief This is the mutex used when parking and waking threads.
+		  */
+
+		std::mutex parkMutex;
+
+		/**
+		  * @brief This is the condition variable used when parking and waking threads.
+		  */
+
+		std::condition_variable parkCondition;
+
+	// Private Methods
+
+		/**
+		  * @brief This method attempts to take ownership of the lock for the specified thread token.
+		  *
+		  * @param token
+		  * 	This is the token of the calling thread.
+		  *
+		  * @return
+		  * 	A boolean value of 'true' if ownership was taken, and 'false' otherwise.
+		  */
+
+		bool tryAcquire( uintptr_t token )
+		{
+			// Create local variables.
+
+				uintptr_t expected = NOT_OWNED;
+
+			// Attempt to take ownership of the lock.
+
+				return owner.compare_exchange_strong( expected, token, std::memory_order_seq_cst, std::memory_order_relaxed );
+		}
+
+		/**
+		  * @brief This method obtains the lock when the first attempt failed, spinning before parking the calling thread.
+		  *
+		  * @param token
+		  * 	This is the token of the calling thread.
+		  */
+
+		void lockSlow( uintptr_t token )
+		{
+			// Spin while the lock is owned, attempting to take ownership whenever it is released.
+
+				for( size_t index = 0; index < SPINLOCK_SPIN_COUNT; index++ )
+				{
+					SPINLOCK_PAUSE;
+
+					if( ( owner.load( std::memory_order_relaxed ) == NOT_OWNED ) && tryAcquire( token ) )
+						return;
+				}
+
+			// Park the calling thread until ownership is taken.  The parked count is published before each attempt, so a releasing thread will either see it
+			// and wake this thread, or this thread's attempt will see the release.
+
+				std::unique_lock< std::mutex > parkGuard( parkMutex );
+				parkedCount.fetch_add( 1, std::memory_order_seq_cst );
+
+				while( !tryAcquire( token ) )
+					parkCondition.wait( parkGuard );
+
+				parkedCount.fetch_sub( 1, std::memory_order_seq_cst );
+		}
+};
+
+} // 'QMXStdLib' Namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of the 'QMXStdLib' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // __QMX_QMXSTDLIB_SPINLOCK_HPP_
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of 'SpinLock.hpp'
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
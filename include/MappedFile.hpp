@@ -0,0 +1,591 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// MappedFile.hpp
+// Robert M. Baker | Created : 17OCT26 | Last Modified : 17OCT26 by Robert M. Baker
+// Version : 2.3.0
+// This is a header file for 'QMXStdLib'; it defines the interface for a memory-mapped file class.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+//
+// This file is part of 'QMXStdLib'.
+//
+// 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option) any later version.
+//
+// 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+  * @file
+  * @author  Robert M. Baker
+  * @date    Created : 17OCT26
+  * @date    Last Modified : 17OCT26 by Robert M. Baker
+  * @version 2.3.0
+  *
+  * @brief This header file defines the interface for a memory-mapped file class.
+  *
+  * @section MappedFileH0000 Description
+  *
+  * This header file defines the interface for a memory-mapped file class.
+  *
+  * @section MappedFileH0001 License
+  *
+  * Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+  *
+  * This file is part of 'QMXStdLib'.
+  *
+  * 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+  * Software Foundation, either version 3 of the License, or (at your option) any later version.
+  *
+  * 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+  * A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+  *
+  * You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+  */
+
+#ifndef __QMX_QMXSTDLIB_MAPPEDFILE_HPP_
+#define __QMX_QMXSTDLIB_MAPPEDFILE_HPP_
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Header Files
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+
+#include "Base.hpp"
+#include "Object.hpp"
+#include "FileSystem.hpp"
+#include "RAII/ScopedLock.hpp"
+#include "RAII/ScopedStackTrace.hpp"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Start of the 'QMXStdLib' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace QMXStdLib
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// The 'MappedFile' Class
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+  * @class MappedFile MappedFile.hpp "include/MappedFile.hpp"
+  *
+  * @brief This class defines memory-mapped file algorithms.
+  *
+  * The contents of a file are mapped into memory and accessed through views, so large files can be processed in place without being copied into buffers.
+  * A view holds a raw pointer into the mapping; it stays valid until the file is closed or resized.
+  *
+  * Platform Independent     : No (Files can only be mapped on POSIX platforms.)<br>
+  * Architecture Independent : Yes<br>
+  * Thread-Safe              : Yes
+  */
+
+class MappedFile : public Object< MappedFile >
+{
+	// Friend Classes
+
+		friend class Object< MappedFile >;
+
+public:
+
+	// Public Data Types
+
+		/**
+		  * @brief This enumeration contains all valid mapping modes.
+		  */
+
+		enum Mode
+		{
+			READ_ONLY,
+			COPY_ON_WRITE,
+			READ_WRITE
+		};
+
+		/**
+		  * @brief This enumeration contains all valid access pattern hints.
+		  */
+
+		enum Advice
+		{
+			NORMAL_ACCESS,
+			SEQUENTIAL_ACCESS,
+			RANDOM_ACCESS,
+			WILL_NEED,
+			HUGE_PAGES
+		};
+
+		/**
+		  * @brief This class is a non-owning view of a contiguous range of elements in a mapping.
+		  */
+
+		template< typename DType > class View
+		{
+		public:
+
+			// Public Constructors
+
+				/**
+				  * @brief This is the default constructor, which creates an empty view.
+				  */
+
+				View() : viewData( nullptr ), viewSize( UNSET )
+				{
+					// Do nothing.
+				}
+
+				/**
+				  * @brief This is the constructor which accepts a pointer and an element count.
+				  *
+				  * @param sourceData
+				  * 	This is a pointer to the first element.
+				  *
+				  * @param sourceSize
+				  * 	This is the number of elements.
+				  */
+
+				View( DType* sourceData, const size_t sourceSize ) : viewData( sourceData ), viewSize( sourceSize )
+				{
+					// Do nothing.
+				}
+
+			// Public Overloaded Operators
+
+				/**
+				  * @brief This is the overloaded subscript operator.
+				  *
+				  * @param index
+				  * 	This is the index of the element, which is not checked.
+				  *
+				  * @return
+				  * 	A reference to the element.
+				  */
+
+				DType& operator[]( const size_t index ) const
+				{
+					// Return element to calling routine.
+
+						return viewData[ index ];
+				}
+
+			// Public Methods
+
+				/**
+				  * @brief This method gets a pointer to the first element.
+				  *
+				  * @return
+				  * 	A pointer to the first element, or a null pointer if the view is empty.
+				  */
+
+				DType* data() const
+				{
+					// Return pointer to first element to calling routine.
+
+						return viewData;
+				}
+
+				/**
+				  * @brief This method gets the number of elements.
+				  *
+				  * @return
+				  * 	The number of elements.
+				  */
+
+				size_t size() const
+				{
+					// Return number of elements to calling routine.
+
+						return viewSize;
+				}
+
+				/**
+				  * @brief This method determines if the view is empty.
+				  *
+				  * @return
+				  * 	A boolean value of 'true' if the view has no elements, and 'false' otherwise.
+				  */
+
+				bool empty() const
+				{
+					// Report wether or not the view is empty to calling routine.
+
+						return !viewSize;
+				}
+
+				/**
+				  * @brief This method gets an iterator to the first element.
+				  *
+				  * @return
+				  * 	A pointer to the first element.
+				  */
+
+				DType* begin() const
+				{
+					// Return pointer to first element to calling routine.
+
+						return viewData;
+				}
+
+				/**
+				  * @brief This method gets an iterator past the last element.
+				  *
+				  * @return
+				  * 	A pointer past the last element.
+				  */
+
+				DType* end() const
+				{
+					// Return pointer past last element to calling routine.
+
+						return ( viewData + viewSize );
+				}
+
+				/**
+				  * @brief This method gets a view of part of this view, clamped to its bounds.
+				  *
+				  * @param offset
+				  * 	This is the index of the first element of the new view.
+				  *
+				  * @param count
+				  * 	This is the maximum number of elements of the new view.
+				  *
+				  * @return
+				  * 	The new view.
+				  */
+
+				View subview( size_t offset, const size_t count = std::numeric_limits< size_t >::max() ) const
+				{
+					// Clamp offset and count to the bounds of this view.
+
+						offset = std::min( offset, viewSize );
+
+					// Return result to calling routine.
+
+						return View( ( viewData + offset ), std::min( count, ( viewSize - offset ) ) );
+				}
+
+		private:
+
+			// Private Fields
+
+				/**
+				  * @brief This is a pointer to the first element.
+				  */
+
+				DType* viewData;
+
+				/**
+				  * @brief This is the number of elements.
+				  */
+
+				size_t viewSize;
+		};
+
+	// Destructor
+
+		/**
+		  * @brief This is the destructor.
+		  */
+
+		~MappedFile();
+
+	// Public Methods
+
+		/**
+		  * @brief This method opens and maps the file at the specified path using the specified mode.
+		  *
+		  * If a file is already open, it will first be closed before proceeding.  In 'READ_WRITE' mode, the file is created if it does not exist; changes are
+		  * written to the file.  In 'COPY_ON_WRITE' mode, changes are private to this mapping and never reach the file.  An empty file is opened without a
+		  * mapping, and all of its views are empty.
+		  *
+		  * @param source
+		  * 	This is the path of the file to open.
+		  *
+		  * @param targetMode
+		  * 	This is the mapping mode to use.
+		  *
+		  * @exception QMXException
+		  * 	If the specified file could not be opened or mapped.
+		  */
+
+		void open( const Path& source, const Mode targetMode = READ_ONLY );
+
+		/**
+		  * @brief This method unmaps and closes the file.
+		  *
+		  * @exception QMXException
+		  * 	If the file could not be closed because it was not open.
+		  */
+
+		void close();
+
+		/**
+		  * @brief This method determines if a file is open.
+		  *
+		  * @return
+		  * 	A boolean value of 'true' if a file is open, and 'false' otherwise.
+		  */
+
+		bool isOpen() const;
+
+		/**
+		  * @brief This method gets the path of the file.
+		  *
+		  * @return
+		  * 	A non-mutable reference to the path of the file, which is empty if no file is open.
+		  */
+
+		const Path& getPath() const;
+
+		/**
+		  * @brief This method gets the mapping mode.
+		  *
+		  * @return
+		  * 	The mapping mode of the open file.
+		  */
+
+		Mode getMode() const;
+
+		/**
+		  * @brief This method gets the size of the file.
+		  *
+		  * @return
+		  * 	The size of the file in bytes, or zero if no file is open.
+		  */
+
+		size_t getSize() const;
+
+		/**
+		  * @brief This method changes the size of the file and remaps it.
+		  *
+		  * On Linux, the mapping is grown or shrunk in place when possible, so growing a file as it is written costs no copy.  Existing views are invalidated,
+		  * and bytes added to the file are zero.
+		  *
+		  * @param targetSize
+		  * 	This is the new size of the file in bytes.
+		  *
+		  * @exception QMXException
+		  * 	If the file is not open.<br>
+		  * 	If the file is not in 'READ_WRITE' mode.<br>
+		  * 	If the file could not be resized or remapped.
+		  */
+
+		void resize( const size_t targetSize );
+
+		/**
+		  * @brief This method passes the specified access pattern hint for part of the mapping to the operating system.
+		  *
+		  * Hints may need to be given again after 'resize'.
+		  *
+		  * @param advice
+		  * 	This is the access pattern hint.
+		  *
+		  * @param offset
+		  * 	This is the offset of the first byte the hint applies to, which is rounded down to a page boundary.
+		  *
+		  * @param length
+		  * 	This is the number of bytes the hint applies to, which is clamped to the end of the file.
+		  *
+		  * @return
+		  * 	A boolean value of 'true' if the hint was accepted, and 'false' if it is not supported for this mapping.
+		  *
+		  * @exception QMXException
+		  * 	If the file is not open.
+		  */
+
+		bool advise( const Advice advice, const size_t offset = UNSET, const size_t length = std::numeric_limits< size_t >::max() );
+
+		/**
+		  * @brief This method writes changes made through the mapping to the file.
+		  *
+		  * Only 'READ_WRITE' mappings have changes to write; for other modes, this method has no effect.
+		  *
+		  * @param isAsync
+		  * 	This is the boolean flag which determines if the method returns once writing has been scheduled instead of once it has completed.
+		  *
+		  * @exception QMXException
+		  * 	If the file is not open.<br>
+		  * 	If the changes could not be written.
+		  */
+
+		void flush( const bool isAsync = false );
+
+		/**
+		  * @brief This method gets a view of elements of the specified type in the mapping.
+		  *
+		  * Views of non-constant elements are only available in 'COPY_ON_WRITE' and 'READ_WRITE' modes.
+		  *
+		  * @param offset
+		  * 	This is the offset of the first element in bytes, which must be aligned for the element type.
+		  *
+		  * @param count
+		  * 	This is the number of elements; by default, the view extends to the last whole element in the file.
+		  *
+		  * @return
+		  * 	The view.
+		  *
+		  * @exception QMXException
+		  * 	If the file is not open.<br>
+		  * 	If the view would extend past the end of the file, or the offset is misaligned.<br>
+		  * 	If a view of non-constant elements was requested in 'READ_ONLY' mode.
+		  */
+
+		template< typename DType = const char > View< DType > getView( const size_t offset = UNSET, size_t count = std::numeric_limits< size_t >::max() ) const
+		{
+			// Create local variables.
+
+				size_t available = UNSET;
+
+			// Clamp the default count to the rest of the file, then check the range and get its address.
+
+				static_assert( std::is_trivially_copyable_v< DType >, "A mapped file can only be viewed as trivially-copyable elements." );
+
+				if( count == std::numeric_limits< size_t >::max() )
+				{
+					available = getSize();
+					count = ( ( offset < available ) ? ( ( available - offset ) / sizeof( DType ) ) : UNSET );
+				}
+
+			// Return result to calling routine.
+
+				return View< DType >(
+					static_cast< DType* >( getAddress( offset, count, sizeof( DType ), alignof( DType ), !std::is_const_v< DType > ) ),
+					count
+				);
+		}
+
+private:
+
+	// Private Fields
+
+		/**
+		  * @brief This is the file descriptor, or a negative value if no file is open.
+		  */
+
+		int descriptor;
+
+		/**
+		  * @brief This is the address of the mapping, or a null pointer if the file is empty.
+		  */
+
+		char* base;
+
+		/**
+		  * @brief This is the size of the file in bytes.
+		  */
+
+		size_t size;
+
+		/**
+		  * @brief This is the mapping mode.
+		  */
+
+		Mode mode;
+
+		/**
+		  * @brief This is the path of the file.
+		  */
+
+		Path filePath;
+
+	// Private Constructors
+
+		/**
+		  * @brief This is the default constructor, which is made private to prevent direct instantiation.
+		  */
+
+		MappedFile();
+
+	// Private Methods
+
+		/**
+		  * @brief This is the overridden implementation for the 'deallocate' method.
+		  */
+
+		void deallocateImp();
+
+		/**
+		  * @brief This is the overridden implementation for the 'clone' method, which opens the file of 'this' in the same mode.
+		  *
+		  * @param target
+		  * 	This is the object pointer to use when setting.
+		  */
+
+		void cloneImp( InstancePtr& target ) const;
+
+		/**
+		  * @brief This method opens and maps the file at the specified path using the specified mode.
+		  *
+		  * @param source
+		  * 	This is the path of the file to open.
+		  *
+		  * @param targetMode
+		  * 	This is the mapping mode to use.
+		  *
+		  * @exception QMXException
+		  * 	If the specified file could not be opened or mapped.
+		  */
+
+		void openImp( const Path& source, const Mode targetMode );
+
+		/**
+		  * @brief This method unmaps and closes the file.
+		  */
+
+		void closeImp();
+
+		/**
+		  * @brief This method maps the file at its current size.
+		  *
+		  * @return
+		  * 	A boolean value of 'true' if the file was mapped or is empty, and 'false' otherwise.
+		  */
+
+		bool mapImp();
+
+		/**
+		  * @brief This method checks the specified range of the mapping and gets its address.
+		  *
+		  * @param offset
+		  * 	This is the offset of the range in bytes.
+		  *
+		  * @param count
+		  * 	This is the number of elements in the range.
+		  *
+		  * @param elementSize
+		  * 	This is the size of an element in bytes.
+		  *
+		  * @param alignment
+		  * 	This is the alignment of an element in bytes.
+		  *
+		  * @param isMutable
+		  * 	This is the boolean flag which determines if the range will be written through.
+		  *
+		  * @return
+		  * 	The address of the range, or a null pointer if it is empty.
+		  *
+		  * @exception QMXException
+		  * 	If the file is not open.<br>
+		  * 	If the range would extend past the end of the file, or the offset is misaligned.<br>
+		  * 	If a mutable range was requested in 'READ_ONLY' mode.
+		  */
+
+		void* getAddress( const size_t offset, const size_t count, const size_t elementSize, const size_t alignment, const bool isMutable ) const;
+};
+
+} // 'QMXStdLib' Namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of the 'QMXStdLib' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // __QMX_QMXSTDLIB_MAPPEDFILE_HPP_
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of 'MappedFile.hpp'
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
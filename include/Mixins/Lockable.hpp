@@ -1,6 +1,6 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Lockable.hpp
-// Robert M. Baker | Created : 04MAR12 | Last Modified : 27AUG19 by Robert M. Baker
+// Robert M. Baker | Created : 04MAR12 | Last Modified : 16OCT26 by Robert M. Baker
 // Version : 2.3.0
 // This is a header file for 'QMXStdLib'; it defines the interface for a mixin class to enable object locking.
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -21,7 +21,7 @@
   * @file
   * @author  Robert M. Baker
   * @date    Created : 04MAR12
-  * @date    Last Modified : 27AUG19 by Robert M. Baker
+  * @date    Last Modified : 16OCT26 by Robert M. Baker
   * @version 2.3.0
   *
   * @brief This header file defines the interface for a mixin class to enable object locking.
@@ -53,6 +53,7 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "../Base.hpp"
+#include "../Locks.hpp"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Start of the 'QMXStdLib' Namespace
@@ -70,17 +71,22 @@ namespace QMXStdLib
   *
   * @brief This class defines a mixin interface to enable object locking.
   *
-  * This is useful when there is a need for thread-safetey within a class.
+  * This is useful when there is a need for thread-safetey within a class.  The lock policy is chosen at compile time: 'NullLock' performs no locking,
+  * 'SpinLock' is an exclusive (mutex) lock, and 'SharedLock' (the default) is a reader/writer lock.
   *
   * Platform Independent     : Yes<br>
   * Architecture Independent : Yes<br>
   * Thread-Safe              : Yes
   */
 
-class Lockable
+template< typename LType = SharedLock > class Lockable
 {
 public:
 
+	// Public Type Definitions
+
+		typedef LType LockType;
+
 	// Public Constructors
 
 		/**
@@ -106,15 +112,15 @@ public:
 	// Public Methods
 
 		/**
-		  * @brief This method obtains the mutex pair object.
+		  * @brief This method obtains the lock object.
 		  *
 		  * @return
-		  * 	A mutable reference to the mutex pair object.
+		  * 	A mutable reference to the lock object.
 		  */
 
-		SharedMutexPair& getMutex() const
+		LType& getMutex() const
 		{
-			// Return a mutable reference to the mutex object to calling routine.
+			// Return a mutable reference to the lock object to calling routine.
 
 				return localMutex;
 		}
@@ -124,10 +130,10 @@ protected:
 	// Protected Fields
 
 		/**
-		  * @brief This is the mutex pair for use when thread-safety is needed.
+		  * @brief This is the lock for use when thread-safety is needed.
 		  */
 
-		mutable SharedMutexPair localMutex;
+		mutable LType localMutex;
 };
 
 } // 'QMXStdLib' Namespace
@@ -1,6 +1,6 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Numeric.hpp
-// Robert M. Baker | Created : 07JAN12 | Last Modified : 29AUG19 by Robert M. Baker
+// Robert M. Baker | Created : 07JAN12 | Last Modified : 17OCT26 by Robert M. Baker
 // Version : 2.3.0
 // This is a header file for 'QMXStdLib'; it defines the interface for a set of numeric manipulation functions.
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -21,7 +21,7 @@
   * @file
   * @author  Robert M. Baker
   * @date    Created : 27AUG19
-  * @date    Last Modified : 29AUG19 by Robert M. Baker
+  * @date    Last Modified : 17OCT26 by Robert M. Baker
   * @version 2.3.0
   *
   * @brief This header file defines the interface for a set of numeric manipulation functions.
@@ -52,7 +52,12 @@
 // Header Files
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include <charconv>
+#include <string_view>
+#include <type_traits>
+
 #include "Base.hpp"
+#include "Expected.hpp"
 #include "Mixins/Stringizable.hpp"
 #include "RAII/ScopedStackTrace.hpp"
 
@@ -199,11 +204,140 @@ template< typename NType > NType getNextPowerOfTwo( NType value )
 }
 
 /**
-  * @brief This function constructs a string representation of the specified value.
+  * @brief This function converts eight bits into their eight binary digits at once, packed into a 64-bit word in memory order.
+  *
+  * The byte is replicated into every lane of the word, each lane keeps the one bit it represents, and adding '0x7F' to each lane carries that bit up to the
+  * lane's top bit, so no lane ever carries into the next.  This requires a little-endian target.
+  *
+  * @param value
+  * 	This is the byte to convert.
+  *
+  * @return
+  * 	The eight ASCII digits, most significant first in memory.
+  */
+
+inline uint64_t toBinaryDigits( uint8_t value ) noexcept
+{
+	// Create local variables.
+
+		uint64_t result = ( ( value * 0x0101010101010101ULL ) & 0x0102040810204080ULL );
+
+	// Turn each non-zero lane into a '1' and each zero lane into a '0'.
+
+		result = ( ( ( ( result + 0x7F7F7F7F7F7F7F7FULL ) >> 7 ) & 0x0101010101010101ULL ) + 0x3030303030303030ULL );
+
+	// Return result to calling routine.
+
+		return result;
+}
+
+/**
+  * @brief This function converts 32 bits into their eight hexadecimal digits at once, packed into a 64-bit word in memory order.
+  *
+  * The nibbles are spread out one per lane, and a lane holding 10 or more gets the extra offset from '9' to 'A' (or 'a') added.  This requires a
+  * little-endian target.
+  *
+  * @param value
+  * 	This is the value to convert.
+  *
+  * @param useUpperCase
+  * 	This is the flag to determine if hexadecimal letters are upper case.
+  *
+  * @return
+  * 	The eight ASCII digits, most significant first in memory.
+  */
+
+inline uint64_t toHexDigits( uint32_t value, bool useUpperCase ) noexcept
+{
+	// Create local variables.
+
+		uint64_t result = value;
+
+	// Spread the nibbles out one per lane, most significant in the lowest lane.
+
+		result = ( ( ( result & 0xFFFF0000ULL ) << 16 ) | ( result & 0x0000FFFFULL ) );
+		result = ( ( ( result & 0x0000FF000000FF00ULL ) << 8 ) | ( result & 0x000000FF000000FFULL ) );
+		result = ( ( ( result & 0x00F000F000F000F0ULL ) << 4 ) | ( result & 0x000F000F000F000FULL ) );
+		result = __builtin_bswap64( result );
+
+	// Convert each lane to its digit, adding the letter offset to lanes above 9.
+
+		result += ( 0x3030303030303030ULL + ( ( ( ( result + 0x0606060606060606ULL ) >> 4 ) & 0x0101010101010101ULL ) * ( useUpperCase ? 7 : 39 ) ) );
+
+	// Return result to calling routine.
+
+		return result;
+}
+
+/**
+  * @brief This function writes the digits of the specified value in a power-of-two base, which is used by 'toString' for binary, octal, and hexadecimal.
+  *
+  * @param value
+  * 	This is the value to write.
+  *
+  * @param shift
+  * 	This is the number of bits per digit, which must be 1, 3, or 4.
+  *
+  * @param digitCount
+  * 	This is the exact number of digits to write, padding with leading zeros; if it is zero, as few digits as possible are written.
+  *
+  * @param useUpperCase
+  * 	This is the flag to determine if hexadecimal letters are upper case.
+  *
+  * @param target
+  * 	This is the start of the buffer into which the digits are written.
+  *
+  * @param last
+  * 	This is the end of the buffer into which the digits are written.
+  *
+  * @return
+  * 	A result pointing past the last digit written, or holding 'value_too_large' if the buffer is too small.
+  */
+
+inline std::to_chars_result toDigits( uint64_t value, uint32_t shift, size_t digitCount, bool useUpperCase, char* target, char* last ) noexcept
+{
+	// Create local variables.
+
+		const char* digits = ( useUpperCase ? "0123456789ABCDEF" : "0123456789abcdef" );
+		const uint64_t mask = ( ( 1ULL << shift ) - 1 );
+		char* position = nullptr;
+
+	// Count the digits needed, and check that they fit.
+
+		if( !digitCount )
+			digitCount = ( value ? ( ( 64 - __builtin_clzll( value ) + shift - 1 ) / shift ) : 1 );
+
+		if( digitCount > size_t( last - target ) )
+			return { last, std::errc::value_too_large };
+
+	// Write the digits from least to most significant.
+
+		for( position = ( target + digitCount ); position != target; value >>= shift )
+			*( --position ) = digits[ value & mask ];
+
+	// Return result to calling routine.
+
+		return { ( target + digitCount ), std::errc() };
+}
+
+/**
+  * @brief This function constructs a string representation of the specified value in the specified buffer, without allocating or throwing.
+  *
+  * The output is exactly what an 'std::ostringstream' configured from the string format would produce, i.e. what this library's stream-based formatter
+  * used to produce: the prefix comes before any padding, padding goes on the left (before any sign), signed values in octal or hexadecimal are shown as
+  * their two's complement bit pattern, 'int8_t' and 'uint8_t' are characters unless 'charsAsInts' is set, and floating point values are fixed-point with
+  * the given precision in decimal but use the stream default ('%g' with a precision of 6) in octal and hexadecimal.  A buffer of 128 characters is large
+  * enough for any integer or boolean value, and for any floating point value in octal or hexadecimal; fixed-point values and wide padding can need more.
   *
   * @param value
   * 	This is the value to use when constructing the string.
   *
+  * @param target
+  * 	This is the buffer into which the string is written; it is not null-terminated.
+  *
+  * @param targetSize
+  * 	This is the size of the buffer, in characters.
+  *
   * @param base
   * 	This is the numeric base to use when constructing a string format object; if set to none, it will be ignored in favor of 'Format'.
   *
@@ -211,78 +345,350 @@ template< typename NType > NType getNextPowerOfTwo( NType value )
   * 	This is a pointer to a string format object, which must be valid if 'base' is set to none.  If base is none, it will be set to decimal.
   *
   * @return
-  * 	A string representing the specified value.
-  *
-  * @exception QMXException
-  * 	If the base was set to none, but the string format pointer was null.
+  * 	A result holding the number of characters written, or an error if the string format pointer was needed but null, or the buffer is too small.
   */
 
-template< typename NType > std::string toString(
+template< typename NType > Expected< size_t > toString(
 	NType value,
+	char* target,
+	size_t targetSize,
 	Stringizable::NumericBase base = Stringizable::DECIMAL,
 	const Stringizable::StringFormat* targetFormat = nullptr
-)
+) noexcept
 {
-	// Create scoped stack traces.
-
-		SCOPED_STACK_TRACE( "Numeric::toString", 0000 );
-
 	// Create local variables.
 
-		std::ostringstream result;
+		constexpr bool IS_CHAR_SIZED = ( std::is_same< NType, int8_t >::value || std::is_same< NType, uint8_t >::value );
+		constexpr bool IS_WIDE_CHAR = (
+			std::is_same< NType, wchar_t >::value || std::is_same< NType, char16_t >::value || std::is_same< NType, char32_t >::value
+		);
 		Stringizable::StringFormat format;
+		std::string_view prefix;
+		std::string_view word;
+		char* last = ( target + targetSize );
+		char* position = target;
+		std::to_chars_result status = { target, std::errc() };
+		size_t length = 0;
+		size_t padding = 0;
 
-	// Construct a string representation of the specified value.
+	// Select string format.
 
 		if( base != Stringizable::NONE )
 			Stringizable::setStringFormat( format, base );
 		else
 		{
-			QMX_ASSERT( targetFormat, "QMXStdLib", "Numeric::toString", "00000010", value << ", " << base );
+			QMX_EXPECT( targetFormat, "QMXStdLib", "Numeric::toString", "00000010" );
 			format = *targetFormat;
 
 			if( format.base == Stringizable::NONE )
 				format.base = Stringizable::DECIMAL;
 		}
 
-		if( typeid( NType ) == typeid( bool ) )
+	// Write the prefix, if any, since it comes before the padding.
+
+		if constexpr( !std::is_same< NType, bool >::value )
 		{
-			if( format.useYesNo )
-				result << ( value ? "yes" : "no" );
-			else
-				result << std::boolalpha << value;
+			if( format.usePrefix && ( format.base != Stringizable::DECIMAL ) )
+				prefix = ( ( format.base == Stringizable::BINARY ) ? "0b" : ( ( format.base == Stringizable::OCTAL ) ? "0" : "0x" ) );
 		}
-		else
+
+		QMX_EXPECT( ( prefix.size() <= targetSize ), "QMXStdLib", "Numeric::toString", "00000033" );
+		position = std::copy( prefix.begin(), prefix.end(), position );
+
+	// Write the value itself; as with streams, upper case applies to hexadecimal digits and to floating point values which are not fixed-point.
+
+		if constexpr( std::is_same< NType, bool >::value )
 		{
-			if( format.usePrefix && ( format.base != Stringizable::DECIMAL ) )
-				result << ( ( format.base == Stringizable::BINARY ) ? "0b" : ( ( format.base == Stringizable::OCTAL ) ? "0" : "0x" ) );
+			word = ( format.useYesNo ? ( value ? "yes" : "no" ) : ( value ? "true" : "false" ) );
+			status.ec = ( ( word.size() <= targetSize ) ? std::errc() : std::errc::value_too_large );
 
-			result << ( format.useUpperCase ? std::uppercase : std::nouppercase );
+			if( status.ec == std::errc() )
+				status.ptr = std::copy( word.begin(), word.end(), position );
+		}
+		else if( format.base == Stringizable::BINARY )
+			status = toDigits( static_cast< unsigned long long >( value ), 1, ( sizeof( NType ) * 8 ), false, position, last );
+		else if constexpr( std::is_floating_point< NType >::value )
+		{
+			if( format.base == Stringizable::DECIMAL )
+				status = std::to_chars( position, last, value, std::chars_format::fixed, ( ( format.precision < 0 ) ? 6 : format.precision ) );
+			else
+			{
+				status = std::to_chars( position, last, value, std::chars_format::general, 6 );
 
-			if( format.filler )
-				result << std::setfill( format.filler ) << std::setw( format.width );
+				for( char* character = position; format.useUpperCase && ( character < status.ptr ); character++ )
+				{
+					if( ( *character >= 'a' ) && ( *character <= 'z' ) )
+						*character -= ( 'a' - 'A' );
+				}
+			}
+		}
+		else if constexpr( std::is_same< NType, char >::value || IS_CHAR_SIZED )
+		{
+			if( IS_CHAR_SIZED && format.charsAsInts )
+			{
+				if( format.base == Stringizable::DECIMAL )
+					status = std::to_chars( position, last, static_cast< int32_t >( value ) );
+				else
+					status = toDigits(
+						static_cast< uint32_t >( static_cast< int32_t >( value ) ),
+						( ( format.base == Stringizable::OCTAL ) ? 3 : 4 ),
+						0,
+						format.useUpperCase,
+						position,
+						last
+					);
+			}
 			else
-				result << std::setw( 0 );
+			{
+				status = { position, ( ( position < last ) ? std::errc() : std::errc::value_too_large ) };
 
-			if( format.base == Stringizable::DECIMAL )
-				result << std::dec << std::setprecision( format.precision ) << std::fixed;
-			else if( format.base != Stringizable::BINARY )
-				result << ( ( format.base == Stringizable::OCTAL ) ? std::oct : std::hex );
+				if( status.ec == std::errc() )
+					*( status.ptr++ ) = static_cast< char >( value );
+			}
+		}
+		else
+		{
+			using IType = typename std::conditional< IS_WIDE_CHAR, decltype( +value ), NType >::type;
 
-			if( format.base == Stringizable::BINARY )
-				result << std::bitset< ( sizeof( NType ) * 8 ) >( value ).to_string();
+			if( format.base == Stringizable::DECIMAL )
+				status = std::to_chars( position, last, static_cast< IType >( value ) );
 			else
 			{
-				if( format.charsAsInts && ( ( typeid( NType ) == typeid( int8_t ) ) || ( typeid( NType ) == typeid( uint8_t ) ) ) )
-					result << static_cast< int32_t >( value );
-				else
-					result << value;
+				status = toDigits(
+					static_cast< typename std::make_unsigned< IType >::type >( value ),
+					( ( format.base == Stringizable::OCTAL ) ? 3 : 4 ),
+					0,
+					format.useUpperCase,
+					position,
+					last
+				);
 			}
 		}
 
+		QMX_EXPECT( ( status.ec == std::errc() ), "QMXStdLib", "Numeric::toString", "00000033" );
+		length = ( status.ptr - position );
+
+	// Pad the value on the left to the minimum width, if a filler is set; the stream-based formatter never padded boolean values.
+
+		if( !std::is_same< NType, bool >::value && format.filler && ( format.width > 0 ) && ( size_t( format.width ) > length ) )
+		{
+			padding = ( format.width - length );
+
+			QMX_EXPECT( ( padding <= size_t( last - status.ptr ) ), "QMXStdLib", "Numeric::toString", "00000033" );
+			std::memmove( ( position + padding ), position, length );
+			std::fill( position, ( position + padding ), format.filler );
+		}
+
 	// Return result to calling routine.
 
-		return result.str();
+		return ( prefix.size() + padding + length );
+}
+
+/**
+  * @brief This function constructs a string representation of the specified value.
+  *
+  * The string is formatted as described for the buffer variant.
+  *
+  * @param value
+  * 	This is the value to use when constructing the string.
+  *
+  * @param base
+  * 	This is the numeric base to use when constructing a string format object; if set to none, it will be ignored in favor of 'Format'.
+  *
+  * @param targetFormat
+  * 	This is a pointer to a string format object, which must be valid if 'base' is set to none.  If base is none, it will be set to decimal.
+  *
+  * @return
+  * 	A string representing the specified value.
+  *
+  * @exception QMXException
+  * 	If the base was set to none, but the string format pointer was null.
+  */
+
+template< typename NType > std::string toString(
+	NType value,
+	Stringizable::NumericBase base = Stringizable::DECIMAL,
+	const Stringizable::StringFormat* targetFormat = nullptr
+)
+{
+	// Create local variables.
+
+		char buffer[ 128 ];
+		std::string result;
+		Expected< size_t > size = toString( value, buffer, sizeof( buffer ), base, targetFormat );
+
+	// Construct a string representation of the specified value, retrying in a growing string if it did not fit into the stack buffer.
+
+		QMX_ASSERT( ( ( base != Stringizable::NONE ) || targetFormat ), "QMXStdLib", "Numeric::toString", "00000010", value << ", " << base );
+
+		if( size )
+			result.assign( buffer, size.getValue() );
+		else
+		{
+			do
+			{
+				result.resize( result.empty() ? ( sizeof( buffer ) * 4 ) : ( result.size() * 2 ) );
+				size = toString( value, result.data(), result.size(), base, targetFormat );
+			} while( !size );
+
+			result.resize( size.getValue() );
+		}
+
+	// Return result to calling routine.
+
+		return result;
+}
+
+/**
+  * @brief This function appends string representations of every value in the specified array to the specified string, separated by the specified separator.
+  *
+  * Each value is formatted exactly as by 'toString'.  The string is grown once up front rather than once per value.  Binary output, and hexadecimal
+  * output padded with zeros to at least the full width of 'NType' (as with the default hexadecimal format), always have the same length for every value,
+  * so on little-endian targets integers in those formats are converted eight digits at a time straight into place.
+  *
+  * @param source
+  * 	This is the array of values to format.
+  *
+  * @param count
+  * 	This is the number of values to format.
+  *
+  * @param format
+  * 	This is the string format to use; if its base is none, it will be set to decimal.
+  *
+  * @param separator
+  * 	This is the string to place between consecutive values.
+  *
+  * @param target
+  * 	This is the string to which the formatted values are appended.
+  */
+
+template< typename NType > void toStringBatch(
+	const NType* source,
+	size_t count,
+	const Stringizable::StringFormat& format,
+	std::string_view separator,
+	std::string& target
+)
+{
+	// Create local variables.
+
+		constexpr bool IS_WORD = (
+			std::is_integral< NType >::value && ( sizeof( NType ) > 1 ) && !std::is_same< NType, wchar_t >::value && !std::is_same< NType, char16_t >::value &&
+			!std::is_same< NType, char32_t >::value
+		);
+		constexpr size_t DIGIT_COUNT = ( sizeof( NType ) * 2 );
+		constexpr size_t BIT_COUNT = ( sizeof( NType ) * 8 );
+		Stringizable::StringFormat targetFormat = format;
+		std::string_view prefix;
+		size_t start = target.size();
+		size_t position = start;
+		size_t length = 0;
+		size_t padding = 0;
+		bool isHex = false;
+		bool isBinary = false;
+		char* data = nullptr;
+		uint64_t bits = 0;
+		uint64_t digits = 0;
+		Expected< size_t > result = size_t( UNSET );
+
+	// Select string format, and check whether every value will have the same fixed-width binary or hexadecimal form.
+
+		if( targetFormat.base == Stringizable::NONE )
+			targetFormat.base = Stringizable::DECIMAL;
+
+		if( targetFormat.usePrefix && ( targetFormat.base != Stringizable::DECIMAL ) )
+			prefix = ( ( targetFormat.base == Stringizable::BINARY ) ? "0b" : ( ( targetFormat.base == Stringizable::OCTAL ) ? "0" : "0x" ) );
+
+#if( __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ )
+		isBinary = ( IS_WORD && ( targetFormat.base == Stringizable::BINARY ) );
+		isHex = (
+			IS_WORD && ( targetFormat.base == Stringizable::HEXIDECIMAL ) && ( targetFormat.filler == '0' ) && ( targetFormat.width >= int32_t( DIGIT_COUNT ) )
+		);
+#endif // Little-Endian Targets
+
+		if( isBinary )
+			padding = ( ( targetFormat.filler && ( targetFormat.width > int32_t( BIT_COUNT ) ) ) ? ( targetFormat.width - BIT_COUNT ) : 0 );
+		else if( isHex )
+			padding = ( targetFormat.width - DIGIT_COUNT );
+
+	// Write fixed-width values straight into place, eight digits at a time.
+
+		if constexpr( IS_WORD )
+		{
+			if( ( isBinary || isHex ) && count )
+			{
+				length = ( prefix.size() + padding + ( isBinary ? BIT_COUNT : DIGIT_COUNT ) );
+				target.resize( start + ( count * length ) + ( ( count - 1 ) * separator.size() ) );
+				data = target.data();
+
+				for( size_t index = 0; index < count; index++ )
+				{
+					if( index )
+					{
+						std::memcpy( ( data + position ), separator.data(), separator.size() );
+						position += separator.size();
+					}
+
+					std::memcpy( ( data + position ), prefix.data(), prefix.size() );
+					std::memset( ( data + position + prefix.size() ), targetFormat.filler, padding );
+					position += ( prefix.size() + padding );
+					bits = static_cast< uint64_t >( static_cast< typename std::make_unsigned< NType >::type >( source[ index ] ) );
+
+					if( isBinary )
+					{
+						for( size_t shift = BIT_COUNT; shift; shift -= 8, position += 8 )
+						{
+							digits = toBinaryDigits( static_cast< uint8_t >( bits >> ( shift - 8 ) ) );
+							std::memcpy( ( data + position ), &digits, 8 );
+						}
+					}
+					else if( DIGIT_COUNT < 8 )
+					{
+						digits = toHexDigits( static_cast< uint32_t >( bits ), targetFormat.useUpperCase );
+						std::memcpy( ( data + position ), ( reinterpret_cast< char* >( &digits ) + ( 8 - DIGIT_COUNT ) ), DIGIT_COUNT );
+						position += DIGIT_COUNT;
+					}
+					else
+					{
+						for( size_t shift = ( DIGIT_COUNT * 4 ); shift; shift -= 32, position += 8 )
+						{
+							digits = toHexDigits( static_cast< uint32_t >( bits >> ( shift - 32 ) ), targetFormat.useUpperCase );
+							std::memcpy( ( data + position ), &digits, 8 );
+						}
+					}
+				}
+
+				return;
+			}
+		}
+
+	// Otherwise, reserve a generous estimate up front, and format each value into place, growing the string only if the estimate falls short.
+
+		length = ( prefix.size() + std::max< size_t >( std::max( targetFormat.width, 0 ), ( BIT_COUNT + 1 ) ) );
+
+		if( std::is_floating_point< NType >::value && ( targetFormat.base == Stringizable::DECIMAL ) )
+			length += std::max( targetFormat.precision, 0 );
+
+		target.resize( start + ( count * ( length + separator.size() ) ) );
+
+		for( size_t index = 0; index < count; index++ )
+		{
+			if( index )
+			{
+				if( ( target.size() - position ) < separator.size() )
+					target.resize( target.size() * 2 );
+
+				std::memcpy( ( target.data() + position ), separator.data(), separator.size() );
+				position += separator.size();
+			}
+
+			while( !( result = toString( source[ index ], ( target.data() + position ), ( target.size() - position ), Stringizable::NONE, &targetFormat ) ) )
+				target.resize( std::max( ( target.size() * 2 ), ( position + 64 ) ) );
+
+			position += result.getValue();
+		}
+
+		target.resize( position );
 }
 
 } // 'Numeric' Namespace
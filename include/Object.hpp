@@ -1,6 +1,6 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Object.hpp
-// Robert M. Baker | Created : 05JAN12 | Last Modified : 29AUG19 by Robert M. Baker
+// Robert M. Baker | Created : 05JAN12 | Last Modified : 16OCT26 by Robert M. Baker
 // Version : 2.3.0
 // This is a header file for 'QMXStdLib'; it defines the interface for a generic base class.
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -21,7 +21,7 @@
   * @file
   * @author  Robert M. Baker
   * @date    Created : 05JAN12
-  * @date    Last Modified : 29AUG19 by Robert M. Baker
+  * @date    Last Modified : 16OCT26 by Robert M. Baker
   * @version 2.3.0
   *
   * @brief This header file defines the interface for a generic base class.
@@ -53,6 +53,7 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "Base.hpp"
+#include "ObjectPool.hpp"
 #include "Mixins/Lockable.hpp"
 #include "RAII/ScopedLock.hpp"
 #include "RAII/ScopedStackTrace.hpp"
@@ -85,14 +86,16 @@ struct NoPublicProperties
   *
   * @brief This class defines base algorithms for all classes.
   *
-  * The purpose of this generic base-class is to encapsulate functionality useful to all sub-classes.
+  * The purpose of this generic base-class is to encapsulate functionality useful to all sub-classes.  The lock policy ('NullLock', 'SpinLock', or
+  * 'SharedLock') is specified by 'LType'.  Instances and their reference counts are created with a single allocation drawn from a per-class
+  * 'ObjectPool'.
   *
   * Platform Independent     : Yes<br>
   * Architecture Independent : Yes<br>
   * Thread-Safe              : Yes
   */
 
-template< typename DType, typename PPType = NoPublicProperties > class Object : public Lockable
+template< typename DType, typename PPType = NoPublicProperties, typename LType = SharedLock > class Object : public Lockable< LType >
 {
 public:
 
@@ -233,7 +236,7 @@ public:
 
 			// Create local variables.
 
-				InstancePtr result( ( new DType() ) );
+				InstancePtr result = std::allocate_shared< DType >( PoolAllocator< DType >() );
 
 			// Initialize new instance, if 'doAllocate' is 'true'.
 
@@ -245,6 +248,34 @@ public:
 				return result;
 		}
 
+		/**
+		  * @brief This method enables or disables the object pool from which 'create' draws instances of this class.
+		  *
+		  * @param value
+		  * 	This is a boolean value which determines if the object pool is enabled.
+		  */
+
+		static void setPoolEnabled( const bool value )
+		{
+			// Set object pool enabled flag to specified value.
+
+				ObjectPool< DType >::setEnabled( value );
+		}
+
+		/**
+		  * @brief This method gets the statistics of the object pool from which 'create' draws instances of this class.
+		  *
+		  * @return
+		  * 	The object pool statistics.
+		  */
+
+		static ObjectPoolStatistics getPoolStatistics()
+		{
+			// Return object pool statistics to calling routine.
+
+				return ObjectPool< DType >::getStatistics();
+		}
+
 		/**
 		  * @brief This method assigns the data of 'this' to the specified object.
 		  *
@@ -275,6 +306,10 @@ public:
 
 protected:
 
+	// Friend Classes
+
+		template< typename VType, typename TagType > friend class PoolAllocator;
+
 	// Protected Fields
 
 		/**
@@ -302,6 +337,20 @@ protected:
 				initialized = false;
 		}
 
+		/**
+		  * @brief This method constructs an instance of this class in place, which allows 'PoolAllocator' to reach the private default constructor.
+		  *
+		  * @param target
+		  * 	This is a pointer to the storage to construct the instance in.
+		  */
+
+		static void constructInstance( DType* target )
+		{
+			// Construct instance.
+
+				::new( static_cast< void* >( target ) ) DType();
+		}
+
 private:
 
 	// Private Methods
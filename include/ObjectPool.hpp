@@ -0,0 +1,707 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// ObjectPool.hpp
+// Robert M. Baker | Created : 16OCT26 | Last Modified : 16OCT26 by Robert M. Baker
+// Version : 2.3.0
+// This is a header file for 'QMXStdLib'; it defines the interface for a thread-caching object pool and its allocator.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+//
+// This file is part of 'QMXStdLib'.
+//
+// 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option) any later version.
+//
+// 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+  * @file
+  * @author  Robert M. Baker
+  * @date    Created : 16OCT26
+  * @date    Last Modified : 16OCT26 by Robert M. Baker
+  * @version 2.3.0
+  *
+  * @brief This header file defines the interface for a thread-caching object pool and its allocator.
+  *
+  * @section ObjectPoolH0000 Description
+  *
+  * This header file defines the interface for a thread-caching object pool and its allocator.
+  *
+  * @section ObjectPoolH0001 License
+  *
+  * Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+  *
+  * This file is part of 'QMXStdLib'.
+  *
+  * 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+  * Software Foundation, either version 3 of the License, or (at your option) any later version.
+  *
+  * 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+  * A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+  *
+  * You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+  */
+
+#ifndef __QMX_QMXSTDLIB_OBJECTPOOL_HPP_
+#define __QMX_QMXSTDLIB_OBJECTPOOL_HPP_
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Header Files
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <atomic>
+#include <new>
+#include <type_traits>
+
+#include "Base.hpp"
+#include "Locks/SpinLock.hpp"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Start of the 'QMXStdLib' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace QMXStdLib
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// The 'ObjectPoolStatistics' Structure
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+  * @brief This structure holds the statistics for an 'ObjectPool'.
+  */
+
+struct ObjectPoolStatistics
+{
+public:
+
+	// Public Fields
+
+		/**
+		  * @brief This is the number of allocations served from a free list.
+		  */
+
+		size_t hitCount;
+
+		/**
+		  * @brief This is the number of allocations which had to fall through to the heap.
+		  */
+
+		size_t missCount;
+
+		/**
+		  * @brief This is the number of free blocks held in the shared free list.
+		  */
+
+		size_t sharedCount;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// The 'ObjectPool' Class
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+  * @class ObjectPool ObjectPool.hpp "include/ObjectPool.hpp"
+  *
+  * @brief This class defines a fixed-size block pool for each tag type.
+  *
+  * Every thread keeps its own free list, so steady-state allocation and release never touch the heap or a lock.  When a thread's free list runs dry it
+  * takes a batch from a shared free list, and when it grows past 'OBJECTPOOL_CACHE_SIZE' it returns a batch; both exchanges take a 'SpinLock'.  The block
+  * size is fixed by the first request, and requests of any other size or of extended alignment bypass the pool.  Statistics are counted per thread and
+  * published whenever a thread exchanges blocks with the shared list or exits, so counts from other threads may lag behind.
+  *
+  * Platform Independent     : Yes<br>
+  * Architecture Independent : Yes<br>
+  * Thread-Safe              : Yes
+  */
+
+template< typename TagType > class ObjectPool
+{
+public:
+
+	// Public Methods
+
+		/**
+		  * @brief This method allocates a block of memory.
+		  *
+		  * @param size
+		  * 	This is the size of the block, in bytes.
+		  *
+		  * @param alignment
+		  * 	This is the required alignment of the block, in bytes.
+		  *
+		  * @return
+		  * 	A pointer to the allocated block.
+		  */
+
+		static void* allocate( const size_t size, const size_t alignment )
+		{
+			// Create local variables.
+
+				FreeNode* result = nullptr;
+
+			// Bypass the pool, if necessary.
+
+				if( !isEnabled.load( std::memory_order_relaxed ) || !isPoolable( size, alignment ) )
+					return allocateBlock( size, alignment );
+
+			// Take a block from this thread's free list, refilling it from the shared free list if it is empty.
+
+				if( !localCache.head )
+					refill();
+
+				if( localCache.head )
+				{
+					result = localCache.head;
+					localCache.head = result->next;
+					localCache.count--;
+					localCache.hitCount++;
+
+					return result;
+				}
+
+			// Return a new block to calling routine.
+
+				localCache.missCount++;
+
+				return allocateBlock( size, alignment );
+		}
+
+		/**
+		  * @brief This method releases a block of memory which was allocated with 'allocate'.
+		  *
+		  * @param target
+		  * 	This is a pointer to the block to release.
+		  *
+		  * @param size
+		  * 	This is the size of the block, in bytes.
+		  *
+		  * @param alignment
+		  * 	This is the required alignment of the block, in bytes.
+		  */
+
+		static void deallocate( void* target, const size_t size, const size_t alignment ) noexcept
+		{
+			// Create local variables.
+
+				FreeNode* node = static_cast< FreeNode* >( target );
+
+			// Bypass the pool, if necessary.
+
+				if( !isEnabled.load( std::memory_order_relaxed ) || !isPoolable( size, alignment ) )
+				{
+					deallocateBlock( target, size, alignment );
+
+					return;
+				}
+
+			// Return block to the shared free list if this thread has already exited, or to this thread's free list otherwise.
+
+				if( localCache.isExited )
+				{
+					GlobalList& globalList = getGlobalList();
+					std::lock_guard< SpinLock > globalLock( globalList.lock );
+
+					node->next = globalList.head;
+					globalList.head = node;
+					globalList.count++;
+
+					return;
+				}
+
+				if( !localCache.head )
+					localFlusher.isArmed = true;
+
+				node->next = localCache.head;
+				localCache.head = node;
+				localCache.count++;
+
+				if( localCache.count > OBJECTPOOL_CACHE_SIZE )
+					spill( OBJECTPOOL_BATCH_SIZE );
+		}
+
+		/**
+		  * @brief This method enables or disables the pool; while disabled, all requests go directly to the heap.
+		  *
+		  * @param value
+		  * 	This is a boolean value which determines if the pool is enabled.
+		  */
+
+		static void setEnabled( const bool value )
+		{
+			// Set enabled flag to specified value.
+
+				isEnabled.store( value, std::memory_order_relaxed );
+		}
+
+		/**
+		  * @brief This method gets the pool statistics, including the unpublished counts of the calling thread.
+		  *
+		  * @return
+		  * 	The pool statistics.
+		  */
+
+		static ObjectPoolStatistics getStatistics()
+		{
+			// Create local variables.
+
+				GlobalList& globalList = getGlobalList();
+				std::lock_guard< SpinLock > globalLock( globalList.lock );
+
+			// Return pool statistics to calling routine.
+
+				return {
+					( globalList.hitCount + localCache.hitCount ),
+					( globalList.missCount + localCache.missCount ),
+					globalList.count
+				};
+		}
+
+		/**
+		  * @brief This method releases every block held in the shared free list back to the heap.
+		  */
+
+		static void trim()
+		{
+			// Create local variables.
+
+				GlobalList& globalList = getGlobalList();
+				std::lock_guard< SpinLock > globalLock( globalList.lock );
+				FreeNode* node = nullptr;
+
+			// Release all shared blocks.
+
+				while( globalList.head )
+				{
+					node = globalList.head;
+					globalList.head = node->next;
+					deallocateBlock( node, blockSize.load( std::memory_order_relaxed ), alignof( FreeNode ) );
+				}
+
+				globalList.count = 0;
+		}
+
+private:
+
+	// Private Data Types
+
+		/**
+		  * @brief This structure overlays a free block, linking it into a free list.
+		  */
+
+		struct FreeNode
+		{
+			FreeNode* next;
+		};
+
+		/**
+		  * @brief This structure holds a thread's free list; it is trivially destructible, so it remains usable after 'localFlusher' runs.
+		  */
+
+		struct LocalCache
+		{
+			FreeNode* head;
+			size_t count;
+			size_t hitCount;
+			size_t missCount;
+			bool isExited;
+		};
+
+		/**
+		  * @brief This structure returns a thread's free list to the shared free list when the thread exits.
+		  */
+
+		struct LocalFlusher
+		{
+			bool isArmed = false;
+
+			~LocalFlusher()
+			{
+				spill( localCache.count );
+				localCache.isExited = true;
+			}
+		};
+
+		/**
+		  * @brief This structure holds the shared free list and the published statistics.
+		  */
+
+		struct GlobalList
+		{
+			SpinLock lock;
+			FreeNode* head = nullptr;
+			size_t count = 0;
+			size_t hitCount = 0;
+			size_t missCount = 0;
+		};
+
+	// Private Fields
+
+		/**
+		  * @brief This is the flag which determines if the pool is enabled.
+		  */
+
+		inline static std::atomic< bool > isEnabled = true;
+
+		/**
+		  * @brief This is the block size served by the pool, which is fixed by the first request.
+		  */
+
+		inline static std::atomic< size_t > blockSize = 0;
+
+		/**
+		  * @brief This is the calling thread's free list.
+		  */
+
+		inline static thread_local LocalCache localCache = { nullptr, 0, 0, 0, false };
+
+		/**
+		  * @brief This is the calling thread's flusher, which is armed whenever its free list becomes non-empty.
+		  */
+
+		inline static thread_local LocalFlusher localFlusher;
+
+	// Private Methods
+
+		/**
+		  * @brief This method gets the shared free list, which is deliberately never destroyed so that blocks may be released during static destruction.
+		  *
+		  * @return
+		  * 	A reference to the shared free list.
+		  */
+
+		static GlobalList& getGlobalList()
+		{
+			// Create local variables.
+
+				static GlobalList* globalList = new GlobalList();
+
+			// Return shared free list to calling routine.
+
+				return *globalList;
+		}
+
+		/**
+		  * @brief This method determines if a request can be served by the pool, fixing the block size if this is the first request.
+		  *
+		  * @param size
+		  * 	This is the size of the block, in bytes.
+		  *
+		  * @param alignment
+		  * 	This is the required alignment of the block, in bytes.
+		  *
+		  * @return
+		  * 	A boolean value of 'true' if the request can be served by the pool, and 'false' otherwise.
+		  */
+
+		static bool isPoolable( const size_t size, const size_t alignment )
+		{
+			// Create local variables.
+
+				size_t expected = 0;
+
+			// Report whether or not the request can be served by the pool to calling routine.
+
+				if( ( alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__ ) || ( size < sizeof( FreeNode ) ) )
+					return false;
+				else if( blockSize.load( std::memory_order_relaxed ) == size )
+					return true;
+
+				return( blockSize.compare_exchange_strong( expected, size, std::memory_order_relaxed ) || ( expected == size ) );
+		}
+
+		/**
+		  * @brief This method moves a batch of blocks from the shared free list to this thread's free list, publishing this thread's statistics.
+		  */
+
+		static void refill()
+		{
+			// Create local variables.
+
+				GlobalList& globalList = getGlobalList();
+				std::lock_guard< SpinLock > globalLock( globalList.lock );
+				FreeNode* node = nullptr;
+
+			// Arm this thread's flusher and publish its statistics.
+
+				localFlusher.isArmed = true;
+				publish( globalList );
+
+			// Move up to 'OBJECTPOOL_BATCH_SIZE' blocks.
+
+				for( size_t index = 0; ( ( index < OBJECTPOOL_BATCH_SIZE ) && globalList.head ); index++ )
+				{
+					node = globalList.head;
+					globalList.head = node->next;
+					globalList.count--;
+					node->next = localCache.head;
+					localCache.head = node;
+					localCache.count++;
+				}
+		}
+
+		/**
+		  * @brief This method moves blocks from this thread's free list to the shared free list, publishing this thread's statistics.
+		  *
+		  * @param count
+		  * 	This is the maximum number of blocks to move.
+		  */
+
+		static void spill( const size_t count ) noexcept
+		{
+			// Create local variables.
+
+				GlobalList& globalList = getGlobalList();
+				std::lock_guard< SpinLock > globalLock( globalList.lock );
+				FreeNode* node = nullptr;
+
+			// Publish this thread's statistics.
+
+				publish( globalList );
+
+			// Move up to 'count' blocks.
+
+				for( size_t index = 0; ( ( index < count ) && localCache.head ); index++ )
+				{
+					node = localCache.head;
+					localCache.head = node->next;
+					localCache.count--;
+					node->next = globalList.head;
+					globalList.head = node;
+					globalList.count++;
+				}
+		}
+
+		/**
+		  * @brief This method adds this thread's statistics to the published statistics; the shared list lock must be held.
+		  *
+		  * @param globalList
+		  * 	This is the shared free list.
+		  */
+
+		static void publish( GlobalList& globalList ) noexcept
+		{
+			// Move this thread's counts into the published counts.
+
+				globalList.hitCount += localCache.hitCount;
+				globalList.missCount += localCache.missCount;
+				localCache.hitCount = 0;
+				localCache.missCount = 0;
+		}
+
+		/**
+		  * @brief This method allocates a block directly from the heap.
+		  *
+		  * @param size
+		  * 	This is the size of the block, in bytes.
+		  *
+		  * @param alignment
+		  * 	This is the required alignment of the block, in bytes.
+		  *
+		  * @return
+		  * 	A pointer to the allocated block.
+		  */
+
+		static void* allocateBlock( const size_t size, const size_t alignment )
+		{
+			// Return allocated block to calling routine.
+
+				if( alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__ )
+					return ::operator new( size, std::align_val_t( alignment ) );
+
+				return ::operator new( size );
+		}
+
+		/**
+		  * @brief This method releases a block directly to the heap.
+		  *
+		  * @param target
+		  * 	This is a pointer to the block to release.
+		  *
+		  * @param size
+		  * 	This is the size of the block, in bytes.
+		  *
+		  * @param alignment
+		  * 	This is the required alignment of the block, in bytes.
+		  */
+
+		static void deallocateBlock( void* target, const size_t size, const size_t alignment ) noexcept
+		{
+			// Release block.
+
+				if( alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__ )
+					::operator delete( target, size, std::align_val_t( alignment ) );
+				else
+					::operator delete( target, size );
+		}
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// The 'PoolAllocator' Class
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+  * @class PoolAllocator ObjectPool.hpp "include/ObjectPool.hpp"
+  *
+  * @brief This class defines a standard allocator which draws from the 'ObjectPool' of 'TagType'.
+  *
+  * Rebinding preserves 'TagType', so the control block created by 'std::allocate_shared' is drawn from the same pool.  Values which cannot be constructed
+  * directly (such as 'Object' sub-classes with private constructors) are constructed through 'TagType::constructInstance'.
+  *
+  * Platform Independent     : Yes<br>
+  * Architecture Independent : Yes<br>
+  * Thread-Safe              : Yes
+  */
+
+template< typename VType, typename TagType = VType > class PoolAllocator
+{
+public:
+
+	// Public Type Definitions
+
+		typedef VType value_type;
+
+	// Public Constructors
+
+		/**
+		  * @brief This is the default constructor.
+		  */
+
+		PoolAllocator() noexcept
+		{
+			// Do nothing.
+		}
+
+		/**
+		  * @brief This is the rebinding copy constructor.
+		  *
+		  * @param instance
+		  * 	N/A
+		  */
+
+		template< typename UType > PoolAllocator( const PoolAllocator< UType, TagType >& instance ) noexcept
+		{
+			// Do nothing.
+		}
+
+	// Public Methods
+
+		/**
+		  * @brief This method allocates storage for the specified number of values.
+		  *
+		  * @param count
+		  * 	This is the number of values to allocate storage for.
+		  *
+		  * @return
+		  * 	A pointer to the allocated storage.
+		  */
+
+		VType* allocate( const size_t count )
+		{
+			// Return allocated storage to calling routine.
+
+				return static_cast< VType* >( ObjectPool< TagType >::allocate( ( sizeof( VType ) * count ), alignof( VType ) ) );
+		}
+
+		/**
+		  * @brief This method releases storage which was allocated with 'allocate'.
+		  *
+		  * @param target
+		  * 	This is a pointer to the storage to release.
+		  *
+		  * @param count
+		  * 	This is the number of values the storage was allocated for.
+		  */
+
+		void deallocate( VType* target, const size_t count ) noexcept
+		{
+			// Release storage.
+
+				ObjectPool< TagType >::deallocate( target, ( sizeof( VType ) * count ), alignof( VType ) );
+		}
+
+		/**
+		  * @brief This method constructs a value in place.
+		  *
+		  * @param target
+		  * 	This is a pointer to the storage to construct the value in.
+		  *
+		  * @param arguments
+		  * 	These are the arguments to forward to the constructor.
+		  */
+
+		template< typename UType, typename... ATypes > void construct( UType* target, ATypes&&... arguments )
+		{
+			// Construct value, deferring to 'TagType' for instances of itself which cannot be constructed directly.
+
+				if constexpr( std::is_constructible< UType, ATypes... >::value )
+					::new( static_cast< void* >( target ) ) UType( std::forward< ATypes >( arguments )... );
+				else
+					TagType::constructInstance( target );
+		}
+
+		/**
+		  * @brief This method destroys a value in place.
+		  *
+		  * @param target
+		  * 	This is a pointer to the value to destroy.
+		  */
+
+		template< typename UType > void destroy( UType* target )
+		{
+			// Destroy value.
+
+				target->~UType();
+		}
+
+	// Public Overloaded Operators
+
+		/**
+		  * @brief This is the overloaded equality operator; all pool allocators of the same tag are interchangeable.
+		  *
+		  * @param instance
+		  * 	N/A
+		  *
+		  * @return
+		  * 	A boolean value of 'true'.
+		  */
+
+		template< typename UType > bool operator==( const PoolAllocator< UType, TagType >& instance ) const noexcept
+		{
+			// Report equality to calling routine.
+
+				return true;
+		}
+
+		/**
+		  * @brief This is the overloaded inequality operator; all pool allocators of the same tag are interchangeable.
+		  *
+		  * @param instance
+		  * 	N/A
+		  *
+		  * @return
+		  * 	A boolean value of 'false'.
+		  */
+
+		template< typename UType > bool operator!=( const PoolAllocator< UType, TagType >& instance ) const noexcept
+		{
+			// Report inequality to calling routine.
+
+				return false;
+		}
+};
+
+} // 'QMXStdLib' Namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of the 'QMXStdLib' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // __QMX_QMXSTDLIB_OBJECTPOOL_HPP_
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of 'ObjectPool.hpp'
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1,6 +1,6 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // ProgramOptions.hpp
-// Robert M. Baker | Created : 23OCT13 | Last Modified : 09SEP19 by Robert M. Baker
+// Robert M. Baker | Created : 23OCT13 | Last Modified : 17OCT26 by Robert M. Baker
 // Version : 2.3.0
 // This is a header file for 'QMXStdLib'; it defines the interface for a program options class.
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -21,7 +21,7 @@
   * @file
   * @author  Robert M. Baker
   * @date    Created : 23OCT13
-  * @date    Last Modified : 09SEP19 by Robert M. Baker
+  * @date    Last Modified : 17OCT26 by Robert M. Baker
   * @version 2.3.0
   *
   * @brief This header file defines the interface for a program options class.
@@ -53,6 +53,7 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "Base.hpp"
+#include "Expected.hpp"
 #include "Object.hpp"
 #include "FileSystem.hpp"
 #include "Mixins/Singleton.hpp"
@@ -150,6 +151,20 @@ public:
 
 		void parseConfigFile( const Path& configPath );
 
+		/**
+		  * @brief This method parses the specified config file without throwing if it could not be opened.
+		  *
+		  * Refer to the 'parseConfigFile' method for more information on the config file format.
+		  *
+		  * @param configPath
+		  * 	This is the config file path to be parsed.
+		  *
+		  * @return
+		  * 	A successful result if the config file was parsed, or the error 'parseConfigFile' would have thrown.
+		  */
+
+		Expected< void > tryParseConfigFile( const Path& configPath );
+
 		/**
 		  * @brief This method saves the current config options to the specified file.
 		  *
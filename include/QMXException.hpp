@@ -1,6 +1,6 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // QMXException.hpp
-// Robert M. Baker | Created : 28FEB12 | Last Modified : 29AUG19 by Robert M. Baker
+// Robert M. Baker | Created : 28FEB12 | Last Modified : 17OCT26 by Robert M. Baker
 // Version : 2.3.0
 // This is a header file for 'QMXStdLib'; it defines the interface for an exception class.
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -21,7 +21,7 @@
   * @file
   * @author  Robert M. Baker
   * @date    Created : 28FEB12
-  * @date    Last Modified : 29AUG19 by Robert M. Baker
+  * @date    Last Modified : 17OCT26 by Robert M. Baker
   * @version 2.3.0
   *
   * @brief This header file defines the interface for an exception class.
@@ -55,6 +55,9 @@
 #include <cstdio>
 #include <cstring>
 #include <exception>
+#include <memory>
+#include <mutex>
+#include <ostream>
 
 #include "Base.hpp"
 
@@ -63,15 +66,15 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #define QMX_THROW(w,x,y,z)         SINGLE_STATEMENT(\
-                                     std::ostringstream eventDataBuffer;\
-                                     eventDataBuffer << z;\
-                                     throw QMXStdLib::QMXException( w, x, y, eventDataBuffer.str().c_str(), STACK_TRACE.c_str() );\
+                                     QMXStdLib::EventDataBuffer eventDataBuffer;\
+                                     eventDataBuffer.getStream() << z;\
+                                     throw QMXStdLib::QMXException( w, x, y, eventDataBuffer.getData(), STACK_TRACE.c_str() );\
                                    )
 
 #define QMX_THROW_X(w,x,y,z)       SINGLE_STATEMENT(\
-                                     std::ostringstream eventDataBuffer;\
-                                     eventDataBuffer << z;\
-                                     throw QMXStdLib::QMXException( w, x, y, eventDataBuffer.str().c_str() );\
+                                     QMXStdLib::EventDataBuffer eventDataBuffer;\
+                                     eventDataBuffer.getStream() << z;\
+                                     throw QMXStdLib::QMXException( w, x, y, eventDataBuffer.getData() );\
                                    )
 
 #define QMX_ASSERT(v,w,x,y,z)      SINGLE_STATEMENT( if( !v ) QMX_THROW( w, x, y, z ); )
@@ -86,6 +89,106 @@
 namespace QMXStdLib
 {
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// The 'EventDataBuffer' Class
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+  * @class EventDataBuffer QMXException.hpp "include/QMXException.hpp"
+  *
+  * @brief This class defines a reusable buffer for formatting exception event data.
+  *
+  * Each thread owns one stream which is reused by every throw, so formatting event data does not construct a new 'std::ostringstream'.  If the buffer is
+  * already in use further up the calling thread's stack (i.e. event data formatting itself throws), a private stream is used instead.  The stream's
+  * formatting state is restored when the buffer is released.
+  *
+  * Platform Independent     : Yes<br>
+  * Architecture Independent : Yes<br>
+  * Thread-Safe              : Yes
+  */
+
+class EventDataBuffer
+{
+public:
+
+	// Public Constructors
+
+		/**
+		  * @brief This is the default constructor, which claims the calling thread's stream.
+		  */
+
+		EventDataBuffer();
+
+		/**
+		  * @brief This is the copy constructor, which is deleted to prevent copying.
+		  *
+		  * @param instance
+		  * 	N/A
+		  */
+
+		EventDataBuffer( const EventDataBuffer& instance ) = delete;
+
+	// Destructor
+
+		/**
+		  * @brief This is the destructor, which releases the calling thread's stream.
+		  */
+
+		~EventDataBuffer();
+
+	// Public Methods
+
+		/**
+		  * @brief This method gets the stream to format event data with.
+		  *
+		  * @return
+		  * 	A reference to the stream.
+		  */
+
+		std::ostream& getStream();
+
+		/**
+		  * @brief This method gets the formatted event data.
+		  *
+		  * @return
+		  * 	A string containing the formatted event data, which remains valid until this buffer is destroyed.
+		  */
+
+		const char* getData();
+
+private:
+
+	// Private Data Types
+
+		/**
+		  * @brief This structure holds a formatting stream and its string buffer.
+		  */
+
+		struct Record;
+
+	// Private Fields
+
+		/**
+		  * @brief This is the record in use by this buffer.
+		  */
+
+		Record* record;
+
+		/**
+		  * @brief This is the private record used when the calling thread's record is already in use.
+		  */
+
+		std::unique_ptr< Record > privateRecord;
+
+	// Private Static Fields
+
+		/**
+		  * @brief This is the calling thread's record.
+		  */
+
+		static thread_local Record localRecord;
+};
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // The 'QMXException' Class
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -95,7 +198,9 @@ namespace QMXStdLib
   *
   * @brief This class defines exception handling algorithms.
   *
-  * These algorithms are useful when it is necessary to collect and report data concerning run-time exceptions.
+  * These algorithms are useful when it is necessary to collect and report data concerning run-time exceptions.  All exception data lives in a single
+  * immutable payload which is shared by every copy, so copying during stack unwinding only adjusts a reference count.  The message and the string returned
+  * by 'what' are formatted once, on first use.
   *
   * Platform Independent     : Yes<br>
   * Architecture Independent : Yes<br>
@@ -216,49 +321,29 @@ public:
 
 private:
 
-	// Private Fields
+	// Private Data Types
 
 		/**
-		  * @brief This is the root ID of the exception.
+		  * @brief This structure holds the immutable exception data shared by all copies of an exception.
 		  */
 
-		char rootID[ MAX_BUFFER_SIZE ];
+		struct Payload;
 
-		/**
-		  * @brief This is the module ID in which the exception occurred.
-		  */
-
-		char moduleID[ MAX_BUFFER_SIZE ];
-
-		/**
-		  * @brief This is the event index of the exception.
-		  */
-
-		char eventIndex[ MAX_BUFFER_SIZE ];
-
-		/**
-		  * @brief This is the event data for the exception.
-		  */
-
-		char eventData[ MAX_BUFFER_SIZE ];
+	// Private Fields
 
 		/**
-		  * @brief This is the stack trace of the exception.
+		  * @brief This is the exception payload.
 		  */
 
-		char stackTrace[ MAX_BUFFER_SIZE ];
-
-		/**
-		  * @brief This is the unlocalized message for the exception.
-		  */
+		std::shared_ptr< const Payload > payload;
 
-		char message[ ( MAX_BUFFER_SIZE * 3 ) ];
+	// Private Methods
 
 		/**
-		  * @brief This is a buffer used to format the string representing the nature of the exception.
+		  * @brief This method formats the message and the string representing the nature of the exception, if they have not already been formatted.
 		  */
 
-		char buffer[ ( MAX_BUFFER_SIZE * 9 ) ];
+		void format() const;
 };
 
 } // 'QMXStdLib' Namespace
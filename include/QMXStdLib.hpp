@@ -1,6 +1,6 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // QMXStdLib.hpp
-// Robert M. Baker | Created : 10DEC11 | Last Modified : 27AUG19 by Robert M. Baker
+// Robert M. Baker | Created : 10DEC11 | Last Modified : 17OCT26 by Robert M. Baker
 // Version : 2.3.0
 // This is the main header file for 'QMXStdLib'; it is for users of the library as a convenient way to include all headers.
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -21,7 +21,7 @@
   * @file
   * @author  Robert M. Baker
   * @date    Created : 10DEC11
-  * @date    Last Modified : 27AUG19 by Robert M. Baker
+  * @date    Last Modified : 17OCT26 by Robert M. Baker
   * @version 2.3.0
   *
   * @brief This is the main header file for 'QMXStdLib' which includes all the other necessary headers.
@@ -63,22 +63,30 @@
 // Header Files
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include "AtomicSequencer.hpp"
 #include "Base.hpp"
 #include "ConsoleIO.hpp"
 #include "DynamicLibrary.hpp"
+#include "Expected.hpp"
 #include "FileSystem.hpp"
 #include "Iterators.hpp"
+#include "LatencyRecorder.hpp"
+#include "Locks.hpp"
+#include "MappedFile.hpp"
 #include "Mixins.hpp"
 #include "Numeric.hpp"
 #include "Object.hpp"
+#include "ObjectPool.hpp"
 #include "ProgramOptions.hpp"
 #include "QMXException.hpp"
 #include "RAII.hpp"
 #include "Sequencer.hpp"
 #include "StackTracer.hpp"
 #include "String.hpp"
+#include "TaskPool.hpp"
 #include "ThreadManager.hpp"
 #include "Timer.hpp"
+#include "TraceLog.hpp"
 #include "UniqueRandom.hpp"
 #include "Utility.hpp"
 
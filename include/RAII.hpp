@@ -1,6 +1,6 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // RAII.hpp
-// Robert M. Baker | Created : 04MAR12 | Last Modified : 28AUG19 by Robert M. Baker
+// Robert M. Baker | Created : 04MAR12 | Last Modified : 17OCT26 by Robert M. Baker
 // Version : 2.3.0
 // This is a header file for 'QMXStdLib'; it includes the various RAII classes.
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -21,7 +21,7 @@
   * @file
   * @author  Robert M. Baker
   * @date    Created : 04MAR12
-  * @date    Last Modified : 28AUG19 by Robert M. Baker
+  * @date    Last Modified : 17OCT26 by Robert M. Baker
   * @version 2.3.0
   *
   * @brief This header file includes the various RAII classes.
@@ -52,6 +52,7 @@
 // Header Files
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include "RAII/ScopedLatency.hpp"
 #include "RAII/ScopedLock.hpp"
 #include "RAII/ScopedStackTrace.hpp"
 
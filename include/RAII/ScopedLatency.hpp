@@ -0,0 +1,170 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// ScopedLatency.hpp
+// Robert M. Baker | Created : 17OCT26 | Last Modified : 17OCT26 by Robert M. Baker
+// Version : 2.3.0
+// This is a header file for 'QMXStdLib'; it defines the interface for an RAII class to time a scope into a latency recorder.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+//
+// This file is part of 'QMXStdLib'.
+//
+// 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option) any later version.
+//
+// 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+  * @file
+  * @author  Robert M. Baker
+  * @date    Created : 17OCT26
+  * @date    Last Modified : 17OCT26 by Robert M. Baker
+  * @version 2.3.0
+  *
+  * @brief This header file defines the interface for an RAII class to time a scope into a latency recorder.
+  *
+  * @section ScopedLatencyH0000 Description
+  *
+  * This header file defines the interface for an RAII class to time a scope into a latency recorder.
+  *
+  * @section ScopedLatencyH0001 License
+  *
+  * Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+  *
+  * This file is part of 'QMXStdLib'.
+  *
+  * 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+  * Software Foundation, either version 3 of the License, or (at your option) any later version.
+  *
+  * 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+  * A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+  *
+  * You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+  */
+
+#ifndef __QMX_QMXSTDLIB_SCOPEDLATENCY_HPP_
+#define __QMX_QMXSTDLIB_SCOPEDLATENCY_HPP_
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Header Files
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../Base.hpp"
+#include "../LatencyRecorder.hpp"
+#include "../Timer.hpp"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Static Macros
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#define SCOPED_LATENCY(x,y) QMXStdLib::ScopedLatency scopedLatency##y( x )
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Start of the 'QMXStdLib' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace QMXStdLib
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// The 'ScopedLatency' Class
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+  * @class ScopedLatency ScopedLatency.hpp "include/RAII/ScopedLatency.hpp"
+  *
+  * @brief This class defines an RAII interface for timing a scope into a latency recorder.
+  *
+  * The clock is read once when the scope is entered and once when it is left, using the time-stamp counter if it is available, and the difference is
+  * recorded into the specified recorder.
+  *
+  * Platform Independent     : Yes<br>
+  * Architecture Independent : Yes<br>
+  * Thread-Safe              : Yes
+  */
+
+class ScopedLatency
+{
+public:
+
+	// Public Constructors
+
+		/**
+		  * @brief This is the copy constructor, which is deleted to prevent copying.
+		  *
+		  * @param instance
+		  * 	N/A
+		  */
+
+		ScopedLatency( const ScopedLatency& instance ) = delete;
+
+		/**
+		  * @brief This is the constructor which accepts the initialization data.
+		  *
+		  * @param targetRecorder
+		  * 	This is the latency recorder to record the time spent in the scope into; it must outlive this object.
+		  */
+
+		ScopedLatency( LatencyRecorder& targetRecorder ) : recorder( targetRecorder ), startTime( Timer::now( Timer::TSC ) )
+		{
+			// Do nothing.
+		}
+
+	// Destructor
+
+		/**
+		  * @brief This is the destructor.
+		  */
+
+		~ScopedLatency()
+		{
+			// Record the time spent in the scope.
+
+				recorder.record( Timer::now( Timer::TSC ) - startTime );
+		}
+
+	// Public Overloaded Operators
+
+		/**
+		  * @brief This is the default assignment-operator, which is deleted to prevent copying.
+		  *
+		  * @param instance
+		  * 	N/A
+		  *
+		  * @return
+		  * 	N/A
+		  */
+
+		ScopedLatency& operator=( const ScopedLatency& instance ) = delete;
+
+private:
+
+	// Private Fields
+
+		/**
+		  * @brief This is the latency recorder to record into.
+		  */
+
+		LatencyRecorder& recorder;
+
+		/**
+		  * @brief This is the time, in nanoseconds, the scope was entered.
+		  */
+
+		int64_t startTime;
+};
+
+} // 'QMXStdLib' Namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of the 'QMXStdLib' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // __QMX_QMXSTDLIB_SCOPEDLATENCY_HPP_
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of 'ScopedLatency.hpp'
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1,6 +1,6 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // ScopedLock.hpp
-// Robert M. Baker | Created : 30MAR16 | Last Modified : 28AUG19 by Robert M. Baker
+// Robert M. Baker | Created : 30MAR16 | Last Modified : 16OCT26 by Robert M. Baker
 // Version : 2.3.0
 // This is a header file for 'QMXStdLib'; it defines the interface for an RAII class to obtain a scoped lock.
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -21,7 +21,7 @@
   * @file
   * @author  Robert M. Baker
   * @date    Created : 30MAR16
-  * @date    Last Modified : 28AUG19 by Robert M. Baker
+  * @date    Last Modified : 16OCT26 by Robert M. Baker
   * @version 2.3.0
   *
   * @brief This is a header file for 'QMXStdLib'; it defines the interface for an RAII class to obtain a scoped lock.
@@ -52,7 +52,10 @@
 // Header Files
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include <type_traits>
+
 #include "../Base.hpp"
+#include "../Locks.hpp"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Static Macros
@@ -79,7 +82,7 @@ namespace QMXStdLib
   *
   * @brief This class defines an RAII interface for a scoped lock.
   *
-  * This is useful for ensuring all obtained mutex locks are appropriately released.
+  * This is useful for ensuring all obtained locks are appropriately released.
   *
   * Platform Independent     : Yes<br>
   * Architecture Independent : Yes<br>
@@ -114,35 +117,46 @@ public:
 		ScopedLock( const ScopedLock& instance ) = delete;
 
 		/**
-		  * @brief This is the constructor which accepts a mutex pair and a lock type.
+		  * @brief This is the constructor which accepts a lock type and a lock.
+		  *
+		  * Any lock policy ('NullLock', 'SpinLock', or 'SharedLock') may be used; reentrancy is handled by the lock itself.
 		  *
 		  * @param targetType
 		  * 	This is the lock type used in acquiring/releasing necessary locks.
 		  *
-		  * @param targetMutex
-		  * 	This is the mutex pair used in acquiring/releasing necessary locks.
+		  * @param targetLock
+		  * 	This is the lock used in acquiring/releasing necessary locks.
 		  */
 
-		ScopedLock( const LockType targetType, SharedMutexPair& targetMutex )
+		template< typename LType > ScopedLock( const LockType targetType, LType& targetLock )
 		{
 			// Initialize fields.
 
-				isLocked = false;
-				type = targetType;
-				localMutex = &targetMutex;
+				localLock = &targetLock;
+				unlockFunction = nullptr;
 
-			// Obtain lock on mutex, if necessary.
+			// Obtain lock, unless the lock policy performs no locking.
 
-				if( ( localMutex->first == NOT_A_THREAD ) || ( localMutex->first != THIS_THREAD_HASH ) )
+				if constexpr( !std::is_same< LType, NullLock >::value )
 				{
-					switch( type )
+					switch( targetType )
 					{
-						case READ: { localMutex->second.lock_shared();  break; }
-						case WRITE: { localMutex->second.lock();  break; }
-					}
+						case READ:
+						{
+							targetLock.lockShared();
+							unlockFunction = &unlockShared< LType >;
 
-					localMutex->first = THIS_THREAD_HASH;
-					isLocked = true;
+							break;
+						}
+
+						case WRITE:
+						{
+							targetLock.lock();
+							unlockFunction = &unlock< LType >;
+
+							break;
+						}
+					}
 				}
 		}
 
@@ -154,18 +168,10 @@ public:
 
 		~ScopedLock()
 		{
-			// Release read lock on mutex, if necessary;
+			// Release lock, if necessary.
 
-				if( isLocked )
-				{
-					switch( type )
-					{
-						case READ: { localMutex->second.unlock_shared();  break; }
-						case WRITE: { localMutex->second.unlock();  break; }
-					}
-
-					localMutex->first = NOT_A_THREAD;
-				}
+				if( unlockFunction )
+					unlockFunction( localLock );
 		}
 
 	// Public Overloaded Operators
@@ -187,22 +193,46 @@ private:
 	// Private Fields
 
 		/**
-		  * @brief This is the flag used to determine mutex locked state.
+		  * @brief This is the lock pointer used when releasing the lock.
+		  */
+
+		void* localLock;
+
+		/**
+		  * @brief This is the function used to release the lock, or 'nullptr' if no lock was obtained.
 		  */
 
-		bool isLocked;
+		void ( *unlockFunction )( void* );
+
+	// Private Methods
 
 		/**
-		  * @brief This is the type used when acquiring/releasing locks.
+		  * @brief This method releases an exclusive lock on the specified lock.
+		  *
+		  * @param target
+		  * 	This is a pointer to the lock to release.
 		  */
 
-		LockType type;
+		template< typename LType > static void unlock( void* target )
+		{
+			// Release exclusive lock.
+
+				static_cast< LType* >( target )->unlock();
+		}
 
 		/**
-		  * @brief This is the mutex pair pointer used when acquiring/releasing locks.
+		  * @brief This method releases a shared lock on the specified lock.
+		  *
+		  * @param target
+		  * 	This is a pointer to the lock to release.
 		  */
 
-		SharedMutexPair* localMutex;
+		template< typename LType > static void unlockShared( void* target )
+		{
+			// Release shared lock.
+
+				static_cast< LType* >( target )->unlockShared();
+		}
 };
 
 } // 'QMXStdLib' Namespace
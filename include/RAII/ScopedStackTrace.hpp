@@ -1,6 +1,6 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // ScopedStackTrace.hpp
-// Robert M. Baker | Created : 04MAR12 | Last Modified : 28AUG19 by Robert M. Baker
+// Robert M. Baker | Created : 04MAR12 | Last Modified : 17OCT26 by Robert M. Baker
 // Version : 2.3.0
 // This is a header file for 'QMXStdLib'; it defines the interface for an RAII class to create a scoped trace.
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -21,7 +21,7 @@
   * @file
   * @author  Robert M. Baker
   * @date    Created : 04MAR12
-  * @date    Last Modified : 28AUG19 by Robert M. Baker
+  * @date    Last Modified : 17OCT26 by Robert M. Baker
   * @version 2.3.0
   *
   * @brief This header file defines the interface for an RAII class to create a scoped trace.
@@ -59,7 +59,15 @@
 // Static Macros
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-#define SCOPED_STACK_TRACE(x,y) QMXStdLib::ScopedStackTrace scopedStackTrace##y( x )
+#ifndef QMXSTDLIB_NO_STACK_TRACE
+#	define SCOPED_STACK_TRACE(x,y) QMXStdLib::ScopedStackTrace scopedStackTrace##y( x )
+#	define SST_PUSH_ENTRY          isPushed = StackTracer::push( entry );
+#	define SST_POP_ENTRY           if( isPushed ) StackTracer::pop();
+#else
+#	define SCOPED_STACK_TRACE(x,y) static_cast< void >( 0 )
+#	define SST_PUSH_ENTRY          static_cast< void >( entry );
+#	define SST_POP_ENTRY
+#endif
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Start of the 'QMXStdLib' Namespace
@@ -77,7 +85,9 @@ namespace QMXStdLib
   *
   * @brief This class defines an RAII interface for a scoped trace.
   *
-  * This is useful for ensuring all pushed stack tracer entries are appropriately popped.
+  * This is useful for ensuring all pushed stack tracer entries are appropriately popped.  The entry is only pushed (and later popped) if the stack tracer is
+  * enabled when the scope is entered, and no allocation is performed in either case.  If 'QMXSTDLIB_NO_STACK_TRACE' is defined, this class does nothing and
+  * the 'SCOPED_STACK_TRACE' macro compiles to nothing.
   *
   * Platform Independent     : Yes<br>
   * Architecture Independent : Yes<br>
@@ -103,14 +113,14 @@ public:
 		  * @brief This is the constructor which accepts the initialization data.
 		  *
 		  * @param entry
-		  * 	This is the string to use when pushing the stack tracer entry.
+		  * 	This is the string literal to use when pushing the stack tracer entry.
 		  */
 
-		ScopedStackTrace( const std::string& entry )
+		ScopedStackTrace( const char* entry )
 		{
-			// Push specified entry into stack tracer.
+			// Push specified entry into stack tracer, if it is enabled.
 
-				StackTracer::push( entry );
+				SST_PUSH_ENTRY
 		}
 
 	// Destructor
@@ -121,9 +131,9 @@ public:
 
 		~ScopedStackTrace()
 		{
-			// Pop the entry from stack tracer.
+			// Pop the entry from stack tracer, if it was pushed.
 
-				StackTracer::pop();
+				SST_POP_ENTRY
 		}
 
 	// Public Overloaded Operators
@@ -139,6 +149,16 @@ public:
 		  */
 
 		ScopedStackTrace& operator=( const ScopedStackTrace& instance ) = delete;
+
+private:
+
+	// Private Fields
+
+		/**
+		  * @brief This is the flag which determines if the entry was pushed into the stack tracer.
+		  */
+
+		bool isPushed = false;
 };
 
 } // 'QMXStdLib' Namespace
@@ -147,6 +167,13 @@ public:
 // End of the 'QMXStdLib' Namespace
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Static Macro Cleanup
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#undef SST_PUSH_ENTRY
+#undef SST_POP_ENTRY
+
 #endif // __QMX_QMXSTDLIB_SCOPEDSTACKTRACE_HPP_
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
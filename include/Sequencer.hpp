@@ -1,6 +1,6 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Sequencer.hpp
-// Robert M. Baker | Created : 29FEB12 | Last Modified : 29AUG19 by Robert M. Baker
+// Robert M. Baker | Created : 29FEB12 | Last Modified : 16OCT26 by Robert M. Baker
 // Version : 2.3.0
 // This is a header file for 'QMXStdLib'; it defines the interface for a numeric sequencer class.
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -21,7 +21,7 @@
   * @file
   * @author  Robert M. Baker
   * @date    Created : 29FEB12
-  * @date    Last Modified : 29AUG19 by Robert M. Baker
+  * @date    Last Modified : 16OCT26 by Robert M. Baker
   * @version 2.3.0
   *
   * @brief This header file defines the interface for a numeric sequencer class.
@@ -124,18 +124,19 @@ public:
   *
   * @brief This class defines numeric sequencing algorithms.
   *
-  * These algorithms are useful when is necessary to control such things as animation logic.
+  * These algorithms are useful when is necessary to control such things as animation logic.  The lock policy defaults to 'SharedLock'; a sequencer which is
+  * only ever touched by a single thread may use 'NullLock' to remove all synchronization cost from its hot path.
   *
   * Platform Independent     : Yes<br>
   * Architecture Independent : Yes<br>
   * Thread-Safe              : Yes
   */
 
-template< typename NType > class Sequencer : public Object< Sequencer< NType >, SequencerProperties< NType > >
+template< typename NType, typename LType = SharedLock > class Sequencer : public Object< Sequencer< NType, LType >, SequencerProperties< NType >, LType >
 {
 	// Friend Classes
 
-		friend class Object< Sequencer< NType >, SequencerProperties< NType > >;
+		friend class Object< Sequencer< NType, LType >, SequencerProperties< NType >, LType >;
 
 public:
 
@@ -371,7 +372,7 @@ private:
 		  * 	This is the object pointer to use when setting.
 		  */
 
-		void cloneImp( typename Sequencer< NType >::InstancePtr& target ) const
+		void cloneImp( typename Sequencer< NType, LType >::InstancePtr& target ) const
 		{
 			// Assign data of 'this' to specified object.
 
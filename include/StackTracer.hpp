@@ -1,6 +1,6 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // StackTracer.hpp
-// Robert M. Baker | Created : 29FEB12 | Last Modified : 03SEP19 by Robert M. Baker
+// Robert M. Baker | Created : 29FEB12 | Last Modified : 16OCT26 by Robert M. Baker
 // Version : 2.3.0
 // This is a header file for 'QMXStdLib'; it defines the interface for a stack tracer class.
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -21,7 +21,7 @@
   * @file
   * @author  Robert M. Baker
   * @date    Created : 29FEB12
-  * @date    Last Modified : 03SEP19 by Robert M. Baker
+  * @date    Last Modified : 16OCT26 by Robert M. Baker
   * @version 2.3.0
   *
   * @brief This header file defines the interface for a stack tracer class.
@@ -52,6 +52,9 @@
 // Header Files
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include <array>
+#include <atomic>
+
 #include "Base.hpp"
 #include "QMXException.hpp"
 #include "RAII/ScopedLock.hpp"
@@ -100,13 +103,9 @@ public:
 
 		static bool getEnabled()
 		{
-			// Obtain locks.
-
-				ScopedLock readLock( ScopedLock::READ, localMutex );
-
 			// Report value of 'IsEnabled' to calling routine.
 
-				return isEnabled;
+				return isEnabled.load( std::memory_order_acquire );
 		}
 
 		/**
@@ -120,13 +119,9 @@ public:
 
 		static void setEnabled( bool target )
 		{
-			// Obtain locks.
-
-				ScopedLock writeLock( ScopedLock::WRITE, localMutex );
-
 			// Set value of 'IsEnabled' to specified value.
 
-				isEnabled = target;
+				isEnabled.store( target, std::memory_order_release );
 		}
 
 		/**
@@ -160,9 +155,10 @@ public:
 		}
 
 		/**
-		  * @brief This method adds the current thread to the stack trace map.
+		  * @brief This method adds the current thread to the stack trace registry.
 		  *
-		  * The current thread's ID should first be set with a call to 'setThreadID'.
+		  * The current thread's ID should first be set with a call to 'setThreadID'.  A fresh thread-local record is created and bound to the current thread;
+		  * all subsequent calls to 'push' and 'pop' operate on that record without locking.
 		  *
 		  * @param base
 		  * 	This is a string containing the base stack trace.
@@ -177,7 +173,7 @@ public:
 		{
 			// Perform pre-lock abort check.
 
-				if( !isEnabled )
+				if( !getEnabled() )
 					return;
 
 			// Obtain locks.
@@ -186,25 +182,35 @@ public:
 
 			// Perform post-lock abort check.
 
-				if( !isEnabled )
+				if( !getEnabled() )
 					return;
 
-			// Add current thread to stack trace map, if its name has been properly set and has not already been added.
+			// Create local variables.
+
+				ThreadRecordPtr record;
+
+			// Add current thread to stack trace registry, if its name has been properly set and has not already been added.
 
 				QMX_ASSERT_X( threadID.get(), "QMXStdLib", "StackTracer::addThread", "00000013", base );
 				QMX_ASSERT_X( threadID->length(), "QMXStdLib", "StackTracer::addThread", "00000014", base );
+				record = std::make_shared< ThreadRecord >( *threadID, base );
 
 				QMX_ASSERT_X(
-					stackTraces.insert( StackTraceMap::value_type( *threadID, StringVector( 1, base ) ) ).second,
+					threadRecords.insert( ThreadRecordMap::value_type( *threadID, record ) ).second,
 					"QMXStdLib",
 					"StackTracer::addThread",
 					"00000015",
 					*threadID << ", " << base
 				);
+
+			// Bind the new record to the current thread.
+
+				record->isRegistered.store( true, std::memory_order_release );
+				localRecord = record;
 		}
 
 		/**
-		  * @brief This method removes the current thread from the stack trace map.
+		  * @brief This method removes the current thread from the stack trace registry.
 		  *
 		  * The current thread's ID should first be set with a call to 'setThreadID'.
 		  *
@@ -218,7 +224,7 @@ public:
 		{
 			// Perform pre-lock abort check.
 
-				if( !isEnabled )
+				if( !getEnabled() )
 					return;
 
 			// Obtain locks.
@@ -227,23 +233,37 @@ public:
 
 			// Perform post-lock abort check.
 
-				if( !isEnabled )
+				if( !getEnabled() )
 					return;
 
-			// Remove the current thread from stack trace map, if its name has been properly set and has been added.
+			// Create local variables.
+
+				ThreadRecordMap::iterator threadRecordMapIterator;
+
+			// Remove the current thread from stack trace registry, if its name has been properly set and has been added.
 
 				QMX_ASSERT_X( threadID.get(), "QMXStdLib", "StackTracer::removeThread", "00000013", "" );
 				QMX_ASSERT_X( threadID->length(), "QMXStdLib", "StackTracer::removeThread", "00000014", "" );
-				QMX_ASSERT_X( stackTraces.erase( *threadID ), "QMXStdLib", "StackTracer::removeThread", "00000016", *threadID );
+				threadRecordMapIterator = threadRecords.find( *threadID );
+				QMX_ASSERT_X( ( threadRecordMapIterator != threadRecords.end() ), "QMXStdLib", "StackTracer::removeThread", "00000016", *threadID );
+				threadRecordMapIterator->second->isRegistered.store( false, std::memory_order_release );
+				threadRecords.erase( threadRecordMapIterator );
+				localRecord.reset();
 		}
 
 		/**
 		  * @brief This method pushes an entry onto the current thread's stack trace.
 		  *
-		  * All pushed entries will be used to construct a stack trace when the 'GetStackTrace' method is called.
+		  * All pushed entries will be used to construct a stack trace when the 'GetStackTrace' method is called.  The push is performed on the current thread's
+		  * local record without locking, and only the pointer is stored; thus, the specified entry must have static storage duration (i.e. a string literal).
+		  * Entries pushed beyond 'STACKTRACER_MAX_DEPTH' are counted, so pops remain balanced, but are omitted from the stack trace.  The current thread's ID
+		  * is only validated if it is not bound to a registered record, since a record is bound to the ID given when 'addThread' was called.
 		  *
 		  * @param target
-		  * 	This is a string containing the entry to push.
+		  * 	This is a string literal containing the entry to push.
+		  *
+		  * @return
+		  * 	A boolean value of 'true' if the entry was pushed, and 'false' if the stack tracer is disabled.
 		  *
 		  * @exception QMXException
 		  * 	If the current thread's ID was not set.<br>
@@ -251,40 +271,44 @@ public:
 		  * 	If the current thread was not added to the tracer.
 		  */
 
-		static void push( const std::string& target )
+		static bool push( const char* target )
 		{
-			// Perform pre-lock abort check.
+			// Perform abort check.
 
-				if( !isEnabled )
-					return;
+				if( !getEnabled() )
+					return false;
 
-			// Obtain locks.
+			// Create local variables.
 
-				ScopedLock writeLock( ScopedLock::WRITE, localMutex );
+				ThreadRecord* record = localRecord.get();
+				size_t depth = UNSET;
 
-			// Perform post-lock abort check.
+			// Push the specified entry onto the current thread's stack trace, if its name has been properly set and has been added.
 
-				if( !isEnabled )
-					return;
+				if( !record || !record->isRegistered.load( std::memory_order_acquire ) )
+				{
+					QMX_ASSERT_X( threadID.get(), "QMXStdLib", "StackTracer::push", "00000013", target );
+					QMX_ASSERT_X( threadID->length(), "QMXStdLib", "StackTracer::push", "00000014", target );
+					QMX_THROW_X( "QMXStdLib", "StackTracer::push", "00000016", *threadID << ", " << target );
+				}
 
-			// Create local variables.
+				depth = record->depth.load( std::memory_order_relaxed );
 
-				StackTraceMap::iterator stackTraceMapIterator;
+				if( depth < STACKTRACER_MAX_DEPTH )
+					record->entries[ depth ].store( target, std::memory_order_relaxed );
 
-			// Push the specified entry onto the current thread's stack trace, if its name has been properly set and has been added.
+				record->depth.store( ( depth + 1 ), std::memory_order_release );
+
+			// Report success to calling routine.
 
-				QMX_ASSERT_X( threadID.get(), "QMXStdLib", "StackTracer::push", "00000013", target );
-				QMX_ASSERT_X( threadID->length(), "QMXStdLib", "StackTracer::push", "00000014", target );
-				stackTraceMapIterator = stackTraces.find( *threadID );
-				QMX_ASSERT_X( ( stackTraceMapIterator != stackTraces.end() ), "QMXStdLib", "StackTracer::push", "00000016", *threadID << ", " << target );
-				stackTraceMapIterator->second.push_back( target );
+				return true;
 		}
 
 		/**
 		  * @brief This method pops an entry off the current thread's stack trace.
 		  *
 		  * This method will remove that last pushed entry, and should be used at the end of any scope which has made a call to push.  If no entries are present
-		  * in the stack trace (other than the base stack trace), this method will have no effect.
+		  * in the stack trace (other than the base stack trace), this method will have no effect.  Like 'push', it does not lock.
 		  *
 		  * @exception QMXException
 		  * 	If the current thread's ID was not set.<br>
@@ -294,38 +318,36 @@ public:
 
 		static void pop()
 		{
-			// Perform pre-lock abort check.
-
-				if( !isEnabled )
-					return;
-
-			// Obtain locks.
-
-				ScopedLock writeLock( ScopedLock::WRITE, localMutex );
+			// Perform abort check.
 
-			// Perform post-lock abort check.
-
-				if( !isEnabled )
+				if( !getEnabled() )
 					return;
 
 			// Create local variables.
 
-				StackTraceMap::iterator stackTraceMapIterator;
+				ThreadRecord* record = localRecord.get();
+				size_t depth = UNSET;
 
 			// Pop the last pushed entry off the current thread's stack trace, if its name has been properly set and has been added.
 
-				QMX_ASSERT_X( threadID.get(), "QMXStdLib", "StackTracer::pop", "00000013", "" );
-				QMX_ASSERT_X( threadID->length(), "QMXStdLib", "StackTracer::pop", "00000014", "" );
-				stackTraceMapIterator = stackTraces.find( *threadID );
-				QMX_ASSERT_X( ( stackTraceMapIterator != stackTraces.end() ), "QMXStdLib", "StackTracer::pop", "00000016", *threadID );
+				if( !record || !record->isRegistered.load( std::memory_order_acquire ) )
+				{
+					QMX_ASSERT_X( threadID.get(), "QMXStdLib", "StackTracer::pop", "00000013", "" );
+					QMX_ASSERT_X( threadID->length(), "QMXStdLib", "StackTracer::pop", "00000014", "" );
+					QMX_THROW_X( "QMXStdLib", "StackTracer::pop", "00000016", *threadID );
+				}
 
-				if( stackTraceMapIterator->second.size() > 1 )
-					stackTraceMapIterator->second.pop_back();
+				depth = record->depth.load( std::memory_order_relaxed );
+
+				if( depth )
+					record->depth.store( ( depth - 1 ), std::memory_order_release );
 		}
 
 		/**
 		  * @brief This method constructs a stack trace for the current thread.
 		  *
+		  * Only the current thread's local record is read; no locks are taken.
+		  *
 		  * @return
 		  * 	The constructed stack trace string.
 		  *
@@ -337,42 +359,58 @@ public:
 
 		static std::string getStackTrace()
 		{
-			// Perform pre-lock abort check.
+			// Perform abort check.
 
-				if( !isEnabled )
+				if( !getEnabled() )
 					return "";
 
-			// Obtain locks.
+			// Create local variables.
 
-				ScopedLock readLock( ScopedLock::READ, localMutex );
+				ThreadRecord* record = localRecord.get();
 
-			// Perform post-lock abort check.
+			// Construct the stack trace for the current thread, if its name has been properly set and has been added.
 
-				if( !isEnabled )
-					return "";
+				if( !record || !record->isRegistered.load( std::memory_order_acquire ) )
+				{
+					QMX_ASSERT_X( threadID.get(), "QMXStdLib", "StackTracer::getStackTrace", "00000013", "" );
+					QMX_ASSERT_X( threadID->length(), "QMXStdLib", "StackTracer::getStackTrace", "00000014", "" );
+					QMX_THROW_X( "QMXStdLib", "StackTracer::getStackTrace", "00000016", *threadID );
+				}
+
+			// Return result to calling routine.
+
+				return record->toString();
+		}
+
+		/**
+		  * @brief This method takes an on-demand snapshot of the stack traces of all added threads.
+		  *
+		  * This is intended for diagnostics; the registry lock is only held for reading, and each thread's record is read without interrupting its owner.  If
+		  * a thread is pushing or popping while the snapshot is taken, its stack trace will reflect either the state before or after that operation.
+		  *
+		  * @return
+		  * 	A map of thread IDs to their constructed stack trace strings, which will be empty if the stack tracer is disabled.
+		  */
 
+		static StringMap getAllStackTraces()
+		{
 			// Create local variables.
 
-				std::string result;
-				StackTraceMap::iterator stackTraceMapIterator;
-				size_t index = UNSET;
+				StringMap result;
 
-			// Construct the stack trace for the current thread, if its name has been properly set and has been added.
+			// Perform pre-lock abort check.
 
-				QMX_ASSERT_X( threadID.get(), "QMXStdLib", "StackTracer::getStackTrace", "00000013", "" );
-				QMX_ASSERT_X( threadID->length(), "QMXStdLib", "StackTracer::getStackTrace", "00000014", "" );
-				stackTraceMapIterator = stackTraces.find( *threadID );
-				QMX_ASSERT_X( ( stackTraceMapIterator != stackTraces.end() ), "QMXStdLib", "StackTracer::getStackTrace", "00000016", *threadID );
+				if( !getEnabled() )
+					return result;
 
-				if( stackTraceMapIterator->second.size() == 1 )
-					result = stackTraceMapIterator->second[ 0 ];
-				else
-				{
-					for( ; index < ( stackTraceMapIterator->second.size() - 1 ); index++ )
-						result += stackTraceMapIterator->second[ index ] + STACKTRACER_ENTRY_SEPARATOR;
+			// Obtain locks.
 
-					result += stackTraceMapIterator->second[ index ];
-				}
+				ScopedLock readLock( ScopedLock::READ, localMutex );
+
+			// Construct the stack trace for every registered thread.
+
+				for( const auto& threadRecord : threadRecords )
+					result.insert( StringMap::value_type( threadRecord.first, threadRecord.second->toString() ) );
 
 			// Return result to calling routine.
 
@@ -391,29 +429,123 @@ public:
 
 			// Reset stack tracer to default state.
 
-				isEnabled = false;
-				stackTraces.clear();
+				isEnabled.store( false, std::memory_order_release );
+
+				for( const auto& threadRecord : threadRecords )
+					threadRecord.second->isRegistered.store( false, std::memory_order_release );
+
+				threadRecords.clear();
 		}
 
 private:
 
+	// Private Data Types
+
+		/**
+		  * @brief This is the per-thread stack trace record.
+		  *
+		  * It is written only by its owning thread; other threads may read it concurrently when taking a snapshot.
+		  */
+
+		struct ThreadRecord
+		{
+			/**
+			  * @brief This is the constructor which accepts the initialization data.
+			  *
+			  * @param targetID
+			  * 	This is the ID of the owning thread.
+			  *
+			  * @param targetBase
+			  * 	This is the base stack trace of the owning thread.
+			  */
+
+			ThreadRecord( const std::string& targetID, const std::string& targetBase ) :
+				id( targetID ),
+				base( targetBase ),
+				depth( 0 ),
+				isRegistered( false )
+			{
+				// Do nothing.
+			}
+
+			/**
+			  * @brief This method constructs the stack trace string for this record.
+			  *
+			  * @return
+			  * 	The constructed stack trace string.
+			  */
+
+			std::string toString() const
+			{
+				// Create local variables.
+
+					std::string result = base;
+					size_t count = std::min< size_t >( depth.load( std::memory_order_acquire ), STACKTRACER_MAX_DEPTH );
+
+				// Append each pushed entry to the base stack trace.
+
+					for( size_t index = 0; index < count; index++ )
+					{
+						result += STACKTRACER_ENTRY_SEPARATOR;
+						result += entries[ index ].load( std::memory_order_relaxed );
+					}
+
+				// Return result to calling routine.
+
+					return result;
+			}
+
+			/**
+			  * @brief This is the ID of the owning thread.
+			  */
+
+			const std::string id;
+
+			/**
+			  * @brief This is the base stack trace of the owning thread.
+			  */
+
+			const std::string base;
+
+			/**
+			  * @brief This is the array of pushed entries.
+			  */
+
+			std::array< std::atomic< const char* >, STACKTRACER_MAX_DEPTH > entries;
+
+			/**
+			  * @brief This is the number of pushed entries, which may exceed the capacity of 'entries'.
+			  */
+
+			std::atomic< size_t > depth;
+
+			/**
+			  * @brief This is the flag which determines if the record is still in the registry.
+			  */
+
+			std::atomic< bool > isRegistered;
+		};
+
 	// Private Type Definitions
 
-		typedef std::unordered_map< std::string, StringVector > StackTraceMap;
+		typedef std::shared_ptr< ThreadRecord > ThreadRecordPtr;
+		typedef std::unordered_map< std::string, ThreadRecordPtr > ThreadRecordMap;
 
 	// Private Fields
 
 		/**
 		  * @brief This is the mutex for use when thread-safety is needed.
+		  *
+		  * It guards only the thread record registry; 'push' and 'pop' never acquire it.
 		  */
 
-		inline static SharedMutexPair localMutex;
+		inline static SharedLock localMutex;
 
 		/**
 		  * @brief This is the flag which determines if the stack tracer is enabled.
 		  */
 
-		inline static bool isEnabled = false;
+		inline static std::atomic< bool > isEnabled{ false };
 
 		/**
 		  * @brief This is a thread-specific pointer to a string containing the current thread's ID.
@@ -422,10 +554,16 @@ private:
 		inline static StringTLS threadID;
 
 		/**
-		  * @brief This is the stack trace map.
+		  * @brief This is the current thread's stack trace record.
+		  */
+
+		inline static thread_local ThreadRecordPtr localRecord;
+
+		/**
+		  * @brief This is the thread record registry.
 		  */
 
-		inline static StackTraceMap stackTraces;
+		inline static ThreadRecordMap threadRecords;
 
 	// Private Constructors
 
@@ -445,8 +583,8 @@ private:
 // End of the 'QMXStdLib' Namespace
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-#endif // __QMX_QMXSTDLIB_TRACER_HPP_
+#endif // __QMX_QMXSTDLIB_STACKTRACER_HPP_
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-// End of 'Tracer.hpp'
+// End of 'StackTracer.hpp'
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1,6 +1,6 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // String.hpp
-// Robert M. Baker | Created : 11JAN12 | Last Modified : 10SEP19 by Robert M. Baker
+// Robert M. Baker | Created : 11JAN12 | Last Modified : 17OCT26 by Robert M. Baker
 // Version : 2.3.0
 // This is a header file for 'QMXStdLib'; it defines the interface for a set of string utility functions.
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -21,7 +21,7 @@
   * @file
   * @author  Robert M. Baker
   * @date    Created : 11JAN12
-  * @date    Last Modified : 10SEP19 by Robert M. Baker
+  * @date    Last Modified : 17OCT26 by Robert M. Baker
   * @version 2.3.0
   *
   * @brief This header file defines the interface for a set of string utility functions.
@@ -52,10 +52,14 @@
 // Header Files
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-#include <codecvt>
+#include <cctype>
+#include <charconv>
+#include <string_view>
+#include <type_traits>
 #include <boost/locale.hpp>
 
 #include "Base.hpp"
+#include "Expected.hpp"
 #include "Mixins/Stringizable.hpp"
 #include "RAII/ScopedStackTrace.hpp"
 
@@ -77,6 +81,328 @@ namespace QMXStdLib
 namespace String
 {
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// The 'TranscoderISA' Enumeration
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+  * @brief This enumeration contains all instruction sets the UTF transcoder can use, in order of preference.
+  */
+
+enum TranscoderISA
+{
+	SCALAR,
+	SSE2,
+	AVX2
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// The 'Tokenizer' Class
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+  * @class Tokenizer String.hpp "include/String.hpp"
+  *
+  * @brief This class defines a lazy range over the tokens of a string, which are yielded as views into the source rather than copies.
+  *
+  * Tokens are separated by runs of delimiter characters, with the same semantics as 'boost::algorithm::split' using 'token_compress_on': a run of delimiters
+  * counts as one separator, and a leading or trailing run yields an empty first or last token.  An empty source yields a single empty token.  Sets of up
+  * to eight delimiters are scanned 16 bytes at a time on x86, and larger sets are scanned with a lookup table.  The source must outlive the tokenizer and
+  * every token obtained from it.
+  *
+  * Platform Independent     : Yes<br>
+  * Architecture Independent : Yes<br>
+  * Thread-Safe              : Yes
+  */
+
+class Tokenizer
+{
+public:
+
+	// Public Data Types
+
+		/**
+		  * @brief This class defines a forward iterator over the tokens of a tokenizer.
+		  */
+
+		class Iterator
+		{
+		public:
+
+			// Public Data Types
+
+				using iterator_category = std::forward_iterator_tag;
+				using value_type = std::string_view;
+				using difference_type = std::ptrdiff_t;
+				using pointer = const std::string_view*;
+				using reference = const std::string_view&;
+
+			// Public Constructors
+
+				/**
+				  * @brief This is the default constructor, which creates a past-the-end iterator.
+				  */
+
+				Iterator() noexcept : owner( nullptr )
+				{
+					// Do nothing.
+				}
+
+				/**
+				  * @brief This is the constructor which accepts the tokenizer, and positions the iterator on its first token.
+				  *
+				  * @param sourceOwner
+				  * 	This is the tokenizer to iterate over.
+				  */
+
+				explicit Iterator( const Tokenizer* sourceOwner ) noexcept;
+
+			// Public Overloaded Operators
+
+				/**
+				  * @brief This is the overloaded dereference operator.
+				  *
+				  * @return
+				  * 	A view of the current token.
+				  */
+
+				reference operator*() const noexcept
+				{
+					// Return result to calling routine.
+
+						return token;
+				}
+
+				/**
+				  * @brief This is the overloaded member access operator.
+				  *
+				  * @return
+				  * 	A pointer to a view of the current token.
+				  */
+
+				pointer operator->() const noexcept
+				{
+					// Return result to calling routine.
+
+						return &token;
+				}
+
+				/**
+				  * @brief This is the overloaded prefix increment operator, which moves the iterator to the next token.
+				  *
+				  * @return
+				  * 	A reference to this iterator.
+				  */
+
+				Iterator& operator++() noexcept;
+
+				/**
+				  * @brief This is the overloaded postfix increment operator, which moves the iterator to the next token.
+				  *
+				  * @return
+				  * 	A copy of this iterator from before it was moved.
+				  */
+
+				Iterator operator++( int ) noexcept
+				{
+					// Create local variables.
+
+						Iterator result = *this;
+
+					// Move to the next token.
+
+						++( *this );
+
+					// Return result to calling routine.
+
+						return result;
+				}
+
+				/**
+				  * @brief This is the overloaded equality operator.
+				  *
+				  * @param instance
+				  * 	This is the iterator to compare against.
+				  *
+				  * @return
+				  * 	A boolean value of 'true' if both iterators are on the same token, or both are past the end, and 'false' otherwise.
+				  */
+
+				bool operator==( const Iterator& instance ) const noexcept
+				{
+					// Return result to calling routine.
+
+						return ( ( owner == instance.owner ) && ( token.data() == instance.token.data() ) );
+				}
+
+				/**
+				  * @brief This is the overloaded inequality operator.
+				  *
+				  * @param instance
+				  * 	This is the iterator to compare against.
+				  *
+				  * @return
+				  * 	A boolean value of 'true' if the iterators are on different tokens, and 'false' otherwise.
+				  */
+
+				bool operator!=( const Iterator& instance ) const noexcept
+				{
+					// Return result to calling routine.
+
+						return !( *this == instance );
+				}
+
+		private:
+
+			// Private Fields
+
+				/**
+				  * @brief This is the tokenizer being iterated over, or 'nullptr' once the iterator is past the end.
+				  */
+
+				const Tokenizer* owner;
+
+				/**
+				  * @brief This is a view of the current token.
+				  */
+
+				std::string_view token;
+		};
+
+	// Public Fields
+
+		/**
+		  * @brief This is the default delimiter set, which matches 'boost::algorithm::is_space' in the classic locale.
+		  */
+
+		static constexpr std::string_view WHITESPACE = " \t\n\v\f\r";
+
+	// Public Constructors
+
+		/**
+		  * @brief This is the constructor which accepts the initialization data.
+		  *
+		  * @param targetSource
+		  * 	This is the string to split into tokens.
+		  *
+		  * @param targetDelimiters
+		  * 	This is the set of delimiter characters; it is copied, so it need not outlive the tokenizer.
+		  */
+
+		explicit Tokenizer( std::string_view targetSource, std::string_view targetDelimiters = WHITESPACE ) noexcept;
+
+	// Public Methods
+
+		/**
+		  * @brief This method gets an iterator on the first token.
+		  *
+		  * @return
+		  * 	An iterator on the first token.
+		  */
+
+		Iterator begin() const noexcept
+		{
+			// Return result to calling routine.
+
+				return Iterator( this );
+		}
+
+		/**
+		  * @brief This method gets a past-the-end iterator.
+		  *
+		  * @return
+		  * 	A past-the-end iterator.
+		  */
+
+		Iterator end() const noexcept
+		{
+			// Return result to calling routine.
+
+				return Iterator();
+		}
+
+private:
+
+	// Private Fields
+
+		/**
+		  * @brief This is the string being split into tokens.
+		  */
+
+		std::string_view source;
+
+		/**
+		  * @brief This is a bitmap of the delimiter characters, indexed by byte value.
+		  */
+
+		uint64_t table[ 4 ];
+
+		/**
+		  * @brief This is a copy of the delimiter characters, used by the vector scan when there are few enough of them.
+		  */
+
+		char delimiters[ 8 ];
+
+		/**
+		  * @brief This is the number of distinct delimiter characters; only the first eight are copied into 'delimiters'.
+		  */
+
+		size_t delimiterCount;
+
+	// Private Methods
+
+		/**
+		  * @brief This method finds the first delimiter character at or after the specified index.
+		  *
+		  * @param index
+		  * 	This is the index at which to start searching.
+		  *
+		  * @return
+		  * 	The index of the first delimiter character found, or the size of the source if there is none.
+		  */
+
+		size_t findDelimiter( size_t index ) const noexcept;
+
+		/**
+		  * @brief This method finds the first non-delimiter character at or after the specified index.
+		  *
+		  * @param index
+		  * 	This is the index at which to start searching.
+		  *
+		  * @return
+		  * 	The index of the first non-delimiter character found, or the size of the source if there is none.
+		  */
+
+		size_t skipDelimiters( size_t index ) const noexcept;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+  * @brief This function gets the instruction set currently used by the UTF transcoder.
+  *
+  * The best instruction set supported by the CPU is selected the first time a transcoding function is called.
+  *
+  * @return
+  * 	The instruction set currently used by the UTF transcoder.
+  */
+
+TranscoderISA getTranscoderISA();
+
+/**
+  * @brief This function sets the instruction set used by the UTF transcoder, which is mostly useful for testing and benchmarking.
+  *
+  * @param targetISA
+  * 	This is the instruction set to use; if the CPU does not support it, the best supported instruction set below it is used instead.
+  *
+  * @return
+  * 	The instruction set which will actually be used.
+  */
+
+TranscoderISA setTranscoderISA( TranscoderISA targetISA );
+
 /**
   * @brief This function converts the specified UTF-16 string to a UTF-8 string.
   *
@@ -85,6 +411,9 @@ namespace String
   *
   * @return
   * 	A UTF-8 equivalent of the specified UTF-16 string.
+  *
+  * @exception QMXException
+  * 	If the specified string contains an unpaired surrogate.
   */
 
 std::string toUTF8( const std::u16string& source );
@@ -97,6 +426,9 @@ std::string toUTF8( const std::u16string& source );
   *
   * @return
   * 	A UTF-8 equivalent of the specified UTF-32 string.
+  *
+  * @exception QMXException
+  * 	If the specified string contains a surrogate or a value above U+10FFFF.
   */
 
 std::string toUTF8( const std::u32string& source );
@@ -109,6 +441,9 @@ std::string toUTF8( const std::u32string& source );
   *
   * @return
   * 	A UTF-16 equivalent of the specified UTF-8 string.
+  *
+  * @exception QMXException
+  * 	If the specified string is not well-formed UTF-8.
   */
 
 std::u16string toUTF16( const std::string& source );
@@ -121,10 +456,93 @@ std::u16string toUTF16( const std::string& source );
   *
   * @return
   * 	A UTF-32 equivalent of the specified UTF-8 string.
+  *
+  * @exception QMXException
+  * 	If the specified string is not well-formed UTF-8.
   */
 
 std::u32string toUTF32( const std::string& source );
 
+/**
+  * @brief This function converts the specified UTF-16 string into the specified buffer as UTF-8, without allocating or throwing.
+  *
+  * A buffer of three bytes per source code unit is always large enough.
+  *
+  * @param source
+  * 	This is the UTF-16 string to convert.
+  *
+  * @param target
+  * 	This is the buffer into which the UTF-8 string is written; it is not null-terminated.
+  *
+  * @param targetSize
+  * 	This is the size of the buffer, in bytes.
+  *
+  * @return
+  * 	A result holding the number of bytes written, or an error if the source is malformed or the buffer is too small.
+  */
+
+Expected< size_t > toUTF8( std::u16string_view source, char* target, size_t targetSize );
+
+/**
+  * @brief This function converts the specified UTF-32 string into the specified buffer as UTF-8, without allocating or throwing.
+  *
+  * A buffer of four bytes per source code unit is always large enough.
+  *
+  * @param source
+  * 	This is the UTF-32 string to convert.
+  *
+  * @param target
+  * 	This is the buffer into which the UTF-8 string is written; it is not null-terminated.
+  *
+  * @param targetSize
+  * 	This is the size of the buffer, in bytes.
+  *
+  * @return
+  * 	A result holding the number of bytes written, or an error if the source is malformed or the buffer is too small.
+  */
+
+Expected< size_t > toUTF8( std::u32string_view source, char* target, size_t targetSize );
+
+/**
+  * @brief This function converts the specified UTF-8 string into the specified buffer as UTF-16, without allocating or throwing.
+  *
+  * A buffer of one code unit per source byte is always large enough.
+  *
+  * @param source
+  * 	This is the UTF-8 string to convert.
+  *
+  * @param target
+  * 	This is the buffer into which the UTF-16 string is written; it is not null-terminated.
+  *
+  * @param targetSize
+  * 	This is the size of the buffer, in code units.
+  *
+  * @return
+  * 	A result holding the number of code units written, or an error if the source is malformed or the buffer is too small.
+  */
+
+Expected< size_t > toUTF16( std::string_view source, char16_t* target, size_t targetSize );
+
+/**
+  * @brief This function converts the specified UTF-8 string into the specified buffer as UTF-32, without allocating or throwing.
+  *
+  * A buffer of one code unit per source byte is always large enough.
+  *
+  * @param source
+  * 	This is the UTF-8 string to convert.
+  *
+  * @param target
+  * 	This is the buffer into which the UTF-32 string is written; it is not null-terminated.
+  *
+  * @param targetSize
+  * 	This is the size of the buffer, in code units.
+  *
+  * @return
+  * 	A result holding the number of code units written, or an error if the source is malformed or the buffer is too small.
+  */
+
+Expected< size_t > toUTF32( std::string_view source, char32_t* target, size_t targetSize );
+
 /**
   * @brief This function determines if the specified string is all whitepace or not.
   *
@@ -210,6 +628,62 @@ std::string toLower( std::string& target, bool modifyTarget = false );
 
 std::string findReplace( std::string& target, const std::string& find, const std::string& replace, bool modifyTarget = false );
 
+/**
+  * @brief This function strips all occurrences of the specified substring from the specified string, in place and without allocating.
+  *
+  * @param target
+  * 	This is the string from which to strip all occurrences of the specified substring.
+  *
+  * @param substring
+  * 	This is the substring to strip from the specified string; if it is empty, the target string is left unchanged.  It may not refer to memory inside the
+  * 	target string.
+  */
+
+void stripInPlace( std::string& target, std::string_view substring );
+
+/**
+  * @brief This function converts the specified string to all uppercase, in place.
+  *
+  * ASCII strings are converted with a vectorized, locale-independent mapping of 'a'-'z' to 'A'-'Z', without allocating; only strings containing non-ASCII
+  * bytes are converted with 'boost::locale', in which case the global locale must be set as described for 'toUpper'.
+  *
+  * @param target
+  * 	This is the string to convert to uppercase.
+  */
+
+void toUpperInPlace( std::string& target );
+
+/**
+  * @brief This function converts the specified string to all lowercase, in place.
+  *
+  * ASCII strings are converted with a vectorized, locale-independent mapping of 'A'-'Z' to 'a'-'z', without allocating; only strings containing non-ASCII
+  * bytes are converted with 'boost::locale', in which case the global locale must be set as described for 'toLower'.
+  *
+  * @param target
+  * 	This is the string to convert to lowercase.
+  */
+
+void toLowerInPlace( std::string& target );
+
+/**
+  * @brief This function replaces all occurrences of the 'Find' substring with the 'Replace' substring in the specified string, in place.
+  *
+  * Occurrences are matched left to right without overlapping, as with 'findReplace'.  If the 'Replace' substring is no longer than the 'Find' substring, no
+  * allocation is made; otherwise, the positions of the matches are collected first, so that the string is grown only once.  Neither substring may refer to
+  * memory inside the target string.
+  *
+  * @param target
+  * 	This is the string to use for the find/replace operation.
+  *
+  * @param find
+  * 	This is the substring for which all occurrences will be replaced; if it is empty, the target string is left unchanged.
+  *
+  * @param replace
+  * 	This is the substring with which to replace all occurrences of the 'Find' substring.
+  */
+
+void findReplaceInPlace( std::string& target, std::string_view find, std::string_view replace );
+
 /**
   * @brief This function defines the structure for a string tokenizer.
   *
@@ -235,10 +709,45 @@ template< typename PType = boost::algorithm::detail::is_classifiedF > void token
 }
 
 /**
-  * @brief This function defines the structure for a string to numeric value converter.
+  * @brief This function splits the specified string into tokens which are views into it, reusing the caller's vector.
   *
-  * If converting to a boolean value, the string must be exactly (case-sensitive) one of the following: "true", "yes", "false", "no"; otherwise, the value
-  * will always be 'false'.  Using an 'NType' of 'int8' or 'uint8' can have undesired results, so it is recommended to substitute 'int32' in those cases.
+  * The tokens follow the same rules as 'Tokenizer'.  The vector is cleared first but keeps its capacity, so splitting strings of a steady shape does not
+  * allocate.
+  *
+  * @param target
+  * 	This is the vector into which the tokens are placed.
+  *
+  * @param source
+  * 	This is the string to split into tokens; it must outlive the tokens.
+  *
+  * @param delimiters
+  * 	This is the set of delimiter characters.
+  */
+
+void tokenize( std::vector< std::string_view >& target, std::string_view source, std::string_view delimiters = Tokenizer::WHITESPACE );
+
+/**
+  * @brief This function parses the digits of an unsigned binary, octal, or hexadecimal number, without any sign or prefix; it is used by 'tryToValue'.
+  *
+  * @param source
+  * 	This is the string of digits to parse.
+  *
+  * @param base
+  * 	This is the numeric base of the digits; any base other than binary or octal is treated as hexadecimal.
+  *
+  * @return
+  * 	A result holding the parsed value, or an error if the string is empty, has an invalid digit, or does not fit into 64 bits.
+  */
+
+Expected< uint64_t > toMagnitude( std::string_view source, Stringizable::NumericBase base ) noexcept;
+
+/**
+  * @brief This function defines the structure for a string to numeric value converter, which reports malformed or out-of-range input instead of throwing.
+  *
+  * Surrounding whitespace and a leading plus sign are ignored, as they would be by a stream, but the rest of the string must be a complete number.  If
+  * converting to a boolean value, the string must be exactly (case-sensitive) one of the following: "true", "yes", "false", "no".  Octal and hexadecimal
+  * values may be negative, and hexadecimal values may have a "0x" prefix.  Binary values may have a "0b" prefix, and are taken as the raw bit pattern of
+  * 'NType', so a set top bit makes a signed value negative.  Floating point values are always parsed as decimal.
   *
   * @param source
   * 	This is the string to convert into a numeric value.
@@ -247,25 +756,185 @@ template< typename PType = boost::algorithm::detail::is_classifiedF > void token
   * 	This is the numeric base to use during the conversion; if it is out-of-range, it will be set to decimal.
   *
   * @return
-  * 	A numeric representation of the specified string.
+  * 	A result holding a numeric representation of the specified string, or an error if the string is malformed or its value does not fit into 'NType'.
   */
 
-template< typename NType > NType toValue( const std::string& source, Stringizable::NumericBase base = Stringizable::DECIMAL )
+template< typename NType > Expected< NType > tryToValue( std::string_view source, Stringizable::NumericBase base = Stringizable::DECIMAL ) noexcept
 {
 	// Create local variables.
 
 		NType result = UNSET;
-		std::string targetSource = ( source.substr( 0, 2 ) == "0b" ) ? source.substr( 2 ) : source;
-		std::istringstream value( source );
+		bool isNegative = false;
+		std::from_chars_result status;
+		Expected< uint64_t > magnitude = uint64_t( UNSET );
+
+	// Trim surrounding whitespace.
+
+		while( !source.empty() && std::isspace( static_cast< unsigned char >( source.front() ) ) )
+			source.remove_prefix( 1 );
+
+		while( !source.empty() && std::isspace( static_cast< unsigned char >( source.back() ) ) )
+			source.remove_suffix( 1 );
 
 	// Convert the specified string to a numerical value.
 
-		if( typeid( NType ) == typeid( bool ) )
-			result = ( ( source == "true" ) || ( source == "yes" ) ) ? true : false;
-		else if( base == Stringizable::BINARY )
-			result = static_cast< NType >( std::bitset< ( sizeof( NType ) * 8 ) >( targetSource ).to_ullong() );
+		if constexpr( std::is_same< NType, bool >::value )
+		{
+			QMX_EXPECT(
+				( ( source == "true" ) || ( source == "yes" ) || ( source == "false" ) || ( source == "no" ) ), "QMXStdLib", "String::toValue", "00000031"
+			);
+
+			result = ( ( source == "true" ) || ( source == "yes" ) );
+		}
+		else if constexpr( std::is_floating_point< NType >::value )
+		{
+			if( ( source.size() > 1 ) && ( source[ 0 ] == '+' ) && ( source[ 1 ] != '-' ) )
+				source.remove_prefix( 1 );
+
+			status = std::from_chars( source.data(), ( source.data() + source.size() ), result );
+
+			QMX_EXPECT(
+				( ( status.ec != std::errc::invalid_argument ) && ( status.ptr == ( source.data() + source.size() ) ) ),
+				"QMXStdLib",
+				"String::toValue",
+				"00000031"
+			);
+			QMX_EXPECT( ( status.ec != std::errc::result_out_of_range ), "QMXStdLib", "String::toValue", "00000032" );
+		}
+		else if( ( base == Stringizable::BINARY ) || ( base == Stringizable::OCTAL ) || ( base == Stringizable::HEXIDECIMAL ) )
+		{
+			if( ( base != Stringizable::BINARY ) && !source.empty() && ( ( source[ 0 ] == '-' ) || ( source[ 0 ] == '+' ) ) )
+			{
+				isNegative = ( source[ 0 ] == '-' );
+				source.remove_prefix( 1 );
+			}
+
+			if( ( base != Stringizable::OCTAL ) && ( source.size() > 2 ) && ( source[ 0 ] == '0' ) )
+			{
+				if(
+					( ( base == Stringizable::BINARY ) && ( ( source[ 1 ] | 0x20 ) == 'b' ) ) ||
+					( ( base == Stringizable::HEXIDECIMAL ) && ( ( source[ 1 ] | 0x20 ) == 'x' ) )
+				)
+					source.remove_prefix( 2 );
+			}
+
+			if( !( magnitude = toMagnitude( source, base ) ) )
+				return magnitude.getError();
+
+			if( base == Stringizable::BINARY )
+			{
+				QMX_EXPECT(
+					!( magnitude.getValue() & ~( std::numeric_limits< uint64_t >::max() >> ( 64 - ( sizeof( NType ) * 8 ) ) ) ),
+					"QMXStdLib",
+					"String::toValue",
+					"00000032"
+				);
+			}
+			else if( isNegative )
+			{
+				QMX_EXPECT(
+					( magnitude.getValue() <= ( std::is_signed< NType >::value ? ( uint64_t( std::numeric_limits< NType >::max() ) + 1 ) : 0 ) ),
+					"QMXStdLib",
+					"String::toValue",
+					"00000032"
+				);
+
+				magnitude = ( 0 - magnitude.getValue() );
+			}
+			else
+			{
+				QMX_EXPECT( ( magnitude.getValue() <= uint64_t( std::numeric_limits< NType >::max() ) ), "QMXStdLib", "String::toValue", "00000032" );
+			}
+
+			result = static_cast< NType >( magnitude.getValue() );
+		}
 		else
-			value >> ( ( base == Stringizable::OCTAL ) ? std::oct : ( ( base == Stringizable::HEXIDECIMAL ) ? std::hex : std::dec ) ) >> result;
+		{
+			if( ( source.size() > 1 ) && ( source[ 0 ] == '+' ) && ( source[ 1 ] != '-' ) )
+				source.remove_prefix( 1 );
+
+			status = std::from_chars( source.data(), ( source.data() + source.size() ), result );
+
+			QMX_EXPECT(
+				( ( status.ec != std::errc::invalid_argument ) && ( status.ptr == ( source.data() + source.size() ) ) ),
+				"QMXStdLib",
+				"String::toValue",
+				"00000031"
+			);
+			QMX_EXPECT( ( status.ec != std::errc::result_out_of_range ), "QMXStdLib", "String::toValue", "00000032" );
+		}
+
+	// Return result to calling routine.
+
+		return result;
+}
+
+/**
+  * @brief This function defines the structure for a string to numeric value converter.
+  *
+  * The string is parsed as described for 'tryToValue'; if it is malformed or out-of-range for 'NType', the value will always be zero (or 'false').
+  *
+  * @param source
+  * 	This is the string to convert into a numeric value.
+  *
+  * @param base
+  * 	This is the numeric base to use during the conversion; if it is out-of-range, it will be set to decimal.
+  *
+  * @return
+  * 	A numeric representation of the specified string.
+  */
+
+template< typename NType > NType toValue( std::string_view source, Stringizable::NumericBase base = Stringizable::DECIMAL ) noexcept
+{
+	// Return result to calling routine.
+
+		return tryToValue< NType >( source, base ).getValueOr( NType( UNSET ) );
+}
+
+/**
+  * @brief This function defines the structure for a batch string to numeric value converter, which fills a contiguous array.
+  *
+  * Each string is parsed as described for 'tryToValue', and conversion stops at the first one which fails; calling 'tryToValue' on that string gives the
+  * reason.  This pairs with the 'string_view' variant of 'tokenize', for parsing whole CSV records or configuration lists at once.
+  *
+  * @param source
+  * 	This is the array of strings to convert.
+  *
+  * @param count
+  * 	This is the number of strings to convert.
+  *
+  * @param target
+  * 	This is the array into which the numeric values are written; it must hold at least 'count' values.
+  *
+  * @param base
+  * 	This is the numeric base to use during the conversion; if it is out-of-range, it will be set to decimal.
+  *
+  * @return
+  * 	The number of strings converted, which is equal to 'count' if all of them were converted.
+  */
+
+template< typename NType > size_t toValues(
+	const std::string_view* source,
+	size_t count,
+	NType* target,
+	Stringizable::NumericBase base = Stringizable::DECIMAL
+) noexcept
+{
+	// Create local variables.
+
+		size_t result = 0;
+
+	// Convert each string until one fails.
+
+		for( ; result < count; result++ )
+		{
+			Expected< NType > value = tryToValue< NType >( source[ result ], base );
+
+			if( !value )
+				break;
+
+			target[ result ] = value.getValue();
+		}
 
 	// Return result to calling routine.
 
@@ -0,0 +1,555 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// TaskPool.hpp
+// Robert M. Baker | Created : 16OCT26 | Last Modified : 17OCT26 by Robert M. Baker
+// Version : 2.3.0
+// This is a header file for 'QMXStdLib'; it defines the interface for a work-stealing task pool class.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+//
+// This file is part of 'QMXStdLib'.
+//
+// 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option) any later version.
+//
+// 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+  * @file
+  * @author  Robert M. Baker
+  * @date    Created : 16OCT26
+  * @date    Last Modified : 17OCT26 by Robert M. Baker
+  * @version 2.3.0
+  *
+  * @brief This header file defines the interface for a work-stealing task pool class.
+  *
+  * @section TaskPoolH0000 Description
+  *
+  * This header file defines the interface for a work-stealing task pool class.
+  *
+  * @section TaskPoolH0001 License
+  *
+  * Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+  *
+  * This file is part of 'QMXStdLib'.
+  *
+  * 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+  * Software Foundation, either version 3 of the License, or (at your option) any later version.
+  *
+  * 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+  * A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+  *
+  * You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+  */
+
+#ifndef __QMX_QMXSTDLIB_TASKPOOL_HPP_
+#define __QMX_QMXSTDLIB_TASKPOOL_HPP_
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Header Files
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <atomic>
+#include <functional>
+#include <future>
+#include <type_traits>
+
+#include "Base.hpp"
+#include "Object.hpp"
+#include "RAII/ScopedLock.hpp"
+#include "RAII/ScopedStackTrace.hpp"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Start of the 'QMXStdLib' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace QMXStdLib
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// The 'TaskGroup' Class
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+  * @class TaskGroup TaskPool.hpp "include/TaskPool.hpp"
+  *
+  * @brief This class defines the bookkeeping for a group of pooled tasks.
+  *
+  * A task group tracks how many of its tasks are still pending, so that they can be waited on as a unit, and carries the interruption state used by
+  * 'TaskPool::interrupt'.  Tasks hold a reference to their group, so a group may safely be released while some of its tasks are still running.
+  *
+  * Platform Independent     : Yes<br>
+  * Architecture Independent : Yes<br>
+  * Thread-Safe              : Yes
+  */
+
+class TaskGroup
+{
+	// Friend Classes
+
+		friend class TaskPool;
+
+public:
+
+	// Public Constructors
+
+		/**
+		  * @brief This is the default constructor.
+		  */
+
+		TaskGroup();
+
+	// Destructor
+
+		/**
+		  * @brief This is the destructor.
+		  */
+
+		virtual ~TaskGroup();
+
+	// Public Methods
+
+		/**
+		  * @brief This method retrieves the number of tasks in this group which have been submitted but have not yet finished.
+		  *
+		  * @return
+		  * 	The number of pending tasks.
+		  */
+
+		size_t getPendingCount() const;
+
+		/**
+		  * @brief This method blocks until all pending tasks in this group have finished.
+		  *
+		  * This is also a predefined interruption point.
+		  *
+		  * @exception ThreadInterrupted
+		  * 	If the current thread has been issued an interrupt request, and interruption is enabled for the current thread.
+		  */
+
+		void wait() const;
+
+		/**
+		  * @brief This method blocks until either all pending tasks in this group have finished or the timeout duration is reached.
+		  *
+		  * This is also a predefined interruption point.
+		  *
+		  * @param duration
+		  * 	This is the timeout duration to use; it can be an instantiation of one of the following classes: 'Nanoseconds', 'Microseconds', 'Milliseconds',
+		  * 	'Seconds', 'Minutes', or 'Hours'.
+		  *
+		  * @return
+		  * 	A boolean value of 'true' if all pending tasks have finished, and 'false' otherwise.
+		  *
+		  * @exception ThreadInterrupted
+		  * 	If the current thread has been issued an interrupt request, and interruption is enabled for the current thread.
+		  */
+
+		template< typename RType, typename PType > bool tryWait( const boost::chrono::duration< RType, PType >& duration ) const
+		{
+			// Create local variables.
+
+				boost::unique_lock< boost::mutex > lock( groupMutex );
+
+			// Wait for all pending tasks to finish, or for the specified timeout duration to be reached.
+
+				return groupCondition.wait_for( lock, duration, [ this ](){ return !pendingCount; } );
+		}
+
+private:
+
+	// Private Fields
+
+		/**
+		  * @brief This is the mutex protecting the pending task count.
+		  */
+
+		mutable boost::mutex groupMutex;
+
+		/**
+		  * @brief This is the condition variable signaled when the last pending task finishes.
+		  */
+
+		mutable boost::condition_variable groupCondition;
+
+		/**
+		  * @brief This is the number of pending tasks.
+		  */
+
+		size_t pendingCount;
+
+		/**
+		  * @brief This is the interruption epoch; tasks submitted before the current epoch are interrupted or cancelled.
+		  */
+
+		std::atomic< uint64_t > epoch;
+
+	// Private Methods
+
+		/**
+		  * @brief This method registers a newly submitted task.
+		  */
+
+		void addPending();
+
+		/**
+		  * @brief This method unregisters a finished task, waking any waiters if it was the last one.
+		  */
+
+		void removePending();
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Type Definitions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+STANDARD_TYPEDEFS_X( TaskGroup,                  TaskGroup );
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// The 'TaskPool' Class
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+  * @class TaskPool TaskPool.hpp "include/TaskPool.hpp"
+  *
+  * @brief This class defines a work-stealing task pool.
+  *
+  * The pool runs a fixed set of worker threads, each owning a deque of tasks.  Workers pop their own tasks in LIFO order and, when idle, steal from the
+  * front of the other workers' deques.  Tasks submitted from inside a worker are pushed onto that worker's deque, while tasks submitted from any other
+  * thread are distributed round-robin.  Every task may belong to a 'TaskGroup', which can be waited on and interrupted as a unit.
+  *
+  * Platform Independent     : Yes<br>
+  * Architecture Independent : Yes<br>
+  * Thread-Safe              : Yes
+  */
+
+class TaskPool : public Object< TaskPool >
+{
+	// Friend Classes
+
+		friend class Object< TaskPool >;
+
+public:
+
+	// Destructor
+
+		/**
+		  * @brief This is the destructor.
+		  */
+
+		~TaskPool();
+
+	// Public Methods
+
+		/**
+		  * @brief This method starts the pool's worker threads.
+		  *
+		  * @param workerCount
+		  * 	This is the number of worker threads to start; if it is zero, one worker per physical core is started, falling back to the number of logical cores
+		  * 	and finally to a single worker if neither count is available.
+		  *
+		  * @exception QMXException
+		  * 	If the pool is already running.
+		  */
+
+		void start( const uint32_t workerCount = 0 );
+
+		/**
+		  * @brief This method stops the pool's worker threads.
+		  *
+		  * Tasks which are still queued are either cancelled or run to completion, depending on 'doInterrupt'.  A cancelled task never runs; its future will
+		  * throw 'ThreadInterrupted' instead.
+		  *
+		  * @param doInterrupt
+		  * 	This is a boolean value which determines if queued tasks are cancelled and running tasks are interrupted, rather than drained.
+		  *
+		  * @param doJoin
+		  * 	This is a boolean value which determines if this method waits for the worker threads to exit, or detaches them.
+		  *
+		  * @exception QMXException
+		  * 	If the pool is not running.
+		  */
+
+		void stop( const bool doInterrupt = true, const bool doJoin = true );
+
+		/**
+		  * @brief This method retrieves the number of worker threads.
+		  *
+		  * @return
+		  * 	The number of worker threads, or '0' if the pool is not running.
+		  */
+
+		uint32_t getWorkerCount() const;
+
+		/**
+		  * @brief This method interrupts all tasks in the specified group which were submitted before this call.
+		  *
+		  * Queued tasks are cancelled, and running tasks have an interrupt request issued to their worker thread, which takes effect upon entering any
+		  * predefined interruption point.  Tasks submitted after this call are not affected.
+		  *
+		  * @param group
+		  * 	This is the group whose tasks are interrupted.
+		  */
+
+		void interrupt( const TaskGroupPtr& group );
+
+		/**
+		  * @brief This method submits a task to the pool.
+		  *
+		  * This method never blocks on the pool's own lock, so tasks running in the pool may freely submit further tasks.
+		  *
+		  * @param group
+		  * 	This is the group the task belongs to; it may be null, in which case the task can only be interrupted by stopping the pool.
+		  *
+		  * @param targetFunction
+		  * 	This is the function which will be called by a worker thread.
+		  *
+		  * @param targetArguments
+		  * 	This is a list of arguments to be sent to 'targetFunction'.
+		  *
+		  * @return
+		  * 	A future which will receive the function's result, or any exception it throws.
+		  *
+		  * @exception QMXException
+		  * 	If the pool is not running, or is being stopped by another thread.
+		  */
+
+		template< typename Type, typename... ATypes > std::future< typename std::invoke_result< Type, ATypes... >::type > submit(
+			const TaskGroupPtr& group,
+			Type targetFunction,
+			ATypes... targetArguments
+		)
+		{
+			// Create scoped stack traces.
+
+				SCOPED_STACK_TRACE( "TaskPool::submit", 0000 );
+
+			// Create local variables.
+
+				typedef typename std::invoke_result< Type, ATypes... >::type ResultType;
+
+				SchedulerPtr targetScheduler = std::atomic_load( &scheduler );
+				std::unique_ptr< TaskImp< ResultType > > task;
+				std::future< ResultType > result;
+
+			// Submit task to the pool, if it is running.
+
+				QMX_ASSERT( targetScheduler, "QMXStdLib", "TaskPool::submit", "00000029", "" );
+
+				task = std::make_unique< TaskImp< ResultType > >(
+					group,
+					[ targetFunction, targetArguments... ]() mutable -> ResultType { return std::invoke( targetFunction, targetArguments... ); }
+				);
+
+				result = task->getFuture();
+				enqueue( targetScheduler, std::move( task ) );
+
+			// Return result to calling routine.
+
+				return result;
+		}
+
+private:
+
+	// Private Data Types
+
+		/**
+		  * @brief This class is the type-erased base for a queued task.
+		  */
+
+		class Task
+		{
+		public:
+
+			// Public Constructors
+
+				/**
+				  * @brief This is the constructor.
+				  *
+				  * @param targetGroup
+				  * 	This is the group the task belongs to; it may be null.
+				  */
+
+				Task( const TaskGroupPtr& targetGroup ) : group( targetGroup ), epoch( targetGroup ? targetGroup->epoch.load() : UNSET )
+				{
+					// Do nothing.
+				}
+
+			// Destructor
+
+				/**
+				  * @brief This is the destructor.
+				  */
+
+				virtual ~Task()
+				{
+					// Do nothing.
+				}
+
+			// Public Methods
+
+				/**
+				  * @brief This method runs the task, or cancels it.
+				  *
+				  * @param isCancelled
+				  * 	This is a boolean value which determines if the task is cancelled instead of run.
+				  */
+
+				virtual void run( const bool isCancelled ) = PURE_VIRTUAL;
+
+			// Public Fields
+
+				/**
+				  * @brief This is the group the task belongs to.
+				  */
+
+				TaskGroupPtr group;
+
+				/**
+				  * @brief This is the group's interruption epoch at the time the task was submitted.
+				  */
+
+				uint64_t epoch;
+		};
+
+		/**
+		  * @brief This class binds a task's callable to the promise of its future.
+		  */
+
+		template< typename RType > class TaskImp : public Task
+		{
+		public:
+
+			// Public Constructors
+
+				/**
+				  * @brief This is the constructor.
+				  *
+				  * @param targetGroup
+				  * 	This is the group the task belongs to; it may be null.
+				  *
+				  * @param targetFunction
+				  * 	This is the callable to run.
+				  */
+
+				template< typename FType > TaskImp( const TaskGroupPtr& targetGroup, FType&& targetFunction ) :
+					Task( targetGroup ),
+					localTask(
+						[ function = std::forward< FType >( targetFunction ) ]( const bool isCancelled ) mutable -> RType
+						{
+							if( isCancelled )
+								throw boost::thread_interrupted();
+
+							return function();
+						}
+					)
+				{
+					// Do nothing.
+				}
+
+			// Public Methods
+
+				/**
+				  * @brief This method retrieves the future associated with the task.
+				  *
+				  * @return
+				  * 	The future associated with the task.
+				  */
+
+				std::future< RType > getFuture()
+				{
+					// Return the task's future to calling routine.
+
+						return localTask.get_future();
+				}
+
+				/**
+				  * @brief This is the overridden implementation for the 'run' method.
+				  *
+				  * @param isCancelled
+				  * 	This is a boolean value which determines if the task is cancelled instead of run.
+				  */
+
+				void run( const bool isCancelled )
+				{
+					// Run task; any exception, including a cancellation, is stored in the task's future.
+
+						localTask( isCancelled );
+				}
+
+		private:
+
+			// Private Fields
+
+				/**
+				  * @brief This is the packaged task.
+				  */
+
+				std::packaged_task< RType( bool ) > localTask;
+		};
+
+		/**
+		  * @brief This class implements the workers, their deques, and the stealing logic; it is defined in 'TaskPool.cpp'.
+		  */
+
+		class Scheduler;
+
+	// Private Type Definitions
+
+		typedef std::unique_ptr< Task > TaskPtr;
+		typedef std::shared_ptr< Scheduler > SchedulerPtr;
+
+	// Private Fields
+
+		/**
+		  * @brief This is the scheduler of the running pool, or null if it is not running; it is only accessed atomically.
+		  */
+
+		SchedulerPtr scheduler;
+
+	// Private Constructors
+
+		/**
+		  * @brief This is the default constructor, which is made private to prevent direct instantiation.
+		  */
+
+		TaskPool();
+
+	// Private Methods
+
+		/**
+		  * @brief This method hands a task over to the specified scheduler.
+		  *
+		  * @param targetScheduler
+		  * 	This is the scheduler which will run the task.
+		  *
+		  * @param task
+		  * 	This is the task to queue.
+		  *
+		  * @exception QMXException
+		  * 	If the scheduler began stopping before the task could be queued.
+		  */
+
+		void enqueue( const SchedulerPtr& targetScheduler, TaskPtr task );
+
+		/**
+		  * @brief This is the overridden implementation for the 'deallocate' method.
+		  */
+
+		void deallocateImp();
+};
+
+} // 'QMXStdLib' Namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of the 'QMXStdLib' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // __QMX_QMXSTDLIB_TASKPOOL_HPP_
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of 'TaskPool.hpp'
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
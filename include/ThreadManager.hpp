@@ -1,6 +1,6 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // ThreadManager.hpp
-// Robert M. Baker | Created : 24FEB16 | Last Modified : 31AUG19 by Robert M. Baker
+// Robert M. Baker | Created : 24FEB16 | Last Modified : 17OCT26 by Robert M. Baker
 // Version : 2.3.0
 // This is a header file for 'QMXStdLib'; it defines the interface for a thread manager class.
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -21,7 +21,7 @@
   * @file
   * @author  Robert M. Baker
   * @date    Created : 24FEB16
-  * @date    Last Modified : 31AUG19 by Robert M. Baker
+  * @date    Last Modified : 17OCT26 by Robert M. Baker
   * @version 2.3.0
   *
   * @brief This is a header file for 'QMXStdLib'; it defines the interface for a thread manager class.
@@ -53,7 +53,9 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "Base.hpp"
+#include "Expected.hpp"
 #include "Object.hpp"
+#include "TaskPool.hpp"
 #include "Mixins/Singleton.hpp"
 #include "RAII/ScopedLock.hpp"
 
@@ -130,6 +132,12 @@ public:
 				  */
 
 				BarrierPtr groupBarrier;
+
+				/**
+				  * @brief This is the group's bookkeeping for tasks submitted to the task pool.
+				  */
+
+				TaskGroupPtr tasks;
 		};
 
 	// Destructor
@@ -164,7 +172,8 @@ public:
 		  * 	This is a boolean value which determines if a non-empty group should have its threads destroyed.
 		  *
 		  * @param doInterrupt
-		  * 	This is a boolean value which determines if destroyed threads are interrupted or detached.
+		  * 	This is a boolean value which determines if destroyed threads are interrupted or detached; if 'true', the group's pooled tasks are interrupted
+		  * 	as well.
 		  *
 		  * @exception QMXException
 		  * 	If the specified thread group does not exist.<br>
@@ -275,11 +284,32 @@ public:
 
 		void join( const std::string& groupID, const std::string& threadID );
 
+		/**
+		  * @brief This method joins the specified thread in the specified group without throwing if either does not exist.
+		  *
+		  * Unlike the timed 'tryJoin', this blocks until the thread exits.
+		  *
+		  * @param groupID
+		  * 	This is a string containing the thread group's ID.
+		  *
+		  * @param threadID
+		  * 	This is a string containing the thread's ID.
+		  *
+		  * @return
+		  * 	A successful result if the thread was joined, or the error 'join' would have thrown.
+		  *
+		  * @exception ThreadInterrupted
+		  * 	If the current thread has been issued an interrupt request, and interruption is enabled for the current thread.
+		  */
+
+		Expected< void > tryJoin( const std::string& groupID, const std::string& threadID );
+
 		/**
 		  * @brief This method joins all the threads in the specified group, if it exists.
 		  *
-		  * This will cause the thread calling this method to block until all threads in the specified group exit, which is useful to ensure all spawned threads
-		  * in a group have completed their task before proceeding.  This is also a predefined interruption point.
+		  * This will cause the thread calling this method to block until all threads in the specified group exit, and all tasks submitted to the group have
+		  * finished, which is useful to ensure all spawned threads in a group have completed their task before proceeding.  This is also a predefined
+		  * interruption point.
 		  *
 		  * @param groupID
 		  * 	This is a string containing the thread group's ID.
@@ -293,6 +323,23 @@ public:
 
 		void joinAll( const std::string& groupID );
 
+		/**
+		  * @brief This method joins all the threads in the specified group without throwing if it does not exist.
+		  *
+		  * Unlike the timed 'tryJoinAll', this blocks until all threads exit and all tasks finish.
+		  *
+		  * @param groupID
+		  * 	This is a string containing the thread group's ID.
+		  *
+		  * @return
+		  * 	A successful result if the group was joined, or the error 'joinAll' would have thrown.
+		  *
+		  * @exception ThreadInterrupted
+		  * 	If the current thread has been issued an interrupt request, and interruption is enabled for the current thread.
+		  */
+
+		Expected< void > tryJoinAll( const std::string& groupID );
+
 		/**
 		  * @brief This method sends an interrupt request to the specified thread in the specified group, if both group and thread exist.
 		  *
@@ -315,14 +362,30 @@ public:
 
 		void interrupt( const std::string& groupID, const std::string& threadID );
 
+		/**
+		  * @brief This method sends an interrupt request to the specified thread in the specified group without throwing if either does not exist.
+		  *
+		  * @param groupID
+		  * 	This is a string containing the thread group's ID.
+		  *
+		  * @param threadID
+		  * 	This is a string containing the thread's ID.
+		  *
+		  * @return
+		  * 	A successful result if the request was sent, or the error 'interrupt' would have thrown.
+		  */
+
+		Expected< void > tryInterrupt( const std::string& groupID, const std::string& threadID );
+
 		/**
 		  * @brief This method sends an interrupt request to all threads in the specified group, if it exists.
 		  *
 		  * This request will cause all threads in the specified group to be interrupted, if interruption is enabled, upon entering any of the predefined
-		  * interruption points.  The 'interruptionRequested' method can be used to process the request manually, regardless of wether or not interruption is
-		  * enabled.  In addition to the 'interruptionPoint' method, the following are also predefined points of interruption: 'wait', 'join', 'joinAll',
-		  * 'tryJoin', and 'tryJoinAll'.  Interruption can be disabled via the class 'DisableInterruption', which will disable interruption for the current thread
-		  * upon construction and restore the previous state upon destruction.
+		  * interruption points.  Tasks submitted to the group are interrupted the same way if they are running, and are cancelled if they are still queued.  The
+		  * 'interruptionRequested' method can be used to process the request manually, regardless of wether or not interruption is enabled.  In addition to the
+		  * 'interruptionPoint' method, the following are also predefined points of interruption: 'wait', 'join', 'joinAll', 'tryJoin', and
+		  * 'tryJoinAll'.  Interruption can be disabled via the class 'DisableInterruption', which will disable interruption for the current thread upon
+		  * construction and restore the previous state upon destruction.
 		  *
 		  * @param GroupID
 		  * 	This is a string containing the thread group's ID.
@@ -333,6 +396,18 @@ public:
 
 		void interruptAll( const std::string& GroupID );
 
+		/**
+		  * @brief This method sends an interrupt request to all threads in the specified group without throwing if it does not exist.
+		  *
+		  * @param groupID
+		  * 	This is a string containing the thread group's ID.
+		  *
+		  * @return
+		  * 	A successful result if the requests were sent, or the error 'interruptAll' would have thrown.
+		  */
+
+		Expected< void > tryInterruptAll( const std::string& groupID );
+
 		/**
 		  * @brief This method determines if an interrupt request has been issued for the current thread.
 		  *
@@ -374,6 +449,40 @@ public:
 
 		uint32_t getPhysicalCoreCount() const;
 
+		/**
+		  * @brief This method starts the task pool, which runs tasks submitted via 'submit' on a fixed set of work-stealing worker threads.
+		  *
+		  * @param workerCount
+		  * 	This is the number of worker threads to start; if it is zero, one worker per physical core is started, falling back to the number of logical cores
+		  * 	and finally to a single worker if neither count is available.
+		  *
+		  * @exception QMXException
+		  * 	If the task pool is already running.
+		  */
+
+		void startPool( const uint32_t workerCount = 0 );
+
+		/**
+		  * @brief This method stops the task pool.
+		  *
+		  * @param doInterrupt
+		  * 	This is a boolean value which determines if queued tasks are cancelled and running tasks are interrupted, rather than drained.
+		  *
+		  * @exception QMXException
+		  * 	If the task pool is not running.
+		  */
+
+		void stopPool( const bool doInterrupt = true );
+
+		/**
+		  * @brief This method retrieves the number of worker threads in the task pool.
+		  *
+		  * @return
+		  * 	The number of worker threads in the task pool, or '0' if it is not running.
+		  */
+
+		uint32_t getPoolSize() const;
+
 		/**
 		  * @brief This method creates a thread in the specified group, if both group and thread are valid.
 		  *
@@ -431,7 +540,55 @@ public:
 		}
 
 		/**
-		  * @brief This method joins the specified thread in the specified group with a timeout duration, if both group and thread exist.
+		  * @brief This method submits a task to the task pool on behalf of the specified group, if it exists.
+		  *
+		  * Unlike 'createThread', no thread is created; the task is queued and run by one of the pool's worker threads.  The task takes part in the group's
+		  * 'joinAll', 'tryJoinAll', and 'interruptAll' calls.
+		  *
+		  * @param groupID
+		  * 	This is a string containing the thread group's ID.
+		  *
+		  * @param targetFunction
+		  * 	This is the function which will be called by a worker thread.
+		  *
+		  * @param targetArguments
+		  * 	This is a list of arguments to be sent to 'targetFunction'.
+		  *
+		  * @return
+		  * 	A future which will receive the function's result, or any exception it throws; if the task is cancelled, it will throw 'ThreadInterrupted'.
+		  *
+		  * @exception QMXException
+		  * 	If the specified thread group does not exist.<br>
+		  * 	If the task pool is not running.
+		  */
+
+		template< typename Type, typename... ATypes > std::future< typename std::invoke_result< Type, ATypes... >::type > submit(
+			const std::string& groupID,
+			Type targetFunction,
+			ATypes... targetArguments
+		)
+		{
+			// Obtain locks.
+
+				SCOPED_READ_LOCK;
+
+			// Create scoped stack traces.
+
+				SCOPED_STACK_TRACE( "ThreadManager::submit", 0000 );
+
+			// Create local variables.
+
+				auto groupMapIterator = groups.find( groupID );
+
+			// Submit task to the task pool on behalf of the specified group, if it exists.
+
+				QMX_ASSERT( ( groupMapIterator != groups.end() ), "QMXStdLib", "ThreadManager::submit", "0000002A", groupID );
+
+				return pool->submit( groupMapIterator->second.tasks, targetFunction, targetArguments... );
+		}
+
+		/**
+		  * @brief This method joins the specified thread in the specified group with a timeout duration, without throwing if either does not exist.
 		  *
 		  * This will cause the thread calling this method to block until either the specified thread exits or the timeout duration is reached, which is useful to
 		  * wait for a spawned thread only a reasonable amount of time before proceeding.  This is also a predefined interruption point.
@@ -447,49 +604,51 @@ public:
 		  * 	'Seconds', 'Minutes', or 'Hours'.
 		  *
 		  * @return
-		  * 	A boolean value of 'true' if the thread was successfully joined, and 'false' otherwise.
+		  * 	A result holding 'true' if the thread was successfully joined and 'false' if the timeout duration was reached, or the error 'join' would have
+		  * 	thrown.  The boolean conversion of the result only reports whether the group and thread exist.
 		  *
 		  * @exception ThreadInterrupted
 		  * 	If the current thread has been issued an interrupt request, and interruption is enabled for the current thread.
-		  *
-		  * @exception QMXException
-		  * 	If the specified thread group does not exist.<br>
-		  * 	If the specified thread does not exist within the specified group.
 		  */
 
-		template< typename RType, typename PType > bool tryJoin(
+		template< typename RType, typename PType > Expected< bool > tryJoin(
 			const std::string& groupID,
 			const std::string& threadID,
 			const boost::chrono::duration< RType, PType >& duration
 		)
 		{
-			// Obtain locks.
+			// Create local variables.
 
-				SCOPED_READ_LOCK;
+				bool result = false;
+				ThreadPtr targetThread;
 
 			// Create scoped stack traces.
 
 				SCOPED_STACK_TRACE( "ThreadManager::tryJoin", 0000 );
 
-			// Create local variables.
+			// Read Scope
+			{
+				// Obtain locks.
 
-				bool result = UNSET;
-				auto groupMapIterator = groups.find( groupID );
-				ThreadPtrMap::iterator threadPtrMapIterator;
+					SCOPED_READ_LOCK;
 
-			// Join specified thread in specified group with specified timeout duration, if both group and thread exist.
+				// Create local variables.
 
-				QMX_ASSERT( ( groupMapIterator != groups.end() ), "QMXStdLib", "ThreadManager::tryJoin", "0000001F", groupID << ", " << threadID );
-				threadPtrMapIterator = groupMapIterator->second.threads.find( threadID );
-				QMX_ASSERT( ( threadPtrMapIterator != groupMapIterator->second.threads.end() ),
-					"QMXStdLib",
-					"ThreadManager::tryJoin",
-					"00000020",
-					groupID << ", " << threadID
-				);
+					auto groupMapIterator = groups.find( groupID );
+					ThreadPtrMap::iterator threadPtrMapIterator;
 
-				if( threadPtrMapIterator->second->joinable() )
-					result = threadPtrMapIterator->second->try_join_for( duration );
+				// Obtain specified thread in specified group, if both group and thread exist.
+
+					QMX_EXPECT( ( groupMapIterator != groups.end() ), "QMXStdLib", "ThreadManager::tryJoin", "0000001F" );
+					threadPtrMapIterator = groupMapIterator->second.threads.find( threadID );
+					QMX_EXPECT( ( threadPtrMapIterator != groupMapIterator->second.threads.end() ), "QMXStdLib", "ThreadManager::tryJoin", "00000020" );
+					targetThread = threadPtrMapIterator->second;
+			}
+
+			// Join thread with specified timeout duration, if possible.
+
+				if( targetThread->joinable() )
+					result = targetThread->try_join_for( duration );
 
 			// Return result to calling routine.
 
@@ -497,11 +656,11 @@ public:
 		}
 
 		/**
-		  * @brief This method joins all the threads in the specified group with a timeout duration, if it exists.
+		  * @brief This method joins all the threads in the specified group with a timeout duration, without throwing if it does not exist.
 		  *
 		  * This will cause the thread calling this method to block until either all threads in the specified group exit or the timeout duration is reached (which
-		  * is applied per thread), which is useful to wait for all spawned threads in a group only a reasonable amount of time before proceeding.  This is also a
-		  * predefined interruption point.
+		  * is applied per thread, and once more for the group's pooled tasks), which is useful to wait for all spawned threads in a group only a reasonable
+		  * amount of time before proceeding.  This is also a predefined interruption point.
 		  *
 		  * @param groupID
 		  * 	This is a string containing the thread group's ID.
@@ -511,40 +670,60 @@ public:
 		  * 	'Seconds', 'Minutes', or 'Hours'.
 		  *
 		  * @return
-		  * 	A boolean value of 'true' if all threads were successfully joined, and 'false' otherwise.
+		  * 	A result holding 'true' if all threads were successfully joined and all tasks finished, and 'false' otherwise, or the error 'joinAll' would have
+		  * 	thrown.  The boolean conversion of the result only reports whether the group exists.
 		  *
 		  * @exception ThreadInterrupted
 		  * 	If the current thread has been issued an interrupt request, and interruption is enabled for the current thread.
-		  *
-		  * @exception QMXException
-		  * 	If the specified thread group does not exist.
 		  */
 
-		template< typename RType, typename PType > bool tryJoinAll( const std::string& groupID, const boost::chrono::duration< RType, PType >& duration )
+		template< typename RType, typename PType > Expected< bool > tryJoinAll(
+			const std::string& groupID,
+			const boost::chrono::duration< RType, PType >& duration
+		)
 		{
-			// Obtain locks.
+			// Create local variables.
 
-				SCOPED_READ_LOCK;
+				bool result = true;
+				ThreadPtrVector targetThreads;
+				TaskGroupPtr targetTasks;
 
 			// Create scoped stack traces.
 
 				SCOPED_STACK_TRACE( "ThreadManager::tryJoinAll", 0000 );
 
-			// Create local variables.
+			// Read Scope
+			{
+				// Obtain locks.
 
-				bool result = UNSET;
-				auto groupMapIterator = groups.find( groupID );
+					SCOPED_READ_LOCK;
+
+				// Create local variables.
+
+					auto groupMapIterator = groups.find( groupID );
+
+				// Obtain all spawned threads and the pooled task bookkeeping for specified group, if it exists.
+
+					QMX_EXPECT( ( groupMapIterator != groups.end() ), "QMXStdLib", "ThreadManager::tryJoinAll", "00000021" );
+					targetThreads.reserve( groupMapIterator->second.threads.size() );
+
+					for( auto& index : groupMapIterator->second.threads )
+						targetThreads.push_back( index.second );
 
-			// Join all spawned threads for specified group with specified timeout duration, if it exists.
+					targetTasks = groupMapIterator->second.tasks;
+			}
 
-				QMX_ASSERT( ( groupMapIterator != groups.end() ), "QMXStdLib", "ThreadManager::tryJoinAll", "00000021", groupID );
+			// Join threads with specified timeout duration, if possible, then wait for the group's pooled tasks to finish.
 
-				for( auto& index : groupMapIterator->second.threads )
+				for( auto& index : targetThreads )
 				{
-					if( index.second->joinable() )
-						result = index.second->try_join_for( duration );
+					if( index->joinable() && !index->try_join_for( duration ) )
+						result = false;
 				}
 
+				if( !targetTasks->tryWait( duration ) )
+					result = false;
+
 			// Return result to calling routine.
 
 				return result;
@@ -564,6 +743,12 @@ private:
 
 		GroupMap groups;
 
+		/**
+		  * @brief This is the task pool used by 'submit'.
+		  */
+
+		TaskPool::InstancePtr pool;
+
 	// Private Constructors
 
 		/**
@@ -574,6 +759,12 @@ private:
 
 	// Private Methods
 
+		/**
+		  * @brief This is the overridden implementation for the 'allocate' method.
+		  */
+
+		void allocateImp();
+
 		/**
 		  * @brief This is the overridden implementation for the 'Deallocate' method.
 		  */
@@ -1,6 +1,6 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Timer.hpp
-// Robert M. Baker | Created : 11JAN12 | Last Modified : 31AUG19 by Robert M. Baker
+// Robert M. Baker | Created : 11JAN12 | Last Modified : 17OCT26 by Robert M. Baker
 // Version : 2.3.0
 // This is a header file for 'QMXStdLib'; it defines the interface for a timer class.
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -21,7 +21,7 @@
   * @file
   * @author  Robert M. Baker
   * @date    Created : 11JAN12
-  * @date    Last Modified : 31JAN19 by Robert M. Baker
+  * @date    Last Modified : 17OCT26 by Robert M. Baker
   * @version 2.3.0
   *
   * @brief This header file defines the interface for a timer class.
@@ -52,7 +52,9 @@
 // Header Files
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-#include <boost/timer/timer.hpp>
+#include <atomic>
+#include <cstdint>
+#include <boost/chrono/duration.hpp>
 
 #include "Base.hpp"
 #include "Object.hpp"
@@ -86,7 +88,9 @@ typedef boost::chrono::hours        Hours;
   *
   * @brief This class defines timer algorithms.
   *
-  * These algorithms are useful for such things as timing durations and synchronizing events.
+  * These algorithms are useful for such things as timing durations and synchronizing events.  Time is read from the steady clock by default, or from the
+  * processor's time-stamp counter where it is invariant, and neither involves a system call.  Reading the elapsed time takes no lock; it retries if the timer
+  * is toggled at the same moment.  Process CPU time is only sampled when enabled.
   *
   * Platform Independent     : Yes<br>
   * Architecture Independent : Yes<br>
@@ -109,12 +113,24 @@ public:
 
 		enum TimeUnits : unsigned long long int
 		{
+			NANOSECONDS = 1ull,
+			MICROSECONDS = 1000ull,
 			MILLISECONDS = 1000000ull,
 			SECONDS = 1000000000ull,
 			MINUTES = 60000000000ull,
 			HOURS = 3600000000000ull
 		};
 
+		/**
+		  * @brief This enumeration defines all clocks a timer can read.
+		  */
+
+		enum ClockSource
+		{
+			STEADY,
+			TSC
+		};
+
 	// Destructor
 
 		/**
@@ -146,11 +162,20 @@ public:
 
 		void reset();
 
+		/**
+		  * @brief This method gets the elapsed time in nanoseconds.
+		  *
+		  * @return
+		  * 	The elapsed time in nanoseconds.
+		  */
+
+		int64_t getNanoseconds() const;
+
 		/**
 		  * @brief This method gets the elapsed time in the specified units.
 		  *
 		  * @param units
-		  * 	This is the time units specifier; if it is set to an out-of-range value, it will be set to seconds.
+		  * 	This is the time units specifier.
 		  *
 		  * @return
 		  * 	The elapsed time in the specified units.
@@ -158,15 +183,127 @@ public:
 
 		real_t getTime( TimeUnits units = SECONDS ) const;
 
+		/**
+		  * @brief This method sets the clock the timer reads; time already elapsed is kept.
+		  *
+		  * @param source
+		  * 	This is the clock to read; 'TSC' falls back to 'STEADY' if the time-stamp counter is unavailable or not invariant.
+		  */
+
+		void setClockSource( ClockSource source );
+
+		/**
+		  * @brief This method gets the clock the timer reads.
+		  *
+		  * @return
+		  * 	The clock the timer reads.
+		  */
+
+		ClockSource getClockSource() const;
+
+		/**
+		  * @brief This method enables or disables measurement of the CPU time the process spends while the timer runs.
+		  *
+		  * Enabling it adds a system call to every toggle; CPU time already measured is kept.
+		  *
+		  * @param isEnabled
+		  * 	This is a boolean value which determines if CPU time is measured.
+		  */
+
+		void setCpuTimeEnabled( const bool isEnabled );
+
+		/**
+		  * @brief This method reports whether or not CPU time is measured.
+		  *
+		  * @return
+		  * 	A boolean value of 'true' if CPU time is measured, and 'false' otherwise.
+		  */
+
+		bool isCpuTimeEnabled() const;
+
+		/**
+		  * @brief This method gets the CPU time the process has spent while the timer was running and CPU time measurement was enabled.
+		  *
+		  * @return
+		  * 	The CPU time in nanoseconds.
+		  */
+
+		int64_t getCpuNanoseconds() const;
+
+		/**
+		  * @brief This method reads the specified clock.
+		  *
+		  * @param source
+		  * 	This is the clock to read.
+		  *
+		  * @return
+		  * 	The time since the clock's epoch, in nanoseconds.
+		  */
+
+		static int64_t now( ClockSource source = STEADY );
+
+		/**
+		  * @brief This method reports whether or not the time-stamp counter can be used as a clock.
+		  *
+		  * The counter is calibrated against the steady clock on first use, which takes about 20 milliseconds.
+		  *
+		  * @return
+		  * 	A boolean value of 'true' if the time-stamp counter is available and invariant, and 'false' otherwise.
+		  */
+
+		static bool isTscAvailable();
+
 private:
 
 	// Private Fields
 
 		/**
-		  * @brief This is the timer object.
+		  * @brief This is the sequence number of the timer state; it is odd while the state is being changed.
+		  */
+
+		std::atomic< uint64_t > version;
+
+		/**
+		  * @brief This is a boolean value which determines if the timer is running.
+		  */
+
+		std::atomic< bool > running;
+
+		/**
+		  * @brief This is the clock the timer reads.
+		  */
+
+		std::atomic< ClockSource > clockSource;
+
+		/**
+		  * @brief This is the clock reading at which the timer was last started, in nanoseconds.
+		  */
+
+		std::atomic< int64_t > startTime;
+
+		/**
+		  * @brief This is the time accumulated before the timer was last started, in nanoseconds.
+		  */
+
+		std::atomic< int64_t > accumulatedTime;
+
+		/**
+		  * @brief This is a boolean value which determines if CPU time is measured.
+		  */
+
+		std::atomic< bool > cpuTimeEnabled;
+
+		/**
+		  * @brief This is the process CPU time at which measurement last started, in nanoseconds.
 		  */
 
-		boost::timer::cpu_timer localTimer;
+		std::atomic< int64_t > cpuStartTime;
+
+		/**
+		  * @brief This is the CPU time accumulated before measurement last started, in nanoseconds.
+		  */
+
+		std::atomic< int64_t > accumulatedCpuTime;
 
 	// Private Constructors
 
@@ -186,6 +323,28 @@ private:
 		  */
 
 		void cloneImp( InstancePtr& target ) const;
+
+		/**
+		  * @brief This method stops the clocks and folds the time since they were started into the accumulated times; it must be called with the write lock
+		  * held and the version odd.
+		  */
+
+		void stopClocks();
+
+		/**
+		  * @brief This method starts the clocks; it must be called with the write lock held and the version odd.
+		  */
+
+		void startClocks();
+
+		/**
+		  * @brief This method reads the CPU time of the process.
+		  *
+		  * @return
+		  * 	The CPU time of the process, in nanoseconds.
+		  */
+
+		static int64_t getProcessCpuTime();
 };
 
 } // 'QMXStdLib' Namespace
@@ -0,0 +1,429 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// TraceLog.hpp
+// Robert M. Baker | Created : 17OCT26 | Last Modified : 17OCT26 by Robert M. Baker
+// Version : 2.3.0
+// This is a header file for 'QMXStdLib'; it defines the interface for a structured binary trace log class.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+//
+// This file is part of 'QMXStdLib'.
+//
+// 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option) any later version.
+//
+// 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+  * @file
+  * @author  Robert M. Baker
+  * @date    Created : 17OCT26
+  * @date    Last Modified : 17OCT26 by Robert M. Baker
+  * @version 2.3.0
+  *
+  * @brief This header file defines the interface for a structured binary trace log class.
+  *
+  * @section TraceLogH0000 Description
+  *
+  * This header file defines the interface for a structured binary trace log class.
+  *
+  * @section TraceLogH0001 License
+  *
+  * Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+  *
+  * This file is part of 'QMXStdLib'.
+  *
+  * 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+  * Software Foundation, either version 3 of the License, or (at your option) any later version.
+  *
+  * 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+  * A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+  *
+  * You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+  */
+
+#ifndef __QMX_QMXSTDLIB_TRACELOG_HPP_
+#define __QMX_QMXSTDLIB_TRACELOG_HPP_
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Header Files
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <atomic>
+#include <cstring>
+#include <ostream>
+#include <string>
+#include <type_traits>
+
+#include "Base.hpp"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Static Macros
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#define TRACE_LOG( level, format, ... ) \
+	SINGLE_STATEMENT( \
+		static const uint32_t QMX_TRACE_FORMAT_ID = QMXStdLib::TraceLog::registerFormat( format ); \
+		QMXStdLib::TraceLog::write( QMXStdLib::TraceLog::level, QMX_TRACE_FORMAT_ID, ##__VA_ARGS__ ); \
+	)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Start of the 'QMXStdLib' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace QMXStdLib
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// The 'TraceLog' Class
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+  * @class TraceLog TraceLog.hpp "include/TraceLog.hpp"
+  *
+  * @brief This class defines a structured logging sink which writes binary records into a memory-mapped ring file.
+  *
+  * It is defined as a utility class; thus, it cannot be instantiated and contains only static members.  Each record has a fixed layout holding a timestamp,
+  * the thread ID, the level, the ID of its format string, and the raw values of up to 'MAX_ARGUMENTS' arguments, so writing one costs a slot claim and a few
+  * stores; nothing is formatted.  Format strings are stored once in the file when they are registered, and 'decode' renders the records as text offline,
+  * replacing each '{}' in the format string with the next argument.  Since the file is shared with the operating system, records written before a crash
+  * remain in it; a record which was being written when the crash occurred is skipped.  Once the ring is full, the oldest records are overwritten.  A writer
+  * stalled for a full lap of the ring may share its slot with a newer one; each record carries a checksum, so a record torn this way is dropped rather than
+  * decoded.
+  *
+  * Platform Independent     : No (Trace log files can only be mapped on POSIX platforms.)<br>
+  * Architecture Independent : No (Records are stored in the byte order of the writer.)<br>
+  * Thread-Safe              : Yes
+  */
+
+class TraceLog
+{
+public:
+
+	// Public Data Types
+
+		/**
+		  * @brief This enumeration contains all valid record levels.
+		  */
+
+		enum Level
+		{
+			DEBUG_LEVEL,
+			INFO_LEVEL,
+			WARNING_LEVEL,
+			ERROR_LEVEL,
+			FATAL_LEVEL,
+			LEVEL_COUNT
+		};
+
+		/**
+		  * @brief This enumeration contains all valid argument types; each type is stored in four bits of a record.
+		  */
+
+		enum ArgumentType
+		{
+			NO_ARGUMENT,
+			SIGNED_ARGUMENT,
+			UNSIGNED_ARGUMENT,
+			FLOAT_ARGUMENT,
+			CHARACTER_ARGUMENT,
+			BOOLEAN_ARGUMENT,
+			POINTER_ARGUMENT
+		};
+
+	// Public Fields
+
+		/**
+		  * @brief This is the maximum number of arguments a record can hold.
+		  */
+
+		static constexpr size_t MAX_ARGUMENTS = 4;
+
+	// Public Methods
+
+		/**
+		  * @brief This method creates the specified trace log file, maps it into memory, and directs records to it.
+		  *
+		  * An existing file is replaced.  Every format string registered so far is stored in the new file.
+		  *
+		  * @param path
+		  * 	This is the path of the trace log file.
+		  *
+		  * @param capacity
+		  * 	This is the number of records the ring holds, which is rounded up to a power of two.
+		  *
+		  * @exception QMXException
+		  * 	If the trace log is already open, or the file could not be created or mapped.
+		  */
+
+		static void open( const std::string& path, const size_t capacity = TRACELOG_RECORD_COUNT );
+
+		/**
+		  * @brief This method waits for records being written, then unmaps and closes the trace log file.
+		  *
+		  * @exception QMXException
+		  * 	If the trace log is not open.
+		  */
+
+		static void close();
+
+		/**
+		  * @brief This method writes the mapped trace log file to storage and waits until it is written.
+		  *
+		  * This is only necessary for records to survive a failure of the system; they survive a crash of the program without it.
+		  */
+
+		static void flush();
+
+		/**
+		  * @brief This method gets the open flag.
+		  *
+		  * @return
+		  * 	A boolean value of 'true' if a trace log file is open, and 'false' otherwise.
+		  */
+
+		static bool isOpen()
+		{
+			// Report wether or not a trace log file is open to calling routine.
+
+				return isEnabled.load( std::memory_order_acquire );
+		}
+
+		/**
+		  * @brief This method gets the minimum level of records which are written.
+		  *
+		  * @return
+		  * 	The current minimum level.
+		  */
+
+		static Level getMinimumLevel()
+		{
+			// Return minimum level to calling routine.
+
+				return static_cast< Level >( minimumLevel.load( std::memory_order_relaxed ) );
+		}
+
+		/**
+		  * @brief This method sets the minimum level of records which are written; records below it are discarded without being written.
+		  *
+		  * @param level
+		  * 	This is the new minimum level.
+		  */
+
+		static void setMinimumLevel( const Level level )
+		{
+			// Set minimum level to specified value.
+
+				minimumLevel.store( level, std::memory_order_relaxed );
+		}
+
+		/**
+		  * @brief This method registers the specified format string and stores it in the open trace log file, if any.
+		  *
+		  * The 'TRACE_LOG' macro calls this once for each place it is used.
+		  *
+		  * @param format
+		  * 	This is the format string to register, in which each '{}' is replaced with the next argument when records are decoded.
+		  *
+		  * @return
+		  * 	The ID of the format string.
+		  */
+
+		static uint32_t registerFormat( const std::string& format );
+
+		/**
+		  * @brief This method writes a record with the specified level, format string ID, and arguments.
+		  *
+		  * Arguments must be arithmetic values, enumerations, or pointers, which are stored as raw values; text belongs in the format string.  If no trace log
+		  * file is open or the level is below the minimum level, the record is discarded.
+		  *
+		  * @param level
+		  * 	This is the level of the record.
+		  *
+		  * @param formatID
+		  * 	This is the ID of the format string, as returned by 'registerFormat'.
+		  *
+		  * @param arguments
+		  * 	These are the arguments of the record.
+		  */
+
+		template< typename... ATypes > static void write( const Level level, const uint32_t formatID, const ATypes&... arguments )
+		{
+			// Create local variables.
+
+				uint64_t values[ MAX_ARGUMENTS ] = {};
+				uint32_t types = 0;
+				size_t index = UNSET;
+
+			// Pack arguments and write the record, unless it is discarded.
+
+				static_assert( ( sizeof...( ATypes ) <= MAX_ARGUMENTS ), "A trace log record holds at most 'MAX_ARGUMENTS' arguments." );
+
+				if( !isEnabled.load( std::memory_order_relaxed ) || ( level < minimumLevel.load( std::memory_order_relaxed ) ) )
+					return;
+
+				( packArgument( arguments, values, types, index ), ... );
+				static_cast< void >( index );
+				writeRecord( level, formatID, values, types, sizeof...( ATypes ) );
+		}
+
+		/**
+		  * @brief This method renders every valid record of the specified trace log file as a line of text, oldest first.
+		  *
+		  * The file is mapped rather than read, so it is not copied however large it is.  Each line holds the UTC time, the thread ID, the level, and the
+		  * formatted message.
+		  *
+		  * @param path
+		  * 	This is the path of the trace log file.
+		  *
+		  * @param target
+		  * 	This is the stream to write the rendered records to.
+		  *
+		  * @return
+		  * 	The number of records rendered.
+		  *
+		  * @exception QMXException
+		  * 	If the file could not be read, or it is malformed or incompatible.
+		  */
+
+		static size_t decode( const std::string& path, std::ostream& target );
+
+private:
+
+	// Private Fields
+
+		/**
+		  * @brief This is the flag which determines if a trace log file is open.
+		  */
+
+		inline static std::atomic< bool > isEnabled = { false };
+
+		/**
+		  * @brief This is the minimum level of records which are written.
+		  */
+
+		inline static std::atomic< int > minimumLevel = { DEBUG_LEVEL };
+
+	// Private Constructors
+
+		/**
+		  * @brief This is the default constructor, which is made private to prevent instantiation.
+		  */
+
+		TraceLog()
+		{
+			// Do nothing.
+		}
+
+	// Private Methods
+
+		/**
+		  * @brief This method stores the raw value and type of the specified argument.
+		  *
+		  * @param argument
+		  * 	This is the argument to store.
+		  *
+		  * @param values
+		  * 	This is the array of raw argument values.
+		  *
+		  * @param types
+		  * 	This is the packed argument types.
+		  *
+		  * @param index
+		  * 	This is the index of the argument, which is advanced.
+		  */
+
+		template< typename DType > static void packArgument( const DType& argument, uint64_t* values, uint32_t& types, size_t& index )
+		{
+			// Create local variables.
+
+				using AType = std::decay_t< DType >;
+
+				ArgumentType type = NO_ARGUMENT;
+				uint64_t value = 0;
+
+			// Store argument based on its type.
+
+				if constexpr( std::is_same_v< AType, bool > )
+				{
+					type = BOOLEAN_ARGUMENT;
+					value = argument;
+				}
+				else if constexpr( std::is_same_v< AType, char > )
+				{
+					type = CHARACTER_ARGUMENT;
+					value = static_cast< unsigned char >( argument );
+				}
+				else if constexpr( std::is_floating_point_v< AType > )
+				{
+					double source = argument;
+
+					type = FLOAT_ARGUMENT;
+					std::memcpy( &value, &source, sizeof( value ) );
+				}
+				else if constexpr( std::is_enum_v< AType > || ( std::is_integral_v< AType > && std::is_signed_v< AType > ) )
+				{
+					type = SIGNED_ARGUMENT;
+					value = static_cast< uint64_t >( static_cast< int64_t >( argument ) );
+				}
+				else if constexpr( std::is_integral_v< AType > )
+				{
+					type = UNSIGNED_ARGUMENT;
+					value = argument;
+				}
+				else if constexpr( std::is_pointer_v< AType > )
+				{
+					static_assert(
+						!std::is_same_v< std::remove_cv_t< std::remove_pointer_t< AType > >, char >,
+						"Strings cannot be stored in a trace log record; place constant text in the format string."
+					);
+
+					type = POINTER_ARGUMENT;
+					value = reinterpret_cast< uintptr_t >( argument );
+				}
+				else
+				{
+					static_assert( ( sizeof( DType ) == 0 ), "Only arithmetic values, enumerations, and pointers can be stored in a trace log record." );
+				}
+
+				values[ index ] = value;
+				types |= ( static_cast< uint32_t >( type ) << ( index * 4 ) );
+				index++;
+		}
+
+		/**
+		  * @brief This method claims the next slot of the ring and writes a record into it.
+		  *
+		  * @param level
+		  * 	This is the level of the record.
+		  *
+		  * @param formatID
+		  * 	This is the ID of the format string.
+		  *
+		  * @param values
+		  * 	This is the array of raw argument values.
+		  *
+		  * @param types
+		  * 	This is the packed argument types.
+		  *
+		  * @param count
+		  * 	This is the number of arguments.
+		  */
+
+		static void writeRecord( const Level level, const uint32_t formatID, const uint64_t* values, const uint32_t types, const size_t count );
+};
+
+} // 'QMXStdLib' Namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of the 'QMXStdLib' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // __QMX_QMXSTDLIB_TRACELOG_HPP_
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of 'TraceLog.hpp'
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
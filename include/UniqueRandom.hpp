@@ -1,6 +1,6 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // UniqueRandom.hpp
-// Robert M. Baker | Created : 03FEB12 | Last Modified : 29AUG19 by Robert M. Baker
+// Robert M. Baker | Created : 03FEB12 | Last Modified : 17OCT26 by Robert M. Baker
 // Version : 2.3.0
 // This is a header file for 'QMXStdLib'; it defines the interface for a set of unique random number generation functions.
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -21,7 +21,7 @@
   * @file
   * @author  Robert M. Baker
   * @date    Created : 03FEB12
-  * @date    Last Modified : 29AUG19 by Robert M. Baker
+  * @date    Last Modified : 17OCT26 by Robert M. Baker
   * @version 2.3.0
   *
   * @brief This header file defines the interface for a unique random number generation class.
@@ -52,7 +52,12 @@
 // Header Files
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <type_traits>
+#include <unordered_set>
+#include <vector>
 
 #include "Base.hpp"
 #include "Object.hpp"
@@ -75,13 +80,258 @@ namespace UniqueRandom
 {
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-// Function Prototypes
+// The 'SamplingMethod' Enumeration
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+/**
+  * @brief This enumeration contains all algorithms the integral generator can use to select unique values.
+  */
+
+enum SamplingMethod
+{
+	AUTOMATIC,
+	SHUFFLE,
+	FLOYD,
+	SELECTION
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Function Definitions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+  * @brief This function randomly permutes the leading elements of a vector using a partial Fisher-Yates shuffle.
+  *
+  * Every ordered selection of 'count' elements is equally likely to end up in the leading 'count' positions; the remaining elements are left in an unspecified
+  * order.
+  *
+  * @param target
+  * 	This is a reference to the vector to shuffle.
+  *
+  * @param count
+  * 	This is the number of leading elements to fill with a random selection; it must not exceed the size of the vector.
+  */
+
+template< typename NType > void shuffle( std::vector< NType >& target, size_t count )
+{
+	// Create local variables.
+
+		size_t last = ( target.size() - 1 );
+
+	// Swap each leading element with a random element at or after its position.
+
+		for( size_t index = 0; ( index < count ) && ( index < last ); index++ )
+			std::swap( target[ index ], target[ Utility::randInt< size_t >( index, last ) ] );
+}
+
+/**
+  * @brief This function selects unique random offsets from a range using Floyd's algorithm, which makes one draw per value and tracks the values already
+  * chosen in a hash set.
+  *
+  * The values are appended to 'target' in an unspecified order.
+  *
+  * @param target
+  * 	This is a reference to a numeric vector which will receive the generated values.
+  *
+  * @param quantity
+  * 	This is the quantity of unique random numbers to generate; it must not exceed 'range'.
+  *
+  * @param range
+  * 	This is the number of values in the range, where 0 stands for the full 2^64 values of a 64-bit type.
+  *
+  * @param min
+  * 	This is the value at offset 0 of the range.
+  */
+
+template< typename NType > void sampleFloyd( std::vector< NType >& target, size_t quantity, uint64_t range, NType min )
+{
+	// Create local variables.
+
+		typedef typename std::make_unsigned< NType >::type UType;
+
+		uint64_t offset = UNSET;
+		uint64_t first = ( range - quantity );
+		std::unordered_set< uint64_t > chosen;
+
+	// Draw one offset per value from a growing prefix of the range, taking the end of the prefix instead whenever the draw was already chosen.
+
+		chosen.reserve( quantity );
+
+		for( uint64_t index = 0; index < quantity; index++ )
+		{
+			offset = Utility::randInt< uint64_t >( 0, ( first + index ) );
+
+			if( !chosen.insert( offset ).second )
+			{
+				offset = ( first + index );
+				chosen.insert( offset );
+			}
+
+			target.push_back( static_cast< NType >( static_cast< UType >( min ) + static_cast< UType >( offset ) ) );
+		}
+}
+
+/**
+  * @brief This function selects unique random offsets from a range in a single ascending pass, using Vitter's selection sampling algorithm D.
+  *
+  * Instead of testing every value of the range, the algorithm draws the size of the gap to the next selected value, so the work and the memory are
+  * proportional to 'quantity' alone.  Once the remaining range is less than 13 times the remaining quantity, it finishes with the simpler algorithm A.  Gap
+  * sizes are computed in double precision, so 'range' must not exceed 2^53.  The values are appended to 'target' in ascending order.
+  *
+  * @param target
+  * 	This is a reference to a numeric vector which will receive the generated values.
+  *
+  * @param quantity
+  * 	This is the quantity of unique random numbers to generate; it must not exceed 'range'.
+  *
+  * @param range
+  * 	This is the number of values in the range.
+  *
+  * @param min
+  * 	This is the value at offset 0 of the range.
+  */
+
+template< typename NType > void sampleSequential( std::vector< NType >& target, size_t quantity, uint64_t range, NType min )
+{
+	// Create local variables.
+
+		typedef typename std::make_unsigned< NType >::type UType;
+
+		constexpr uint64_t ALPHA_INVERSE = 13;
+
+		auto uniform = []() { return ( 1.0 - Utility::randFloat< double >( 0.0, 1.0 ) ); };
+		auto select = [ & ]( uint64_t offset ) { target.push_back( static_cast< NType >( static_cast< UType >( min ) + static_cast< UType >( offset ) ) ); };
+
+		uint64_t remaining = quantity;
+		uint64_t size = range;
+		uint64_t current = UNSET;
+		uint64_t skip = UNSET;
+		uint64_t limit = UNSET;
+		uint64_t qu1 = ( size - remaining + 1 );
+		double remainingReal = static_cast< double >( remaining );
+		double sizeReal = static_cast< double >( size );
+		double qu1Real = ( sizeReal - remainingReal + 1.0 );
+		double remainingInverse = ( 1.0 / remainingReal );
+		double nextInverse = 0.0;
+		double vPrime = std::exp( std::log( uniform() ) * remainingInverse );
+		double x = 0.0;
+		double y1 = 0.0;
+		double y2 = 0.0;
+		double top = 0.0;
+		double bottom = 0.0;
+		double quotient = 0.0;
+
+	// Select values with algorithm D while the range is sparse, drawing each gap from its exact distribution by rejection against a continuous envelope.
+
+		while( ( remaining > 1 ) && ( ( ALPHA_INVERSE * remaining ) < size ) )
+		{
+			nextInverse = ( 1.0 / ( remainingReal - 1.0 ) );
+
+			for( ;; )
+			{
+				for( ;; )
+				{
+					x = ( sizeReal * ( 1.0 - vPrime ) );
+					skip = static_cast< uint64_t >( x );
+
+					if( skip < qu1 )
+						break;
+
+					vPrime = std::exp( std::log( uniform() ) * remainingInverse );
+				}
+
+				y1 = std::exp( std::log( uniform() * sizeReal / qu1Real ) * nextInverse );
+				vPrime = ( y1 * ( 1.0 - x / sizeReal ) * ( qu1Real / ( qu1Real - static_cast< double >( skip ) ) ) );
+
+				if( vPrime <= 1.0 )
+					break;
+
+				y2 = 1.0;
+				top = ( sizeReal - 1.0 );
+
+				if( ( remaining - 1 ) > skip )
+				{
+					bottom = ( sizeReal - remainingReal );
+					limit = ( size - skip );
+				}
+				else
+				{
+					bottom = ( sizeReal - static_cast< double >( skip ) - 1.0 );
+					limit = qu1;
+				}
+
+				for( uint64_t index = ( size - 1 ); index >= limit; index-- )
+				{
+					y2 = ( ( y2 * top ) / bottom );
+					top -= 1.0;
+					bottom -= 1.0;
+				}
+
+				if( ( sizeReal / ( sizeReal - x ) ) >= ( y1 * std::exp( std::log( y2 ) * nextInverse ) ) )
+				{
+					vPrime = std::exp( std::log( uniform() ) * nextInverse );
+
+					break;
+				}
+
+				vPrime = std::exp( std::log( uniform() ) * remainingInverse );
+			}
+
+			current += skip;
+			select( current++ );
+			size -= ( skip + 1 );
+			sizeReal = static_cast< double >( size );
+			qu1 -= skip;
+			qu1Real = static_cast< double >( qu1 );
+			remaining--;
+			remainingReal -= 1.0;
+			remainingInverse = nextInverse;
+		}
+
+	// Select the rest with algorithm A, which walks the gap one value at a time and is cheaper once the range is dense.
+
+		top = static_cast< double >( size - remaining );
+
+		while( remaining > 1 )
+		{
+			skip = UNSET;
+			quotient = ( top / sizeReal );
+			x = Utility::randFloat< double >( 0.0, 1.0 );
+
+			while( quotient > x )
+			{
+				skip++;
+				top -= 1.0;
+				sizeReal -= 1.0;
+				quotient = ( ( quotient * top ) / sizeReal );
+			}
+
+			current += skip;
+			select( current++ );
+			size -= ( skip + 1 );
+			sizeReal -= 1.0;
+			remaining--;
+		}
+
+	// Select the last value uniformly from what is left of the range.
+
+		if( remaining )
+			select( current + Utility::randInt< uint64_t >( 0, ( size - 1 ) ) );
+}
+
 /**
   * @brief This function defines the structure for a generator which will produce a set of unique random integral numbers.
   *
-  * If 'min' is less-than 'max', 'min' will be set to 'max - 1';  'quantity' will be clamped on the closed interval [0, ( max - min + 1 )].
+  * If 'min' is not less-than 'max', 'min' will be set to 'max - 1';  'quantity' will be clamped on the closed interval [0, ( max - min + 1 )].  The values are
+  * produced in random order, and the algorithm is chosen from the density of the request unless one is specified:
+  *
+  * - SHUFFLE fills the vector with the whole range and shuffles the leading 'quantity' values into place, for requests covering at least a sixteenth of the
+  *   range.
+  * - FLOYD makes one draw per value and rejects repeats through a hash set, for small requests against a large range.
+  * - SELECTION streams an ascending sample in one pass with no memory beyond the result and then shuffles it, for large requests against a huge range.
+  *
+  * Ranges wider than 2^53 always use FLOYD, since SELECTION computes in double precision, and SHUFFLE falls back to FLOYD when the range is more than sixteen
+  * times the quantity.
   *
   * @param target
   * 	This is a reference to a numeric vector which will receive the generated values; it will be cleared if not empty.
@@ -94,41 +344,88 @@ namespace UniqueRandom
   *
   * @param max
   * 	This is the maximum value to use while generating random numbers.
+  *
+  * @param method
+  * 	This is the algorithm to use, or 'AUTOMATIC' to choose one from the density of the request.
   */
 
-template< typename NType > void generateInt( std::vector< NType >& target, size_t quantity, NType min, NType max )
+template< typename NType > void generateInt( std::vector< NType >& target, size_t quantity, NType min, NType max, SamplingMethod method = AUTOMATIC )
 {
 	// Create local variables.
 
-		NType value = UNSET;
+		typedef typename std::make_unsigned< NType >::type UType;
+
+		constexpr uint64_t DENSE_RATIO = 16;
+		constexpr uint64_t FLOYD_LIMIT = 1024;
+		constexpr uint64_t SELECTION_RANGE = ( 1ull << 53 );
+
+		uint64_t range = UNSET;
 
 	// Check arguments.
 
 		if( min >= max )
 			min = max - 1;
 
-		Numeric::clamp< size_t >( quantity, 0, ( max - min + 1 ) );
+		range = ( static_cast< uint64_t >( static_cast< UType >( max ) - static_cast< UType >( min ) ) + 1 );
+
+		if( range && ( quantity > range ) )
+			quantity = range;
 
 	// Clear number vector if necessary.
 
 		if( !target.empty() )
 			target.clear();
 
+		if( !quantity )
+			return;
+
+	// Choose an algorithm from the density of the request, where 'range' is 0 only for the full range of a 64-bit type.
+
+		if( method == AUTOMATIC )
+		{
+			if( range && ( ( range / DENSE_RATIO ) <= quantity ) )
+				method = SHUFFLE;
+			else if( ( quantity <= FLOYD_LIMIT ) || !range || ( range > SELECTION_RANGE ) )
+				method = FLOYD;
+			else
+				method = SELECTION;
+		}
+		else if( ( method == SHUFFLE ) && ( !range || ( ( range / DENSE_RATIO ) > quantity ) ) )
+			method = FLOYD;
+		else if( ( method == SELECTION ) && ( !range || ( range > SELECTION_RANGE ) ) )
+			method = FLOYD;
+
 	// Generate random numbers based on specified data.
 
-		while( target.size() < quantity )
+		if( method == SHUFFLE )
 		{
-			value = QMXStdLib::Utility::randInt< NType >( min, max );
+			target.resize( range );
 
-			if( std::find( target.begin(), target.end(), value ) == target.end() )
-				target.push_back( value );
+			for( uint64_t index = 0; index < range; index++ )
+				target[ index ] = static_cast< NType >( static_cast< UType >( min ) + static_cast< UType >( index ) );
+
+			shuffle( target, quantity );
+			target.resize( quantity );
+		}
+		else
+		{
+			target.reserve( quantity );
+
+			if( method == FLOYD )
+				sampleFloyd( target, quantity, range, min );
+			else
+				sampleSequential( target, quantity, range, min );
+
+			shuffle( target, quantity );
 		}
 }
 
 /**
   * @brief This function defines the structure for a generator which will produce a set of unique random floating point numbers.
   *
-  * If 'min' is less-than 'max', 'min' will be set to 'max - 1'.
+  * If 'min' is not less-than 'max', 'min' will be set to 'max - 1'.  Values are drawn uniformly from the half-open interval [min, max), and repeats are
+  * rejected through a hash set.  When the interval holds too few representable values for rejection to finish quickly, they are enumerated and shuffled
+  * instead, and 'quantity' is clamped to how many there are.
   *
   * @param target
   * 	This is a reference to a numeric vector which will receive the generated values; it will be cleared if not empty.
@@ -141,31 +438,73 @@ template< typename NType > void generateInt( std::vector< NType >& target, size_
   *
   * @param max
   * 	This is the maximum value to use while generating random numbers.
+  *
+  * @exception QMXException
+  * 	If the interval is empty or not finite, such as when 'max' is too large for 'max - 1' to differ from it.
   */
 
 template< typename NType > void generateFloat( std::vector< NType >& target, size_t quantity, NType min, NType max )
 {
 	// Create local variables.
 
+		constexpr size_t DENSE_RATIO = 8;
+
 		NType value = UNSET;
+		NType spacing = UNSET;
+		std::unordered_set< NType > chosen;
 
 	// Check arguments.
 
-		if( min >= max )
+		if( !( min < max ) )
 			min = max - 1;
 
+		QMX_ASSERT(
+			( std::isfinite( min ) && std::isfinite( max ) && ( min < max ) ),
+			"QMXStdLib",
+			"UniqueRandom::generateFloat",
+			"00000034",
+			min << ", " << max
+		);
+
 	// Clear number vector if necessary.
 
 		if( !target.empty() )
 			target.clear();
 
+		if( !quantity )
+			return;
+
+	// If the interval is not comfortably larger than the request at the coarsest spacing of its values, enumerate them; stop once there are plenty.
+
+		value = std::max( std::fabs( min ), std::fabs( max ) );
+		spacing = ( std::nextafter( value, std::numeric_limits< NType >::infinity() ) - value );
+
+		if( !( ( ( max - min ) / spacing ) >= ( static_cast< NType >( quantity ) * DENSE_RATIO ) ) )
+		{
+			for( value = min; ( value < max ) && ( target.size() <= ( quantity * DENSE_RATIO ) ); value = std::nextafter( value, max ) )
+				target.push_back( value );
+
+			if( !( value < max ) )
+			{
+				shuffle( target, quantity );
+				target.resize( std::min( quantity, target.size() ) );
+
+				return;
+			}
+
+			target.clear();
+		}
+
 	// Generate random numbers based on specified data.
 
+		target.reserve( quantity );
+		chosen.reserve( quantity );
+
 		while( target.size() < quantity )
 		{
 			value = QMXStdLib::Utility::randFloat< NType >( min, max );
 
-			if( std::find( target.begin(), target.end(), value ) == target.end() )
+			if( chosen.insert( value ).second )
 				target.push_back( value );
 		}
 }
@@ -1,6 +1,6 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Utility.hpp
-// Robert M. Baker | Created : 11JAN12 | Last Modified : 03SEP19 by Robert M. Baker
+// Robert M. Baker | Created : 11JAN12 | Last Modified : 17OCT26 by Robert M. Baker
 // Version : 2.3.0
 // This is a header file for 'QMXStdLib'; it defines the interface for a general utility class.
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -21,7 +21,7 @@
   * @file
   * @author  Robert M. Baker
   * @date    Created : 11JAN12
-  * @date    Last Modified : 03SEP19 by Robert M. Baker
+  * @date    Last Modified : 17OCT26 by Robert M. Baker
   * @version 2.3.0
   *
   * @brief This header file defines the interface for a general utility class.
@@ -52,7 +52,17 @@
 // Header Files
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <ctime>
+#include <limits>
 #include <random>
+#include <thread>
+#include <type_traits>
+#include <vector>
 #include <boost/locale.hpp>
 
 #include "Base.hpp"
@@ -65,6 +75,14 @@
 #define UTILITY_LANGUAGES 187
 #define UTILITY_COUNTRIES 249
 
+#if ( defined( __x86_64__ ) || defined( __i386__ ) )
+#	define UTILITY_SPIN_PAUSE __builtin_ia32_pause()
+#elif defined( __aarch64__ )
+#	define UTILITY_SPIN_PAUSE asm volatile( "yield" )
+#else
+#	define UTILITY_SPIN_PAUSE std::this_thread::yield()
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Start of the 'QMXStdLib' Namespace
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -187,6 +205,325 @@ public:
 				WType word[ 2 ];
 		};
 
+		/**
+		  * @brief This enumeration defines all waiting strategies the 'pause' method can use.
+		  */
+
+		enum PauseMode
+		{
+			HYBRID,
+			SLEEP,
+			SPIN
+		};
+
+		/**
+		  * @brief This structure holds wake-up jitter statistics for the 'pause' method, in nanoseconds.
+		  */
+
+		struct PauseStatistics
+		{
+		public:
+
+			// Public Fields
+
+				/**
+				  * @brief This is the number of pauses measured.
+				  */
+
+				uint64_t count;
+
+				/**
+				  * @brief This is the smallest jitter measured.
+				  */
+
+				int64_t minimum;
+
+				/**
+				  * @brief This is the largest jitter measured.
+				  */
+
+				int64_t maximum;
+
+				/**
+				  * @brief This is the sum of all jitter measured, which divided by 'count' gives the mean.
+				  */
+
+				int64_t total;
+		};
+
+		/**
+		  * @brief This enumeration defines all engines the random number generation methods can use.
+		  */
+
+		enum RandomEngine
+		{
+			MERSENNE_TWISTER,
+			XOSHIRO,
+			PCG
+		};
+
+		/**
+		  * @brief This class defines the xoshiro256** engine, a 64-bit generator with 256 bits of state.
+		  *
+		  * It is much smaller and faster than the Mersenne twister, and it satisfies the requirements of a uniform random bit generator, so it may be used with
+		  * the standard distributions.
+		  */
+
+		class Xoshiro256Engine
+		{
+		public:
+
+			// Public Type Definitions
+
+				typedef uint64_t result_type;
+
+			// Public Constructors
+
+				/**
+				  * @brief This is the constructor.
+				  *
+				  * @param value
+				  * 	This is the seed to use.
+				  */
+
+				explicit Xoshiro256Engine( uint64_t value = UNSET )
+				{
+					// Seed engine with specified value.
+
+						seed( value );
+				}
+
+			// Public Methods
+
+				/**
+				  * @brief This method gets the smallest value the engine can produce.
+				  *
+				  * @return
+				  * 	The smallest value the engine can produce.
+				  */
+
+				static constexpr result_type min()
+				{
+					// Return result to calling routine.
+
+						return 0;
+				}
+
+				/**
+				  * @brief This method gets the largest value the engine can produce.
+				  *
+				  * @return
+				  * 	The largest value the engine can produce.
+				  */
+
+				static constexpr result_type max()
+				{
+					// Return result to calling routine.
+
+						return std::numeric_limits< result_type >::max();
+				}
+
+				/**
+				  * @brief This method seeds the engine, expanding the specified value into the full state with SplitMix64.
+				  *
+				  * @param value
+				  * 	This is the seed to use.
+				  */
+
+				void seed( uint64_t value )
+				{
+					// Expand seed into engine state.
+
+						for( auto& index : state )
+							index = splitMix64( value );
+				}
+
+				/**
+				  * @brief This method advances the engine.
+				  *
+				  * @return
+				  * 	The next value in the sequence.
+				  */
+
+				result_type operator()()
+				{
+					// Create local variables.
+
+						result_type result = ( rotate( state[ 1 ] * 5, 7 ) * 9 );
+						uint64_t shifted = ( state[ 1 ] << 17 );
+
+					// Advance engine state.
+
+						state[ 2 ] ^= state[ 0 ];
+						state[ 3 ] ^= state[ 1 ];
+						state[ 1 ] ^= state[ 2 ];
+						state[ 0 ] ^= state[ 3 ];
+						state[ 2 ] ^= shifted;
+						state[ 3 ] = rotate( state[ 3 ], 45 );
+
+					// Return result to calling routine.
+
+						return result;
+				}
+
+		private:
+
+			// Private Fields
+
+				/**
+				  * @brief This is the engine state.
+				  */
+
+				uint64_t state[ 4 ];
+
+			// Private Methods
+
+				/**
+				  * @brief This method rotates a value left.
+				  *
+				  * @param value
+				  * 	This is the value to rotate.
+				  *
+				  * @param count
+				  * 	This is the number of bits to rotate by, on the open interval (0, 64).
+				  *
+				  * @return
+				  * 	The rotated value.
+				  */
+
+				static uint64_t rotate( uint64_t value, uint32_t count )
+				{
+					// Return result to calling routine.
+
+						return ( ( value << count ) | ( value >> ( 64 - count ) ) );
+				}
+		};
+
+		/**
+		  * @brief This class defines the PCG32 engine (XSH-RR variant), a 32-bit generator with 64 bits of state and a selectable stream.
+		  *
+		  * It satisfies the requirements of a uniform random bit generator, so it may be used with the standard distributions.
+		  */
+
+		class PCG32Engine
+		{
+		public:
+
+			// Public Type Definitions
+
+				typedef uint32_t result_type;
+
+			// Public Constructors
+
+				/**
+				  * @brief This is the constructor.
+				  *
+				  * @param value
+				  * 	This is the seed to use.
+				  *
+				  * @param stream
+				  * 	This is the stream to use; engines with different streams produce different sequences from the same seed.
+				  */
+
+				explicit PCG32Engine( uint64_t value = 0x853C49E6748FEA9Bull, uint64_t stream = 0xDA3E39CB94B95BDBull )
+				{
+					// Seed engine with specified values.
+
+						seed( value, stream );
+				}
+
+			// Public Methods
+
+				/**
+				  * @brief This method gets the smallest value the engine can produce.
+				  *
+				  * @return
+				  * 	The smallest value the engine can produce.
+				  */
+
+				static constexpr result_type min()
+				{
+					// Return result to calling routine.
+
+						return 0;
+				}
+
+				/**
+				  * @brief This method gets the largest value the engine can produce.
+				  *
+				  * @return
+				  * 	The largest value the engine can produce.
+				  */
+
+				static constexpr result_type max()
+				{
+					// Return result to calling routine.
+
+						return std::numeric_limits< result_type >::max();
+				}
+
+				/**
+				  * @brief This method seeds the engine.
+				  *
+				  * @param value
+				  * 	This is the seed to use.
+				  *
+				  * @param stream
+				  * 	This is the stream to use.
+				  */
+
+				void seed( uint64_t value, uint64_t stream = 0xDA3E39CB94B95BDBull )
+				{
+					// Initialize engine state the way the reference implementation does.
+
+						state = UNSET;
+						increment = ( ( stream << 1 ) | 1 );
+						( *this )();
+						state += value;
+						( *this )();
+				}
+
+				/**
+				  * @brief This method advances the engine.
+				  *
+				  * @return
+				  * 	The next value in the sequence.
+				  */
+
+				result_type operator()()
+				{
+					// Create local variables.
+
+						uint64_t previous = state;
+						uint32_t shifted = static_cast< uint32_t >( ( ( previous >> 18 ) ^ previous ) >> 27 );
+						uint32_t count = static_cast< uint32_t >( previous >> 59 );
+
+					// Advance engine state.
+
+						state = ( ( previous * 6364136223846793005ull ) + increment );
+
+					// Return result to calling routine.
+
+						return ( ( shifted >> count ) | ( shifted << ( ( 32 - count ) & 31 ) ) );
+				}
+
+		private:
+
+			// Private Fields
+
+				/**
+				  * @brief This is the engine state.
+				  */
+
+				uint64_t state;
+
+				/**
+				  * @brief This is the odd increment which selects the stream.
+				  */
+
+				uint64_t increment;
+		};
+
 	// Public Fields
 
 		/**
@@ -826,41 +1163,231 @@ public:
 		/**
 		  * @brief This method halts execution of the application for the specified amount of time.
 		  *
-		  * This method will block any further execution during the period it is in effect.  This should only be used when constant logic processing is unneeded.
+		  * In 'HYBRID' mode, the calling thread sleeps until the pause margin before the deadline, then spins for the remainder, which gives the precision of a
+		  * busy wait for the cost of a few microseconds of processor time.  'SLEEP' mode never spins, and 'SPIN' mode never sleeps, which suits waits too
+		  * short for the scheduler to honor.  The wake-up jitter of every pause is recorded in the pause statistics of the calling thread.
 		  *
 		  * @param interval
 		  * 	This is the time interval that the application will be halted.
 		  *
 		  * @param units
 		  * 	These are the units to use with the specified time interval.
+		  *
+		  * @param mode
+		  * 	This is the waiting strategy to use.
+		  *
+		  * @return
+		  * 	The wake-up jitter, which is how many nanoseconds after the deadline the pause returned.
 		  */
 
-		static void pause( real_t interval, Timer::TimeUnits units = Timer::MILLISECONDS )
+		static int64_t pause( real_t interval, Timer::TimeUnits units = Timer::MILLISECONDS, PauseMode mode = HYBRID )
 		{
 			// Create local variables.
 
-				Timer::InstancePtr delayTimer = Timer::create();
+				int64_t start = getSteadyTime();
+				int64_t deadline = ( start + static_cast< int64_t >( interval * static_cast< real_t >( units ) ) );
+				int64_t wakeTime = ( ( mode == SLEEP ) ? deadline : ( deadline - pauseMargin.load( std::memory_order_relaxed ) ) );
+				int64_t result = UNSET;
 
-			// Pause for the specified time interval.
+			// Sleep for most of the specified time interval, then spin for the remainder, as specified.
 
-				delayTimer->toggle();
+				if( ( mode != SPIN ) && ( wakeTime > start ) )
+					sleepUntil( wakeTime );
 
-				while( delayTimer->getTime( units ) < interval );
-					// Empty Loop
+				result = getSteadyTime();
+
+				if( mode != SLEEP )
+				{
+					while( result < deadline )
+					{
+						UTILITY_SPIN_PAUSE;
+						result = getSteadyTime();
+					}
+				}
+
+			// Record the wake-up jitter in the statistics of the calling thread.
+
+				result -= deadline;
+
+				if( !pauseStatistics.count || ( result < pauseStatistics.minimum ) )
+					pauseStatistics.minimum = result;
+
+				if( !pauseStatistics.count || ( result > pauseStatistics.maximum ) )
+					pauseStatistics.maximum = result;
+
+				pauseStatistics.count++;
+				pauseStatistics.total += result;
+
+			// Return result to calling routine.
+
+				return result;
 		}
 
 		/**
-		  * @brief This method sets the seed for the random number generator.
+		  * @brief This method sets how long before the deadline a 'HYBRID' pause stops sleeping and starts spinning.
+		  *
+		  * It should cover the time the scheduler takes to wake a sleeping thread; a smaller margin spins less but wakes late more often.
+		  *
+		  * @param margin
+		  * 	This is the margin to use, in nanoseconds.
+		  */
+
+		static void setPauseMargin( int64_t margin )
+		{
+			// Store specified margin.
+
+				pauseMargin.store( margin );
+		}
+
+		/**
+		  * @brief This method gets how long before the deadline a 'HYBRID' pause stops sleeping and starts spinning.
+		  *
+		  * @return
+		  * 	The margin in use, in nanoseconds.
+		  */
+
+		static int64_t getPauseMargin()
+		{
+			// Return result to calling routine.
+
+				return pauseMargin.load();
+		}
+
+		/**
+		  * @brief This method calibrates the pause margin by measuring how late the calling thread wakes from short sleeps.
+		  *
+		  * The margin is set to the 90th percentile of the measured wake-up jitter, so that nine 'HYBRID' pauses in ten wake early enough to finish by
+		  * spinning.  The pause statistics of the calling thread are not affected.
+		  *
+		  * @param samples
+		  * 	This is the number of sleeps to measure; each one lasts 200 microseconds plus the jitter.
+		  *
+		  * @return
+		  * 	The new margin, in nanoseconds.
+		  */
+
+		static int64_t calibratePause( size_t samples = 64 )
+		{
+			// Create local variables.
+
+				PauseStatistics statistics = pauseStatistics;
+				std::vector< int64_t > jitter;
+
+			// Measure the wake-up jitter of short sleeps, and set the margin to its 90th percentile.
+
+				for( size_t index = 0; index < std::max< size_t >( samples, 1 ); index++ )
+					jitter.push_back( pause( 200.0, Timer::MICROSECONDS, SLEEP ) );
+
+				std::nth_element( jitter.begin(), ( jitter.begin() + ( ( jitter.size() * 9 ) / 10 ) ), jitter.end() );
+				pauseMargin.store( std::max< int64_t >( jitter[ ( jitter.size() * 9 ) / 10 ], 0 ) );
+				pauseStatistics = statistics;
+
+			// Return result to calling routine.
+
+				return pauseMargin.load();
+		}
+
+		/**
+		  * @brief This method gets the wake-up jitter statistics of every pause the calling thread has made since they were last reset.
+		  *
+		  * @return
+		  * 	The statistics of the calling thread.
+		  */
+
+		static PauseStatistics getPauseStatistics()
+		{
+			// Return result to calling routine.
+
+				return pauseStatistics;
+		}
+
+		/**
+		  * @brief This method resets the wake-up jitter statistics of the calling thread.
+		  */
+
+		static void resetPauseStatistics()
+		{
+			// Reset statistics of the calling thread.
+
+				pauseStatistics = PauseStatistics();
+		}
+
+		/**
+		  * @brief This method advances a SplitMix64 generator, which is used to expand seeds into engine state.
+		  *
+		  * @param state
+		  * 	This is a reference to the generator state, which is advanced.
+		  *
+		  * @return
+		  * 	The next value in the sequence.
+		  */
+
+		static uint64_t splitMix64( uint64_t& state )
+		{
+			// Create local variables.
+
+				uint64_t result = ( state += 0x9E3779B97F4A7C15ull );
+
+			// Scramble the advanced state.
+
+				result = ( ( result ^ ( result >> 30 ) ) * 0xBF58476D1CE4E5B9ull );
+				result = ( ( result ^ ( result >> 27 ) ) * 0x94D049BB133111EBull );
+
+			// Return result to calling routine.
+
+				return ( result ^ ( result >> 31 ) );
+		}
+
+		/**
+		  * @brief This method sets the global seed for the random number generators.
+		  *
+		  * Every thread has its own engine, seeded from the global seed and the thread's stream; a thread reseeds itself on its next draw after the global seed
+		  * changes, so the sequence a thread produces depends only on the seed, its stream, and the engine.
 		  *
 		  * @param seed
 		  * 	This is the seed to use; if it is set to 'UNSET', the current time will be used instead.
 		  */
 
-		static void setRandomSeed( uint32_t seed = UNSET )
+		static void setRandomSeed( uint64_t seed = UNSET )
+		{
+			// Store specified seed, or the current time if specified value is 'UNSET', and have every thread reseed itself.
+
+				randomSeed.store( ( !seed ? static_cast< uint64_t >( time( nullptr ) ) : seed ) );
+				randomEpoch++;
+		}
+
+		/**
+		  * @brief This method sets the engine every thread uses for the random number generation methods.
+		  *
+		  * @param engine
+		  * 	This is the engine to use; the default is the Mersenne twister.
+		  */
+
+		static void setRandomEngine( RandomEngine engine )
 		{
-			// Seed random number generator with specified value, or use current time if specified value is 'UNSET'.
+			// Store specified engine, and have every thread reseed itself.
 
-				generator.seed( ( !seed ? time( nullptr ) : seed ) );
+				randomEngine.store( engine );
+				randomEpoch++;
+		}
+
+		/**
+		  * @brief This method sets the stream of the calling thread, and reseeds its engine.
+		  *
+		  * Threads which do not set a stream are numbered in the order in which they first draw a random number, starting from 0; setting the stream explicitly
+		  * makes the sequence of a thread reproducible regardless of scheduling.
+		  *
+		  * @param stream
+		  * 	This is the stream to use.
+		  */
+
+		static void setRandomStream( uint64_t stream )
+		{
+			// Store specified stream for the calling thread, and reseed its engine on the next draw.
+
+				randomState.stream = stream;
+				randomState.hasStream = true;
+				randomState.epoch = UNSET;
 		}
 
 		/**
@@ -884,7 +1411,7 @@ public:
 
 			// Return a random number within the specified range to calling routine.
 
-				return distro( generator );
+				return withRandomEngine( [ &distro ]( auto& engine ) { return distro( engine ); } );
 		}
 
 		/**
@@ -908,18 +1435,266 @@ public:
 
 			// Return a random number within the specified range to calling routine.
 
-				return distro( generator );
+				return withRandomEngine( [ &distro ]( auto& engine ) { return distro( engine ); } );
+		}
+
+		/**
+		  * @brief This method fills an array with random numbers.
+		  *
+		  * The engine output is generated a block at a time, then mapped onto the range in a separate branch-free loop which the compiler can vectorize.
+		  * Integral ranges of up to 2^32 values use Lemire's multiply-shift mapping, with the rare biased draws redone afterwards; wider ranges fall back to one
+		  * draw per value.  Floating point values are drawn from the half-open interval [min, max) with 24 bits of precision for 'float' and 52 bits otherwise.
+		  *
+		  * @param target
+		  * 	This is a pointer to the array to fill.
+		  *
+		  * @param count
+		  * 	This is the number of values to generate.
+		  *
+		  * @param min
+		  * 	This is the minimum value of the random numbers.
+		  *
+		  * @param max
+		  * 	This is the maximum value of the random numbers; it must not be less-than 'min'.
+		  */
+
+		template< typename NType > static void fill( NType* target, size_t count, NType min, NType max )
+		{
+			// Create local variables.
+
+				constexpr size_t BLOCK_SIZE = 256;
+
+				RandomState& state = getRandomState();
+				size_t blockCount = UNSET;
+
+			// Fill the array a block at a time, using the mapping appropriate for the type and range.
+
+				if constexpr( std::is_same< NType, float >::value )
+				{
+					uint32_t words[ BLOCK_SIZE ];
+					float unit = UNSET;
+					float scale = ( max - min );
+
+					for( size_t offset = 0; offset < count; offset += BLOCK_SIZE )
+					{
+						blockCount = std::min( BLOCK_SIZE, ( count - offset ) );
+						generateWords( state, words, blockCount );
+
+						for( size_t index = 0; index < blockCount; index++ )
+						{
+							words[ index ] = ( ( words[ index ] >> 9 ) | 0x3F800000u );
+							std::memcpy( &unit, &words[ index ], sizeof( unit ) );
+							target[ offset + index ] = ( min + ( scale * ( unit - 1.0f ) ) );
+						}
+					}
+				}
+				else if constexpr( std::is_floating_point< NType >::value )
+				{
+					uint64_t words[ BLOCK_SIZE ];
+					double unit = UNSET;
+					NType scale = ( max - min );
+
+					for( size_t offset = 0; offset < count; offset += BLOCK_SIZE )
+					{
+						blockCount = std::min( BLOCK_SIZE, ( count - offset ) );
+						generateWords( state, words, blockCount );
+
+						for( size_t index = 0; index < blockCount; index++ )
+						{
+							words[ index ] = ( ( words[ index ] >> 12 ) | 0x3FF0000000000000ull );
+							std::memcpy( &unit, &words[ index ], sizeof( unit ) );
+							target[ offset + index ] = ( min + ( scale * static_cast< NType >( unit - 1.0 ) ) );
+						}
+					}
+				}
+				else
+				{
+					typedef typename std::make_unsigned< NType >::type UType;
+
+					uint64_t span = static_cast< uint64_t >( static_cast< UType >( static_cast< UType >( max ) - static_cast< UType >( min ) ) );
+					uint64_t range = ( span + 1 );
+					uint32_t threshold = UNSET;
+					uint32_t words[ BLOCK_SIZE ];
+					uint32_t rejected = UNSET;
+					uint64_t product = UNSET;
+
+					if( span > std::numeric_limits< uint32_t >::max() )
+					{
+						std::uniform_int_distribution< uint64_t > distro( 0, span );
+
+						withRandomEngine( [ & ]( auto& engine ) {
+							for( size_t index = 0; index < count; index++ )
+								target[ index ] = static_cast< NType >( static_cast< UType >( min ) + static_cast< UType >( distro( engine ) ) );
+						} );
+
+						return;
+					}
+
+					threshold = static_cast< uint32_t >( ( 0x100000000ull - range ) % range );
+
+					for( size_t offset = 0; offset < count; offset += BLOCK_SIZE )
+					{
+						blockCount = std::min( BLOCK_SIZE, ( count - offset ) );
+						generateWords( state, words, blockCount );
+						rejected = UNSET;
+
+						for( size_t index = 0; index < blockCount; index++ )
+						{
+							product = ( static_cast< uint64_t >( words[ index ] ) * range );
+							rejected |= static_cast< uint32_t >( static_cast< uint32_t >( product ) < threshold );
+							target[ offset + index ] = static_cast< NType >( static_cast< UType >( min ) + static_cast< UType >( product >> 32 ) );
+						}
+
+						if( rejected )
+						{
+							for( size_t index = 0; index < blockCount; index++ )
+							{
+								product = ( static_cast< uint64_t >( words[ index ] ) * range );
+
+								while( static_cast< uint32_t >( product ) < threshold )
+								{
+									generateWords( state, &words[ index ], 1 );
+									product = ( static_cast< uint64_t >( words[ index ] ) * range );
+								}
+
+								target[ offset + index ] = static_cast< NType >( static_cast< UType >( min ) + static_cast< UType >( product >> 32 ) );
+							}
+						}
+					}
+				}
+		}
+
+		/**
+		  * @brief This method fills a vector with random numbers.
+		  *
+		  * @param target
+		  * 	This is a reference to the vector to fill; its size determines how many values are generated.
+		  *
+		  * @param min
+		  * 	This is the minimum value of the random numbers.
+		  *
+		  * @param max
+		  * 	This is the maximum value of the random numbers; it must not be less-than 'min'.
+		  */
+
+		template< typename NType > static void fill( std::vector< NType >& target, NType min, NType max )
+		{
+			// Fill the whole vector.
+
+				fill( target.data(), target.size(), min, max );
 		}
 
 private:
 
+	// Private Data Types
+
+		/**
+		  * @brief This structure holds the random number generation state of a thread.
+		  */
+
+		struct RandomState
+		{
+		public:
+
+			// Public Constructors
+
+				/**
+				  * @brief This is the default constructor.
+				  */
+
+				RandomState() : epoch( UNSET ), stream( UNSET ), hasStream( false ), engine( MERSENNE_TWISTER )
+				{
+					// Do nothing.
+				}
+
+			// Public Fields
+
+				/**
+				  * @brief This is the global epoch the engines were last seeded at, or 'UNSET' if they have not been seeded.
+				  */
+
+				uint64_t epoch;
+
+				/**
+				  * @brief This is the stream of the thread, which is mixed with the global seed.
+				  */
+
+				uint64_t stream;
+
+				/**
+				  * @brief This is a boolean value which determines if the stream has been assigned.
+				  */
+
+				bool hasStream;
+
+				/**
+				  * @brief This is the engine in use.
+				  */
+
+				RandomEngine engine;
+
+				/**
+				  * @brief This is the Mersenne twister engine.
+				  */
+
+				std::mt19937 mersenne;
+
+				/**
+				  * @brief This is the xoshiro256** engine.
+				  */
+
+				Xoshiro256Engine xoshiro;
+
+				/**
+				  * @brief This is the PCG32 engine.
+				  */
+
+				PCG32Engine pcg;
+		};
+
 	// Private Fields
 
 		/**
-		  * @brief This is the generator to use for the random number generation methods.
+		  * @brief This is the global seed for the random number generators.
 		  */
 
-		inline static std::mt19937 generator;
+		inline static std::atomic< uint64_t > randomSeed = { std::mt19937::default_seed };
+
+		/**
+		  * @brief This is the engine every thread uses.
+		  */
+
+		inline static std::atomic< RandomEngine > randomEngine = { MERSENNE_TWISTER };
+
+		/**
+		  * @brief This is the global epoch, which is advanced whenever the seed or engine changes so that every thread reseeds itself.
+		  */
+
+		inline static std::atomic< uint64_t > randomEpoch = { 1 };
+
+		/**
+		  * @brief This is the next stream to assign to a thread which has not set its own.
+		  */
+
+		inline static std::atomic< uint64_t > nextStream = { UNSET };
+
+		/**
+		  * @brief This is the random number generation state of the calling thread.
+		  */
+
+		inline static thread_local RandomState randomState;
+
+		/**
+		  * @brief This is how long before the deadline a 'HYBRID' pause starts spinning, in nanoseconds.
+		  */
+
+		inline static std::atomic< int64_t > pauseMargin = { 100000 };
+
+		/**
+		  * @brief This is the wake-up jitter statistics of the calling thread.
+		  */
+
+		inline static thread_local PauseStatistics pauseStatistics;
 
 	// Private Constructors
 
@@ -931,6 +1706,207 @@ private:
 		{
 			// Do nothing.
 		}
+
+	// Private Methods
+
+		/**
+		  * @brief This method gets the time of the steady clock.
+		  *
+		  * @return
+		  * 	The time since the steady clock's epoch, in nanoseconds.
+		  */
+
+		static int64_t getSteadyTime()
+		{
+			// Return result to calling routine.
+
+				return std::chrono::duration_cast< std::chrono::nanoseconds >( std::chrono::steady_clock::now().time_since_epoch() ).count();
+		}
+
+		/**
+		  * @brief This method sleeps until the steady clock reaches the specified time.
+		  *
+		  * @param deadline
+		  * 	This is the time to wake at, in nanoseconds since the steady clock's epoch.
+		  */
+
+		static void sleepUntil( int64_t deadline )
+		{
+			// Sleep until specified time, resuming after any interruption by a signal.
+
+#if ( QMX_PLATFORM == QMX_PLATFORM_LINUX )
+				timespec wakeTime = { static_cast< time_t >( deadline / 1000000000 ), static_cast< long >( deadline % 1000000000 ) };
+
+				while( clock_nanosleep( CLOCK_MONOTONIC, TIMER_ABSTIME, &wakeTime, nullptr ) == EINTR );
+					// Empty Loop
+#else
+				std::this_thread::sleep_until( std::chrono::steady_clock::time_point( std::chrono::nanoseconds( deadline ) ) );
+#endif // Platform Sleep
+		}
+
+		/**
+		  * @brief This method gets the random number generation state of the calling thread.
+		  *
+		  * The engine of the calling thread is reseeded first if the global seed or engine has changed since it was last seeded.
+		  *
+		  * @return
+		  * 	A reference to the state of the calling thread.
+		  */
+
+		static RandomState& getRandomState()
+		{
+			// Create local variables.
+
+				RandomState& result = randomState;
+				uint64_t epoch = randomEpoch.load( std::memory_order_acquire );
+				uint64_t mixer = UNSET;
+
+			// Derive a seed for the calling thread from the global seed and its stream, if necessary.
+
+				if( result.epoch != epoch )
+				{
+					if( !result.hasStream )
+					{
+						result.stream = nextStream++;
+						result.hasStream = true;
+					}
+
+					mixer = result.stream;
+					mixer = ( randomSeed.load() ^ splitMix64( mixer ) );
+					result.engine = randomEngine.load();
+					result.epoch = epoch;
+
+					switch( result.engine )
+					{
+						case XOSHIRO:
+							result.xoshiro.seed( splitMix64( mixer ) );
+
+							break;
+
+						case PCG:
+							result.pcg.seed( splitMix64( mixer ), result.stream );
+
+							break;
+
+						default:
+						{
+							uint32_t words[ 4 ];
+
+							for( auto& index : words )
+								index = static_cast< uint32_t >( splitMix64( mixer ) );
+
+							std::seed_seq sequence( std::begin( words ), std::end( words ) );
+							result.mersenne.seed( sequence );
+						}
+					}
+				}
+
+			// Return result to calling routine.
+
+				return result;
+		}
+
+		/**
+		  * @brief This method calls a function with the engine of the calling thread.
+		  *
+		  * @param function
+		  * 	This is the function to call; it must accept a reference to any of the engines.
+		  *
+		  * @return
+		  * 	The value returned by the function.
+		  */
+
+		template< typename FType > static auto withRandomEngine( FType function )
+		{
+			// Create local variables.
+
+				RandomState& state = getRandomState();
+
+			// Call specified function with the engine in use, and return its result to calling routine.
+
+				switch( state.engine )
+				{
+					case XOSHIRO:
+						return function( state.xoshiro );
+
+					case PCG:
+						return function( state.pcg );
+
+					default:
+						return function( state.mersenne );
+				}
+		}
+
+		/**
+		  * @brief This method fills an array with raw engine output.
+		  *
+		  * @param state
+		  * 	This is a reference to the state of the calling thread.
+		  *
+		  * @param target
+		  * 	This is a pointer to the array to fill, of 32-bit or 64-bit words.
+		  *
+		  * @param count
+		  * 	This is the number of words to generate.
+		  */
+
+		template< typename WType > static void generateWords( RandomState& state, WType* target, size_t count )
+		{
+			// Create local variables.
+
+				auto generate = [ target, count ]( auto& engine ) {
+					typedef typename std::remove_reference< decltype( engine ) >::type EType;
+
+					if constexpr( EType::max() == std::numeric_limits< WType >::max() )
+					{
+						for( size_t index = 0; index < count; index++ )
+							target[ index ] = static_cast< WType >( engine() );
+					}
+					else if constexpr( EType::max() > std::numeric_limits< WType >::max() )
+					{
+						uint64_t value = UNSET;
+
+						for( size_t index = 0; index < count; index += 2 )
+						{
+							value = engine();
+							target[ index ] = static_cast< WType >( value );
+
+							if( ( index + 1 ) < count )
+								target[ index + 1 ] = static_cast< WType >( value >> 32 );
+						}
+					}
+					else
+					{
+						WType high = UNSET;
+						WType low = UNSET;
+
+						for( size_t index = 0; index < count; index++ )
+						{
+							high = static_cast< WType >( engine() );
+							low = static_cast< WType >( engine() );
+							target[ index ] = ( ( high << 32 ) | low );
+						}
+					}
+				};
+
+			// Fill specified array from the engine in use.
+
+				switch( state.engine )
+				{
+					case XOSHIRO:
+						generate( state.xoshiro );
+
+						break;
+
+					case PCG:
+						generate( state.pcg );
+
+						break;
+
+					default:
+						generate( state.mersenne );
+				}
+		}
 };
 
 } // 'QMXStdLib' Namespace
@@ -0,0 +1,519 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// ConsoleIO.cpp
+// Robert M. Baker | Created : 17OCT26 | Last Modified : 17OCT26 by Robert M. Baker
+// Version : 2.3.0
+// This is a source file for 'QMXStdLib'; it defines the implementation for a console I/O class.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+//
+// This file is part of 'QMXStdLib'.
+//
+// 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option) any later version.
+//
+// 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+  * @file
+  * @author  Robert M. Baker
+  * @date    Created : 17OCT26
+  * @date    Last Modified : 17OCT26 by Robert M. Baker
+  * @version 2.3.0
+  *
+  * @brief This source file defines the implementation for a console I/O class.
+  *
+  * @section ConsoleIOS0000 Description
+  *
+  * This source file defines the implementation for a console I/O class.
+  *
+  * @section ConsoleIOS0001 License
+  *
+  * Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+  *
+  * This file is part of 'QMXStdLib'.
+  *
+  * 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+  * Software Foundation, either version 3 of the License, or (at your option) any later version.
+  *
+  * 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+  * A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+  *
+  * You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+  */
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Header Files
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+
+#include "../include/ConsoleIO.hpp"
+#include "../include/QMXException.hpp"
+
+#if ( QMX_PLATFORM != QMX_PLATFORM_WINDOWS )
+#	include <cerrno>
+#	include <sys/uio.h>
+#	include <unistd.h>
+#endif // Platform Headers
+
+using namespace std;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Start of the 'QMXStdLib' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace QMXStdLib
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Start of the 'ConsoleWriter' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+  * @brief This is the namespace for the queue and background writer used by console streams in asynchronous mode.
+  *
+  * The queue is a bounded ring in which every slot carries a sequence number, so producers claim slots with a single compare-and-swap and the writer never
+  * takes a lock to consume them.  A producer swaps its formatted string into the slot and takes back the string the writer emptied, so no record is copied
+  * and no memory is allocated once buffers have grown to the size of the records.
+  */
+
+namespace ConsoleWriter
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Type Definitions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct Slot
+{
+	Slot() : sequence( UNSET ), type( ConsoleIO::OUTPUT_STREAM )
+	{
+		// Do nothing.
+	}
+
+	atomic< size_t > sequence;
+	ConsoleIO::StreamType type;
+	string data;
+};
+
+struct Queue
+{
+	Queue( const size_t capacity, const ConsoleIO::OverflowPolicy targetPolicy ) :
+		slots( new Slot[ capacity ] ), mask( capacity - 1 ), policy( targetPolicy ), enqueuePosition( UNSET ), dequeuePosition( UNSET ),
+		writtenPosition( UNSET ), isWriterWaiting( false ), isStopping( false )
+	{
+		// Initialize fields.
+
+			for( size_t index = 0; index < capacity; index++ )
+				slots[ index ].sequence.store( index, memory_order_relaxed );
+	}
+
+	unique_ptr< Slot[] > slots;
+	size_t mask;
+	ConsoleIO::OverflowPolicy policy;
+	atomic< size_t > enqueuePosition;
+	size_t dequeuePosition;
+	atomic< size_t > writtenPosition;
+	atomic< bool > isWriterWaiting;
+	atomic< bool > isStopping;
+	boost::mutex writerMutex;
+	boost::condition_variable writerCondition;
+	boost::condition_variable flushCondition;
+	boost::thread writer;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Global Variables
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const size_t BATCH_SIZE = 64;
+streambuf* const STANDARD_BUFFERS[ ConsoleIO::STREAM_COUNT ] = { cout.rdbuf(), cerr.rdbuf(), clog.rdbuf() };
+atomic< Queue* > activeQueue = { nullptr };
+atomic< size_t > activeProducers = { 0 };
+atomic< uint64_t > droppedCount = { 0 };
+boost::mutex controlMutex;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Function Definitions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void writeRecords( const ConsoleIO::StreamType type, const Slot* const* records, const size_t count )
+{
+	// Create local variables.
+
+		ostream& target = ( ( type == ConsoleIO::OUTPUT_STREAM ) ? cout : ( ( type == ConsoleIO::ERROR_STREAM ) ? cerr : clog ) );
+
+#if ( QMX_PLATFORM != QMX_PLATFORM_WINDOWS )
+	// Write records straight to the descriptor while the stream still uses its standard buffer, flushing what the C library holds for it first; gather records
+	// into one call, then resume after any partial write until every byte is written or the descriptor fails.
+
+		if( target.rdbuf() == STANDARD_BUFFERS[ type ] )
+		{
+			int descriptor = ( ( type == ConsoleIO::OUTPUT_STREAM ) ? STDOUT_FILENO : STDERR_FILENO );
+			iovec vectors[ BATCH_SIZE ];
+			size_t first = UNSET;
+			ssize_t written = UNSET;
+
+			fflush( ( type == ConsoleIO::OUTPUT_STREAM ) ? stdout : stderr );
+
+			for( size_t index = 0; index < count; index++ )
+			{
+				vectors[ index ].iov_base = const_cast< char* >( records[ index ]->data.data() );
+				vectors[ index ].iov_len = records[ index ]->data.size();
+			}
+
+			while( first < count )
+			{
+				written = writev( descriptor, ( vectors + first ), static_cast< int >( count - first ) );
+
+				if( written < 0 )
+				{
+					if( errno == EINTR )
+						continue;
+
+					break;
+				}
+
+				while( ( first < count ) && ( static_cast< size_t >( written ) >= vectors[ first ].iov_len ) )
+					written -= vectors[ first++ ].iov_len;
+
+				if( first < count )
+				{
+					vectors[ first ].iov_base = ( static_cast< char* >( vectors[ first ].iov_base ) + written );
+					vectors[ first ].iov_len -= written;
+				}
+			}
+
+			return;
+		}
+#endif // Platform Write
+
+	// Write records through the stream, so a buffer set with 'rdbuf' receives them.
+
+		for( size_t index = 0; index < count; index++ )
+			target.write( records[ index ]->data.data(), records[ index ]->data.size() );
+
+		target.flush();
+}
+
+void runWriter( Queue* queue )
+{
+	// Create local variables.
+
+		Slot* batch[ BATCH_SIZE ];
+		Slot* slot = nullptr;
+		size_t count = UNSET;
+		size_t first = UNSET;
+
+	// Write ready records in batches until stopped and drained, sleeping while the queue is empty.
+
+		for( ;; )
+		{
+			count = UNSET;
+
+			while( count < BATCH_SIZE )
+			{
+				slot = &queue->slots[ ( queue->dequeuePosition + count ) & queue->mask ];
+
+				if( slot->sequence.load( memory_order_acquire ) != ( queue->dequeuePosition + count + 1 ) )
+					break;
+
+				batch[ count++ ] = slot;
+			}
+
+			if( !count )
+			{
+				boost::unique_lock< boost::mutex > lock( queue->writerMutex );
+
+				queue->isWriterWaiting.store( true );
+				slot = &queue->slots[ queue->dequeuePosition & queue->mask ];
+
+				if( slot->sequence.load() != ( queue->dequeuePosition + 1 ) )
+				{
+					if( queue->isStopping.load() )
+						break;
+
+					queue->writerCondition.wait_for( lock, boost::chrono::milliseconds( 10 ) );
+				}
+
+				queue->isWriterWaiting.store( false );
+
+				continue;
+			}
+
+			for( size_t index = first = 0; index <= count; index++ )
+			{
+				if( ( index == count ) || ( ( batch[ index ]->type == ConsoleIO::OUTPUT_STREAM ) != ( batch[ first ]->type == ConsoleIO::OUTPUT_STREAM ) ) )
+				{
+					writeRecords( batch[ first ]->type, ( batch + first ), ( index - first ) );
+					first = index;
+				}
+			}
+
+			for( size_t index = 0; index < count; index++ )
+			{
+				batch[ index ]->data.clear();
+				batch[ index ]->sequence.store( ( queue->dequeuePosition + index + queue->mask + 1 ), memory_order_release );
+			}
+
+			queue->dequeuePosition += count;
+
+			{
+				boost::lock_guard< boost::mutex > lock( queue->writerMutex );
+
+				queue->writtenPosition.store( queue->dequeuePosition );
+				queue->flushCondition.notify_all();
+			}
+		}
+}
+
+void stopAtExit()
+{
+	// Write all queued records before the program ends.
+
+		if( ConsoleIO::isAsync() )
+			ConsoleIO::stopAsync();
+}
+
+} // 'ConsoleWriter' Namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of the 'ConsoleWriter' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Public Methods for the 'ConsoleIO' Class
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void ConsoleIO::startAsync( const size_t capacity, const ConsoleIO::OverflowPolicy policy )
+{
+	// Obtain locks.
+
+		boost::lock_guard< boost::mutex > lock( ConsoleWriter::controlMutex );
+
+	// Create scoped stack traces.
+
+		SCOPED_STACK_TRACE( "ConsoleIO::startAsync", 0000 );
+
+	// Create local variables.
+
+		static const int IS_REGISTERED = atexit( ConsoleWriter::stopAtExit );
+
+		size_t targetCapacity = 2;
+		ConsoleWriter::Queue* queue = nullptr;
+
+	// Start the background writer, then route console streams to its queue.
+
+		static_cast< void >( IS_REGISTERED );
+		QMX_ASSERT( !ConsoleWriter::activeQueue.load(), "QMXStdLib", "ConsoleIO::startAsync", "00000037", capacity );
+
+		while( targetCapacity < capacity )
+			targetCapacity <<= 1;
+
+		cout.flush();
+		cerr.flush();
+		clog.flush();
+		queue = new ConsoleWriter::Queue( targetCapacity, policy );
+		queue->writer = boost::thread( ConsoleWriter::runWriter, queue );
+		ConsoleWriter::activeQueue.store( queue );
+		isAsyncEnabled.store( true, memory_order_release );
+}
+
+void ConsoleIO::stopAsync()
+{
+	// Obtain locks.
+
+		boost::lock_guard< boost::mutex > lock( ConsoleWriter::controlMutex );
+
+	// Create scoped stack traces.
+
+		SCOPED_STACK_TRACE( "ConsoleIO::stopAsync", 0000 );
+
+	// Create local variables.
+
+		unique_ptr< ConsoleWriter::Queue > queue;
+
+	// Route console streams back to synchronous mode, wait for records being queued, then let the writer drain the queue and exit.
+
+		QMX_ASSERT( ConsoleWriter::activeQueue.load(), "QMXStdLib", "ConsoleIO::stopAsync", "00000038", "" );
+		isAsyncEnabled.store( false, memory_order_release );
+		queue.reset( ConsoleWriter::activeQueue.exchange( nullptr ) );
+
+		while( ConsoleWriter::activeProducers.load() )
+			boost::this_thread::yield();
+
+		{
+			boost::lock_guard< boost::mutex > writerLock( queue->writerMutex );
+
+			queue->isStopping.store( true );
+			queue->writerCondition.notify_one();
+		}
+
+		queue->writer.join();
+}
+
+void ConsoleIO::flush()
+{
+	// Create local variables.
+
+		size_t target = UNSET;
+		ConsoleWriter::Queue* queue = nullptr;
+
+	// Wait until the writer has passed every record queued so far; holding the control mutex keeps the queue alive meanwhile.
+
+		boost::lock_guard< boost::mutex > lock( ConsoleWriter::controlMutex );
+
+		queue = ConsoleWriter::activeQueue.load();
+
+		if( !queue )
+			return;
+
+		target = queue->enqueuePosition.load();
+
+		boost::unique_lock< boost::mutex > writerLock( queue->writerMutex );
+
+		queue->writerCondition.notify_one();
+
+		while( queue->writtenPosition.load() < target )
+			queue->flushCondition.wait( writerLock );
+}
+
+uint64_t ConsoleIO::getDroppedCount()
+{
+	// Return number of dropped records to calling routine.
+
+		return ConsoleWriter::droppedCount.load();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private Methods for the 'ConsoleIO' Class
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void ConsoleIO::submit( const ConsoleIO::StreamType type, const size_t recordStart )
+{
+	// Create local variables.
+
+		string& data = recordBuffer.data;
+		ConsoleWriter::Queue* queue = nullptr;
+		ConsoleWriter::Slot* slot = nullptr;
+		size_t position = UNSET;
+		size_t sequence = UNSET;
+
+	// Perform abort check.
+
+		if( data.size() == recordStart )
+			return;
+
+	// Register as a producer, so the queue cannot be destroyed under this call, then write the record directly if asynchronous mode has been disabled.
+
+		ConsoleWriter::activeProducers++;
+		queue = ConsoleWriter::activeQueue.load();
+
+		if( !queue )
+		{
+			ConsoleWriter::activeProducers--;
+			write( type, recordStart );
+
+			return;
+		}
+
+	// Claim a slot, dropping the record or waiting for room if the queue is full, depending on its policy.
+
+		position = queue->enqueuePosition.load( memory_order_relaxed );
+
+		for( ;; )
+		{
+			slot = &queue->slots[ position & queue->mask ];
+			sequence = slot->sequence.load( memory_order_acquire );
+
+			if( sequence == position )
+			{
+				if( queue->enqueuePosition.compare_exchange_weak( position, ( position + 1 ), memory_order_relaxed ) )
+					break;
+			}
+			else if( sequence < position )
+			{
+				if( queue->policy == DROP )
+				{
+					ConsoleWriter::droppedCount++;
+					ConsoleWriter::activeProducers--;
+					data.resize( recordStart );
+
+					return;
+				}
+
+				boost::this_thread::yield();
+				position = queue->enqueuePosition.load( memory_order_relaxed );
+			}
+			else
+				position = queue->enqueuePosition.load( memory_order_relaxed );
+		}
+
+	// Move the record into the slot, taking back the emptied string the slot held, and publish it.
+
+		slot->type = type;
+
+		if( recordStart )
+		{
+			slot->data.assign( data, recordStart, string::npos );
+			data.resize( recordStart );
+		}
+		else
+			slot->data.swap( data );
+
+		slot->sequence.store( ( position + 1 ), memory_order_release );
+
+	// Wake the writer if it is waiting for records.
+
+		atomic_thread_fence( memory_order_seq_cst );
+
+		if( queue->isWriterWaiting.load() )
+		{
+			boost::lock_guard< boost::mutex > lock( queue->writerMutex );
+
+			queue->writerCondition.notify_one();
+		}
+
+		ConsoleWriter::activeProducers--;
+}
+
+void ConsoleIO::write( const ConsoleIO::StreamType type, const size_t recordStart )
+{
+	// Create local variables.
+
+		string& data = recordBuffer.data;
+
+	// Perform abort check.
+
+		if( data.size() == recordStart )
+			return;
+
+	// Write the record with a single call while holding the lock of its stream, then remove it from the buffer.
+
+		{
+			boost::lock_guard< SharedMutex > lock( streamMutexes[ type ] );
+
+			( ( type == OUTPUT_STREAM ) ? cout : ( ( type == ERROR_STREAM ) ? cerr : clog ) ).write(
+				( data.data() + recordStart ),
+				( data.size() - recordStart )
+			);
+		}
+
+		data.resize( recordStart );
+}
+
+} // 'QMXStdLib' Namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of the 'QMXStdLib' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of 'ConsoleIO.cpp'
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
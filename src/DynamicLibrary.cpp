@@ -1,6 +1,6 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // DynamicLibrary.cpp
-// Robert M. Baker | Created : 15APR12 | Last Modified : 27AUG19 by Robert M. Baker
+// Robert M. Baker | Created : 15APR12 | Last Modified : 17OCT26 by Robert M. Baker
 // Version : 2.3.0
 // This is a source file for 'QMXStdLib'; it defines the implementation for a dynamically-loaded library class.
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -21,7 +21,7 @@
   * @file
   * @author  Robert M. Baker
   * @date    Created : 15APR12
-  * @date    Last Modified : 27AUG19 by Robert M. Baker
+  * @date    Last Modified : 17OCT26 by Robert M. Baker
   * @version 2.3.0
   *
   * @brief This source file defines the implementation for a dynamically-loaded library class.
@@ -136,6 +136,25 @@ const Path& DynamicLibrary::getPath() const
 }
 
 void* DynamicLibrary::getSymbol( const std::string& symbol ) const
+{
+	// Create scoped stack traces.
+
+		SCOPED_STACK_TRACE( "DynamicLibrary::getSymbol", 0000 );
+
+	// Create local variables.
+
+		Expected< void* > result = tryGetSymbol( symbol );
+
+	// Retrieve specified symbol from the dynamic library.
+
+		QMX_ASSERT_RESULT( result, getPath() << ", " << symbol );
+
+	// Return result to calling routine.
+
+		return result.getValue();
+}
+
+Expected< void* > DynamicLibrary::tryGetSymbol( const std::string& symbol ) const
 {
 	// Obtain locks.
 
@@ -143,7 +162,7 @@ void* DynamicLibrary::getSymbol( const std::string& symbol ) const
 
 	// Create scoped stack traces.
 
-		SCOPED_STACK_TRACE( "DynamicLibrary::getSymbol", 0000 );
+		SCOPED_STACK_TRACE( "DynamicLibrary::tryGetSymbol", 0000 );
 
 	// Create local variables.
 
@@ -151,15 +170,8 @@ void* DynamicLibrary::getSymbol( const std::string& symbol ) const
 
 	// Retrieve specified symbol from the dynamic library.
 
-		QMX_ASSERT( handle, "QMXStdLib", "DynamicLibrary::getSymbol", "00000004", symbol );
-
-		QMX_ASSERT(
-			( result = reinterpret_cast< void* >( DYNLIB_GETSYMBOL( handle, symbol.c_str() ) ) ),
-			"QMXStdLib",
-			"DynamicLibrary::getSymbol",
-			"00000005",
-			dynLibPath << ", " << symbol
-		);
+		QMX_EXPECT( handle, "QMXStdLib", "DynamicLibrary::getSymbol", "00000004" );
+		QMX_EXPECT( ( result = reinterpret_cast< void* >( DYNLIB_GETSYMBOL( handle, symbol.c_str() ) ) ), "QMXStdLib", "DynamicLibrary::getSymbol", "00000005" );
 
 	// Return result to calling routine.
 
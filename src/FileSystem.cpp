@@ -1,6 +1,6 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // FileSystem.cpp
-// Robert M. Baker | Created : 17DEC14 | Last Modified : 29AUG19 by Robert M. Baker
+// Robert M. Baker | Created : 17DEC14 | Last Modified : 17OCT26 by Robert M. Baker
 // Version : 2.3.0
 // This is a source file for 'QMXStdLib'; it defines the implementation for a set of file system functions.
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -21,7 +21,7 @@
   * @file
   * @author  Robert M. Baker
   * @date    Created : 17DEC14
-  * @date    Last Modified : 29AUG19 by Robert M. Baker
+  * @date    Last Modified : 17OCT26 by Robert M. Baker
   * @version 2.3.0
   *
   * @brief This source file defines the implementation for a set of file system functions.
@@ -49,7 +49,21 @@
 // Header Files
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include <atomic>
+#include <memory>
+
 #include "../include/FileSystem.hpp"
+#include "../include/TaskPool.hpp"
+
+#if ( QMX_PLATFORM == QMX_PLATFORM_LINUX )
+#	include <cerrno>
+#	include <fcntl.h>
+#	include <linux/fs.h>
+#	include <sys/ioctl.h>
+#	include <sys/sendfile.h>
+#	include <sys/stat.h>
+#	include <unistd.h>
+#endif // Platform Headers
 
 using namespace std;
 
@@ -67,6 +81,398 @@ namespace QMXStdLib
 namespace FileSystem
 {
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Start of the 'CopyEngine' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+  * @brief This is the namespace for the engine behind 'FileSystem::copy'.
+  *
+  * Every target is copied by its own task.  A directory task creates the destination directory and then submits a task for each of its entries, reusing the
+  * status the directory iterator already read; when the destination directory had to be created, its entries cannot exist yet, so their destinations are
+  * not checked.  A recursive copy runs its tasks on a private task pool, while any other copy runs its single task on the calling thread.
+  */
+
+namespace CopyEngine
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Type Definitions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct Job
+{
+	Job( bool targetIsRecursive, CopyOption targetCopyOption, const CopyHandler& targetProgressHandler ) :
+		isRecursive( targetIsRecursive ),
+		copyOption( targetCopyOption ),
+		progressHandler( targetProgressHandler ),
+		isAborted( false ),
+		fileCount( UNSET ),
+		directoryCount( UNSET ),
+		symlinkCount( UNSET ),
+		skippedCount( UNSET ),
+		byteCount( UNSET ),
+		startTime( boost::chrono::steady_clock::now() )
+	{
+		// Do nothing.
+	}
+
+	const bool isRecursive;
+	const CopyOption copyOption;
+	const CopyHandler& progressHandler;
+	TaskPool::InstancePtr pool;
+	TaskGroupPtr group;
+	boost::mutex jobMutex;
+	atomic< bool > isAborted;
+	Expected< void > result;
+	atomic< uint64_t > fileCount;
+	atomic< uint64_t > directoryCount;
+	atomic< uint64_t > symlinkCount;
+	atomic< uint64_t > skippedCount;
+	atomic< uint64_t > byteCount;
+	const boost::chrono::steady_clock::time_point startTime;
+};
+
+#if ( QMX_PLATFORM == QMX_PLATFORM_LINUX )
+class ScopedDescriptor
+{
+public:
+
+	explicit ScopedDescriptor( int targetDescriptor ) : descriptor( targetDescriptor )
+	{
+		// Do nothing.
+	}
+
+	~ScopedDescriptor()
+	{
+		// Perform necessary cleanup.
+
+			if( descriptor != -1 )
+				close( descriptor );
+	}
+
+	const int descriptor;
+};
+#endif // Platform Types
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Global Variables
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if ( QMX_PLATFORM == QMX_PLATFORM_LINUX )
+const size_t CHUNK_SIZE = 0x40000000;
+const size_t BUFFER_SIZE = 0x20000;
+#endif // Platform Variables
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Function Declarations
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void dispatch( Job& job, const Path& source, const Path& destination, const boost::filesystem::file_status& status, bool isMissing );
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Function Definitions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void snapshot( const Job& job, CopyStatistics& target )
+{
+	// Copy the current counters of the specified job into the specified statistics.
+
+		target.fileCount = job.fileCount;
+		target.directoryCount = job.directoryCount;
+		target.symlinkCount = job.symlinkCount;
+		target.skippedCount = job.skippedCount;
+		target.byteCount = job.byteCount;
+		target.elapsed = boost::chrono::duration_cast< boost::chrono::nanoseconds >( boost::chrono::steady_clock::now() - job.startTime ).count();
+}
+
+void report( Job& job )
+{
+	// Create local variables.
+
+		CopyStatistics statistics;
+
+	// Pass the statistics so far to the progress handler, if there is one.
+
+		if( job.progressHandler )
+		{
+			boost::lock_guard< boost::mutex > lock( job.jobMutex );
+			snapshot( job, statistics );
+			job.progressHandler( statistics );
+		}
+}
+
+void fail( Job& job, const Expected< void >& result )
+{
+	// Obtain locks.
+
+		boost::lock_guard< boost::mutex > lock( job.jobMutex );
+
+	// Record the specified error, unless an earlier one already aborted the job.
+
+		if( !job.isAborted )
+		{
+			job.result = result;
+			job.isAborted = true;
+		}
+}
+
+#if ( QMX_PLATFORM == QMX_PLATFORM_LINUX )
+bool isInterrupted( ssize_t count )
+{
+	// Return result of checking if a system call failed only because a signal interrupted it to calling routine.
+
+		return( ( count == -1 ) && ( errno == EINTR ) );
+}
+
+bool writeAll( int descriptor, const char* data, size_t size )
+{
+	// Create local variables.
+
+		ssize_t count = UNSET;
+
+	// Write the specified data, resuming after short writes and interrupted calls.
+
+		while( size )
+		{
+			count = write( descriptor, data, size );
+
+			if( count > 0 )
+			{
+				data += count;
+				size -= static_cast< size_t >( count );
+			}
+			else if( !isInterrupted( count ) )
+				return false;
+		}
+
+	// Return result to calling routine.
+
+		return true;
+}
+#endif // Platform Functions
+
+Expected< void > copyFile( Job& job, const Path& source, const Path& destination, bool isOverwriting )
+{
+#if ( QMX_PLATFORM == QMX_PLATFORM_LINUX )
+	// Create local variables.
+
+		ScopedDescriptor sourceFile( open( source.c_str(), ( O_RDONLY | O_CLOEXEC ) ) );
+		struct stat sourceStatus;
+		ssize_t count = UNSET;
+		unique_ptr< char[] > buffer;
+
+	// Open both files; the destination receives the permissions of the source.
+
+		QMX_EXPECT( ( ( sourceFile.descriptor != -1 ) && !fstat( sourceFile.descriptor, &sourceStatus ) ), "QMXStdLib", "FileSystem::copy", "0000000F" );
+
+		ScopedDescriptor destinationFile(
+			open( destination.c_str(), ( O_WRONLY | O_CREAT | O_CLOEXEC | ( isOverwriting ? O_TRUNC : O_EXCL ) ), ( sourceStatus.st_mode & 07777 ) )
+		);
+
+		QMX_EXPECT( ( destinationFile.descriptor != -1 ), "QMXStdLib", "FileSystem::copy", "0000000F" );
+		QMX_EXPECT( !fchmod( destinationFile.descriptor, ( sourceStatus.st_mode & 07777 ) ), "QMXStdLib", "FileSystem::copy", "0000000F" );
+
+	// Clone the source if the filesystem supports reflinks; otherwise, copy it inside the kernel, falling back to sending it and then to reading and writing it.
+	// Each fallback continues from the file offsets the previous one left behind.
+
+		if( !ioctl( destinationFile.descriptor, FICLONE, sourceFile.descriptor ) )
+		{
+			job.byteCount += static_cast< uint64_t >( sourceStatus.st_size );
+
+			return Expected< void >();
+		}
+
+	// Every stage retries calls interrupted by a signal.
+
+		while(
+			( ( count = copy_file_range( sourceFile.descriptor, nullptr, destinationFile.descriptor, nullptr, CHUNK_SIZE, 0 ) ) > 0 ) ||
+			isInterrupted( count )
+		)
+		{
+			if( count > 0 )
+				job.byteCount += static_cast< uint64_t >( count );
+		}
+
+		if( count && ( ( errno == EXDEV ) || ( errno == EINVAL ) || ( errno == ENOSYS ) || ( errno == EOPNOTSUPP ) ) )
+		{
+			while( ( ( count = sendfile( destinationFile.descriptor, sourceFile.descriptor, nullptr, CHUNK_SIZE ) ) > 0 ) || isInterrupted( count ) )
+			{
+				if( count > 0 )
+					job.byteCount += static_cast< uint64_t >( count );
+			}
+
+			if( count && ( ( errno == EINVAL ) || ( errno == ENOSYS ) ) )
+			{
+				buffer.reset( new char[ BUFFER_SIZE ] );
+
+				while( ( ( count = read( sourceFile.descriptor, buffer.get(), BUFFER_SIZE ) ) > 0 ) || isInterrupted( count ) )
+				{
+					if( count > 0 )
+					{
+						QMX_EXPECT( writeAll( destinationFile.descriptor, buffer.get(), count ), "QMXStdLib", "FileSystem::copy", "0000000F" );
+						job.byteCount += static_cast< uint64_t >( count );
+					}
+				}
+			}
+		}
+
+		QMX_EXPECT( !count, "QMXStdLib", "FileSystem::copy", "0000000F" );
+#else
+	// Create local variables.
+
+		boost::system::error_code errorCode;
+		uintmax_t size = boost::filesystem::file_size( source, errorCode );
+
+	// Copy the source file.
+
+		QMX_EXPECT( !errorCode, "QMXStdLib", "FileSystem::copy", "0000000F" );
+
+		boost::filesystem::copy_file(
+			source,
+			destination,
+			( isOverwriting ? boost::filesystem::copy_options::overwrite_existing : boost::filesystem::copy_options::none ),
+			errorCode
+		);
+
+		QMX_EXPECT( !errorCode, "QMXStdLib", "FileSystem::copy", "0000000F" );
+		job.byteCount += size;
+#endif // Platform Implementation
+
+	// Return result to calling routine.
+
+		return Expected< void >();
+}
+
+Expected< void > copyTarget( Job& job, const Path& source, const Path& destination, const boost::filesystem::file_status& status, bool isMissing )
+{
+	// Create local variables.
+
+		boost::system::error_code errorCode;
+		boost::filesystem::file_status destinationStatus;
+		Expected< void > result;
+		bool isExisting = false;
+
+	// Check if the destination exists, unless it is already known to be missing.
+
+		if( !isMissing )
+		{
+			destinationStatus = boost::filesystem::status( destination, errorCode );
+			QMX_EXPECT( ( !errorCode || ( destinationStatus.type() == boost::filesystem::file_not_found ) ), "QMXStdLib", "FileSystem::copy", "0000000F" );
+			isExisting = boost::filesystem::exists( destinationStatus );
+			errorCode.clear();
+		}
+
+	// Copy the specified source path to the specified destination path, submitting the entries of a directory when copying recursively.
+
+		if( boost::filesystem::is_directory( status ) )
+		{
+			if( !isExisting )
+			{
+				boost::filesystem::create_directory( destination, errorCode );
+
+				if( !errorCode )
+					boost::filesystem::permissions( destination, status.permissions(), errorCode );
+			}
+			else
+				QMX_EXPECT( ( job.copyOption != FAIL_IF_EXISTS ), "QMXStdLib", "FileSystem::copy", "0000000F" );
+
+			QMX_EXPECT( !errorCode, "QMXStdLib", "FileSystem::copy", "0000000F" );
+			job.directoryCount++;
+
+			if( job.isRecursive )
+			{
+				DirectoryIterator index( source, errorCode );
+
+				for( ; !errorCode && !job.isAborted && ( index != DIRECTORY_END ); index.increment( errorCode ) )
+				{
+					dispatch( job, index->path(), ( destination / index->path().filename() ), index->symlink_status( errorCode ), !isExisting );
+
+					if( errorCode )
+						break;
+				}
+
+				QMX_EXPECT( !errorCode, "QMXStdLib", "FileSystem::copy", "0000000F" );
+			}
+		}
+		else if( isExisting && ( job.copyOption == SKIP_IF_EXISTS ) )
+			job.skippedCount++;
+		else
+		{
+			QMX_EXPECT( ( !isExisting || ( job.copyOption == OVERWRITE_IF_EXISTS ) ), "QMXStdLib", "FileSystem::copy", "0000000F" );
+
+			if( boost::filesystem::is_regular_file( status ) )
+			{
+				if( !( result = copyFile( job, source, destination, isExisting ) ) )
+					return result;
+
+				job.fileCount++;
+			}
+			else if( boost::filesystem::is_symlink( status ) )
+			{
+				if( isExisting )
+					boost::filesystem::remove( destination, errorCode );
+
+				if( !errorCode )
+					boost::filesystem::copy_symlink( source, destination, errorCode );
+
+				QMX_EXPECT( !errorCode, "QMXStdLib", "FileSystem::copy", "0000000F" );
+				job.symlinkCount++;
+			}
+			else if( job.copyOption == OVERWRITE_IF_EXISTS )
+				return Error( "QMXStdLib", "FileSystem::copy", "0000000E" );
+			else
+				return Error( "QMXStdLib", "FileSystem::copy", "0000000F" );
+		}
+
+	// Return result to calling routine.
+
+		return result;
+}
+
+void run( Job* job, const Path& source, const Path& destination, const boost::filesystem::file_status& status, bool isMissing )
+{
+	// Create local variables.
+
+		Expected< void > result;
+
+	// Perform abort check.
+
+		if( job->isAborted )
+			return;
+
+	// Copy the specified target, then either report progress or abort the job.
+
+		try
+		{
+			if( ( result = copyTarget( *job, source, destination, status, isMissing ) ) )
+				report( *job );
+		}
+		catch( const exception& except )
+		{
+			result = Error( "QMXStdLib", "FileSystem::copy", "0000000F" );
+		}
+
+		if( !result )
+			fail( *job, result );
+}
+
+void dispatch( Job& job, const Path& source, const Path& destination, const boost::filesystem::file_status& status, bool isMissing )
+{
+	// Submit the specified target to the job's task pool, or copy it right away if the job has none.
+
+		if( job.pool )
+			job.pool->submit( job.group, &run, &job, source, destination, status, isMissing );
+		else
+			run( &job, source, destination, status, isMissing );
+}
+
+} // 'CopyEngine' Namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of the 'CopyEngine' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Function Definitions
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -194,7 +600,14 @@ void createLink( const Path& source, const Path& link, bool isHardlink )
 		}
 }
 
-void copy( const Path& source, const Path& destination, bool isRecursive, CopyOption targetCopyOption )
+void copy(
+	const Path& source,
+	const Path& destination,
+	bool isRecursive,
+	CopyOption targetCopyOption,
+	CopyStatistics* statistics,
+	const CopyHandler& progressHandler
+)
 {
 	// Create scoped stack traces.
 
@@ -202,89 +615,59 @@ void copy( const Path& source, const Path& destination, bool isRecursive, CopyOp
 
 	// Create local variables.
 
-		boost::filesystem::file_status status;
-		Path recursionSource;
-		Path recursionDestination;
+		Expected< void > result = tryCopy( source, destination, isRecursive, targetCopyOption, statistics, progressHandler );
 
-	// Copy the specified source path to the specified destination path with optional recursion and overwriting.
+	// Check copy result.
 
-		try
-		{
-			status = boost::filesystem::symlink_status( source );
+		QMX_ASSERT_RESULT( result, source << ", " << destination << ", " << boolalpha << isRecursive << ", " << targetCopyOption );
+}
 
-			if( boost::filesystem::is_directory( status ) )
-			{
-				if( !boost::filesystem::exists( destination ) )
-					boost::filesystem::copy_directory( source, destination );
-				else if( targetCopyOption == FAIL_IF_EXISTS )
-					QMX_THROW(
-						"QMXStdLib",
-						"FileSystem::copy",
-						"0000000F",
-						source << ", " << destination << ", " << boolalpha << isRecursive << ", " << targetCopyOption
-					);
-
-				if( isRecursive )
-				{
-					for( DirectoryIterator index( source ); index != DIRECTORY_END; index++ )
-					{
-						recursionSource = index->path();
-						recursionDestination = destination.string() + '/' + index->path().filename().string();
-						copy( recursionSource, recursionDestination, true, targetCopyOption );
-					}
-				}
-			}
-			else
-			{
-				switch( targetCopyOption )
-				{
-					case SKIP_IF_EXISTS:
-					{
-						if( !boost::filesystem::exists( destination ) )
-							boost::filesystem::copy( source, destination );
+Expected< void > tryCopy(
+	const Path& source,
+	const Path& destination,
+	bool isRecursive,
+	CopyOption targetCopyOption,
+	CopyStatistics* statistics,
+	const CopyHandler& progressHandler
+)
+{
+	// Create scoped stack traces.
 
-						break;
-					}
+		SCOPED_STACK_TRACE( "FileSystem::tryCopy", 0000 );
 
-					case FAIL_IF_EXISTS:
-					{
-						boost::filesystem::copy( source, destination );
+	// Create local variables.
 
-						break;
-					}
+		boost::system::error_code errorCode;
+		boost::filesystem::file_status status;
+		CopyEngine::Job job( isRecursive, targetCopyOption, progressHandler );
 
-					case OVERWRITE_IF_EXISTS:
-					{
-						if( boost::filesystem::is_regular_file( status ) )
-							boost::filesystem::copy_file( source, destination, boost::filesystem::copy_option::overwrite_if_exists );
-						else if( boost::filesystem::is_symlink( status ) )
-						{
-							if( boost::filesystem::exists( destination ) )
-								boost::filesystem::remove( destination );
-
-							boost::filesystem::copy_symlink( source, destination );
-						}
-						else
-							QMX_THROW(
-								"QMXStdLib",
-								"FileSystem::copy",
-								"0000000E",
-								source << ", " << destination << ", " << boolalpha << isRecursive << ", " << targetCopyOption
-							);
+	// Copy the specified source path to the specified destination path with optional recursion and overwriting; a recursive copy of a directory runs on its
+	// own task pool.
 
-						break;
-					}
-				}
-			}
+		status = boost::filesystem::symlink_status( source, errorCode );
+		QMX_EXPECT( ( !errorCode || ( status.type() == boost::filesystem::file_not_found ) ), "QMXStdLib", "FileSystem::copy", "0000000F" );
+
+		if( isRecursive && boost::filesystem::is_directory( status ) )
+		{
+			job.pool = TaskPool::create();
+			job.group = make_shared< TaskGroup >();
+			job.pool->start( FILESYSTEM_COPY_WORKER_COUNT );
 		}
-		catch( const boost::filesystem::filesystem_error& except )
+
+		CopyEngine::run( &job, source, destination, status, false );
+
+		if( job.pool )
 		{
-			QMX_THROW(
-				"QMXStdLib",
-				"FileSystem::Copy",
-				"0000000F",
-				source << ", " << destination << ", " << boolalpha << isRecursive << ", " << targetCopyOption );
+			job.group->wait();
+			job.pool->stop( false );
 		}
+
+		if( statistics )
+			CopyEngine::snapshot( job, *statistics );
+
+	// Return result to calling routine.
+
+		return job.result;
 }
 
 bool runCommand( const char* command, int successValue )
@@ -0,0 +1,628 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// LatencyRecorder.cpp
+// Robert M. Baker | Created : 17OCT26 | Last Modified : 17OCT26 by Robert M. Baker
+// Version : 2.3.0
+// This is a source file for 'QMXStdLib'; it defines the implementation for a latency histogram class.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+//
+// This file is part of 'QMXStdLib'.
+//
+// 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option) any later version.
+//
+// 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+  * @file
+  * @author  Robert M. Baker
+  * @date    Created : 17OCT26
+  * @date    Last Modified : 17OCT26 by Robert M. Baker
+  * @version 2.3.0
+  *
+  * @brief This source file defines the implementation for a latency histogram class.
+  *
+  * @section LatencyRecorderS0000 Description
+  *
+  * This source file defines the implementation for a latency histogram class.
+  *
+  * @section LatencyRecorderS0001 License
+  *
+  * Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+  *
+  * This file is part of 'QMXStdLib'.
+  *
+  * 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+  * Software Foundation, either version 3 of the License, or (at your option) any later version.
+  *
+  * 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+  * A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+  *
+  * You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+  */
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Header Files
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+
+#include "../include/LatencyRecorder.hpp"
+
+using namespace std;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Start of the 'QMXStdLib' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace QMXStdLib
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Start of the 'LatencyDump' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+  * @brief This is the namespace for encoding and decoding dumped latency histograms.
+  *
+  * A dump begins with the 'QMXL' signature, followed by variable-length integers holding the format version, the histogram layout, the count, total,
+  * minimum, and maximum, and then a pair for each bucket holding latencies: the number of empty buckets skipped since the previous one, and the count.
+  */
+
+namespace LatencyDump
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Global Variables
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const char SIGNATURE[] = { 'Q', 'M', 'X', 'L' };
+const uint64_t VERSION = 1;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Function Definitions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void writeInteger( string& target, uint64_t value )
+{
+	// Write value seven bits at a time, setting the high bit of every byte but the last.
+
+		while( value >= 0x80 )
+		{
+			target.push_back( static_cast< char >( ( value & 0x7F ) | 0x80 ) );
+			value >>= 7;
+		}
+
+		target.push_back( static_cast< char >( value ) );
+}
+
+bool readInteger( const string& source, size_t& offset, uint64_t& value )
+{
+	// Create local variables.
+
+		uint8_t byte = UNSET;
+
+	// Read value seven bits at a time, failing if the string ends first or the value does not fit in 64 bits.
+
+		value = UNSET;
+
+		for( uint32_t shift = 0; shift < 64; shift += 7 )
+		{
+			if( offset == source.size() )
+				return false;
+
+			byte = static_cast< uint8_t >( source[ offset++ ] );
+			value |= ( static_cast< uint64_t >( byte & 0x7F ) << shift );
+
+			if( !( byte & 0x80 ) )
+				return ( ( shift < 63 ) || ( byte <= 1 ) );
+		}
+
+	// Report failure to calling routine.
+
+		return false;
+}
+
+} // 'LatencyDump' Namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of the 'LatencyDump' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Public Methods for the 'LatencyRecorder' Class
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+LatencyRecorder::~LatencyRecorder()
+{
+	try
+	{
+		// Perform necessary cleanup.
+
+			if( initialized )
+				deallocate();
+	}
+	catch( const exception& except )
+	{
+		// Do nothing.
+	}
+
+	// Release shards.
+
+		for( auto& shard : shards )
+			delete shard.load();
+}
+
+void LatencyRecorder::record( int64_t nanoseconds )
+{
+	// Create local variables.
+
+		Shard& shard = getShard();
+		int64_t limit = UNSET;
+
+	// Count latency in its bucket and update the totals of the shard.
+
+		nanoseconds = max< int64_t >( nanoseconds, 0 );
+		shard.buckets[ getBucketIndex( nanoseconds ) ].fetch_add( 1, memory_order_relaxed );
+		shard.count.fetch_add( 1, memory_order_relaxed );
+		shard.total.fetch_add( nanoseconds, memory_order_relaxed );
+		limit = shard.minimum.load( memory_order_relaxed );
+
+		while( ( nanoseconds < limit ) && !shard.minimum.compare_exchange_weak( limit, nanoseconds, memory_order_relaxed ) );
+			// Empty Loop
+
+		limit = shard.maximum.load( memory_order_relaxed );
+
+		while( ( nanoseconds > limit ) && !shard.maximum.compare_exchange_weak( limit, nanoseconds, memory_order_relaxed ) );
+			// Empty Loop
+}
+
+void LatencyRecorder::record( const Timer& timer )
+{
+	// Record elapsed time of specified timer.
+
+		record( timer.getNanoseconds() );
+}
+
+void LatencyRecorder::reset()
+{
+	// Create local variables.
+
+		Shard* shard = nullptr;
+
+	// Empty every shard created so far.
+
+		for( auto& slot : shards )
+		{
+			shard = slot.load( memory_order_acquire );
+
+			if( shard )
+			{
+				for( auto& bucket : shard->buckets )
+					bucket.store( UNSET, memory_order_relaxed );
+
+				shard->count.store( UNSET, memory_order_relaxed );
+				shard->total.store( UNSET, memory_order_relaxed );
+				shard->minimum.store( numeric_limits< int64_t >::max(), memory_order_relaxed );
+				shard->maximum.store( UNSET, memory_order_relaxed );
+			}
+		}
+}
+
+uint64_t LatencyRecorder::getCount() const
+{
+	// Create local variables.
+
+		Shard* shard = nullptr;
+		uint64_t result = UNSET;
+
+	// Add counts of every shard created so far.
+
+		for( const auto& slot : shards )
+		{
+			shard = slot.load( memory_order_acquire );
+
+			if( shard )
+				result += shard->count.load( memory_order_relaxed );
+		}
+
+	// Return result to calling routine.
+
+		return result;
+}
+
+int64_t LatencyRecorder::getMinimum() const
+{
+	// Create local variables.
+
+		Shard* shard = nullptr;
+		int64_t result = numeric_limits< int64_t >::max();
+
+	// Find smallest latency of every shard created so far.
+
+		for( const auto& slot : shards )
+		{
+			shard = slot.load( memory_order_acquire );
+
+			if( shard )
+				result = min( result, shard->minimum.load( memory_order_relaxed ) );
+		}
+
+	// Return result to calling routine.
+
+		return ( ( result == numeric_limits< int64_t >::max() ) ? 0 : result );
+}
+
+int64_t LatencyRecorder::getMaximum() const
+{
+	// Create local variables.
+
+		Shard* shard = nullptr;
+		int64_t result = UNSET;
+
+	// Find largest latency of every shard created so far.
+
+		for( const auto& slot : shards )
+		{
+			shard = slot.load( memory_order_acquire );
+
+			if( shard )
+				result = max( result, shard->maximum.load( memory_order_relaxed ) );
+		}
+
+	// Return result to calling routine.
+
+		return result;
+}
+
+real_t LatencyRecorder::getMean() const
+{
+	// Create local variables.
+
+		Shard* shard = nullptr;
+		uint64_t count = UNSET;
+		uint64_t total = UNSET;
+
+	// Add counts and totals of every shard created so far.
+
+		for( const auto& slot : shards )
+		{
+			shard = slot.load( memory_order_acquire );
+
+			if( shard )
+			{
+				count += shard->count.load( memory_order_relaxed );
+				total += shard->total.load( memory_order_relaxed );
+			}
+		}
+
+	// Return result to calling routine.
+
+		return ( count ? ( static_cast< real_t >( total ) / count ) : 0.0l );
+}
+
+int64_t LatencyRecorder::getPercentile( const real_t percentile ) const
+{
+	// Create scoped stack traces.
+
+		SCOPED_STACK_TRACE( "LatencyRecorder::getPercentile", 0000 );
+
+	// Return latency at specified percentile to calling routine.
+
+		QMX_ASSERT( ( ( percentile >= 0.0l ) && ( percentile <= 100.0l ) ), "QMXStdLib", "LatencyRecorder::getPercentile", "00000035", percentile );
+
+		return getPercentile( getSummary(), percentile );
+}
+
+vector< int64_t > LatencyRecorder::getPercentiles( const vector< real_t >& percentiles ) const
+{
+	// Create scoped stack traces.
+
+		SCOPED_STACK_TRACE( "LatencyRecorder::getPercentiles", 0000 );
+
+	// Create local variables.
+
+		Summary summary;
+		vector< int64_t > result;
+
+	// Merge the shards once and look up each of the specified percentiles.
+
+		for( auto percentile : percentiles )
+			QMX_ASSERT( ( ( percentile >= 0.0l ) && ( percentile <= 100.0l ) ), "QMXStdLib", "LatencyRecorder::getPercentiles", "00000035", percentile );
+
+		summary = getSummary();
+		result.reserve( percentiles.size() );
+
+		for( auto percentile : percentiles )
+			result.push_back( getPercentile( summary, percentile ) );
+
+	// Return result to calling routine.
+
+		return result;
+}
+
+string LatencyRecorder::dump() const
+{
+	// Create local variables.
+
+		Summary summary = getSummary();
+		size_t previous = UNSET;
+		string result( LatencyDump::SIGNATURE, sizeof( LatencyDump::SIGNATURE ) );
+
+	// Write the header, then the position and count of every bucket holding latencies.
+
+		LatencyDump::writeInteger( result, LatencyDump::VERSION );
+		LatencyDump::writeInteger( result, PRECISION_BITS );
+		LatencyDump::writeInteger( result, RANGE_BITS );
+		LatencyDump::writeInteger( result, summary.count );
+		LatencyDump::writeInteger( result, summary.total );
+		LatencyDump::writeInteger( result, ( summary.count ? summary.minimum : 0 ) );
+		LatencyDump::writeInteger( result, summary.maximum );
+
+		for( size_t index = 0; index < BUCKET_COUNT; index++ )
+		{
+			if( summary.buckets[ index ] )
+			{
+				LatencyDump::writeInteger( result, ( index - previous ) );
+				LatencyDump::writeInteger( result, summary.buckets[ index ] );
+				previous = ( index + 1 );
+			}
+		}
+
+	// Return result to calling routine.
+
+		return result;
+}
+
+void LatencyRecorder::load( const string& source )
+{
+	// Create scoped stack traces.
+
+		SCOPED_STACK_TRACE( "LatencyRecorder::load", 0000 );
+
+	// Create local variables.
+
+		bool isValid = false;
+		size_t offset = sizeof( LatencyDump::SIGNATURE );
+		size_t index = UNSET;
+		uint64_t header[ 7 ] = { UNSET, UNSET, UNSET, UNSET, UNSET, UNSET, UNSET };
+		uint64_t gap = UNSET;
+		uint64_t count = UNSET;
+		uint64_t loaded = UNSET;
+		Summary summary;
+
+	// Read and check the header.
+
+		isValid = (
+			( source.size() >= sizeof( LatencyDump::SIGNATURE ) ) && equal( begin( LatencyDump::SIGNATURE ), end( LatencyDump::SIGNATURE ), source.begin() )
+		);
+
+		for( auto& field : header )
+			isValid = ( isValid && LatencyDump::readInteger( source, offset, field ) );
+
+		isValid = (
+			isValid && ( header[ 0 ] == LatencyDump::VERSION ) && ( header[ 1 ] == PRECISION_BITS ) && ( header[ 2 ] == RANGE_BITS ) &&
+			( header[ 5 ] <= static_cast< uint64_t >( numeric_limits< int64_t >::max() ) ) &&
+			( header[ 6 ] <= static_cast< uint64_t >( numeric_limits< int64_t >::max() ) )
+		);
+
+		QMX_ASSERT( isValid, "QMXStdLib", "LatencyRecorder::load", "00000036", "" );
+
+	// Read the buckets, checking that they stay in range and add up to the recorded count.
+
+		while( offset < source.size() )
+		{
+			isValid = ( LatencyDump::readInteger( source, offset, gap ) && LatencyDump::readInteger( source, offset, count ) );
+			isValid = ( isValid && ( gap < ( BUCKET_COUNT - index ) ) && count && ( count <= ( header[ 3 ] - loaded ) ) );
+			QMX_ASSERT( isValid, "QMXStdLib", "LatencyRecorder::load", "00000036", "" );
+			index += gap;
+			summary.buckets[ index++ ] = count;
+			loaded += count;
+		}
+
+		QMX_ASSERT( ( loaded == header[ 3 ] ), "QMXStdLib", "LatencyRecorder::load", "00000036", "" );
+
+	// Add the histogram to this one.
+
+		if( loaded )
+		{
+			summary.count = header[ 3 ];
+			summary.total = header[ 4 ];
+			summary.minimum = static_cast< int64_t >( header[ 5 ] );
+			summary.maximum = static_cast< int64_t >( header[ 6 ] );
+			addSummary( summary );
+		}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private Methods for the 'LatencyRecorder' Class
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+LatencyRecorder::LatencyRecorder()
+{
+	// Initialize fields.
+
+		for( auto& shard : shards )
+			shard.store( nullptr );
+}
+
+void LatencyRecorder::cloneImp( LatencyRecorder::InstancePtr& target ) const
+{
+	// Assign data of 'this' to specified object.
+
+		target->reset();
+		target->addSummary( getSummary() );
+}
+
+LatencyRecorder::Shard& LatencyRecorder::getShard()
+{
+	// Create local variables.
+
+		Shard* result = nullptr;
+		Shard* created = nullptr;
+
+	// Give the current thread its shard, on first use, then create the shard if no thread has used it yet.
+
+		if( shardIndex == SHARD_COUNT )
+			shardIndex = ( nextShard.fetch_add( 1, memory_order_relaxed ) % SHARD_COUNT );
+
+		result = shards[ shardIndex ].load( memory_order_acquire );
+
+		if( !result )
+		{
+			created = new Shard();
+
+			if( shards[ shardIndex ].compare_exchange_strong( result, created, memory_order_acq_rel ) )
+				result = created;
+			else
+				delete created;
+		}
+
+	// Return result to calling routine.
+
+		return *result;
+}
+
+LatencyRecorder::Summary LatencyRecorder::getSummary() const
+{
+	// Create local variables.
+
+		Shard* shard = nullptr;
+		Summary result;
+
+	// Add the buckets and totals of every shard created so far; the count is taken from the buckets, so percentiles stay consistent while others record.
+
+		for( const auto& slot : shards )
+		{
+			shard = slot.load( memory_order_acquire );
+
+			if( shard )
+			{
+				for( size_t index = 0; index < BUCKET_COUNT; index++ )
+					result.buckets[ index ] += shard->buckets[ index ].load( memory_order_relaxed );
+
+				result.total += shard->total.load( memory_order_relaxed );
+				result.minimum = min( result.minimum, shard->minimum.load( memory_order_relaxed ) );
+				result.maximum = max( result.maximum, shard->maximum.load( memory_order_relaxed ) );
+			}
+		}
+
+		for( auto count : result.buckets )
+			result.count += count;
+
+	// Return result to calling routine.
+
+		return result;
+}
+
+void LatencyRecorder::addSummary( const LatencyRecorder::Summary& source )
+{
+	// Create local variables.
+
+		Shard& shard = getShard();
+		int64_t limit = UNSET;
+
+	// Add the buckets and totals of specified histogram to the shard of the current thread.
+
+		for( size_t index = 0; index < BUCKET_COUNT; index++ )
+		{
+			if( source.buckets[ index ] )
+				shard.buckets[ index ].fetch_add( source.buckets[ index ], memory_order_relaxed );
+		}
+
+		shard.count.fetch_add( source.count, memory_order_relaxed );
+		shard.total.fetch_add( source.total, memory_order_relaxed );
+		limit = shard.minimum.load( memory_order_relaxed );
+
+		while( ( source.minimum < limit ) && !shard.minimum.compare_exchange_weak( limit, source.minimum, memory_order_relaxed ) );
+			// Empty Loop
+
+		limit = shard.maximum.load( memory_order_relaxed );
+
+		while( ( source.maximum > limit ) && !shard.maximum.compare_exchange_weak( limit, source.maximum, memory_order_relaxed ) );
+			// Empty Loop
+}
+
+int64_t LatencyRecorder::getPercentile( const LatencyRecorder::Summary& source, const real_t percentile )
+{
+	// Create local variables.
+
+		uint64_t rank = UNSET;
+		uint64_t count = UNSET;
+
+	// Find the bucket holding the latency at the rank of specified percentile, rounded to the nearest sample; the last bucket has no limit, so the largest
+	// latency is reported for it.
+
+		if( !source.count )
+			return 0;
+
+		rank = max< uint64_t >( static_cast< uint64_t >( ( ( percentile / 100.0l ) * source.count ) + 0.5l ), 1 );
+
+		for( size_t index = 0; index < BUCKET_COUNT; index++ )
+		{
+			count += source.buckets[ index ];
+
+			if( count >= rank )
+			{
+				return (
+					( index == ( BUCKET_COUNT - 1 ) ) ? source.maximum : clamp( getBucketLimit( index ), min( source.minimum, source.maximum ), source.maximum )
+				);
+			}
+		}
+
+	// Return result to calling routine.
+
+		return source.maximum;
+}
+
+size_t LatencyRecorder::getBucketIndex( const uint64_t value )
+{
+	// Create local variables.
+
+		uint32_t shift = UNSET;
+
+	// Values below twice the sub-bucket count map to themselves; larger ones keep their top bits, which select a bucket within their power of two.
+
+		if( value < ( 2ull << PRECISION_BITS ) )
+			return value;
+		else if( value >> RANGE_BITS )
+			return ( BUCKET_COUNT - 1 );
+
+		shift = ( ( 63 - __builtin_clzll( value ) ) - PRECISION_BITS );
+
+	// Return result to calling routine.
+
+		return ( ( static_cast< size_t >( shift ) << PRECISION_BITS ) + ( value >> shift ) );
+}
+
+int64_t LatencyRecorder::getBucketLimit( const size_t index )
+{
+	// Create local variables.
+
+		size_t shift = UNSET;
+
+	// Reverse the mapping done by 'getBucketIndex', then fill the bits it dropped.
+
+		if( index < ( 2ull << PRECISION_BITS ) )
+			return index;
+
+		shift = ( ( index >> PRECISION_BITS ) - 1 );
+
+	// Return result to calling routine.
+
+		return ( ( static_cast< int64_t >( ( index - ( shift << PRECISION_BITS ) ) + 1 ) << shift ) - 1 );
+}
+
+} // 'QMXStdLib' Namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of the 'QMXStdLib' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of 'LatencyRecorder.cpp'
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
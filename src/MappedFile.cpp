@@ -0,0 +1,483 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// MappedFile.cpp
+// Robert M. Baker | Created : 17OCT26 | Last Modified : 17OCT26 by Robert M. Baker
+// Version : 2.3.0
+// This is a source file for 'QMXStdLib'; it defines the implementation for a memory-mapped file class.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+//
+// This file is part of 'QMXStdLib'.
+//
+// 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option) any later version.
+//
+// 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+  * @file
+  * @author  Robert M. Baker
+  * @date    Created : 17OCT26
+  * @date    Last Modified : 17OCT26 by Robert M. Baker
+  * @version 2.3.0
+  *
+  * @brief This source file defines the implementation for a memory-mapped file class.
+  *
+  * @section MappedFileS0000 Description
+  *
+  * This source file defines the implementation for a memory-mapped file class.
+  *
+  * @section MappedFileS0001 License
+  *
+  * Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+  *
+  * This file is part of 'QMXStdLib'.
+  *
+  * 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+  * Software Foundation, either version 3 of the License, or (at your option) any later version.
+  *
+  * 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+  * A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+  *
+  * You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+  */
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Header Files
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../include/MappedFile.hpp"
+
+#if ( QMX_PLATFORM != QMX_PLATFORM_WINDOWS )
+#	include <fcntl.h>
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#	include <unistd.h>
+#endif // Platform Headers
+
+using namespace std;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Start of the 'QMXStdLib' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace QMXStdLib
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Public Methods for the 'MappedFile' Class
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+MappedFile::~MappedFile()
+{
+	try
+	{
+		// Perform necessary cleanup.
+
+			if( initialized )
+				deallocate();
+	}
+	catch( const exception& except )
+	{
+		// Do nothing.
+	}
+}
+
+void MappedFile::open( const Path& source, const MappedFile::Mode targetMode )
+{
+	// Obtain locks.
+
+		SCOPED_WRITE_LOCK;
+
+	// Create scoped stack traces.
+
+		SCOPED_STACK_TRACE( "MappedFile::open", 0000 );
+
+	// Open and map specified file.
+
+		openImp( source, targetMode );
+}
+
+void MappedFile::close()
+{
+	// Obtain locks.
+
+		SCOPED_WRITE_LOCK;
+
+	// Create scoped stack traces.
+
+		SCOPED_STACK_TRACE( "MappedFile::close", 0000 );
+
+	// Unmap and close the file.
+
+		QMX_ASSERT( ( descriptor >= 0 ), "QMXStdLib", "MappedFile::close", "0000003E", "" );
+		closeImp();
+}
+
+bool MappedFile::isOpen() const
+{
+	// Obtain locks.
+
+		SCOPED_READ_LOCK;
+
+	// Report wether or not a file is open to calling routine.
+
+		return ( descriptor >= 0 );
+}
+
+const Path& MappedFile::getPath() const
+{
+	// Obtain locks.
+
+		SCOPED_READ_LOCK;
+
+	// Return file path to calling routine.
+
+		return filePath;
+}
+
+MappedFile::Mode MappedFile::getMode() const
+{
+	// Obtain locks.
+
+		SCOPED_READ_LOCK;
+
+	// Return mapping mode to calling routine.
+
+		return mode;
+}
+
+size_t MappedFile::getSize() const
+{
+	// Obtain locks.
+
+		SCOPED_READ_LOCK;
+
+	// Return file size to calling routine.
+
+		return size;
+}
+
+void MappedFile::resize( const size_t targetSize )
+{
+	// Obtain locks.
+
+		SCOPED_WRITE_LOCK;
+
+	// Create scoped stack traces.
+
+		SCOPED_STACK_TRACE( "MappedFile::resize", 0000 );
+
+	// Create local variables.
+
+		bool isResized = false;
+
+	// Resize the file, then grow or shrink the mapping, moving it only if it cannot be resized in place.
+
+		QMX_ASSERT( ( descriptor >= 0 ), "QMXStdLib", "MappedFile::resize", "0000003E", "" );
+		QMX_ASSERT( ( mode == READ_WRITE ), "QMXStdLib", "MappedFile::resize", "00000040", filePath );
+
+#if ( QMX_PLATFORM != QMX_PLATFORM_WINDOWS )
+		if( !ftruncate( descriptor, static_cast< off_t >( targetSize ) ) )
+		{
+#	if ( QMX_PLATFORM == QMX_PLATFORM_LINUX )
+			if( base && targetSize )
+			{
+				void* target = mremap( base, size, targetSize, MREMAP_MAYMOVE );
+
+				if( target != MAP_FAILED )
+				{
+					base = static_cast< char* >( target );
+					size = targetSize;
+					isResized = true;
+				}
+			}
+#	endif // Linux Remap
+
+			if( !isResized )
+			{
+				if( base )
+					munmap( base, size );
+
+				base = nullptr;
+				size = targetSize;
+				isResized = mapImp();
+			}
+		}
+#endif // Platform Resize
+
+		QMX_ASSERT( isResized, "QMXStdLib", "MappedFile::resize", "00000041", filePath << ", " << targetSize );
+}
+
+bool MappedFile::advise( const MappedFile::Advice advice, const size_t offset, const size_t length )
+{
+	// Obtain locks.
+
+		SCOPED_READ_LOCK;
+
+	// Create scoped stack traces.
+
+		SCOPED_STACK_TRACE( "MappedFile::advise", 0000 );
+
+	// Create local variables.
+
+		bool result = false;
+
+#if ( QMX_PLATFORM != QMX_PLATFORM_WINDOWS )
+		size_t pageSize = static_cast< size_t >( sysconf( _SC_PAGESIZE ) );
+		size_t first = min( offset, size );
+		size_t start = ( first - ( first % pageSize ) );
+		size_t end = ( first + min( length, ( size - first ) ) );
+		int hint = -1;
+#endif // Platform Variables
+
+	// Translate the hint and pass it on for the range, clamped to the mapping.
+
+		QMX_ASSERT( ( descriptor >= 0 ), "QMXStdLib", "MappedFile::advise", "0000003E", "" );
+
+#if ( QMX_PLATFORM != QMX_PLATFORM_WINDOWS )
+		switch( advice )
+		{
+			case NORMAL_ACCESS:
+			{
+				hint = MADV_NORMAL;
+
+				break;
+			}
+
+			case SEQUENTIAL_ACCESS:
+			{
+				hint = MADV_SEQUENTIAL;
+
+				break;
+			}
+
+			case RANDOM_ACCESS:
+			{
+				hint = MADV_RANDOM;
+
+				break;
+			}
+
+			case WILL_NEED:
+			{
+				hint = MADV_WILLNEED;
+
+				break;
+			}
+
+			case HUGE_PAGES:
+			{
+#	ifdef MADV_HUGEPAGE
+				hint = MADV_HUGEPAGE;
+#	endif // MADV_HUGEPAGE
+
+				break;
+			}
+		}
+
+		if( base && ( hint >= 0 ) && ( start < end ) )
+			result = !madvise( ( base + start ), ( end - start ), hint );
+#endif // Platform Advise
+
+	// Return result to calling routine.
+
+		return result;
+}
+
+void MappedFile::flush( const bool isAsync )
+{
+	// Obtain locks.
+
+		SCOPED_READ_LOCK;
+
+	// Create scoped stack traces.
+
+		SCOPED_STACK_TRACE( "MappedFile::flush", 0000 );
+
+	// Write changes to the file, if the mapping is shared with it.
+
+		QMX_ASSERT( ( descriptor >= 0 ), "QMXStdLib", "MappedFile::flush", "0000003E", "" );
+
+#if ( QMX_PLATFORM != QMX_PLATFORM_WINDOWS )
+		if( ( mode == READ_WRITE ) && base )
+			QMX_ASSERT( !msync( base, size, ( isAsync ? MS_ASYNC : MS_SYNC ) ), "QMXStdLib", "MappedFile::flush", "00000041", filePath );
+#endif // Platform Flush
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private Methods for the 'MappedFile' Class
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+MappedFile::MappedFile()
+{
+	// Initialize fields.
+
+		descriptor = -1;
+		base = nullptr;
+		size = UNSET;
+		mode = READ_ONLY;
+}
+
+void MappedFile::deallocateImp()
+{
+	// Create scoped stack traces.
+
+		SCOPED_STACK_TRACE( "MappedFile::deallocateImp", 0000 );
+
+	// Perform necessary cleanup.
+
+		if( descriptor >= 0 )
+			closeImp();
+}
+
+void MappedFile::cloneImp( MappedFile::InstancePtr& target ) const
+{
+	// Create scoped stack traces.
+
+		SCOPED_STACK_TRACE( "MappedFile::cloneImp", 0000 );
+
+	// Open the file of 'this' in the same mode, or close the file of the target if 'this' has none.
+
+		if( descriptor >= 0 )
+			target->openImp( filePath, mode );
+		else if( target->descriptor >= 0 )
+			target->closeImp();
+}
+
+void MappedFile::openImp( const Path& source, const MappedFile::Mode targetMode )
+{
+	// Create scoped stack traces.
+
+		SCOPED_STACK_TRACE( "MappedFile::openImp", 0000 );
+
+	// Create local variables.
+
+		bool isMapped = false;
+
+#if ( QMX_PLATFORM != QMX_PLATFORM_WINDOWS )
+		struct stat status;
+#endif // Platform Variables
+
+	// If a file is currently open, close it.
+
+		if( descriptor >= 0 )
+			closeImp();
+
+	// Open specified file and map it at its current size.
+
+#if ( QMX_PLATFORM != QMX_PLATFORM_WINDOWS )
+		descriptor = ::open( source.string().c_str(), ( ( targetMode == READ_WRITE ) ? ( O_RDWR | O_CREAT | O_CLOEXEC ) : ( O_RDONLY | O_CLOEXEC ) ), 0644 );
+
+		if( ( descriptor >= 0 ) && !fstat( descriptor, &status ) )
+		{
+			mode = targetMode;
+			size = static_cast< size_t >( status.st_size );
+			isMapped = mapImp();
+		}
+#endif // Platform Open
+
+		if( !isMapped )
+		{
+			closeImp();
+			QMX_THROW( "QMXStdLib", "MappedFile::openImp", "0000003D", source );
+		}
+
+		filePath = source;
+}
+
+void MappedFile::closeImp()
+{
+	// Unmap and close the file.
+
+#if ( QMX_PLATFORM != QMX_PLATFORM_WINDOWS )
+		if( base )
+			munmap( base, size );
+
+		if( descriptor >= 0 )
+			::close( descriptor );
+#endif // Platform Close
+
+		descriptor = -1;
+		base = nullptr;
+		size = UNSET;
+		mode = READ_ONLY;
+		filePath.clear();
+}
+
+bool MappedFile::mapImp()
+{
+	// Create local variables.
+
+		bool result = false;
+
+#if ( QMX_PLATFORM != QMX_PLATFORM_WINDOWS )
+		void* target = nullptr;
+#endif // Platform Variables
+
+	// Map the whole file, unless it is empty.
+
+#if ( QMX_PLATFORM != QMX_PLATFORM_WINDOWS )
+		if( !size )
+			return true;
+
+		target = mmap(
+			nullptr,
+			size,
+			( ( mode == READ_ONLY ) ? PROT_READ : ( PROT_READ | PROT_WRITE ) ),
+			( ( mode == COPY_ON_WRITE ) ? MAP_PRIVATE : MAP_SHARED ),
+			descriptor,
+			0
+		);
+
+		if( target != MAP_FAILED )
+		{
+			base = static_cast< char* >( target );
+			result = true;
+		}
+#endif // Platform Map
+
+	// Return result to calling routine.
+
+		return result;
+}
+
+void* MappedFile::getAddress( const size_t offset, const size_t count, const size_t elementSize, const size_t alignment, const bool isMutable ) const
+{
+	// Obtain locks.
+
+		SCOPED_READ_LOCK;
+
+	// Create scoped stack traces.
+
+		SCOPED_STACK_TRACE( "MappedFile::getAddress", 0000 );
+
+	// Check the range against the mapping.
+
+		QMX_ASSERT( ( descriptor >= 0 ), "QMXStdLib", "MappedFile::getAddress", "0000003E", "" );
+		QMX_ASSERT(
+			( ( offset <= size ) && ( count <= ( ( size - offset ) / elementSize ) ) && !( offset % alignment ) ),
+			"QMXStdLib",
+			"MappedFile::getAddress",
+			"0000003F",
+			filePath << ", " << offset << ", " << count
+		);
+		QMX_ASSERT( ( !isMutable || ( mode != READ_ONLY ) ), "QMXStdLib", "MappedFile::getAddress", "00000040", filePath );
+
+	// Return result to calling routine.
+
+		return ( count ? static_cast< void* >( base + offset ) : nullptr );
+}
+
+} // 'QMXStdLib' Namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of the 'QMXStdLib' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of 'MappedFile.cpp'
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
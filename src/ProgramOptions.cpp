@@ -1,6 +1,6 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // ProgramOptions.cpp
-// Robert M. Baker | Created : 23OCT13 | Last Modified : 03SEP19 by Robert M. Baker
+// Robert M. Baker | Created : 23OCT13 | Last Modified : 17OCT26 by Robert M. Baker
 // Version : 2.3.0
 // This is a source file for 'QMXStdLib'; it defines the implementation for a program options class.
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -21,7 +21,7 @@
   * @file
   * @author  Robert M. Baker
   * @date    Created : 23OCT13
-  * @date    Last Modified : 03SEP19 by Robert M. Baker
+  * @date    Last Modified : 17OCT26 by Robert M. Baker
   * @version 2.3.0
   *
   * @brief This source file defines the implementation for a program options class.
@@ -138,6 +138,21 @@ void ProgramOptions::parseCommandLine( int argumentCount, char* argumentValues[]
 }
 
 void ProgramOptions::parseConfigFile( const Path& configPath )
+{
+	// Create scoped stack traces.
+
+		SCOPED_STACK_TRACE( "ProgramOptions::parseConfigFile", 0000 );
+
+	// Create local variables.
+
+		Expected< void > result = tryParseConfigFile( configPath );
+
+	// Check parse result.
+
+		QMX_ASSERT_RESULT( result, configPath );
+}
+
+Expected< void > ProgramOptions::tryParseConfigFile( const Path& configPath )
 {
 	// Obtain locks.
 
@@ -145,7 +160,7 @@ void ProgramOptions::parseConfigFile( const Path& configPath )
 
 	// Create scoped stack traces.
 
-		SCOPED_STACK_TRACE( "ProgramOptions::parseConfigFile", 0000 );
+		SCOPED_STACK_TRACE( "ProgramOptions::tryParseConfigFile", 0000 );
 
 	// Create local variables.
 
@@ -159,7 +174,7 @@ void ProgramOptions::parseConfigFile( const Path& configPath )
 
 	// Parse specified config file, if it exists.
 
-		QMX_ASSERT( configFile, "QMXStdLib", "ProgramOptions::parseConfigFile", "00000011", configPath );
+		QMX_EXPECT( configFile, "QMXStdLib", "ProgramOptions::parseConfigFile", "00000011" );
 		configFile.getline( buffer, MAX_BUFFER_SIZE );
 
 		while( configFile.good() )
@@ -183,6 +198,10 @@ void ProgramOptions::parseConfigFile( const Path& configPath )
 
 			configFile.getline( buffer, MAX_BUFFER_SIZE );
 		}
+
+	// Return result to calling routine.
+
+		return Expected< void >();
 }
 
 void ProgramOptions::saveConfigFile( const Path& configPath ) const
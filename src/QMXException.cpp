@@ -1,6 +1,6 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // QMXException.cpp
-// Robert M. Baker | Created : 28FEB12 | Last Modified : 29AUG19 by Robert M. Baker
+// Robert M. Baker | Created : 28FEB12 | Last Modified : 17OCT26 by Robert M. Baker
 // Version : 2.3.0
 // This is a source file for 'QMXStdLib'; it defines the implementation for an exception class.
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -21,7 +21,7 @@
   * @file
   * @author  Robert M. Baker
   * @date    Created : 28FEB12
-  * @date    Last Modified : 29AUG19 by Robert M. Baker
+  * @date    Last Modified : 17OCT26 by Robert M. Baker
   * @version 2.3.0
   *
   * @brief This source file defines the implementation for an exception class.
@@ -60,21 +60,156 @@ using namespace std;
 namespace QMXStdLib
 {
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private Data Types for the 'EventDataBuffer' Class
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct EventDataBuffer::Record
+{
+	// Public Data Types
+
+		/**
+		  * @brief This class exposes the start of the put area, so the formatted data can be read without copying it.
+		  */
+
+		class StreamBuffer : public std::stringbuf
+		{
+		public:
+
+			const char* getBase() const
+			{
+				return ( pbase() ? pbase() : "" );
+			}
+		};
+
+	// Public Fields
+
+		StreamBuffer buffer;
+		std::ostream stream;
+		std::ios_base::fmtflags defaultFlags;
+		bool isInUse;
+
+	// Public Constructors
+
+		Record() :
+			stream( &buffer ),
+			defaultFlags( stream.flags() ),
+			isInUse( false )
+		{
+			// Do nothing.
+		}
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private Static Fields for the 'EventDataBuffer' Class
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+thread_local EventDataBuffer::Record EventDataBuffer::localRecord;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Public Methods for the 'EventDataBuffer' Class
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+EventDataBuffer::EventDataBuffer()
+{
+	// Claim the calling thread's record, or a private record if it is already in use.
+
+		if( localRecord.isInUse )
+		{
+			privateRecord.reset( new Record() );
+			record = privateRecord.get();
+		}
+		else
+			record = &localRecord;
+
+		record->isInUse = true;
+}
+
+EventDataBuffer::~EventDataBuffer()
+{
+	// Restore record to its initial state, retaining the buffer's capacity.
+
+		record->buffer.str( "" );
+		record->stream.clear();
+		record->stream.flags( record->defaultFlags );
+		record->stream.precision( 6 );
+		record->stream.width( 0 );
+		record->stream.fill( ' ' );
+		record->isInUse = false;
+}
+
+ostream& EventDataBuffer::getStream()
+{
+	// Return stream to calling routine.
+
+		return record->stream;
+}
+
+const char* EventDataBuffer::getData()
+{
+	// Terminate formatted data, and return it to calling routine.
+
+		record->stream.put( '\0' );
+
+		return record->buffer.getBase();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private Data Types for the 'QMXException' Class
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct QMXException::Payload
+{
+	// Public Fields
+
+		/**
+		  * @brief This holds every string of the exception back to back, each with its own null terminator, so the payload needs one buffer.
+		  */
+
+		string storage;
+
+		/**
+		  * @brief These point into 'storage' and are fixed once the payload is built.
+		  */
+
+		const char* rootID = "";
+		const char* moduleID = "";
+		const char* eventIndex = "";
+		const char* eventData = "";
+		const char* stackTrace = "";
+
+		/**
+		  * @brief This is the flag which ensures 'message' and 'description' are formatted exactly once.
+		  */
+
+		mutable once_flag formatFlag;
+
+		/**
+		  * @brief This is the unlocalized message for the exception.
+		  */
+
+		mutable string message;
+
+		/**
+		  * @brief This is the string representing the nature of the exception.
+		  */
+
+		mutable string description;
+};
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Public Methods for the 'QMXException' Class
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 QMXException::QMXException()
 {
+	// Create local variables.
+
+		static const shared_ptr< const Payload >* defaultPayload = new shared_ptr< const Payload >( make_shared< const Payload >() );
+
 	// Initialize fields.
 
-		ZERO_ARRAY( rootID );
-		ZERO_ARRAY( moduleID );
-		ZERO_ARRAY( eventIndex );
-		ZERO_ARRAY( eventData );
-		ZERO_ARRAY( stackTrace );
-		ZERO_ARRAY( message );
-		sprintf( buffer, "QMXStdLib::QMXException" );
+		payload = *defaultPayload;
 }
 
 QMXException::QMXException(
@@ -85,27 +220,38 @@ QMXException::QMXException(
 	const char* sourceStackTrace
 )
 {
-	// Initialize fields.
+	// Create local variables.
+
+		const char* sources[] = { sourceRootID, sourceModuleID, sourceEventIndex, sourceEventData, sourceStackTrace };
+		size_t lengths[ ARRAY_SIZE( sources ) ];
+		size_t offsets[ ARRAY_SIZE( sources ) ];
+		size_t totalLength = 0;
+		shared_ptr< Payload > newPayload = make_shared< Payload >();
+
+	// Copy all strings into the payload's storage.
 
-		strcpy( rootID, sourceRootID );
-		strcpy( moduleID, sourceModuleID );
-		strcpy( eventIndex, sourceEventIndex );
-		strcpy( eventData, sourceEventData );
-		strcpy( stackTrace, sourceStackTrace );
-		sprintf( message, "%s.EventMessages.<LL>_<CC>.%s", rootID, eventIndex );
-		sprintf( buffer, "Exception occurred in '%s::%s' -> %s", rootID, moduleID, message );
-
-		if( strlen( eventData ) )
-		{		
-			strcat( buffer, " : " );
-			strcpy( buffer, strcat( buffer, eventData ) );
+		for( size_t index = 0; index < ARRAY_SIZE( sources ); index++ )
+		{
+			lengths[ index ] = strlen( sources[ index ] );
+			totalLength += ( lengths[ index ] + 1 );
 		}
 
-		if( strlen( stackTrace ) )
+		newPayload->storage.reserve( totalLength );
+
+		for( size_t index = 0; index < ARRAY_SIZE( sources ); index++ )
 		{
-			strcat( buffer, "\n\nStack Trace: " );
-			strcpy( buffer, strcat( buffer, stackTrace ) );
+			offsets[ index ] = newPayload->storage.size();
+			newPayload->storage.append( sources[ index ], ( lengths[ index ] + 1 ) );
 		}
+
+	// Initialize fields.
+
+		newPayload->rootID = ( newPayload->storage.data() + offsets[ 0 ] );
+		newPayload->moduleID = ( newPayload->storage.data() + offsets[ 1 ] );
+		newPayload->eventIndex = ( newPayload->storage.data() + offsets[ 2 ] );
+		newPayload->eventData = ( newPayload->storage.data() + offsets[ 3 ] );
+		newPayload->stackTrace = ( newPayload->storage.data() + offsets[ 4 ] );
+		payload = move( newPayload );
 }
 
 QMXException::~QMXException()
@@ -117,49 +263,92 @@ const char* QMXException::getRootID() const
 {
 	// Return event root ID to calling routine.
 
-		return rootID;
+		return payload->rootID;
 }
 
 const char* QMXException::getModuleID() const
 {
 	// Return event module ID to calling routine.
 
-		return moduleID;
+		return payload->moduleID;
 }
 
 const char* QMXException::getEventIndex() const
 {
 	// Return event index to calling routine.
 
-		return eventIndex;
+		return payload->eventIndex;
 }
 
 const char* QMXException::getEventData() const
 {
 	// Return event data to calling routine.
 
-		return eventData;
+		return payload->eventData;
 }
 
 const char* QMXException::getStackTrace() const
 {
 	// Return event stack trace to calling routine.
 
-		return stackTrace;
+		return payload->stackTrace;
 }
 
 const char* QMXException::getMessage() const
 {
+	// Format message, if necessary.
+
+		format();
+
 	// Return event message to calling routine.
 
-		return message;
+		return payload->message.c_str();
 }
 
 const char* QMXException::what() const throw()
 {
+	// Format string representing the nature of the exception, if necessary.
+
+		format();
+
 	// Return nature of the exception to calling routine.
 
-		return buffer;
+		return payload->description.c_str();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private Methods for the 'QMXException' Class
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void QMXException::format() const
+{
+	// Format message and string representing the nature of the exception, exactly once for all copies of this exception.
+
+		call_once( payload->formatFlag, [ this ]() {
+			try
+			{
+				if( payload->storage.empty() )
+				{
+					payload->description = "QMXStdLib::QMXException";
+
+					return;
+				}
+
+				payload->message.append( payload->rootID ).append( ".EventMessages.<LL>_<CC>." ).append( payload->eventIndex );
+				payload->description.append( "Exception occurred in '" ).append( payload->rootID ).append( "::" ).append( payload->moduleID );
+				payload->description.append( "' -> " ).append( payload->message );
+
+				if( *payload->eventData )
+					payload->description.append( " : " ).append( payload->eventData );
+
+				if( *payload->stackTrace )
+					payload->description.append( "\n\nStack Trace: " ).append( payload->stackTrace );
+			}
+			catch( const std::exception& except )
+			{
+				// Do nothing.
+			}
+		} );
 }
 
 } // 'QMXStdLib' Namespace
@@ -1,6 +1,6 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // String.cpp
-// Robert M. Baker | Created : 08JAN15 | Last Modified : 10SEP19 by Robert M. Baker
+// Robert M. Baker | Created : 08JAN15 | Last Modified : 17OCT26 by Robert M. Baker
 // Version : 2.3.0
 // This is a source file for 'QMXStdLib'; it defines the implementation for a set of string utility functions.
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -21,7 +21,7 @@
   * @file
   * @author  Robert M. Baker
   * @date    Created : 08JAN15
-  * @date    Last Modified : 10SEP19 by Robert M. Baker
+  * @date    Last Modified : 17OCT26 by Robert M. Baker
   * @version 2.3.0
   *
   * @brief This source file defines the implementation for a set of string utility functions.
@@ -49,8 +49,17 @@
 // Header Files
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include <array>
+#include <atomic>
+
 #include "../include/String.hpp"
 
+#if( ( defined( __x86_64__ ) || defined( __i386__ ) ) && defined( __SSE2__ ) )
+#	include <immintrin.h>
+#	define QMX_STRING_X86
+#	define AVX2_TARGET __attribute__(( target( "avx2" ) ))
+#endif // x86 Headers
+
 using namespace std;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -67,52 +76,1046 @@ namespace QMXStdLib
 namespace String
 {
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Start of the 'Transcoder' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+  * @brief This is the namespace for the UTF transcoder's internal state and kernels.
+  *
+  * Each conversion runs a scalar, fully validating decoder one code point at a time, and hands off to a vector kernel whenever the next code point is one
+  * the kernel can handle in bulk.  The SSE2 kernels copy runs of ASCII; the AVX2 kernels also convert runs of three-byte UTF-8 (i.e. the rest of the Basic
+  * Multilingual Plane, which covers CJK text).  A kernel validates a whole block before committing it, and stops at the first block it cannot handle, so
+  * every code point it skips is still checked by the scalar decoder.
+  */
+
+namespace Transcoder
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Type Definitions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+enum Status
+{
+	SUCCESS,
+	MALFORMED,
+	OVERFLOWED
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Global Variables
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const char32_t INVALID_CODE_POINT = 0xFFFFFFFF;
+
+atomic< int > currentISA( -1 );
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Function Definitions
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+TranscoderISA getSupportedISA()
+{
+	// Return best instruction set supported by the CPU to calling routine.
+
+#if defined( QMX_STRING_X86 )
+		__builtin_cpu_init();
+
+		return ( __builtin_cpu_supports( "avx2" ) ? AVX2 : SSE2 );
+#else
+		return SCALAR;
+#endif // QMX_STRING_X86
+}
+
+inline TranscoderISA getISA()
+{
+	// Create local variables.
+
+		int result = currentISA.load( memory_order_relaxed );
+
+	// Select best supported instruction set, if one has not been selected yet.
+
+		if( result < 0 )
+		{
+			result = getSupportedISA();
+			currentISA.store( result, memory_order_relaxed );
+		}
+
+	// Return result to calling routine.
+
+		return static_cast< TranscoderISA >( result );
+}
+
+inline char32_t decodeUTF8( const uint8_t* source, size_t sourceSize, size_t& index )
+{
+	// Create local variables.
+
+		uint8_t lead = source[ index ];
+		size_t remaining = ( sourceSize - index );
+		uint8_t lowerBound = 0x80;
+		uint8_t upperBound = 0xBF;
+		char32_t result = INVALID_CODE_POINT;
+
+	// Decode one code point, rejecting overlong forms, surrogates, values above U+10FFFF, and truncated sequences.
+
+		if( lead < 0x80 )
+		{
+			index++;
+			result = lead;
+		}
+		else if( lead < 0xC2 )
+			result = INVALID_CODE_POINT;
+		else if( lead < 0xE0 )
+		{
+			if( ( remaining >= 2 ) && ( ( source[ index + 1 ] & 0xC0 ) == 0x80 ) )
+			{
+				result = ( ( ( lead & 0x1F ) << 6 ) | ( source[ index + 1 ] & 0x3F ) );
+				index += 2;
+			}
+		}
+		else if( lead < 0xF0 )
+		{
+			lowerBound = ( ( lead == 0xE0 ) ? 0xA0 : 0x80 );
+			upperBound = ( ( lead == 0xED ) ? 0x9F : 0xBF );
+
+			if(
+				( remaining >= 3 ) && ( source[ index + 1 ] >= lowerBound ) && ( source[ index + 1 ] <= upperBound ) &&
+				( ( source[ index + 2 ] & 0xC0 ) == 0x80 )
+			)
+			{
+				result = ( ( ( lead & 0x0F ) << 12 ) | ( ( source[ index + 1 ] & 0x3F ) << 6 ) | ( source[ index + 2 ] & 0x3F ) );
+				index += 3;
+			}
+		}
+		else if( lead < 0xF5 )
+		{
+			lowerBound = ( ( lead == 0xF0 ) ? 0x90 : 0x80 );
+			upperBound = ( ( lead == 0xF4 ) ? 0x8F : 0xBF );
+
+			if(
+				( remaining >= 4 ) && ( source[ index + 1 ] >= lowerBound ) && ( source[ index + 1 ] <= upperBound ) &&
+				( ( source[ index + 2 ] & 0xC0 ) == 0x80 ) && ( ( source[ index + 3 ] & 0xC0 ) == 0x80 )
+			)
+			{
+				result = (
+					( ( lead & 0x07 ) << 18 ) | ( ( source[ index + 1 ] & 0x3F ) << 12 ) | ( ( source[ index + 2 ] & 0x3F ) << 6 ) |
+					( source[ index + 3 ] & 0x3F )
+				);
+
+				index += 4;
+			}
+		}
+
+	// Return result to calling routine.
+
+		return result;
+}
+
+inline char32_t decodeUTF16( const char16_t* source, size_t sourceSize, size_t& index )
+{
+	// Create local variables.
+
+		char32_t lead = source[ index ];
+		char32_t result = INVALID_CODE_POINT;
+
+	// Decode one code point, rejecting unpaired surrogates.
+
+		if( ( lead & 0xF800 ) != 0xD800 )
+		{
+			index++;
+			result = lead;
+		}
+		else if( ( lead < 0xDC00 ) && ( ( sourceSize - index ) >= 2 ) && ( ( source[ index + 1 ] & 0xFC00 ) == 0xDC00 ) )
+		{
+			result = ( 0x10000 + ( ( lead - 0xD800 ) << 10 ) + ( source[ index + 1 ] - 0xDC00 ) );
+			index += 2;
+		}
+
+	// Return result to calling routine.
+
+		return result;
+}
+
+inline char32_t decodeUTF32( const char32_t* source, size_t, size_t& index )
+{
+	// Create local variables.
+
+		char32_t result = source[ index++ ];
+
+	// Reject surrogates and values above U+10FFFF.
+
+		if( ( result > 0x10FFFF ) || ( ( result & 0xFFFFF800 ) == 0xD800 ) )
+			result = INVALID_CODE_POINT;
+
+	// Return result to calling routine.
+
+		return result;
+}
+
+inline size_t encodeUTF8( char32_t source, char* target, size_t targetSize )
+{
+	// Create local variables.
+
+		size_t result = ( ( source < 0x80 ) ? 1 : ( ( source < 0x800 ) ? 2 : ( ( source < 0x10000 ) ? 3 : 4 ) ) );
+
+	// Encode one code point, if it fits.
+
+		if( result > targetSize )
+			result = 0;
+		else if( result == 1 )
+			target[ 0 ] = static_cast< char >( source );
+		else if( result == 2 )
+		{
+			target[ 0 ] = static_cast< char >( 0xC0 | ( source >> 6 ) );
+			target[ 1 ] = static_cast< char >( 0x80 | ( source & 0x3F ) );
+		}
+		else if( result == 3 )
+		{
+			target[ 0 ] = static_cast< char >( 0xE0 | ( source >> 12 ) );
+			target[ 1 ] = static_cast< char >( 0x80 | ( ( source >> 6 ) & 0x3F ) );
+			target[ 2 ] = static_cast< char >( 0x80 | ( source & 0x3F ) );
+		}
+		else
+		{
+			target[ 0 ] = static_cast< char >( 0xF0 | ( source >> 18 ) );
+			target[ 1 ] = static_cast< char >( 0x80 | ( ( source >> 12 ) & 0x3F ) );
+			target[ 2 ] = static_cast< char >( 0x80 | ( ( source >> 6 ) & 0x3F ) );
+			target[ 3 ] = static_cast< char >( 0x80 | ( source & 0x3F ) );
+		}
+
+	// Return result to calling routine.
+
+		return result;
+}
+
+#if defined( QMX_STRING_X86 )
+
+template< typename CType > size_t fromUTF8SSE2( const uint8_t* source, size_t sourceSize, CType* target, size_t targetSize, size_t& produced )
+{
+	// Create local variables.
+
+		const __m128i zero = _mm_setzero_si128();
+		size_t result = 0;
+		__m128i block;
+		__m128i wide;
+		int mask = 0;
+
+	// Widen runs of ASCII, 16 bytes at a time; the block containing the first non-ASCII byte is widened too, but only its ASCII prefix is kept.
+
+		while( ( ( result + 16 ) <= sourceSize ) && ( ( result + 16 ) <= targetSize ) )
+		{
+			block = _mm_loadu_si128( reinterpret_cast< const __m128i* >( source + result ) );
+			mask = _mm_movemask_epi8( block );
+
+			for( size_t index = 0; index < 2; index++ )
+			{
+				wide = ( index ? _mm_unpackhi_epi8( block, zero ) : _mm_unpacklo_epi8( block, zero ) );
+
+				if( sizeof( CType ) == 2 )
+					_mm_storeu_si128( reinterpret_cast< __m128i* >( target + result + ( index * 8 ) ), wide );
+				else
+				{
+					_mm_storeu_si128( reinterpret_cast< __m128i* >( target + result + ( index * 8 ) ), _mm_unpacklo_epi16( wide, zero ) );
+					_mm_storeu_si128( reinterpret_cast< __m128i* >( target + result + ( index * 8 ) + 4 ), _mm_unpackhi_epi16( wide, zero ) );
+				}
+			}
+
+			if( mask )
+			{
+				result += __builtin_ctz( mask );
+
+				break;
+			}
+
+			result += 16;
+		}
+
+	// Return result to calling routine.
+
+		produced = result;
+
+		return result;
+}
+
+template< typename CType > size_t toUTF8SSE2( const CType* source, size_t sourceSize, char* target, size_t targetSize, size_t& produced )
+{
+	// Create local variables.
+
+		const __m128i highBits = _mm_set1_epi32( ( sizeof( CType ) == 2 ) ? 0xFF80FF80 : 0xFFFFFF80 );
+		const __m128i zero = _mm_setzero_si128();
+		const size_t blockSize = ( 16 / sizeof( CType ) );
+		size_t result = 0;
+		__m128i blocks[ 4 ];
+		__m128i isASCII;
+		__m128i narrow[ 2 ];
+		uint64_t mask = 0;
+
+	// Narrow runs of ASCII, 16 code units at a time; the block containing the first non-ASCII code unit is narrowed too, but only its ASCII prefix is kept.
+
+		while( ( ( result + 16 ) <= sourceSize ) && ( ( result + 16 ) <= targetSize ) )
+		{
+			mask = 0;
+
+			for( size_t index = 0; index < ( 16 / blockSize ); index++ )
+			{
+				blocks[ index ] = _mm_loadu_si128( reinterpret_cast< const __m128i* >( source + result + ( index * blockSize ) ) );
+				isASCII = _mm_and_si128( blocks[ index ], highBits );
+				isASCII = ( ( sizeof( CType ) == 2 ) ? _mm_cmpeq_epi16( isASCII, zero ) : _mm_cmpeq_epi32( isASCII, zero ) );
+				mask |= ( static_cast< uint64_t >( _mm_movemask_epi8( isASCII ) ) << ( index * 16 ) );
+			}
+
+			if( sizeof( CType ) == 2 )
+				_mm_storeu_si128( reinterpret_cast< __m128i* >( target + result ), _mm_packus_epi16( blocks[ 0 ], blocks[ 1 ] ) );
+			else
+			{
+				narrow[ 0 ] = _mm_packs_epi32( blocks[ 0 ], blocks[ 1 ] );
+				narrow[ 1 ] = _mm_packs_epi32( blocks[ 2 ], blocks[ 3 ] );
+				_mm_storeu_si128( reinterpret_cast< __m128i* >( target + result ), _mm_packus_epi16( narrow[ 0 ], narrow[ 1 ] ) );
+			}
+
+			if( ( sizeof( CType ) == 2 ) ? ( mask != 0xFFFFFFFF ) : ( mask != UINT64_MAX ) )
+			{
+				result += ( __builtin_ctzll( ~mask ) / sizeof( CType ) );
+
+				break;
+			}
+
+			result += 16;
+		}
+
+	// Return result to calling routine.
+
+		produced = result;
+
+		return result;
+}
+
+AVX2_TARGET inline size_t decodeThreeByteAVX2( const uint8_t* source, __m256i& result )
+{
+	// Create local variables.
+
+		const __m256i leadShuffle = _mm256_broadcastsi128_si256( _mm_setr_epi8( 0, -1, 3, -1, 6, -1, 9, -1, 12, -1, -1, -1, -1, -1, -1, -1 ) );
+		const __m256i firstShuffle = _mm256_broadcastsi128_si256( _mm_setr_epi8( 1, -1, 4, -1, 7, -1, 10, -1, 13, -1, -1, -1, -1, -1, -1, -1 ) );
+		const __m256i secondShuffle = _mm256_broadcastsi128_si256( _mm_setr_epi8( 2, -1, 5, -1, 8, -1, 11, -1, 14, -1, -1, -1, -1, -1, -1, -1 ) );
+		const __m256i continuationMask = _mm256_set1_epi16( 0xC0 );
+		const __m256i continuationBits = _mm256_set1_epi16( 0x80 );
+		const __m256i payloadMask = _mm256_set1_epi16( 0x3F );
+
+		__m256i block = _mm256_inserti128_si256(
+			_mm256_castsi128_si256( _mm_loadu_si128( reinterpret_cast< const __m128i* >( source ) ) ),
+			_mm_loadu_si128( reinterpret_cast< const __m128i* >( source + 15 ) ),
+			1
+		);
+
+		__m256i lead = _mm256_shuffle_epi8( block, leadShuffle );
+		__m256i first = _mm256_shuffle_epi8( block, firstShuffle );
+		__m256i second = _mm256_shuffle_epi8( block, secondShuffle );
+		__m256i isValid;
+		uint32_t mask = 0;
+
+	// Decode five three-byte sequences from each half of the block into the low five 16-bit lanes of that half, and validate them.
+
+		isValid = _mm256_and_si256(
+			_mm256_cmpeq_epi16( _mm256_and_si256( lead, _mm256_set1_epi16( 0xF0 ) ), _mm256_set1_epi16( 0xE0 ) ),
+			_mm256_and_si256(
+				_mm256_cmpeq_epi16( _mm256_and_si256( first, continuationMask ), continuationBits ),
+				_mm256_cmpeq_epi16( _mm256_and_si256( second, continuationMask ), continuationBits )
+			)
+		);
+
+		result = _mm256_or_si256(
+			_mm256_slli_epi16( _mm256_and_si256( lead, _mm256_set1_epi16( 0x0F ) ), 12 ),
+			_mm256_or_si256( _mm256_slli_epi16( _mm256_and_si256( first, payloadMask ), 6 ), _mm256_and_si256( second, payloadMask ) )
+		);
+
+		isValid = _mm256_and_si256( isValid, _mm256_cmpeq_epi16( _mm256_max_epu16( result, _mm256_set1_epi16( 0x800 ) ), result ) );
+
+		isValid = _mm256_andnot_si256(
+			_mm256_cmpeq_epi16(
+				_mm256_and_si256( result, _mm256_set1_epi16( static_cast< short >( 0xF800 ) ) ),
+				_mm256_set1_epi16( static_cast< short >( 0xD800 ) )
+			),
+			isValid
+		);
+
+		mask = ( static_cast< uint32_t >( _mm256_movemask_epi8( isValid ) ) & 0x03FF03FF );
+
+	// Return number of code points decoded (i.e. ten, or five if only the first half is valid) to calling routine.
+
+		return ( ( mask == 0x03FF03FF ) ? 10 : ( ( ( mask & 0x03FF ) == 0x03FF ) ? 5 : 0 ) );
+}
+
+AVX2_TARGET inline size_t countThreeByteAVX2( __m256i source )
+{
+	// Create local variables.
+
+		__m256i isValid = _mm256_cmpeq_epi16( _mm256_max_epu16( source, _mm256_set1_epi16( 0x800 ) ), source );
+		uint32_t mask = 0;
+
+	// Check which 16-bit lanes encode to exactly three bytes (i.e. they are at least U+0800, and are not surrogates).
+
+		isValid = _mm256_andnot_si256(
+			_mm256_cmpeq_epi16(
+				_mm256_and_si256( source, _mm256_set1_epi16( static_cast< short >( 0xF800 ) ) ),
+				_mm256_set1_epi16( static_cast< short >( 0xD800 ) )
+			),
+			isValid
+		);
+
+		mask = static_cast< uint32_t >( _mm256_movemask_epi8( isValid ) );
+
+	// Return number of leading code points which qualify (i.e. sixteen, eight, or none) to calling routine.
+
+		return ( ( mask == 0xFFFFFFFF ) ? 16 : ( ( ( mask & 0xFFFF ) == 0xFFFF ) ? 8 : 0 ) );
+}
+
+AVX2_TARGET inline void encodeThreeByteAVX2( __m256i source, char* target )
+{
+	// Create local variables.
+
+		const __m256i firstShuffleA = _mm256_broadcastsi128_si256( _mm_setr_epi8( 0, 8, -1, 1, 9, -1, 2, 10, -1, 3, 11, -1, 4, 12, -1, 5 ) );
+		const __m256i firstShuffleB = _mm256_broadcastsi128_si256( _mm_setr_epi8( -1, -1, 0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1 ) );
+		const __m256i secondShuffleA = _mm256_broadcastsi128_si256( _mm_setr_epi8( 13, -1, 6, 14, -1, 7, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1 ) );
+		const __m256i secondShuffleB = _mm256_broadcastsi128_si256( _mm_setr_epi8( -1, 5, -1, -1, 6, -1, -1, 7, -1, -1, -1, -1, -1, -1, -1, -1 ) );
+		const __m256i payloadMask = _mm256_set1_epi16( 0x3F );
+		const __m256i continuationBits = _mm256_set1_epi16( 0x80 );
+
+		__m256i lead = _mm256_or_si256( _mm256_srli_epi16( source, 12 ), _mm256_set1_epi16( 0xE0 ) );
+		__m256i first = _mm256_or_si256( _mm256_and_si256( _mm256_srli_epi16( source, 6 ), payloadMask ), continuationBits );
+		__m256i second = _mm256_or_si256( _mm256_and_si256( source, payloadMask ), continuationBits );
+		__m256i packedA = _mm256_packus_epi16( lead, first );
+		__m256i packedB = _mm256_packus_epi16( second, second );
+		__m256i output[ 2 ];
+
+	// Interleave the lead and continuation bytes of each half into 24 bytes of output.
+
+		output[ 0 ] = _mm256_or_si256( _mm256_shuffle_epi8( packedA, firstShuffleA ), _mm256_shuffle_epi8( packedB, firstShuffleB ) );
+		output[ 1 ] = _mm256_or_si256( _mm256_shuffle_epi8( packedA, secondShuffleA ), _mm256_shuffle_epi8( packedB, secondShuffleB ) );
+		_mm_storeu_si128( reinterpret_cast< __m128i* >( target ), _mm256_castsi256_si128( output[ 0 ] ) );
+		_mm_storel_epi64( reinterpret_cast< __m128i* >( target + 16 ), _mm256_castsi256_si128( output[ 1 ] ) );
+		_mm_storeu_si128( reinterpret_cast< __m128i* >( target + 24 ), _mm256_extracti128_si256( output[ 0 ], 1 ) );
+		_mm_storel_epi64( reinterpret_cast< __m128i* >( target + 40 ), _mm256_extracti128_si256( output[ 1 ], 1 ) );
+}
+
+template< typename CType > AVX2_TARGET size_t fromUTF8AVX2( const uint8_t* source, size_t sourceSize, CType* target, size_t targetSize, size_t& produced )
+{
+	// Create local variables.
+
+		size_t result = 0;
+		size_t count = 0;
+		__m256i block;
+
+	// Widen runs of ASCII with the SSE2 kernel (the 128-bit stores never split a cache line, so they are as fast as 256-bit ones here), and decode runs of
+	// three-byte sequences ten at a time.
+
+		produced = 0;
+
+		while( result < sourceSize )
+		{
+			if( source[ result ] < 0x80 )
+			{
+				result += fromUTF8SSE2( ( source + result ), ( sourceSize - result ), ( target + produced ), ( targetSize - produced ), count );
+				produced += count;
+			}
+
+			if( ( ( result + 31 ) > sourceSize ) || ( ( produced + 16 ) > targetSize ) || ( ( source[ result ] & 0xF0 ) != 0xE0 ) )
+				break;
+
+			if( !( count = decodeThreeByteAVX2( ( source + result ), block ) ) )
+				break;
+
+			if( sizeof( CType ) == 2 )
+			{
+				_mm_storeu_si128( reinterpret_cast< __m128i* >( target + produced ), _mm256_castsi256_si128( block ) );
+				_mm_storeu_si128( reinterpret_cast< __m128i* >( target + produced + 5 ), _mm256_extracti128_si256( block, 1 ) );
+			}
+			else
+			{
+				_mm256_storeu_si256( reinterpret_cast< __m256i* >( target + produced ), _mm256_cvtepu16_epi32( _mm256_castsi256_si128( block ) ) );
+				_mm256_storeu_si256( reinterpret_cast< __m256i* >( target + produced + 5 ), _mm256_cvtepu16_epi32( _mm256_extracti128_si256( block, 1 ) ) );
+			}
+
+			result += ( count * 3 );
+			produced += count;
+		}
+
+	// Return result to calling routine.
+
+		return result;
+}
+
+template< typename CType > AVX2_TARGET size_t toUTF8AVX2( const CType* source, size_t sourceSize, char* target, size_t targetSize, size_t& produced )
+{
+	// Create local variables.
+
+		const __m256i highBits = _mm256_set1_epi32( static_cast< int >( 0xFFFF0000 ) );
+		size_t result = 0;
+		size_t count = 0;
+		__m256i blocks[ 2 ];
+		__m256i wide;
+
+	// Narrow runs of ASCII with the SSE2 kernel, and encode runs of three-byte code points 16 (or at least 8) at a time.
+
+		produced = 0;
+
+		while( result < sourceSize )
+		{
+			if( source[ result ] < 0x80 )
+			{
+				result += toUTF8SSE2( ( source + result ), ( sourceSize - result ), ( target + produced ), ( targetSize - produced ), count );
+				produced += count;
+			}
+
+			if( ( ( result + 16 ) > sourceSize ) || ( ( produced + 48 ) > targetSize ) || ( source[ result ] < 0x800 ) )
+				break;
+
+			if( sizeof( CType ) == 2 )
+				wide = _mm256_loadu_si256( reinterpret_cast< const __m256i* >( source + result ) );
+			else
+			{
+				blocks[ 0 ] = _mm256_loadu_si256( reinterpret_cast< const __m256i* >( source + result ) );
+				blocks[ 1 ] = _mm256_loadu_si256( reinterpret_cast< const __m256i* >( source + result + 8 ) );
+				wide = _mm256_permute4x64_epi64( _mm256_packus_epi32( blocks[ 0 ], blocks[ 1 ] ), 0xD8 );
+			}
+
+			count = countThreeByteAVX2( wide );
+
+			if( ( sizeof( CType ) == 4 ) && count )
+			{
+				if( !_mm256_testz_si256( blocks[ 0 ], highBits ) )
+					count = 0;
+				else if( !_mm256_testz_si256( blocks[ 1 ], highBits ) )
+					count = 8;
+			}
+
+			if( !count )
+				break;
+
+			encodeThreeByteAVX2( wide, ( target + produced ) );
+			result += count;
+			produced += ( count * 3 );
+		}
+
+	// Return result to calling routine.
+
+		return result;
+}
+
+#endif // QMX_STRING_X86
+
+template< typename CType > Status fromUTF8( const uint8_t* source, size_t sourceSize, CType* target, size_t targetSize, size_t& written )
+{
+	// Create local variables.
+
+		TranscoderISA isa = getISA();
+		size_t sourceIndex = 0;
+		size_t targetIndex = 0;
+		size_t consumed = 0;
+		size_t produced = 0;
+		char32_t codePoint = 0;
+
+	// Decode the specified UTF-8 string, handing off to the vector kernel whenever the next byte starts a run it can convert.
+
+		while( sourceIndex < sourceSize )
+		{
+#if defined( QMX_STRING_X86 )
+			if( ( isa != SCALAR ) && ( ( source[ sourceIndex ] < 0x80 ) || ( ( isa == AVX2 ) && ( ( source[ sourceIndex ] & 0xF0 ) == 0xE0 ) ) ) )
+			{
+				if( isa == AVX2 )
+				{
+					consumed = fromUTF8AVX2(
+						( source + sourceIndex ),
+						( sourceSize - sourceIndex ),
+						( target + targetIndex ),
+						( targetSize - targetIndex ),
+						produced
+					);
+				}
+				else
+				{
+					consumed = fromUTF8SSE2(
+						( source + sourceIndex ),
+						( sourceSize - sourceIndex ),
+						( target + targetIndex ),
+						( targetSize - targetIndex ),
+						produced
+					);
+				}
+
+				sourceIndex += consumed;
+				targetIndex += produced;
+
+				if( sourceIndex == sourceSize )
+					break;
+			}
+#endif // QMX_STRING_X86
+
+			if( ( codePoint = decodeUTF8( source, sourceSize, sourceIndex ) ) == INVALID_CODE_POINT )
+				return MALFORMED;
+
+			if( ( sizeof( CType ) == 2 ) && ( codePoint > 0xFFFF ) )
+			{
+				if( ( targetIndex + 2 ) > targetSize )
+					return OVERFLOWED;
+
+				target[ targetIndex++ ] = static_cast< CType >( 0xD800 + ( ( codePoint - 0x10000 ) >> 10 ) );
+				target[ targetIndex++ ] = static_cast< CType >( 0xDC00 + ( ( codePoint - 0x10000 ) & 0x3FF ) );
+			}
+			else
+			{
+				if( targetIndex >= targetSize )
+					return OVERFLOWED;
+
+				target[ targetIndex++ ] = static_cast< CType >( codePoint );
+			}
+		}
+
+	// Return result to calling routine.
+
+		written = targetIndex;
+
+		return SUCCESS;
+}
+
+template< typename CType > Status toUTF8( const CType* source, size_t sourceSize, char* target, size_t targetSize, size_t& written )
+{
+	// Create local variables.
+
+		TranscoderISA isa = getISA();
+		size_t sourceIndex = 0;
+		size_t targetIndex = 0;
+		size_t consumed = 0;
+		size_t produced = 0;
+		size_t length = 0;
+		char32_t codePoint = 0;
+
+	// Encode the specified UTF-16/UTF-32 string, handing off to the vector kernel whenever the next code unit starts a run it can convert.
+
+		while( sourceIndex < sourceSize )
+		{
+#if defined( QMX_STRING_X86 )
+			if( ( isa != SCALAR ) && ( ( source[ sourceIndex ] < 0x80 ) || ( ( isa == AVX2 ) && ( source[ sourceIndex ] >= 0x800 ) ) ) )
+			{
+				if( isa == AVX2 )
+				{
+					consumed = toUTF8AVX2(
+						( source + sourceIndex ),
+						( sourceSize - sourceIndex ),
+						( target + targetIndex ),
+						( targetSize - targetIndex ),
+						produced
+					);
+				}
+				else
+				{
+					consumed = toUTF8SSE2(
+						( source + sourceIndex ),
+						( sourceSize - sourceIndex ),
+						( target + targetIndex ),
+						( targetSize - targetIndex ),
+						produced
+					);
+				}
+
+				sourceIndex += consumed;
+				targetIndex += produced;
+
+				if( sourceIndex == sourceSize )
+					break;
+			}
+#endif // QMX_STRING_X86
+
+			if( sizeof( CType ) == 2 )
+				codePoint = decodeUTF16( reinterpret_cast< const char16_t* >( source ), sourceSize, sourceIndex );
+			else
+				codePoint = decodeUTF32( reinterpret_cast< const char32_t* >( source ), sourceSize, sourceIndex );
+
+			if( codePoint == INVALID_CODE_POINT )
+				return MALFORMED;
+
+			if( !( length = encodeUTF8( codePoint, ( target + targetIndex ), ( targetSize - targetIndex ) ) ) )
+				return OVERFLOWED;
+
+			targetIndex += length;
+		}
+
+	// Return result to calling routine.
+
+		written = targetIndex;
+
+		return SUCCESS;
+}
+
+} // 'Transcoder' Namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of the 'Transcoder' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Start of the 'CaseFolder' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+  * @brief This is the namespace for the ASCII case folding kernels used by the in-place case conversion functions.
+  *
+  * Each kernel folds the string 16 bytes at a time and stops at the first block holding a non-ASCII byte, leaving the rest to 'boost::locale'.
+  */
+
+namespace CaseFolder
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Function Definitions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template< bool IsUpper > size_t fold( char* target, size_t size )
+{
+	// Create local variables.
+
+		const char first = ( IsUpper ? 'a' : 'A' );
+		size_t result = 0;
+
+#if defined( QMX_STRING_X86 )
+		const __m128i offset = _mm_set1_epi8( static_cast< char >( 0x80 - first ) );
+		const __m128i limit = _mm_set1_epi8( static_cast< char >( -128 + 26 ) );
+		const __m128i flip = _mm_set1_epi8( 0x20 );
+		__m128i block;
+
+	// Fold whole blocks of ASCII; shifting the letters to the bottom of the signed range lets one comparison select them.
+
+		for( ; ( result + 16 ) <= size; result += 16 )
+		{
+			block = _mm_loadu_si128( reinterpret_cast< const __m128i* >( target + result ) );
+
+			if( _mm_movemask_epi8( block ) )
+				return result;
+
+			block = _mm_xor_si128( block, _mm_and_si128( _mm_cmplt_epi8( _mm_add_epi8( block, offset ), limit ), flip ) );
+			_mm_storeu_si128( reinterpret_cast< __m128i* >( target + result ), block );
+		}
+#endif // QMX_STRING_X86
+
+	// Fold the remaining bytes.
+
+		for( ; result < size; result++ )
+		{
+			if( target[ result ] & 0x80 )
+				break;
+
+			if( static_cast< unsigned char >( target[ result ] - first ) < 26 )
+				target[ result ] ^= 0x20;
+		}
+
+	// Return result to calling routine.
+
+		return result;
+}
+
+} // 'CaseFolder' Namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of the 'CaseFolder' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Public Methods for the 'Tokenizer::Iterator' Class
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Tokenizer::Iterator::Iterator( const Tokenizer* sourceOwner ) noexcept : owner( sourceOwner )
+{
+	// Position the iterator on the first token, which ends at the first delimiter.
+
+		token = owner->source.substr( 0, owner->findDelimiter( 0 ) );
+}
+
+Tokenizer::Iterator& Tokenizer::Iterator::operator++() noexcept
+{
+	// Create local variables.
+
+		size_t index = ( token.data() - owner->source.data() + token.size() );
+
+	// Move past the end if the current token was the last one, otherwise skip the run of delimiters after it and take the next token.
+
+		if( index == owner->source.size() )
+		{
+			owner = nullptr;
+			token = string_view();
+		}
+		else
+		{
+			index = owner->skipDelimiters( index );
+			token = owner->source.substr( index, ( owner->findDelimiter( index ) - index ) );
+		}
+
+	// Return result to calling routine.
+
+		return *this;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Public Methods for the 'Tokenizer' Class
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Tokenizer::Tokenizer( string_view targetSource, string_view targetDelimiters ) noexcept : source( targetSource ), delimiterCount( UNSET )
+{
+	// Initialize fields.
+
+		ZERO_ARRAY( table );
+		ZERO_ARRAY( delimiters );
+
+		for( char delimiter : targetDelimiters )
+		{
+			uint8_t value = static_cast< uint8_t >( delimiter );
+
+			if( table[ value >> 6 ] & ( 1ULL << ( value & 63 ) ) )
+				continue;
+
+			table[ value >> 6 ] |= ( 1ULL << ( value & 63 ) );
+
+			if( delimiterCount < sizeof( delimiters ) )
+				delimiters[ delimiterCount ] = delimiter;
+
+			delimiterCount++;
+		}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private Methods for the 'Tokenizer' Class
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+size_t Tokenizer::findDelimiter( size_t index ) const noexcept
+{
+	// Create local variables.
+
+		const char* data = source.data();
+		size_t size = source.size();
+
+#if defined( QMX_STRING_X86 )
+		__m128i sets[ sizeof( delimiters ) ];
+		__m128i block;
+		__m128i matches;
+		int mask = 0;
+
+	// Compare whole blocks against each delimiter in turn, when there are few enough delimiters for that to beat the lookup table.
+
+		if( delimiterCount && ( delimiterCount <= sizeof( delimiters ) ) )
+		{
+			for( size_t delimiter = 0; delimiter < delimiterCount; delimiter++ )
+				sets[ delimiter ] = _mm_set1_epi8( delimiters[ delimiter ] );
+
+			for( ; ( index + 16 ) <= size; index += 16 )
+			{
+				block = _mm_loadu_si128( reinterpret_cast< const __m128i* >( data + index ) );
+				matches = _mm_cmpeq_epi8( block, sets[ 0 ] );
+
+				for( size_t delimiter = 1; delimiter < delimiterCount; delimiter++ )
+					matches = _mm_or_si128( matches, _mm_cmpeq_epi8( block, sets[ delimiter ] ) );
+
+				if( ( mask = _mm_movemask_epi8( matches ) ) )
+					return ( index + __builtin_ctz( mask ) );
+			}
+		}
+#endif // QMX_STRING_X86
+
+	// Check the remaining bytes against the lookup table.
+
+		for( uint8_t value; index < size; index++ )
+		{
+			value = static_cast< uint8_t >( data[ index ] );
+
+			if( table[ value >> 6 ] & ( 1ULL << ( value & 63 ) ) )
+				break;
+		}
+
+	// Return result to calling routine.
+
+		return index;
+}
+
+size_t Tokenizer::skipDelimiters( size_t index ) const noexcept
+{
+	// Create local variables.
+
+		const char* data = source.data();
+		size_t size = source.size();
+
+	// Skip the run of delimiters, which is usually only a byte or two long, so the lookup table beats a vector scan here.
+
+		for( uint8_t value; index < size; index++ )
+		{
+			value = static_cast< uint8_t >( data[ index ] );
+
+			if( !( table[ value >> 6 ] & ( 1ULL << ( value & 63 ) ) ) )
+				break;
+		}
+
+	// Return result to calling routine.
+
+		return index;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Function Definitions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TranscoderISA getTranscoderISA()
+{
+	// Return result to calling routine.
+
+		return Transcoder::getISA();
+}
+
+TranscoderISA setTranscoderISA( TranscoderISA targetISA )
+{
+	// Create local variables.
+
+		TranscoderISA result = min( targetISA, Transcoder::getSupportedISA() );
+
+	// Set the instruction set used by the UTF transcoder.
+
+		Transcoder::currentISA.store( result, memory_order_relaxed );
+
+	// Return result to calling routine.
+
+		return result;
+}
+
 string toUTF8( const u16string& source )
 {
 	// Create local variables.
 
-		wstring_convert< codecvt_utf8_utf16< char16_t >, char16_t > convert;
+		string result( ( source.size() * 3 ), '\0' );
+		Expected< size_t > size = toUTF8( source, &result[ 0 ], result.size() );
 
-	// Return result of converting specified UTF-16 string to a UTF-8 string to calling routine.
+	// Convert specified UTF-16 string to a UTF-8 string.
 
-		return convert.to_bytes( source );
+		QMX_ASSERT_RESULT( size, source.size() );
+		result.resize( size.getValue() );
+
+	// Return result to calling routine.
+
+		return result;
 }
 
 string toUTF8( const u32string& source )
 {
 	// Create local variables.
 
-		wstring_convert< codecvt_utf8< char32_t >, char32_t > convert;
+		string result( ( source.size() * 4 ), '\0' );
+		Expected< size_t > size = toUTF8( source, &result[ 0 ], result.size() );
 
-	// Return result of converting specified UTF-32 string to a UTF-8 string to calling routine.
+	// Convert specified UTF-32 string to a UTF-8 string.
+
+		QMX_ASSERT_RESULT( size, source.size() );
+		result.resize( size.getValue() );
+
+	// Return result to calling routine.
 
-		return convert.to_bytes( source );
+		return result;
 }
 
 u16string toUTF16( const string& source )
 {
 	// Create local variables.
 
-		wstring_convert< codecvt_utf8_utf16< char16_t >, char16_t > convert;
+		u16string result( source.size(), u'\0' );
+		Expected< size_t > size = toUTF16( source, &result[ 0 ], result.size() );
+
+	// Convert specified UTF-8 string to a UTF-16 string.
 
-	// Return result of converting specified UTF-8 string to a UTF-16 string to calling routine.
+		QMX_ASSERT_RESULT( size, source.size() );
+		result.resize( size.getValue() );
+
+	// Return result to calling routine.
 
-		return convert.from_bytes( source );
+		return result;
 }
 
 u32string toUTF32( const string& source )
 {
 	// Create local variables.
 
-		wstring_convert< codecvt_utf8< char32_t >, char32_t > convert;
+		u32string result( source.size(), U'\0' );
+		Expected< size_t > size = toUTF32( source, &result[ 0 ], result.size() );
+
+	// Convert specified UTF-8 string to a UTF-32 string.
 
-	// Return result of converting specified UTF-8 string to a UTF-32 string to calling routine.
+		QMX_ASSERT_RESULT( size, source.size() );
+		result.resize( size.getValue() );
+
+	// Return result to calling routine.
 
-		return convert.from_bytes( source );
+		return result;
+}
+
+Expected< size_t > toUTF8( u16string_view source, char* target, size_t targetSize )
+{
+	// Create local variables.
+
+		size_t result = 0;
+		Transcoder::Status status = Transcoder::toUTF8( source.data(), source.size(), target, targetSize, result );
+
+	// Check conversion status.
+
+		QMX_EXPECT( ( status != Transcoder::MALFORMED ), "QMXStdLib", "String::toUTF8", "0000002F" );
+		QMX_EXPECT( ( status != Transcoder::OVERFLOWED ), "QMXStdLib", "String::toUTF8", "00000030" );
+
+	// Return result to calling routine.
+
+		return result;
+}
+
+Expected< size_t > toUTF8( u32string_view source, char* target, size_t targetSize )
+{
+	// Create local variables.
+
+		size_t result = 0;
+		Transcoder::Status status = Transcoder::toUTF8( source.data(), source.size(), target, targetSize, result );
+
+	// Check conversion status.
+
+		QMX_EXPECT( ( status != Transcoder::MALFORMED ), "QMXStdLib", "String::toUTF8", "0000002F" );
+		QMX_EXPECT( ( status != Transcoder::OVERFLOWED ), "QMXStdLib", "String::toUTF8", "00000030" );
+
+	// Return result to calling routine.
+
+		return result;
+}
+
+Expected< size_t > toUTF16( string_view source, char16_t* target, size_t targetSize )
+{
+	// Create local variables.
+
+		size_t result = 0;
+		Transcoder::Status status = Transcoder::fromUTF8( reinterpret_cast< const uint8_t* >( source.data() ), source.size(), target, targetSize, result );
+
+	// Check conversion status.
+
+		QMX_EXPECT( ( status != Transcoder::MALFORMED ), "QMXStdLib", "String::toUTF16", "0000002F" );
+		QMX_EXPECT( ( status != Transcoder::OVERFLOWED ), "QMXStdLib", "String::toUTF16", "00000030" );
+
+	// Return result to calling routine.
+
+		return result;
+}
+
+Expected< size_t > toUTF32( string_view source, char32_t* target, size_t targetSize )
+{
+	// Create local variables.
+
+		size_t result = 0;
+		Transcoder::Status status = Transcoder::fromUTF8( reinterpret_cast< const uint8_t* >( source.data() ), source.size(), target, targetSize, result );
+
+	// Check conversion status.
+
+		QMX_EXPECT( ( status != Transcoder::MALFORMED ), "QMXStdLib", "String::toUTF32", "0000002F" );
+		QMX_EXPECT( ( status != Transcoder::OVERFLOWED ), "QMXStdLib", "String::toUTF32", "00000030" );
+
+	// Return result to calling routine.
+
+		return result;
 }
 
 bool isAllWhitespace( const string& source )
@@ -126,12 +1129,20 @@ string strip( string& target, const string& substring, bool modifyTarget )
 {
 	// Create local variables.
 
-		string result = boost::algorithm::erase_all_copy( target, substring );
+		string result;
 
-	// Modify target string if modify flag is set to 'true'.
+	// Strip the target string itself if modify flag is set to 'true', otherwise strip a single copy of it.
 
 		if( modifyTarget )
-			target = result;
+		{
+			stripInPlace( target, substring );
+			result = target;
+		}
+		else
+		{
+			result = target;
+			stripInPlace( result, substring );
+		}
 
 	// Return result to calling routine.
 
@@ -142,12 +1153,20 @@ string toUpper( string& target, bool modifyTarget )
 {
 	// Create local variables.
 
-		string result = boost::locale::to_upper( target );
+		string result;
 
-	// Modify target string if modify flag is set to 'true'.
+	// Convert the target string itself if modify flag is set to 'true', otherwise convert a single copy of it.
 
 		if( modifyTarget )
-			target = result;
+		{
+			toUpperInPlace( target );
+			result = target;
+		}
+		else
+		{
+			result = target;
+			toUpperInPlace( result );
+		}
 
 	// Return result to calling routine.
 
@@ -158,12 +1177,20 @@ string toLower( string& target, bool modifyTarget )
 {
 	// Create local variables.
 
-		string result = boost::locale::to_lower( target );
+		string result;
 
-	// Modify target string if modify flag is set to 'true'.
+	// Convert the target string itself if modify flag is set to 'true', otherwise convert a single copy of it.
 
 		if( modifyTarget )
-			target = result;
+		{
+			toLowerInPlace( target );
+			result = target;
+		}
+		else
+		{
+			result = target;
+			toLowerInPlace( result );
+		}
 
 	// Return result to calling routine.
 
@@ -174,18 +1201,189 @@ string findReplace( string& target, const string& find, const string& replace, b
 {
 	// Create local variables.
 
-		string result = boost::algorithm::replace_all_copy( target, find, replace );
+		string result;
 
-	// Modify target string if modify flag is set to 'true'.
+	// Modify the target string itself if modify flag is set to 'true', otherwise modify a single copy of it.
 
 		if( modifyTarget )
-			target = result;
+		{
+			findReplaceInPlace( target, find, replace );
+			result = target;
+		}
+		else
+		{
+			result = target;
+			findReplaceInPlace( result, find, replace );
+		}
+
+	// Return result to calling routine.
+
+		return result;
+}
+
+void stripInPlace( string& target, string_view substring )
+{
+	// Strip all occurrences of the specified substring.
+
+		findReplaceInPlace( target, substring, string_view() );
+}
+
+void toUpperInPlace( string& target )
+{
+	// Fold the ASCII prefix of the target string, and hand the whole string to 'boost::locale' if a non-ASCII byte stopped the fold.
+
+		if( CaseFolder::fold< true >( target.data(), target.size() ) != target.size() )
+			target = boost::locale::to_upper( target );
+}
+
+void toLowerInPlace( string& target )
+{
+	// Fold the ASCII prefix of the target string, and hand the whole string to 'boost::locale' if a non-ASCII byte stopped the fold.
+
+		if( CaseFolder::fold< false >( target.data(), target.size() ) != target.size() )
+			target = boost::locale::to_lower( target );
+}
+
+void findReplaceInPlace( string& target, string_view find, string_view replace )
+{
+	// Create local variables.
+
+		vector< size_t > matches;
+		string_view source( target );
+		size_t sourceIndex = 0;
+		size_t targetIndex = 0;
+		size_t match = 0;
+		char* data = nullptr;
+
+	// Check for an empty 'Find' substring, which has no occurrences.
+
+		if( find.empty() )
+			return;
+
+	// Single characters are common enough (e.g. separators and whitespace) to warrant their own loops, which avoid a search call per match.
+
+		if( ( find.size() == 1 ) && ( replace.size() <= 1 ) )
+		{
+			if( replace.empty() )
+				target.erase( remove( target.begin(), target.end(), find.front() ), target.end() );
+			else
+				std::replace( target.begin(), target.end(), find.front(), replace.front() );
+
+			return;
+		}
+
+	// If the string cannot grow, compact it front to back, writing each segment and replacement over the space the previous matches left behind.
+
+		if( replace.size() <= find.size() )
+		{
+			data = target.data();
+
+			while( ( match = source.find( find, sourceIndex ) ) != string_view::npos )
+			{
+				if( targetIndex != sourceIndex )
+					memmove( ( data + targetIndex ), ( data + sourceIndex ), ( match - sourceIndex ) );
+
+				targetIndex += ( match - sourceIndex );
+				memcpy( ( data + targetIndex ), replace.data(), replace.size() );
+				targetIndex += replace.size();
+				sourceIndex = ( match + find.size() );
+			}
+
+			if( sourceIndex )
+			{
+				memmove( ( data + targetIndex ), ( data + sourceIndex ), ( target.size() - sourceIndex ) );
+				target.resize( targetIndex + target.size() - sourceIndex );
+			}
+
+			return;
+		}
+
+	// Otherwise, record where the matches are, grow the string once, and expand it back to front so no segment is overwritten before it is moved.
+
+		while( ( match = source.find( find, sourceIndex ) ) != string_view::npos )
+		{
+			matches.push_back( match );
+			sourceIndex = ( match + find.size() );
+		}
+
+		if( matches.empty() )
+			return;
+
+		sourceIndex = target.size();
+		target.resize( sourceIndex + ( matches.size() * ( replace.size() - find.size() ) ) );
+		data = target.data();
+		targetIndex = target.size();
+
+		for( auto index = matches.rbegin(); index != matches.rend(); index++ )
+		{
+			match = ( *index + find.size() );
+			targetIndex -= ( sourceIndex - match );
+			memmove( ( data + targetIndex ), ( data + match ), ( sourceIndex - match ) );
+			targetIndex -= replace.size();
+			memcpy( ( data + targetIndex ), replace.data(), replace.size() );
+			sourceIndex = *index;
+		}
+}
+
+Expected< uint64_t > toMagnitude( string_view source, Stringizable::NumericBase base ) noexcept
+{
+	// Create local variables.
+
+		static const auto digits = []()
+		{
+			array< uint8_t, 256 > result;
+
+			result.fill( 0xFF );
+
+			for( uint8_t index = 0; index < 10; index++ )
+				result[ '0' + index ] = index;
+
+			for( uint8_t index = 0; index < 6; index++ )
+				result[ 'A' + index ] = result[ 'a' + index ] = ( 10 + index );
+
+			return result;
+		}();
+
+		const uint32_t shift = ( ( base == Stringizable::BINARY ) ? 1 : ( ( base == Stringizable::OCTAL ) ? 3 : 4 ) );
+		const uint64_t limit = ( numeric_limits< uint64_t >::max() >> shift );
+		uint64_t result = 0;
+		uint8_t digit = 0;
+
+	// Check for an empty string, which has no digits.
+
+		QMX_EXPECT( !source.empty(), "QMXStdLib", "String::toValue", "00000031" );
+
+	// Accumulate digits, shifting each one in; every base is a power of two, so the value overflows exactly when a set bit is shifted out of the top.
+
+		for( char character : source )
+		{
+			digit = digits[ static_cast< uint8_t >( character ) ];
+
+			QMX_EXPECT( ( digit < ( 1U << shift ) ), "QMXStdLib", "String::toValue", "00000031" );
+			QMX_EXPECT( ( result <= limit ), "QMXStdLib", "String::toValue", "00000032" );
+
+			result = ( ( result << shift ) | digit );
+		}
 
 	// Return result to calling routine.
 
 		return result;
 }
 
+void tokenize( vector< string_view >& target, string_view source, string_view delimiters )
+{
+	// Create local variables.
+
+		Tokenizer tokenizer( source, delimiters );
+
+	// Split specified string into tokens, keeping the vector's capacity.
+
+		target.clear();
+
+		for( string_view token : tokenizer )
+			target.push_back( token );
+}
+
 } // 'String' Namespace
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,815 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// TaskPool.cpp
+// Robert M. Baker | Created : 16OCT26 | Last Modified : 17OCT26 by Robert M. Baker
+// Version : 2.3.0
+// This is a source file for 'QMXStdLib'; it defines the implementation for a work-stealing task pool class.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+//
+// This file is part of 'QMXStdLib'.
+//
+// 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option) any later version.
+//
+// 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+  * @file
+  * @author  Robert M. Baker
+  * @date    Created : 16OCT26
+  * @date    Last Modified : 17OCT26 by Robert M. Baker
+  * @version 2.3.0
+  *
+  * @brief This source file defines the implementation for a work-stealing task pool class.
+  *
+  * @section TaskPoolS0000 Description
+  *
+  * This source file defines the implementation for a work-stealing task pool class.
+  *
+  * @section TaskPoolS0001 License
+  *
+  * Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+  *
+  * This file is part of 'QMXStdLib'.
+  *
+  * 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+  * Software Foundation, either version 3 of the License, or (at your option) any later version.
+  *
+  * 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+  * A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+  *
+  * You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+  */
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Header Files
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../include/TaskPool.hpp"
+
+using namespace std;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Start of the 'QMXStdLib' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace QMXStdLib
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// The 'TaskPool::Scheduler' Class
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class TaskPool::Scheduler
+{
+public:
+
+	// Public Data Types
+
+		/**
+		  * @brief This structure stores a worker's data.
+		  */
+
+		struct Worker
+		{
+		public:
+
+			// Public Fields
+
+				/**
+				  * @brief This is the worker's thread.
+				  */
+
+				boost::thread thread;
+
+				/**
+				  * @brief This is the mutex protecting the worker's deque.
+				  */
+
+				boost::mutex queueMutex;
+
+				/**
+				  * @brief This is the worker's deque of tasks; the owner works at the back, thieves at the front.
+				  */
+
+				deque< TaskPtr > tasks;
+
+				/**
+				  * @brief This is the mutex protecting the worker's running task state.
+				  */
+
+				boost::mutex stateMutex;
+
+				/**
+				  * @brief This is the flag which determines if the worker is running a task.
+				  */
+
+				bool isBusy = false;
+
+				/**
+				  * @brief This is the group of the task being run, if any.
+				  */
+
+				const TaskGroup* currentGroup = nullptr;
+
+				/**
+				  * @brief This is the submission epoch of the task being run.
+				  */
+
+				uint64_t currentEpoch = UNSET;
+		};
+
+	// Public Constructors
+
+		/**
+		  * @brief This is the constructor.
+		  *
+		  * @param workerCount
+		  * 	This is the number of workers to create; it must be greater than zero.
+		  */
+
+		Scheduler( const uint32_t workerCount ) : workers( workerCount ), nextWorker( UNSET ), queuedCount( UNSET ), sleeperCount( UNSET )
+		{
+			// Initialize fields.
+
+				isStopping = false;
+				isCancelling = false;
+
+				for( auto& index : workers )
+					index = make_unique< Worker >();
+		}
+
+	// Public Methods
+
+		/**
+		  * @brief This method starts the worker threads of the specified scheduler.
+		  *
+		  * Each worker thread keeps its scheduler alive, so that detached workers never outlive it.
+		  *
+		  * @param target
+		  * 	This is the scheduler to start.
+		  */
+
+		static void start( const SchedulerPtr& target )
+		{
+			// Start worker threads.
+
+				for( auto& index : target->workers )
+					index->thread = boost::thread( &Scheduler::run, target, index.get() );
+		}
+
+		/**
+		  * @brief This method retrieves the number of workers.
+		  *
+		  * @return
+		  * 	The number of workers.
+		  */
+
+		uint32_t getWorkerCount() const
+		{
+			// Return the number of workers to calling routine.
+
+				return static_cast< uint32_t >( workers.size() );
+		}
+
+		/**
+		  * @brief This method queues a task, waking a sleeping worker if there is one.
+		  *
+		  * A task submitted from outside the pool is checked against the stop flag and queued under the idle lock, so that no worker can see the pool as
+		  * stopping with nothing queued in between; once the pool is stopping, such a task is rejected.
+		  *
+		  * @param task
+		  * 	This is the task to queue; it is left untouched if it is rejected.
+		  *
+		  * @return
+		  * 	A boolean value of 'true' if the task was queued, and 'false' if it was rejected.
+		  */
+
+		bool enqueue( TaskPtr& task )
+		{
+			// Create local variables.
+
+				bool isExternal = ( currentScheduler != this );
+				Worker* target = isExternal ? workers[ nextWorker.fetch_add( 1, memory_order_relaxed ) % workers.size() ].get() : currentWorker;
+				boost::unique_lock< boost::mutex > idleLock( idleMutex, boost::defer_lock );
+
+			// Perform abort check.
+
+				if( isExternal )
+				{
+					idleLock.lock();
+
+					if( isStopping )
+						return false;
+				}
+
+			// Push task onto the target worker's deque, then wake a sleeping worker, if any.
+
+				// Queue Scope
+				{
+					// Obtain locks.
+
+						boost::lock_guard< boost::mutex > lock( target->queueMutex );
+
+					// Push task onto the back of the deque.
+
+						target->tasks.push_back( move( task ) );
+				}
+
+				queuedCount.fetch_add( 1 );
+
+				if( sleeperCount.load() )
+				{
+					if( !idleLock.owns_lock() )
+						idleLock.lock();
+
+					idleCondition.notify_one();
+				}
+
+			// Return result to calling routine.
+
+				return true;
+		}
+
+		/**
+		  * @brief This method interrupts all tasks in the specified group which were submitted before this call.
+		  *
+		  * @param group
+		  * 	This is the group whose tasks are interrupted.
+		  */
+
+		void interrupt( TaskGroup& group )
+		{
+			// Create local variables.
+
+				uint64_t newEpoch = group.epoch.fetch_add( 1 ) + 1;
+
+			// Interrupt any worker running a task of the specified group; queued tasks are cancelled as they are dequeued.
+
+				for( auto& index : workers )
+				{
+					boost::lock_guard< boost::mutex > lock( index->stateMutex );
+
+					if( index->isBusy && ( index->currentGroup == &group ) && ( index->currentEpoch < newEpoch ) )
+						index->thread.interrupt();
+				}
+		}
+
+		/**
+		  * @brief This method stops all workers.
+		  *
+		  * @param doInterrupt
+		  * 	This is a boolean value which determines if queued tasks are cancelled and running tasks are interrupted, rather than drained.
+		  *
+		  * @param doJoin
+		  * 	This is a boolean value which determines if this method waits for the worker threads to exit, or detaches them.
+		  */
+
+		void shutdown( const bool doInterrupt, const bool doJoin )
+		{
+			// Signal workers to stop.
+
+				// Idle Scope
+				{
+					// Obtain locks.
+
+						boost::lock_guard< boost::mutex > lock( idleMutex );
+
+					// Set stop flags.
+
+						isCancelling = doInterrupt;
+						isStopping = true;
+				}
+
+				idleCondition.notify_all();
+
+			// Interrupt running tasks, if 'doInterrupt' is 'true'.
+
+				if( doInterrupt )
+				{
+					for( auto& index : workers )
+					{
+						boost::lock_guard< boost::mutex > lock( index->stateMutex );
+
+						if( index->isBusy )
+							index->thread.interrupt();
+					}
+				}
+
+			// Join or detach worker threads.
+
+				for( auto& index : workers )
+				{
+					if( index->thread.joinable() )
+					{
+						if( doJoin && ( index->thread.get_id() != THIS_THREAD_HASH ) )
+							index->thread.join();
+						else
+							index->thread.detach();
+					}
+				}
+		}
+
+private:
+
+	// Private Type Definitions
+
+		typedef unique_ptr< Worker > WorkerPtr;
+
+	// Private Fields
+
+		/**
+		  * @brief This is the scheduler owning the current thread, if it is a worker thread.
+		  */
+
+		static thread_local Scheduler* currentScheduler;
+
+		/**
+		  * @brief This is the worker running on the current thread, if it is a worker thread.
+		  */
+
+		static thread_local Worker* currentWorker;
+
+		/**
+		  * @brief This is the list of workers; it never changes once the scheduler is constructed.
+		  */
+
+		vector< WorkerPtr > workers;
+
+		/**
+		  * @brief This is the round-robin index used for tasks submitted from outside the pool.
+		  */
+
+		atomic< size_t > nextWorker;
+
+		/**
+		  * @brief This is the number of queued tasks across all deques.
+		  */
+
+		atomic< size_t > queuedCount;
+
+		/**
+		  * @brief This is the number of workers sleeping on 'idleCondition'.
+		  */
+
+		atomic< size_t > sleeperCount;
+
+		/**
+		  * @brief This is the flag which determines if the workers should exit once no work remains.
+		  */
+
+		atomic< bool > isStopping;
+
+		/**
+		  * @brief This is the flag which determines if remaining tasks are cancelled instead of run.
+		  */
+
+		atomic< bool > isCancelling;
+
+		/**
+		  * @brief This is the mutex used by idle workers.
+		  */
+
+		boost::mutex idleMutex;
+
+		/**
+		  * @brief This is the condition variable idle workers sleep on.
+		  */
+
+		boost::condition_variable idleCondition;
+
+	// Private Methods
+
+		/**
+		  * @brief This method pops a task from the back of the specified worker's own deque.
+		  *
+		  * @param self
+		  * 	This is the worker to pop from.
+		  *
+		  * @return
+		  * 	The popped task, or null if the deque was empty.
+		  */
+
+		TaskPtr pop( Worker* self )
+		{
+			// Obtain locks.
+
+				boost::lock_guard< boost::mutex > lock( self->queueMutex );
+
+			// Create local variables.
+
+				TaskPtr result;
+
+			// Pop task from the back of the deque, if any.
+
+				if( !self->tasks.empty() )
+				{
+					result = move( self->tasks.back() );
+					self->tasks.pop_back();
+					queuedCount.fetch_sub( 1 );
+				}
+
+			// Return result to calling routine.
+
+				return result;
+		}
+
+		/**
+		  * @brief This method steals a task from the front of another worker's deque.
+		  *
+		  * @param self
+		  * 	This is the worker doing the stealing.
+		  *
+		  * @return
+		  * 	The stolen task, or null if all other deques were empty.
+		  */
+
+		TaskPtr steal( Worker* self )
+		{
+			// Create local variables.
+
+				TaskPtr result;
+				size_t selfIndex = UNSET;
+
+			// Find the position of the stealing worker.
+
+				while( workers[ selfIndex ].get() != self )
+					selfIndex++;
+
+			// Steal task from the front of the first non-empty deque, starting with the next worker.
+
+				for( size_t offset = 1; !result && ( offset < workers.size() ); offset++ )
+				{
+					Worker* victim = workers[ ( selfIndex + offset ) % workers.size() ].get();
+					boost::lock_guard< boost::mutex > lock( victim->queueMutex );
+
+					if( !victim->tasks.empty() )
+					{
+						result = move( victim->tasks.front() );
+						victim->tasks.pop_front();
+						queuedCount.fetch_sub( 1 );
+					}
+				}
+
+			// Return result to calling routine.
+
+				return result;
+		}
+
+		/**
+		  * @brief This method runs a task on the specified worker, cancelling it instead if it was interrupted before it started.
+		  *
+		  * @param self
+		  * 	This is the worker running the task.
+		  *
+		  * @param task
+		  * 	This is the task to run.
+		  *
+		  * @param diInstance
+		  * 	This is the worker's interruption guard, which is lifted only while the task is running.
+		  */
+
+		void execute( Worker* self, TaskPtr& task, boost::this_thread::disable_interruption& diInstance )
+		{
+			// Create local variables.
+
+				bool isCancelled = false;
+
+			// Publish the running task, so that it can be interrupted, and only then check if it was cancelled; an interrupt issued before the check is seen by
+			// it, and one issued after it finds the worker busy.
+
+				// State Scope
+				{
+					// Obtain locks.
+
+						boost::lock_guard< boost::mutex > lock( self->stateMutex );
+
+					// Set running task state.
+
+						self->isBusy = true;
+						self->currentGroup = task->group.get();
+						self->currentEpoch = task->epoch;
+						isCancelled = ( isCancelling || ( task->group && ( task->epoch < task->group->epoch.load() ) ) );
+				}
+
+			// Run task with interruption enabled.
+
+				// Run Scope
+				{
+					// Create scope variables.
+
+						boost::this_thread::restore_interruption riInstance( diInstance );
+
+					// Run task.
+
+						task->run( isCancelled );
+				}
+
+			// Clear the running task state, then discard any interrupt request which arrived too late to reach the task.
+
+				// State Scope
+				{
+					// Obtain locks.
+
+						boost::lock_guard< boost::mutex > lock( self->stateMutex );
+
+					// Clear running task state.
+
+						self->isBusy = false;
+						self->currentGroup = nullptr;
+				}
+
+				if( boost::this_thread::interruption_requested() )
+				{
+					boost::this_thread::restore_interruption riInstance( diInstance );
+
+					try
+					{
+						boost::this_thread::interruption_point();
+					}
+					catch( const boost::thread_interrupted& except )
+					{
+						// Do nothing.
+					}
+				}
+
+			// Report the task as finished to its group.
+
+				if( task->group )
+					task->group->removePending();
+
+				task.reset();
+		}
+
+		/**
+		  * @brief This is the main routine of a worker thread.
+		  *
+		  * @param target
+		  * 	This is the scheduler which owns the worker.
+		  *
+		  * @param self
+		  * 	This is the worker.
+		  */
+
+		static void run( SchedulerPtr target, Worker* self )
+		{
+			// Create local variables.
+
+				boost::this_thread::disable_interruption diInstance;
+				TaskPtr task;
+				bool isDone = false;
+
+			// Register the current thread as a worker.
+
+				currentScheduler = target.get();
+				currentWorker = self;
+
+			// Run tasks until the scheduler stops and no work remains, sleeping whenever no task can be found.
+
+				while( !isDone )
+				{
+					task = target->pop( self );
+
+					if( !task )
+						task = target->steal( self );
+
+					if( task )
+						target->execute( self, task, diInstance );
+					else
+					{
+						boost::unique_lock< boost::mutex > lock( target->idleMutex );
+						target->sleeperCount.fetch_add( 1 );
+
+						while( !target->queuedCount.load() && !target->isStopping )
+							target->idleCondition.wait( lock );
+
+						target->sleeperCount.fetch_sub( 1 );
+						isDone = ( target->isStopping && !target->queuedCount.load() );
+					}
+				}
+
+			// Unregister the current thread.
+
+				currentScheduler = nullptr;
+				currentWorker = nullptr;
+		}
+};
+
+thread_local TaskPool::Scheduler* TaskPool::Scheduler::currentScheduler = nullptr;
+thread_local TaskPool::Scheduler::Worker* TaskPool::Scheduler::currentWorker = nullptr;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Public Methods for the 'TaskGroup' Class
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TaskGroup::TaskGroup() : pendingCount( UNSET ), epoch( UNSET )
+{
+	// Do nothing.
+}
+
+TaskGroup::~TaskGroup()
+{
+	// Do nothing.
+}
+
+size_t TaskGroup::getPendingCount() const
+{
+	// Obtain locks.
+
+		boost::lock_guard< boost::mutex > lock( groupMutex );
+
+	// Return the number of pending tasks to calling routine.
+
+		return pendingCount;
+}
+
+void TaskGroup::wait() const
+{
+	// Create local variables.
+
+		boost::unique_lock< boost::mutex > lock( groupMutex );
+
+	// Wait for all pending tasks to finish.
+
+		while( pendingCount )
+			groupCondition.wait( lock );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private Methods for the 'TaskGroup' Class
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void TaskGroup::addPending()
+{
+	// Obtain locks.
+
+		boost::lock_guard< boost::mutex > lock( groupMutex );
+
+	// Increment the pending task count.
+
+		pendingCount++;
+}
+
+void TaskGroup::removePending()
+{
+	// Obtain locks.
+
+		boost::lock_guard< boost::mutex > lock( groupMutex );
+
+	// Decrement the pending task count, waking all waiters if it reaches zero.
+
+		if( !--pendingCount )
+			groupCondition.notify_all();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Public Methods for the 'TaskPool' Class
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TaskPool::~TaskPool()
+{
+	try
+	{
+		// Perform necessary cleanup.
+
+			if( initialized )
+				deallocate();
+	}
+	catch( const exception& except )
+	{
+		// Do nothing.
+	}
+}
+
+void TaskPool::start( const uint32_t workerCount )
+{
+	// Obtain locks.
+
+		SCOPED_WRITE_LOCK;
+
+	// Create scoped stack traces.
+
+		SCOPED_STACK_TRACE( "TaskPool::start", 0000 );
+
+	// Create local variables.
+
+		uint32_t targetCount = workerCount;
+		SchedulerPtr newScheduler;
+
+	// Start worker threads, if the pool is not already running.
+
+		QMX_ASSERT( !atomic_load( &scheduler ), "QMXStdLib", "TaskPool::start", "00000027", workerCount );
+
+		if( !targetCount )
+			targetCount = boost::thread::physical_concurrency();
+
+		if( !targetCount )
+			targetCount = boost::thread::hardware_concurrency();
+
+		if( !targetCount )
+			targetCount = 1;
+
+		newScheduler = make_shared< Scheduler >( targetCount );
+		Scheduler::start( newScheduler );
+		atomic_store( &scheduler, newScheduler );
+}
+
+void TaskPool::stop( const bool doInterrupt, const bool doJoin )
+{
+	// Create local variables.
+
+		SchedulerPtr targetScheduler;
+
+	// Create scoped stack traces.
+
+		SCOPED_STACK_TRACE( "TaskPool::stop", 0000 );
+
+	// Write Scope
+	{
+		// Obtain locks.
+
+			SCOPED_WRITE_LOCK;
+
+		// Detach the scheduler, if the pool is running, so that no further tasks can be submitted.
+
+			targetScheduler = atomic_load( &scheduler );
+			QMX_ASSERT( targetScheduler, "QMXStdLib", "TaskPool::stop", "00000028", boolalpha << doInterrupt << ", " << doJoin );
+			atomic_store( &scheduler, SchedulerPtr() );
+	}
+
+	// Stop worker threads.
+
+		targetScheduler->shutdown( doInterrupt, doJoin );
+}
+
+uint32_t TaskPool::getWorkerCount() const
+{
+	// Create local variables.
+
+		SchedulerPtr targetScheduler = atomic_load( &scheduler );
+
+	// Return the number of workers to calling routine.
+
+		return ( targetScheduler ? targetScheduler->getWorkerCount() : UNSET );
+}
+
+void TaskPool::interrupt( const TaskGroupPtr& group )
+{
+	// Create local variables.
+
+		SchedulerPtr targetScheduler = atomic_load( &scheduler );
+
+	// Interrupt the specified group's tasks; if the pool is not running, only the group's epoch is advanced.
+
+		if( targetScheduler )
+			targetScheduler->interrupt( *group );
+		else
+			group->epoch.fetch_add( 1 );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private Methods for the 'TaskPool' Class
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TaskPool::TaskPool()
+{
+	// Do nothing.
+}
+
+void TaskPool::enqueue( const SchedulerPtr& targetScheduler, TaskPtr task )
+{
+	// Register task with its group, then queue it; if the pool began stopping in the meantime, undo the registration.
+
+		if( task->group )
+			task->group->addPending();
+
+		if( !targetScheduler->enqueue( task ) )
+		{
+			if( task->group )
+				task->group->removePending();
+
+			QMX_THROW( "QMXStdLib", "TaskPool::submit", "00000029", "" );
+		}
+}
+
+void TaskPool::deallocateImp()
+{
+	// Perform necessary cleanup.
+
+		if( atomic_load( &scheduler ) )
+			stop();
+}
+
+} // 'QMXStdLib' Namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of the 'QMXStdLib' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of 'TaskPool.cpp'
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1,6 +1,6 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // ThreadManager.cpp
-// Robert M. Baker | Created : 24FEB16 | Last Modified : 03SEP19 by Robert M. Baker
+// Robert M. Baker | Created : 24FEB16 | Last Modified : 17OCT26 by Robert M. Baker
 // Version : 2.3.0
 // This is a source file for 'QMXStdLib'; it defines the implementation for a thread manager class.
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -21,7 +21,7 @@
   * @file
   * @author  Robert M. Baker
   * @date    Created : 24FEB16
-  * @date    Last Modified : 03SEP19 by Robert M. Baker
+  * @date    Last Modified : 17OCT26 by Robert M. Baker
   * @version 2.3.0
   *
   * @brief This is a source file for 'QMXStdLib'; it defines the implementation for a thread manager class.
@@ -92,7 +92,7 @@ void ThreadManager::createGroup( const string& groupID )
 	// Create specified group, if it does not already exist.
 
 		QMX_ASSERT(
-			groups.insert( GroupMap::value_type( groupID, { ThreadPtrMap(), BarrierPtr() } ) ).second,
+			groups.insert( GroupMap::value_type( groupID, { ThreadPtrMap(), BarrierPtr(), make_shared< TaskGroup >() } ) ).second,
 			"QMXStdLib",
 			"ThreadManager::createGroup",
 			"00000017",
@@ -133,6 +133,9 @@ void ThreadManager::destroyGroup( const string& groupID, const bool doDestroyThr
 				else if( index.second->joinable() )
 					index.second->detach();
 			}
+
+			if( doInterrupt )
+				pool->interrupt( groupMapIterator->second.tasks );
 		}
 		else
 			QMX_ASSERT(
@@ -280,6 +283,21 @@ void ThreadManager::wait( const string& groupID )
 }
 
 void ThreadManager::join( const string& groupID, const string& threadID )
+{
+	// Create scoped stack traces.
+
+		SCOPED_STACK_TRACE( "ThreadManager::join", 0000 );
+
+	// Create local variables.
+
+		Expected< void > result = tryJoin( groupID, threadID );
+
+	// Check join result.
+
+		QMX_ASSERT_RESULT( result, groupID << ", " << threadID );
+}
+
+Expected< void > ThreadManager::tryJoin( const string& groupID, const string& threadID )
 {
 	// Create local variables.
 
@@ -287,7 +305,7 @@ void ThreadManager::join( const string& groupID, const string& threadID )
 
 	// Create scoped stack traces.
 
-		SCOPED_STACK_TRACE( "ThreadManager::join", 0000 );
+		SCOPED_STACK_TRACE( "ThreadManager::tryJoin", 0000 );
 
 	// Read Scope
 	{
@@ -302,17 +320,9 @@ void ThreadManager::join( const string& groupID, const string& threadID )
 
 		// Obtain specified thread in specified group, if both group and thread exist.
 
-			QMX_ASSERT( ( groupMapIterator != groups.end() ), "QMXStdLib", "ThreadManager::join", "0000001F", groupID << ", " << threadID );
+			QMX_EXPECT( ( groupMapIterator != groups.end() ), "QMXStdLib", "ThreadManager::join", "0000001F" );
 			threadPtrMapIterator = groupMapIterator->second.threads.find( threadID );
-
-			QMX_ASSERT(
-				( threadPtrMapIterator != groupMapIterator->second.threads.end() ),
-				"QMXStdLib",
-				"ThreadManager::join",
-				"00000020",
-				groupID << ", " << threadID
-			);
-
+			QMX_EXPECT( ( threadPtrMapIterator != groupMapIterator->second.threads.end() ), "QMXStdLib", "ThreadManager::join", "00000020" );
 			targetThread = threadPtrMapIterator->second;
 	}
 
@@ -320,17 +330,37 @@ void ThreadManager::join( const string& groupID, const string& threadID )
 
 		if( targetThread->joinable() )
 			targetThread->join();
+
+	// Return result to calling routine.
+
+		return Expected< void >();
 }
 
 void ThreadManager::joinAll( const string& groupID )
 {
+	// Create scoped stack traces.
+
+		SCOPED_STACK_TRACE( "ThreadManager::joinAll", 0000 );
+
 	// Create local variables.
 
-		ThreadPtrMap targetThreads;
+		Expected< void > result = tryJoinAll( groupID );
+
+	// Check join result.
+
+		QMX_ASSERT_RESULT( result, groupID );
+}
+
+Expected< void > ThreadManager::tryJoinAll( const string& groupID )
+{
+	// Create local variables.
+
+		ThreadPtrVector targetThreads;
+		TaskGroupPtr targetTasks;
 
 	// Create scoped stack traces.
 
-		SCOPED_STACK_TRACE( "ThreadManager::joinAll", 0000 );
+		SCOPED_STACK_TRACE( "ThreadManager::tryJoinAll", 0000 );
 
 	// Read Scope
 	{
@@ -342,22 +372,48 @@ void ThreadManager::joinAll( const string& groupID )
 
 			auto groupMapIterator = groups.find( groupID );
 
-		// Obtain all spawned threads for specified group, if it exists.
+		// Obtain all spawned threads and the pooled task bookkeeping for specified group, if it exists.
+
+			QMX_EXPECT( ( groupMapIterator != groups.end() ), "QMXStdLib", "ThreadManager::joinAll", "00000021" );
+			targetThreads.reserve( groupMapIterator->second.threads.size() );
+
+			for( auto& index : groupMapIterator->second.threads )
+				targetThreads.push_back( index.second );
 
-			QMX_ASSERT( ( groupMapIterator != groups.end() ), "QMXStdLib", "ThreadManager::joinAll", "00000021", groupID );
-			targetThreads = groupMapIterator->second.threads;
+			targetTasks = groupMapIterator->second.tasks;
 	}
 
-	// Join threads, if possible.
+	// Join threads, if possible, then wait for the group's pooled tasks to finish.
 
 		for( auto& index : targetThreads )
 		{
-			if( index.second->joinable() )
-				index.second->join();
+			if( index->joinable() )
+				index->join();
 		}
+
+		targetTasks->wait();
+
+	// Return result to calling routine.
+
+		return Expected< void >();
 }
 
 void ThreadManager::interrupt( const string& groupID, const string& threadID )
+{
+	// Create scoped stack traces.
+
+		SCOPED_STACK_TRACE( "ThreadManager::interrupt", 0000 );
+
+	// Create local variables.
+
+		Expected< void > result = tryInterrupt( groupID, threadID );
+
+	// Check interrupt result.
+
+		QMX_ASSERT_RESULT( result, groupID << ", " << threadID );
+}
+
+Expected< void > ThreadManager::tryInterrupt( const string& groupID, const string& threadID )
 {
 	// Obtain locks.
 
@@ -365,7 +421,7 @@ void ThreadManager::interrupt( const string& groupID, const string& threadID )
 
 	// Create scoped stack traces.
 
-		SCOPED_STACK_TRACE( "ThreadManager::interrupt", 0000 );
+		SCOPED_STACK_TRACE( "ThreadManager::tryInterrupt", 0000 );
 
 	// Create local variables.
 
@@ -374,21 +430,32 @@ void ThreadManager::interrupt( const string& groupID, const string& threadID )
 
 	// Interrupt specified thread in specified group, if both group and thread exist.
 
-		QMX_ASSERT( ( groupMapIterator != groups.end() ), "QMXStdLib", "ThreadManager::interrupt", "00000022", groupID << ", " << threadID );
+		QMX_EXPECT( ( groupMapIterator != groups.end() ), "QMXStdLib", "ThreadManager::interrupt", "00000022" );
 		threadPtrMapIterator = groupMapIterator->second.threads.find( threadID );
+		QMX_EXPECT( ( threadPtrMapIterator != groupMapIterator->second.threads.end() ), "QMXStdLib", "ThreadManager::interrupt", "00000023" );
+		threadPtrMapIterator->second->interrupt();
 
-		QMX_ASSERT(
-			( threadPtrMapIterator != groupMapIterator->second.threads.end() ),
-			"QMXStdLib",
-			"ThreadManager::interrupt",
-			"00000023",
-			groupID << ", " << threadID
-		);
+	// Return result to calling routine.
 
-		threadPtrMapIterator->second->interrupt();
+		return Expected< void >();
 }
 
 void ThreadManager::interruptAll( const string& groupID )
+{
+	// Create scoped stack traces.
+
+		SCOPED_STACK_TRACE( "ThreadManager::interruptAll", 0000 );
+
+	// Create local variables.
+
+		Expected< void > result = tryInterruptAll( groupID );
+
+	// Check interrupt result.
+
+		QMX_ASSERT_RESULT( result, groupID );
+}
+
+Expected< void > ThreadManager::tryInterruptAll( const string& groupID )
 {
 	// Obtain locks.
 
@@ -396,7 +463,7 @@ void ThreadManager::interruptAll( const string& groupID )
 
 	// Create scoped stack traces.
 
-		SCOPED_STACK_TRACE( "ThreadManager::interruptAll", 0000 );
+		SCOPED_STACK_TRACE( "ThreadManager::tryInterruptAll", 0000 );
 
 	// Create local variables.
 
@@ -404,10 +471,16 @@ void ThreadManager::interruptAll( const string& groupID )
 
 	// Interrupt all spawned threads for specified group, if it exists.
 
-		QMX_ASSERT( ( groupMapIterator != groups.end() ), "QMXStdLib", "ThreadManager::interruptAll", "00000024", groupID );
+		QMX_EXPECT( ( groupMapIterator != groups.end() ), "QMXStdLib", "ThreadManager::interruptAll", "00000024" );
 
 		for( auto& index : groupMapIterator->second.threads )
 			index.second->interrupt();
+
+		pool->interrupt( groupMapIterator->second.tasks );
+
+	// Return result to calling routine.
+
+		return Expected< void >();
 }
 
 bool ThreadManager::interruptionRequested() const
@@ -438,6 +511,50 @@ uint32_t ThreadManager::getPhysicalCoreCount() const
 		return boost::thread::physical_concurrency();
 }
 
+void ThreadManager::startPool( const uint32_t workerCount )
+{
+	// Obtain locks.
+
+		SCOPED_READ_LOCK;
+
+	// Start the task pool.
+
+		pool->start( workerCount );
+}
+
+void ThreadManager::stopPool( const bool doInterrupt )
+{
+	// Create local variables.
+
+		TaskPool::InstancePtr targetPool;
+
+	// Read Scope
+	{
+		// Obtain locks.
+
+			SCOPED_READ_LOCK;
+
+		// Obtain the task pool.
+
+			targetPool = pool;
+	}
+
+	// Stop the task pool; no lock is held, so that running tasks may still call into the manager.
+
+		targetPool->stop( doInterrupt );
+}
+
+uint32_t ThreadManager::getPoolSize() const
+{
+	// Obtain locks.
+
+		SCOPED_READ_LOCK;
+
+	// Report the number of worker threads in the task pool to calling routine.
+
+		return pool->getWorkerCount();
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Private Methods for the 'ThreadManager' Class
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -447,10 +564,22 @@ ThreadManager::ThreadManager()
 	// Do nothing.
 }
 
+void ThreadManager::allocateImp()
+{
+	// Perform necessary initialization.
+
+		pool = TaskPool::create();
+}
+
 void ThreadManager::deallocateImp()
 {
 	// Perform necessary cleanup.
 
+		if( pool->getWorkerCount() )
+			pool->stop( true, false );
+
+		pool = nullptr;
+
 		if( !groups.empty() )
 		{
 			for( auto& indexA : groups )
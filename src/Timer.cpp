@@ -1,6 +1,6 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Timer.cpp
-// Robert M. Baker | Created : 11JAN12 | Last Modified : 29AUG19 by Robert M. Baker
+// Robert M. Baker | Created : 11JAN12 | Last Modified : 17OCT26 by Robert M. Baker
 // Version : 2.3.0
 // This is a source file for 'QMXStdLib'; it defines the implementation for a timer class.
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -21,7 +21,7 @@
   * @file
   * @author  Robert M. Baker
   * @date    Created : 11JAN12
-  * @date    Last Modified : 29AUG19 by Robert M. Baker
+  * @date    Last Modified : 17OCT26 by Robert M. Baker
   * @version 2.3.0
   *
   * @brief This source file defines the implementation for a timer class.
@@ -49,8 +49,18 @@
 // Header Files
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include <chrono>
+#include <ctime>
+#include <limits>
+
 #include "../include/Timer.hpp"
 
+#if ( defined( __x86_64__ ) || defined( __i386__ ) )
+#	include <cpuid.h>
+#	include <x86intrin.h>
+#	define QMX_TIMER_TSC
+#endif // x86 Headers
+
 using namespace std;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -60,6 +70,123 @@ using namespace std;
 namespace QMXStdLib
 {
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Start of the 'TimerClock' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+  * @brief This is the namespace for reading the clocks a timer can use.
+  */
+
+namespace TimerClock
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Type Definitions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct TscCalibration
+{
+	double period;
+	int64_t baseSteady;
+	uint64_t baseTsc;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Function Definitions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int64_t getSteadyTime()
+{
+	// Return time of the steady clock, in nanoseconds, to calling routine.
+
+		return chrono::duration_cast< chrono::nanoseconds >( chrono::steady_clock::now().time_since_epoch() ).count();
+}
+
+#if defined( QMX_TIMER_TSC )
+void sampleClocks( int64_t& steadyTime, uint64_t& tscTime )
+{
+	// Create local variables.
+
+		uint64_t before = UNSET;
+		uint64_t after = UNSET;
+		uint64_t spread = numeric_limits< uint64_t >::max();
+		int64_t sample = UNSET;
+
+	// Read the steady clock between two readings of the counter, keeping the tightest of several tries so a preemption cannot skew the pair.
+
+		for( size_t index = 0; index < 8; index++ )
+		{
+			before = __rdtsc();
+			sample = getSteadyTime();
+			after = __rdtsc();
+
+			if( ( after - before ) < spread )
+			{
+				spread = ( after - before );
+				steadyTime = sample;
+				tscTime = ( before + ( spread / 2 ) );
+			}
+		}
+}
+#endif // QMX_TIMER_TSC
+
+const TscCalibration& getTscCalibration()
+{
+	// Create local variables.
+
+		static const TscCalibration RESULT = []() {
+			TscCalibration result = { 0.0, UNSET, UNSET };
+
+#if defined( QMX_TIMER_TSC )
+			uint32_t registers[ 4 ] = { UNSET, UNSET, UNSET, UNSET };
+			int64_t steadyEnd = UNSET;
+			uint64_t tscEnd = UNSET;
+
+			// Use the counter only if it is invariant, i.e. it ticks at a constant rate across power states, and calibrate it against the steady clock.
+
+				if(
+					__get_cpuid( 0x80000007, &registers[ 0 ], &registers[ 1 ], &registers[ 2 ], &registers[ 3 ] ) &&
+					( registers[ 3 ] & ( 1u << 8 ) )
+				)
+				{
+					sampleClocks( result.baseSteady, result.baseTsc );
+
+					while( ( getSteadyTime() - result.baseSteady ) < 20000000 );
+						// Empty Loop
+
+					sampleClocks( steadyEnd, tscEnd );
+					result.period = ( static_cast< double >( steadyEnd - result.baseSteady ) / static_cast< double >( tscEnd - result.baseTsc ) );
+				}
+#endif // QMX_TIMER_TSC
+
+			return result;
+		}();
+
+	// Return calibration, with a period of 0 if the counter cannot be used, to calling routine.
+
+		return RESULT;
+}
+
+int64_t getTscTime()
+{
+	// Return time of the time-stamp counter, in nanoseconds since the epoch of the steady clock, to calling routine.
+
+#if defined( QMX_TIMER_TSC )
+		const TscCalibration& calibration = getTscCalibration();
+
+		return ( calibration.baseSteady + static_cast< int64_t >( static_cast< double >( __rdtsc() - calibration.baseTsc ) * calibration.period ) );
+#else
+		return getSteadyTime();
+#endif // QMX_TIMER_TSC
+}
+
+} // 'TimerClock' Namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of the 'TimerClock' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Public Methods for the 'Timer' Class
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -81,13 +208,9 @@ Timer::~Timer()
 
 bool Timer::isRunning() const
 {
-	// Obtain locks.
-
-		SCOPED_READ_LOCK;
-
 	// Report wether or not the timer is running to the calling routine.
 
-		return !localTimer.is_stopped();
+		return running.load();
 }
 
 void Timer::toggle()
@@ -96,12 +219,16 @@ void Timer::toggle()
 
 		SCOPED_WRITE_LOCK;
 
-	// Toggle the timer.
+	// Toggle the timer, making the version odd while the state changes.
+
+		version++;
 
-		if( localTimer.is_stopped() )
-			localTimer.resume();
+		if( running.load() )
+			stopClocks();
 		else
-			localTimer.stop();
+			startClocks();
+
+		version++;
 }
 
 void Timer::reset()
@@ -112,38 +239,210 @@ void Timer::reset()
 
 	// Reset the timer.
 
-		localTimer.start();
-		localTimer.stop();
+		version++;
+		running.store( false );
+		accumulatedTime.store( UNSET );
+		accumulatedCpuTime.store( UNSET );
+		version++;
+}
+
+int64_t Timer::getNanoseconds() const
+{
+	// Create local variables.
+
+		uint64_t before = UNSET;
+		int64_t result = UNSET;
+
+	// Read the accumulated time plus the time since the timer was started, retrying if the timer was toggled meanwhile.
+
+		do
+		{
+			before = version.load( memory_order_acquire );
+			result = accumulatedTime.load( memory_order_relaxed );
+
+			if( running.load( memory_order_relaxed ) )
+				result += ( now( clockSource.load( memory_order_relaxed ) ) - startTime.load( memory_order_relaxed ) );
+
+			atomic_thread_fence( memory_order_acquire );
+		} while( ( before & 1 ) || ( before != version.load( memory_order_relaxed ) ) );
+
+	// Return result to calling routine.
+
+		return result;
 }
 
 real_t Timer::getTime( Timer::TimeUnits units ) const
+{
+	// Return elapsed time, in specified units, to calling routine.
+
+		return( getNanoseconds() / static_cast< real_t >( units ) );
+}
+
+void Timer::setClockSource( Timer::ClockSource source )
 {
 	// Obtain locks.
 
-		SCOPED_READ_LOCK;
+		SCOPED_WRITE_LOCK;
 
-	// Return elapsed time, in specified units, to calling routine.
+	// Switch clocks, keeping time already elapsed.
+
+		if( ( source == TSC ) && !isTscAvailable() )
+			source = STEADY;
+
+		version++;
+
+		if( running.load() )
+		{
+			stopClocks();
+			clockSource.store( source );
+			startClocks();
+		}
+		else
+			clockSource.store( source );
+
+		version++;
+}
+
+Timer::ClockSource Timer::getClockSource() const
+{
+	// Return clock the timer reads to calling routine.
+
+		return clockSource.load();
+}
+
+void Timer::setCpuTimeEnabled( const bool isEnabled )
+{
+	// Obtain locks.
+
+		SCOPED_WRITE_LOCK;
+
+	// Enable or disable CPU time measurement, keeping CPU time already measured.
+
+		if( isEnabled == cpuTimeEnabled.load() )
+			return;
+
+		version++;
+
+		if( running.load() )
+		{
+			if( isEnabled )
+				cpuStartTime.store( getProcessCpuTime() );
+			else
+				accumulatedCpuTime += ( getProcessCpuTime() - cpuStartTime.load() );
+		}
+
+		cpuTimeEnabled.store( isEnabled );
+		version++;
+}
+
+bool Timer::isCpuTimeEnabled() const
+{
+	// Report wether or not CPU time is measured to calling routine.
+
+		return cpuTimeEnabled.load();
+}
+
+int64_t Timer::getCpuNanoseconds() const
+{
+	// Create local variables.
+
+		uint64_t before = UNSET;
+		int64_t result = UNSET;
 
-		return( localTimer.elapsed().wall / static_cast< real_t >( units ) );
+	// Read the accumulated CPU time plus the CPU time since the timer was started, retrying if the timer was toggled meanwhile.
+
+		do
+		{
+			before = version.load( memory_order_acquire );
+			result = accumulatedCpuTime.load( memory_order_relaxed );
+
+			if( running.load( memory_order_relaxed ) && cpuTimeEnabled.load( memory_order_relaxed ) )
+				result += ( getProcessCpuTime() - cpuStartTime.load( memory_order_relaxed ) );
+
+			atomic_thread_fence( memory_order_acquire );
+		} while( ( before & 1 ) || ( before != version.load( memory_order_relaxed ) ) );
+
+	// Return result to calling routine.
+
+		return result;
+}
+
+int64_t Timer::now( Timer::ClockSource source )
+{
+	// Return time of specified clock to calling routine.
+
+		return ( ( ( source == TSC ) && isTscAvailable() ) ? TimerClock::getTscTime() : TimerClock::getSteadyTime() );
+}
+
+bool Timer::isTscAvailable()
+{
+	// Report wether or not the time-stamp counter was calibrated to calling routine.
+
+		return ( TimerClock::getTscCalibration().period > 0.0 );
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Private Methods for the 'Timer' Class
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-Timer::Timer()
+Timer::Timer() : version( UNSET ), running( false ), clockSource( STEADY ), startTime( UNSET ), accumulatedTime( UNSET ), cpuTimeEnabled( false ),
+	cpuStartTime( UNSET ), accumulatedCpuTime( UNSET )
 {
-	// Initialize fields.
-
-		localTimer.start();
-		localTimer.stop();
+	// Do nothing.
 }
 
 void Timer::cloneImp( Timer::InstancePtr& target ) const
 {
 	// Assign data of 'this' to specified object.
 
-		target->localTimer = localTimer;
+		target->version++;
+		target->running.store( running.load() );
+		target->clockSource.store( clockSource.load() );
+		target->startTime.store( startTime.load() );
+		target->accumulatedTime.store( accumulatedTime.load() );
+		target->cpuTimeEnabled.store( cpuTimeEnabled.load() );
+		target->cpuStartTime.store( cpuStartTime.load() );
+		target->accumulatedCpuTime.store( accumulatedCpuTime.load() );
+		target->version++;
+}
+
+void Timer::stopClocks()
+{
+	// Fold the time since the clocks were started into the accumulated times.
+
+		accumulatedTime += ( now( clockSource.load() ) - startTime.load() );
+
+		if( cpuTimeEnabled.load() )
+			accumulatedCpuTime += ( getProcessCpuTime() - cpuStartTime.load() );
+
+		running.store( false );
+}
+
+void Timer::startClocks()
+{
+	// Record the time the clocks were started.
+
+		startTime.store( now( clockSource.load() ) );
+
+		if( cpuTimeEnabled.load() )
+			cpuStartTime.store( getProcessCpuTime() );
+
+		running.store( true );
+}
+
+int64_t Timer::getProcessCpuTime()
+{
+	// Return CPU time of the process to calling routine.
+
+#if ( QMX_PLATFORM == QMX_PLATFORM_LINUX )
+		timespec result;
+
+		clock_gettime( CLOCK_PROCESS_CPUTIME_ID, &result );
+
+		return ( ( static_cast< int64_t >( result.tv_sec ) * 1000000000 ) + result.tv_nsec );
+#else
+		return static_cast< int64_t >( ( static_cast< double >( clock() ) * 1000000000.0 ) / CLOCKS_PER_SEC );
+#endif // Platform CPU Time
 }
 
 } // 'QMXStdLib' Namespace
@@ -0,0 +1,702 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// TraceLog.cpp
+// Robert M. Baker | Created : 17OCT26 | Last Modified : 17OCT26 by Robert M. Baker
+// Version : 2.3.0
+// This is a source file for 'QMXStdLib'; it defines the implementation for a structured binary trace log class.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+//
+// This file is part of 'QMXStdLib'.
+//
+// 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option) any later version.
+//
+// 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+  * @file
+  * @author  Robert M. Baker
+  * @date    Created : 17OCT26
+  * @date    Last Modified : 17OCT26 by Robert M. Baker
+  * @version 2.3.0
+  *
+  * @brief This source file defines the implementation for a structured binary trace log class.
+  *
+  * @section TraceLogS0000 Description
+  *
+  * This source file defines the implementation for a structured binary trace log class.
+  *
+  * @section TraceLogS0001 License
+  *
+  * Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+  *
+  * This file is part of 'QMXStdLib'.
+  *
+  * 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+  * Software Foundation, either version 3 of the License, or (at your option) any later version.
+  *
+  * 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+  * A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+  *
+  * You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+  */
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Header Files
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <chrono>
+#include <ctime>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "../include/MappedFile.hpp"
+#include "../include/QMXException.hpp"
+#include "../include/Timer.hpp"
+#include "../include/TraceLog.hpp"
+
+#if ( QMX_PLATFORM != QMX_PLATFORM_WINDOWS )
+#	include <unistd.h>
+#endif // Platform Headers
+
+#if ( QMX_PLATFORM == QMX_PLATFORM_LINUX )
+#	include <sys/syscall.h>
+#endif // Thread ID Headers
+
+using namespace std;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Start of the 'QMXStdLib' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace QMXStdLib
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Start of the 'TraceFile' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+  * @brief This is the namespace for the layout and mapping of trace log files.
+  *
+  * A trace log file begins with a page holding the header, followed by the format table and the ring of records.  The format table holds an entry for each
+  * registered format string: its ID, its length, and its characters.  A writer claims a slot by incrementing the write position of the header, clears the
+  * sequence of the record in it, fills in the record along with a checksum of its sequence and contents, and then stores the sequence, which is one more
+  * than the write position it claimed.  A record is only valid if its sequence maps back to its own slot and its checksum matches, so one left half-written
+  * by a crash is skipped, as is one torn by two writers a full lap of the ring apart which claimed the same slot at the same time.
+  */
+
+namespace TraceFile
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Type Definitions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct Header
+{
+	char signature[ 8 ];
+	uint32_t version;
+	uint32_t recordSize;
+	uint64_t recordCount;
+	uint64_t formatTableOffset;
+	uint64_t formatTableSize;
+	uint64_t formatTableUsed;
+	uint64_t recordOffset;
+	int64_t steadyBase;
+	int64_t systemBase;
+	uint64_t processID;
+	uint64_t writePosition;
+};
+
+struct Record
+{
+	uint64_t sequence;
+	int64_t timestamp;
+	uint32_t threadID;
+	uint32_t formatID;
+	uint8_t level;
+	uint8_t argumentCount;
+	uint16_t argumentTypes;
+	uint32_t checksum;
+	uint64_t arguments[ TraceLog::MAX_ARGUMENTS ];
+};
+
+struct Mapping
+{
+	Mapping() : base( nullptr ), header( nullptr ), records( nullptr ), mask( UNSET )
+	{
+		// Do nothing.
+	}
+
+	MappedFile::InstancePtr file;
+	char* base;
+	Header* header;
+	Record* records;
+	uint64_t mask;
+};
+
+static_assert( ( sizeof( Record ) == 64 ), "A trace log record must fill exactly one cache line." );
+static_assert( ( ( TraceLog::MAX_ARGUMENTS * 4 ) <= 16 ), "The argument types of a trace log record must fit in sixteen bits." );
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Global Variables
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const char SIGNATURE[] = { 'Q', 'M', 'X', 'T', 'R', 'A', 'C', 'E' };
+const uint32_t VERSION = 2;
+const size_t HEADER_SIZE = 4096;
+const size_t FORMAT_TABLE_SIZE = 65536;
+const size_t FORMAT_ENTRY_SIZE = ( sizeof( uint32_t ) * 2 );
+const char* const LEVEL_NAMES[] = { "DEBUG", "INFO", "WARNING", "ERROR", "FATAL" };
+atomic< Mapping* > activeMapping = { nullptr };
+atomic< size_t > activeWriters = { 0 };
+atomic< uint32_t > nextThreadID = { 1 };
+thread_local uint32_t threadID = UNSET;
+boost::mutex controlMutex;
+vector< string > formats;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Function Definitions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+uint32_t getChecksum(
+	const uint64_t sequence,
+	const int64_t timestamp,
+	const uint32_t threadID,
+	const uint32_t formatID,
+	const uint8_t level,
+	const uint8_t argumentCount,
+	const uint16_t argumentTypes,
+	const uint64_t* arguments
+)
+{
+	// Create local variables.
+
+		uint64_t result = ( sequence * 0x9E3779B97F4A7C15ULL );
+		const uint64_t words[] = {
+			static_cast< uint64_t >( timestamp ),
+			( ( static_cast< uint64_t >( threadID ) << 32 ) | formatID ),
+			( level | ( static_cast< uint64_t >( argumentCount ) << 8 ) | ( static_cast< uint64_t >( argumentTypes ) << 16 ) ),
+			arguments[ 0 ],
+			arguments[ 1 ],
+			arguments[ 2 ],
+			arguments[ 3 ]
+		};
+
+		static_assert( ( TraceLog::MAX_ARGUMENTS == 4 ), "The trace log record checksum covers exactly four arguments." );
+
+	// Fold every word of the record into the sequence with a multiply-xorshift step.
+
+		for( uint64_t word : words )
+		{
+			result = ( ( result ^ word ) * 0xFF51AFD7ED558CCDULL );
+			result ^= ( result >> 32 );
+		}
+
+	// Return result to calling routine.
+
+		return static_cast< uint32_t >( result );
+}
+
+uint32_t getThreadID()
+{
+	// Assign the ID of the current thread on first use; on Linux, it is the ID the kernel reports for the thread.
+
+		if( !threadID )
+		{
+#if ( QMX_PLATFORM == QMX_PLATFORM_LINUX )
+			threadID = static_cast< uint32_t >( syscall( SYS_gettid ) );
+#else
+			threadID = nextThreadID++;
+#endif // Thread ID
+		}
+
+	// Return result to calling routine.
+
+		return threadID;
+}
+
+void appendFormat( Mapping* mapping, const uint32_t formatID, const string& format )
+{
+	// Create local variables.
+
+		Header* header = mapping->header;
+		uint64_t used = header->formatTableUsed;
+		uint32_t length = static_cast< uint32_t >( format.size() );
+		char* entry = ( mapping->base + header->formatTableOffset + used );
+
+	// Perform abort check; once the table is full, records using further format strings are decoded without them.
+
+		if( ( used + FORMAT_ENTRY_SIZE + length ) > header->formatTableSize )
+			return;
+
+	// Write the entry, then publish it by advancing the used size of the table.
+
+		memcpy( entry, &formatID, sizeof( formatID ) );
+		memcpy( ( entry + sizeof( formatID ) ), &length, sizeof( length ) );
+		memcpy( ( entry + FORMAT_ENTRY_SIZE ), format.data(), length );
+		__atomic_store_n( &header->formatTableUsed, ( used + FORMAT_ENTRY_SIZE + length ), __ATOMIC_RELEASE );
+}
+
+void writeTime( ostream& target, const int64_t nanoseconds )
+{
+	// Create local variables.
+
+		time_t seconds = static_cast< time_t >( nanoseconds / 1000000000 );
+		int64_t fraction = ( nanoseconds % 1000000000 );
+		tm calendar;
+
+	// Write time as UTC with nanosecond precision.
+
+		if( fraction < 0 )
+		{
+			seconds--;
+			fraction += 1000000000;
+		}
+
+#if ( QMX_PLATFORM != QMX_PLATFORM_WINDOWS )
+		gmtime_r( &seconds, &calendar );
+#else
+		gmtime_s( &calendar, &seconds );
+#endif // Platform Time
+
+		target << put_time( &calendar, "%Y-%m-%d %H:%M:%S" ) << '.' << setfill( '0' ) << setw( 9 ) << fraction << setfill( ' ' );
+}
+
+void writeArgument( ostream& target, const uint64_t value, const uint32_t type )
+{
+	// Create local variables.
+
+		double floatValue = 0.0;
+
+	// Write argument based on its type.
+
+		switch( static_cast< TraceLog::ArgumentType >( type ) )
+		{
+			case TraceLog::SIGNED_ARGUMENT:
+			{
+				target << static_cast< int64_t >( value );
+
+				break;
+			}
+
+			case TraceLog::UNSIGNED_ARGUMENT:
+			{
+				target << value;
+
+				break;
+			}
+
+			case TraceLog::FLOAT_ARGUMENT:
+			{
+				memcpy( &floatValue, &value, sizeof( floatValue ) );
+				target << floatValue;
+
+				break;
+			}
+
+			case TraceLog::CHARACTER_ARGUMENT:
+			{
+				target << static_cast< char >( value );
+
+				break;
+			}
+
+			case TraceLog::BOOLEAN_ARGUMENT:
+			{
+				target << ( value ? "true" : "false" );
+
+				break;
+			}
+
+			case TraceLog::POINTER_ARGUMENT:
+			{
+				target << "0x" << hex << value << dec;
+
+				break;
+			}
+
+			default:
+			{
+				target << '?';
+
+				break;
+			}
+		}
+}
+
+void writeRecord( ostream& target, const Header& header, const Record& record, const map< uint32_t, string >& formatTable )
+{
+	// Create local variables.
+
+		auto format = formatTable.find( record.formatID );
+		size_t argumentCount = min< size_t >( record.argumentCount, TraceLog::MAX_ARGUMENTS );
+		size_t argument = UNSET;
+		size_t start = UNSET;
+		size_t marker = UNSET;
+
+	// Write time, thread ID, and level.
+
+		writeTime( target, ( header.systemBase + ( record.timestamp - header.steadyBase ) ) );
+		target << ' ' << setw( 7 ) << record.threadID << ' ' << left << setw( 7 );
+
+		if( record.level < TraceLog::LEVEL_COUNT )
+			target << LEVEL_NAMES[ record.level ];
+		else
+			target << static_cast< uint32_t >( record.level );
+
+		target << right << ' ';
+
+	// Write message, replacing each '{}' with the next argument; without its format string, write the arguments alone.
+
+		if( format != formatTable.end() )
+		{
+			while( ( marker = format->second.find( "{}", start ) ) != string::npos )
+			{
+				if( argument == argumentCount )
+					break;
+
+				target.write( ( format->second.data() + start ), ( marker - start ) );
+				writeArgument( target, record.arguments[ argument ], ( ( record.argumentTypes >> ( argument * 4 ) ) & 0xF ) );
+				argument++;
+				start = ( marker + 2 );
+			}
+
+			target.write( ( format->second.data() + start ), ( format->second.size() - start ) );
+		}
+		else
+		{
+			target << "<unknown format " << record.formatID << '>';
+		}
+
+		for( ; argument < argumentCount; argument++ )
+		{
+			target << ' ';
+			writeArgument( target, record.arguments[ argument ], ( ( record.argumentTypes >> ( argument * 4 ) ) & 0xF ) );
+		}
+
+		target << '\n';
+}
+
+} // 'TraceFile' Namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of the 'TraceFile' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Public Methods for the 'TraceLog' Class
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void TraceLog::open( const string& path, const size_t capacity )
+{
+	// Obtain locks.
+
+		boost::lock_guard< boost::mutex > lock( TraceFile::controlMutex );
+
+	// Create scoped stack traces.
+
+		SCOPED_STACK_TRACE( "TraceLog::open", 0000 );
+
+	// Create local variables.
+
+		uint64_t recordCount = 2;
+		unique_ptr< TraceFile::Mapping > mapping( new TraceFile::Mapping() );
+		TraceFile::Header* header = nullptr;
+
+	// Create and map the file, then initialize its header and store every registered format string.
+
+		QMX_ASSERT( !TraceFile::activeMapping.load(), "QMXStdLib", "TraceLog::open", "00000039", path );
+
+		while( recordCount < capacity )
+			recordCount <<= 1;
+
+		mapping->mask = ( recordCount - 1 );
+
+		try
+		{
+			mapping->file = MappedFile::create();
+			mapping->file->open( path, MappedFile::READ_WRITE );
+			mapping->file->resize( UNSET );
+			mapping->file->resize( TraceFile::HEADER_SIZE + TraceFile::FORMAT_TABLE_SIZE + ( recordCount * sizeof( TraceFile::Record ) ) );
+		}
+		catch( const QMXException& except )
+		{
+			QMX_THROW( "QMXStdLib", "TraceLog::open", "0000003B", path );
+		}
+
+		mapping->base = mapping->file->getView< char >().data();
+		header = reinterpret_cast< TraceFile::Header* >( mapping->base );
+		mapping->header = header;
+		mapping->records = reinterpret_cast< TraceFile::Record* >( mapping->base + TraceFile::HEADER_SIZE + TraceFile::FORMAT_TABLE_SIZE );
+		header->version = TraceFile::VERSION;
+		header->recordSize = sizeof( TraceFile::Record );
+		header->recordCount = recordCount;
+		header->formatTableOffset = TraceFile::HEADER_SIZE;
+		header->formatTableSize = TraceFile::FORMAT_TABLE_SIZE;
+		header->formatTableUsed = UNSET;
+		header->recordOffset = ( TraceFile::HEADER_SIZE + TraceFile::FORMAT_TABLE_SIZE );
+		header->steadyBase = Timer::now( Timer::TSC );
+		header->systemBase = chrono::duration_cast< chrono::nanoseconds >( chrono::system_clock::now().time_since_epoch() ).count();
+#if ( QMX_PLATFORM != QMX_PLATFORM_WINDOWS )
+		header->processID = static_cast< uint64_t >( getpid() );
+#endif // Platform Process ID
+		header->writePosition = UNSET;
+		memcpy( header->signature, TraceFile::SIGNATURE, sizeof( TraceFile::SIGNATURE ) );
+
+		for( size_t index = 0; index < TraceFile::formats.size(); index++ )
+			TraceFile::appendFormat( mapping.get(), static_cast< uint32_t >( index ), TraceFile::formats[ index ] );
+
+		TraceFile::activeMapping.store( mapping.release() );
+		isEnabled.store( true, memory_order_release );
+}
+
+void TraceLog::close()
+{
+	// Obtain locks.
+
+		boost::lock_guard< boost::mutex > lock( TraceFile::controlMutex );
+
+	// Create scoped stack traces.
+
+		SCOPED_STACK_TRACE( "TraceLog::close", 0000 );
+
+	// Create local variables.
+
+		unique_ptr< TraceFile::Mapping > mapping;
+
+	// Stop directing records to the file, wait for records being written, then unmap it.
+
+		QMX_ASSERT( TraceFile::activeMapping.load(), "QMXStdLib", "TraceLog::close", "0000003A", "" );
+		isEnabled.store( false, memory_order_release );
+		mapping.reset( TraceFile::activeMapping.exchange( nullptr ) );
+
+		while( TraceFile::activeWriters.load() )
+			boost::this_thread::yield();
+}
+
+void TraceLog::flush()
+{
+	// Obtain locks.
+
+		boost::lock_guard< boost::mutex > lock( TraceFile::controlMutex );
+
+	// Create local variables.
+
+		TraceFile::Mapping* mapping = TraceFile::activeMapping.load();
+
+	// Write the mapped file to storage; holding the control mutex keeps the mapping alive meanwhile.
+
+		if( mapping )
+			mapping->file->flush();
+}
+
+uint32_t TraceLog::registerFormat( const string& format )
+{
+	// Obtain locks.
+
+		boost::lock_guard< boost::mutex > lock( TraceFile::controlMutex );
+
+	// Create local variables.
+
+		uint32_t result = static_cast< uint32_t >( TraceFile::formats.size() );
+		TraceFile::Mapping* mapping = TraceFile::activeMapping.load();
+
+	// Register format string and store it in the open file, if any.
+
+		TraceFile::formats.push_back( format );
+
+		if( mapping )
+			TraceFile::appendFormat( mapping, result, format );
+
+	// Return result to calling routine.
+
+		return result;
+}
+
+size_t TraceLog::decode( const string& path, ostream& target )
+{
+	// Create scoped stack traces.
+
+		SCOPED_STACK_TRACE( "TraceLog::decode", 0000 );
+
+	// Create local variables.
+
+		size_t result = UNSET;
+		MappedFile::InstancePtr source = MappedFile::create();
+		MappedFile::View< const char > data;
+		TraceFile::Header header;
+		map< uint32_t, string > formatTable;
+		vector< TraceFile::Record > records;
+		TraceFile::Record record;
+		uint64_t offset = UNSET;
+		uint64_t formatTableEnd = UNSET;
+		uint32_t formatID = UNSET;
+		uint32_t length = UNSET;
+
+	// Map the file and validate its header.
+
+		try
+		{
+			source->open( path );
+			source->advise( MappedFile::SEQUENTIAL_ACCESS );
+			data = source->getView();
+		}
+		catch( const QMXException& except )
+		{
+			QMX_THROW( "QMXStdLib", "TraceLog::decode", "0000003B", path );
+		}
+
+		QMX_ASSERT( ( data.size() >= sizeof( header ) ), "QMXStdLib", "TraceLog::decode", "0000003C", path );
+		memcpy( &header, data.data(), sizeof( header ) );
+		QMX_ASSERT(
+			(
+				!memcmp( header.signature, TraceFile::SIGNATURE, sizeof( TraceFile::SIGNATURE ) ) &&
+				( header.version == TraceFile::VERSION ) &&
+				( header.recordSize == sizeof( TraceFile::Record ) ) &&
+				header.recordCount &&
+				!( header.recordCount & ( header.recordCount - 1 ) ) &&
+				( header.formatTableOffset <= data.size() ) &&
+				( header.formatTableSize <= ( data.size() - header.formatTableOffset ) ) &&
+				( header.recordOffset <= data.size() ) &&
+				( header.recordCount <= ( ( data.size() - header.recordOffset ) / sizeof( TraceFile::Record ) ) )
+			),
+			"QMXStdLib",
+			"TraceLog::decode",
+			"0000003C",
+			path
+		);
+
+	// Read the format table, stopping at its used size.
+
+		offset = header.formatTableOffset;
+		formatTableEnd = ( header.formatTableOffset + min( header.formatTableUsed, header.formatTableSize ) );
+
+		while( ( formatTableEnd - offset ) >= TraceFile::FORMAT_ENTRY_SIZE )
+		{
+			memcpy( &formatID, ( data.data() + offset ), sizeof( formatID ) );
+			memcpy( &length, ( data.data() + offset + sizeof( formatID ) ), sizeof( length ) );
+			offset += TraceFile::FORMAT_ENTRY_SIZE;
+
+			if( length > ( formatTableEnd - offset ) )
+				break;
+
+			formatTable[ formatID ].assign( ( data.data() + offset ), length );
+			offset += length;
+		}
+
+	// Collect every record whose sequence maps back to its slot and whose checksum matches, order them by sequence, and render them.
+
+		for( uint64_t index = 0; index < header.recordCount; index++ )
+		{
+			memcpy( &record, ( data.data() + header.recordOffset + ( index * sizeof( record ) ) ), sizeof( record ) );
+
+			if(
+				record.sequence &&
+				( ( ( record.sequence - 1 ) & ( header.recordCount - 1 ) ) == index ) &&
+				( record.checksum == TraceFile::getChecksum(
+					record.sequence,
+					record.timestamp,
+					record.threadID,
+					record.formatID,
+					record.level,
+					record.argumentCount,
+					record.argumentTypes,
+					record.arguments
+				) )
+			)
+				records.push_back( record );
+		}
+
+		sort(
+			records.begin(),
+			records.end(),
+			[]( const TraceFile::Record& first, const TraceFile::Record& second ) {
+				return ( first.sequence < second.sequence );
+			}
+		);
+
+		for( const auto& element : records )
+		{
+			TraceFile::writeRecord( target, header, element, formatTable );
+			result++;
+		}
+
+	// Return result to calling routine.
+
+		return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private Methods for the 'TraceLog' Class
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void TraceLog::writeRecord( const TraceLog::Level level, const uint32_t formatID, const uint64_t* values, const uint32_t types, const size_t count )
+{
+	// Create local variables.
+
+		TraceFile::Mapping* mapping = nullptr;
+		TraceFile::Record* record = nullptr;
+		uint64_t position = UNSET;
+		int64_t timestamp = UNSET;
+		uint32_t threadID = UNSET;
+
+	// Register as a writer, so the mapping cannot be released under this call.
+
+		TraceFile::activeWriters++;
+		mapping = TraceFile::activeMapping.load();
+
+		if( !mapping )
+		{
+			TraceFile::activeWriters--;
+
+			return;
+		}
+
+	// Claim a slot, invalidate it, fill in the record and its checksum, and then publish its sequence; the checksum is computed from the values written
+	// rather than read back, since another writer may share the slot.
+
+		timestamp = Timer::now( Timer::TSC );
+		threadID = TraceFile::getThreadID();
+		position = __atomic_fetch_add( &mapping->header->writePosition, 1, __ATOMIC_RELAXED );
+		record = ( mapping->records + ( position & mapping->mask ) );
+		__atomic_store_n( &record->sequence, UNSET, __ATOMIC_RELAXED );
+		atomic_thread_fence( memory_order_release );
+		record->timestamp = timestamp;
+		record->threadID = threadID;
+		record->formatID = formatID;
+		record->level = static_cast< uint8_t >( level );
+		record->argumentCount = static_cast< uint8_t >( count );
+		record->argumentTypes = static_cast< uint16_t >( types );
+		memcpy( record->arguments, values, sizeof( record->arguments ) );
+		record->checksum = TraceFile::getChecksum(
+			( position + 1 ),
+			timestamp,
+			threadID,
+			formatID,
+			static_cast< uint8_t >( level ),
+			static_cast< uint8_t >( count ),
+			static_cast< uint16_t >( types ),
+			values
+		);
+		__atomic_store_n( &record->sequence, ( position + 1 ), __ATOMIC_RELEASE );
+		TraceFile::activeWriters--;
+}
+
+} // 'QMXStdLib' Namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of the 'QMXStdLib' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of 'TraceLog.cpp'
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1,6 +1,6 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // ConsoleIOTest.hpp
-// Robert M. Baker | Created : 30JAN12 | Last Modified : 29AUG19 by Robert M. Baker
+// Robert M. Baker | Created : 30JAN12 | Last Modified : 17OCT26 by Robert M. Baker
 // Version : 2.3.0
 // This is a header file for 'QMXStdLibTest'; it defines a set of unit tests for the 'QMXStdLib::ConsoleIO' class.
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -24,12 +24,16 @@
 // Header Files
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include <cstdio>
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <vector>
 #include <gtest/gtest.h>
+#include <unistd.h>
 
 #include "../../include/ConsoleIO.hpp"
+#include "../../include/QMXException.hpp"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Static Macros
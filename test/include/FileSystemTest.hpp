@@ -1,6 +1,6 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // FileSystemTest.hpp
-// Robert M. Baker | Created : 12MAR12 | Last Modified : 29AUG19 by Robert M. Baker
+// Robert M. Baker | Created : 12MAR12 | Last Modified : 17OCT26 by Robert M. Baker
 // Version : 2.3.0
 // This is a header file for 'QMXStdLibTest'; it defines a set of unit tests for the 'QMXStdLib::FileSystem' functions.
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -36,6 +36,7 @@
 #include <cstdlib>
 #include <sstream>
 #include <string>
+#include <boost/filesystem/fstream.hpp>
 #include <gtest/gtest.h>
 
 #include "../../include/QMXException.hpp"
@@ -1,6 +1,6 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // NumericTest.hpp
-// Robert M. Baker | Created : 10FEB12 | Last Modified : 29AUG19 by Robert M. Baker
+// Robert M. Baker | Created : 10FEB12 | Last Modified : 17OCT26 by Robert M. Baker
 // Version : 2.3.0
 // This is a header file for 'QMXStdLibTest'; it defines a set of unit tests for the 'QMXStdLib::Numeric' functions.
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -24,9 +24,16 @@
 // Header Files
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include <bitset>
+#include <iomanip>
+#include <initializer_list>
+#include <limits>
+#include <sstream>
 #include <string>
+#include <typeinfo>
 #include <gtest/gtest.h>
 
+#include "../../include/Expected.hpp"
 #include "../../include/QMXException.hpp"
 #include "../../include/Mixins/Stringizable.hpp"
 #include "../../include/Numeric.hpp"
@@ -1,6 +1,6 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // StringTest.hpp
-// Robert M. Baker | Created : 20FEB12 | Last Modified : 29AUG19 by Robert M. Baker
+// Robert M. Baker | Created : 20FEB12 | Last Modified : 17OCT26 by Robert M. Baker
 // Version : 2.3.0
 // This is a header file for 'QMXStdLibTest'; it defines a set of unit tests for the 'QMXStdLib::String' functions.
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -26,10 +26,15 @@
 
 #include <limits>
 #include <locale>
+#include <random>
 #include <string>
+#include <string_view>
+#include <vector>
 #include <boost/locale.hpp>
 #include <gtest/gtest.h>
 
+#include "../../include/Expected.hpp"
+#include "../../include/QMXException.hpp"
 #include "../../include/Mixins/Stringizable.hpp"
 #include "../../include/String.hpp"
 
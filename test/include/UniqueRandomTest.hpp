@@ -1,6 +1,6 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // UniqueRandomTest.hpp
-// Robert M. Baker | Created : 10FEB12 | Last Modified : 29AUG19 by Robert M. Baker
+// Robert M. Baker | Created : 10FEB12 | Last Modified : 17OCT26 by Robert M. Baker
 // Version : 2.3.0
 // This is a header file for 'QMXStdLibTest'; it defines a set of unit tests for the 'QMXStdLib::UniqueRandom' functions.
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -24,9 +24,13 @@
 // Header Files
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include <cmath>
+#include <limits>
 #include <set>
+#include <vector>
 #include <gtest/gtest.h>
 
+#include "../../include/QMXException.hpp"
 #include "../../include/Utility.hpp"
 #include "../../include/UniqueRandom.hpp"
 
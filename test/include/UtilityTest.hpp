@@ -1,6 +1,6 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // UtilityTest.hpp
-// Robert M. Baker | Created : 22FEB12 | Last Modified : 29AUG19 by Robert M. Baker
+// Robert M. Baker | Created : 22FEB12 | Last Modified : 17OCT26 by Robert M. Baker
 // Version : 2.3.0
 // This is a header file for 'QMXStdLibTest'; it defines a set of unit tests for the 'QMXStdLib::Utility' class.
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -24,9 +24,13 @@
 // Header Files
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
+#include <chrono>
 #include <ctime>
+#include <limits>
 #include <locale>
 #include <sstream>
+#include <thread>
 #include <vector>
 #include <boost/locale.hpp>
 #include <gtest/gtest.h>
@@ -0,0 +1,209 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// AtomicSequencerTest.cpp
+// Robert M. Baker | Created : 16OCT26 | Last Modified : 17OCT26 by Robert M. Baker
+// Version : 2.3.0
+// This is a source file for 'QMXStdLibTest'; it defines a set of unit tests for the 'QMXStdLib::AtomicSequencer' class.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+//
+// This file is part of 'QMXStdLib'.
+//
+// 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option) any later version.
+//
+// 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Header Files
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../include/AtomicSequencerTest.hpp"
+
+using namespace std;
+using namespace QMXStdLib;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Start of the 'AtomicSequencerTest' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace AtomicSequencerTest
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Function Definitions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void createPair( const SequencerProperties< int32_t >& source, Sequencer< int32_t >::InstancePtr& expected, AtomicSequencer< int32_t >::InstancePtr& actual )
+{
+	// Create a 'Sequencer' to serve as the reference implementation, and an 'AtomicSequencer' with identical properties.
+
+		expected = Sequencer< int32_t >::create();
+		actual = AtomicSequencer< int32_t >::create();
+		expected->set( source );
+		actual->set( source );
+}
+
+void forEachConfiguration( const function< void( const SequencerProperties< int32_t >& ) >& callback )
+{
+	// Create local variables.
+
+		const int32_t values[] = { -3, 0, 3, 7, 9 };
+		const int32_t steps[] = { 1, 2, 3, 10 };
+
+	// Invoke the specified callback for every combination of mode, looping, step, and starting value.
+
+		for( int mode = Sequencer< int32_t >::LINEAR; mode <= Sequencer< int32_t >::OSCILLATE; mode++ )
+		{
+			for( int looped = 0; looped < 2; looped++ )
+			{
+				for( auto step : steps )
+				{
+					for( auto value : values )
+						callback( { ( looped != 0 ), mode, 0, 7, step, value } );
+				}
+			}
+		}
+}
+
+void countValues( AtomicSequencer< int32_t >* target, atomic< size_t >* counts )
+{
+	// Step the shared sequencer, counting every value this thread was handed.
+
+		for( size_t index = 0; index < ITERATION_COUNT; index++ )
+			counts[ target->fetchAdvance( 1 ) ].fetch_add( 1 );
+}
+
+} // 'AtomicSequencerTest' Namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of the 'AtomicSequencerTest' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// 'QMXStdLib::AtomicSequencer' Test Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST( AtomicSequencerTest, SetWorks )
+{
+	// Create local variables.
+
+		AtomicSequencer< int32_t >::InstancePtr instance = AtomicSequencer< int32_t >::create();
+		SequencerProperties< int32_t > result;
+
+	// Perform unit test for 'set' and 'get' methods.
+
+		instance->set( { true, AtomicSequencer< int32_t >::LINEAR, -4, 4, 2, 1 } );
+		instance->get( result );
+		ASSERT_TRUE( result.isLooped );
+		ASSERT_EQ( AtomicSequencer< int32_t >::LINEAR, result.sequenceMode );
+		ASSERT_EQ( -4, result.minimum );
+		ASSERT_EQ( 4, result.maximum );
+		ASSERT_EQ( 2, result.step );
+		ASSERT_EQ( 1, result.value );
+		(*instance)++;
+		instance->get( result );
+		ASSERT_EQ( 3, result.value );
+		ASSERT_THROW( instance->set( { true, AtomicSequencer< int32_t >::LINEAR, -4, 4, 0, 1 } ), QMXException );
+		ASSERT_THROW( instance->set( { true, AtomicSequencer< int32_t >::LINEAR, 4, -4, 2, 1 } ), QMXException );
+		ASSERT_EQ( 3, instance->getValue() );
+}
+
+TEST( AtomicSequencerTest, OperatorsMatchSequencer )
+{
+	// Perform unit test for 'operator++( int )' and 'operator--( int )' methods, using 'Sequencer' as the reference implementation.
+
+		AtomicSequencerTest::forEachConfiguration( []( const SequencerProperties< int32_t >& source ) {
+			Sequencer< int32_t >::InstancePtr expected;
+			AtomicSequencer< int32_t >::InstancePtr actual;
+
+			AtomicSequencerTest::createPair( source, expected, actual );
+
+			for( size_t index = 0; index < 40; index++ )
+			{
+				ASSERT_EQ( expected->getValue(), actual->getValue() );
+				(*expected)++;
+				(*actual)++;
+			}
+
+			for( size_t index = 0; index < 40; index++ )
+			{
+				ASSERT_EQ( expected->getValue(), actual->getValue() );
+				(*expected)--;
+				(*actual)--;
+			}
+		} );
+}
+
+TEST( AtomicSequencerTest, FetchAdvanceWorks )
+{
+	// Perform unit test for 'fetchAdvance' method, using 'Sequencer' as the reference implementation.
+
+		AtomicSequencerTest::forEachConfiguration( []( const SequencerProperties< int32_t >& source ) {
+			Sequencer< int32_t >::InstancePtr expected;
+			AtomicSequencer< int32_t >::InstancePtr actual;
+
+			AtomicSequencerTest::createPair( source, expected, actual );
+
+			for( uint64_t count = 0; count < 24; count++ )
+			{
+				ASSERT_EQ( expected->getValue(), actual->fetchAdvance( count ) );
+
+				for( uint64_t index = 0; index < count; index++ )
+					(*expected)++;
+			}
+
+			ASSERT_EQ( expected->getValue(), actual->getValue() );
+		} );
+
+	// Verify very large counts are reduced by the sequence period.
+
+		{
+			AtomicSequencer< uint8_t >::InstancePtr instance = AtomicSequencer< uint8_t >::create();
+
+			instance->set( { true, AtomicSequencer< uint8_t >::LINEAR, 0, 7, 2, 0 } );
+			ASSERT_EQ( 0, instance->fetchAdvance( 1000000000000ull ) );
+			ASSERT_EQ( 0, instance->getValue() );
+			instance->fetchAdvance( 1000000000003ull );
+			ASSERT_EQ( 6, instance->getValue() );
+			instance->set( { true, AtomicSequencer< uint8_t >::OSCILLATE, 0, 4, 1, 0 } );
+			instance->fetchAdvance( 8000000000005ull );
+			ASSERT_EQ( 3, instance->getValue() );
+			instance->set( { false, AtomicSequencer< uint8_t >::LINEAR, 0, 200, 1, 0 } );
+			instance->fetchAdvance( UINT64_MAX );
+			ASSERT_EQ( 200, instance->getValue() );
+		}
+}
+
+TEST( AtomicSequencerTest, ConcurrentFetchAdvanceWorks )
+{
+	// Create local variables.
+
+		AtomicSequencer< int32_t >::InstancePtr instance = AtomicSequencer< int32_t >::create();
+		boost::thread_group threads;
+		atomic< size_t > counts[ SEQUENCE_LENGTH ];
+
+	// Perform unit test for 'fetchAdvance' method as a round-robin selector shared by several threads.
+
+		for( auto& count : counts )
+			count.store( 0 );
+
+		instance->set( { true, AtomicSequencer< int32_t >::LINEAR, 0, ( SEQUENCE_LENGTH - 1 ), 1, 0 } );
+
+		for( size_t index = 0; index < THREAD_COUNT; index++ )
+			threads.add_thread( ( new boost::thread( AtomicSequencerTest::countValues, instance.get(), counts ) ) );
+
+		threads.join_all();
+
+		for( auto& count : counts )
+			ASSERT_EQ( ( ( THREAD_COUNT * ITERATION_COUNT ) / SEQUENCE_LENGTH ), count.load() );
+
+		ASSERT_EQ( 0, instance->getValue() );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of 'AtomicSequencerTest.cpp'
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1,6 +1,6 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // ConsoleIOTest.cpp
-// Robert M. Baker | Created : 30JAN12 | Last Modified : 31AUG19 by Robert M. Baker
+// Robert M. Baker | Created : 30JAN12 | Last Modified : 17OCT26 by Robert M. Baker
 // Version : 2.3.0
 // This is a source file for 'QMXStdLibTest'; it defines a set of unit tests for the 'QMXStdLib::ConsoleIO' class.
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -33,6 +33,15 @@ using namespace QMXStdLib;
 namespace ConsoleIOTest
 {
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Type Definitions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct CountedValue
+{
+	mutable size_t formatCount;
+};
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Function Definitions
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -44,6 +53,49 @@ void threadMain( ConsoleIO::StreamType targetType )
 		ConsoleIO::SynchronizedStream( targetType ) << 'T' << 'e' << 's' << 't' << 'i' << 'n' << 'g' << ' ' << '1' << '2' << '3' << '4' << '5' << '\n';
 }
 
+void logMain( size_t threadIndex, size_t lineCount )
+{
+	// Output numbered lines to every stream type.
+
+		for( size_t index = 0; index < lineCount; index++ )
+		{
+			COUT << "Thread " << threadIndex << " line " << index << '\n';
+			CERR << "Error " << threadIndex << '\n';
+			CLOG << "Log " << threadIndex << '\n';
+		}
+}
+
+ostream& operator<<( ostream& target, const CountedValue& source )
+{
+	// Count formatting of specified value, then format it.
+
+		source.formatCount++;
+
+	// Return specified stream to calling routine.
+
+		return ( target << "counted" );
+}
+
+string readFile( FILE* source )
+{
+	// Create local variables.
+
+		string result;
+		char buffer[ 4096 ];
+		size_t count = UNSET;
+
+	// Read specified file from its start.
+
+		rewind( source );
+
+		while( ( count = fread( buffer, 1, sizeof( buffer ), source ) ) )
+			result.append( buffer, count );
+
+	// Return result to calling routine.
+
+		return result;
+}
+
 } // 'ConsoleIOTest' Namespace
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -96,12 +148,189 @@ TEST( ConsoleIOTest, SynchronizedStreamWorks )
 			expectedOutput = "";
 		}
 
+	// Perform unit test for recovering from a failed insertion, which must not silence the next record of the same thread.
+
+		buffers[ ConsoleIO::OUTPUT_STREAM ].str( "" );
+		ConsoleIO::SynchronizedStream( ConsoleIO::OUTPUT_STREAM ) << static_cast< const char* >( nullptr );
+		ConsoleIO::SynchronizedStream( ConsoleIO::OUTPUT_STREAM ) << "Recovered\n";
+		ASSERT_EQ( "Recovered\n", buffers[ ConsoleIO::OUTPUT_STREAM ].str() );
+
 	// Restore stream buffers for output streams.
 
 		for( size_t index = 0; index < ARRAY_SIZE( stream ); index++ )
 			stream[ index ]->rdbuf( bufferBackups[ index ] );
 }
 
+TEST( ConsoleIOTest, StreamDisabledWorks )
+{
+	// Create local variables.
+
+		streambuf* bufferBackup = cout.rdbuf();
+		ostringstream buffer;
+		ConsoleIOTest::CountedValue value = { 0 };
+
+	// Change stream buffer for output stream to output buffer stream.
+
+		cout.rdbuf( buffer.rdbuf() );
+
+	// Perform unit test for 'getStreamDisabled' and 'setStreamDisabled' methods, and for the format state of each record.
+
+		ConsoleIO::setStreamDisabled( ConsoleIO::OUTPUT_STREAM, true );
+		COUT << value << '\n';
+		ConsoleIO::setStreamDisabled( ConsoleIO::OUTPUT_STREAM, false );
+		COUT << std::hex << 255 << std::endl;
+		COUT << 255 << ' ' << value << '\n';
+
+	// Restore stream buffer for output stream.
+
+		cout.rdbuf( bufferBackup );
+		ASSERT_FALSE( ConsoleIO::getStreamDisabled( ConsoleIO::OUTPUT_STREAM ) );
+		ASSERT_EQ( 1u, value.formatCount );
+		ASSERT_EQ( "ff\n255 counted\n", buffer.str() );
+}
+
+TEST( ConsoleIOTest, AsyncModeWorks )
+{
+	// Create local variables.
+
+		FILE* files[] = {
+			tmpfile(),
+			tmpfile()
+		};
+
+		int descriptorBackups[] = {
+			dup( STDOUT_FILENO ),
+			dup( STDERR_FILENO )
+		};
+
+		string output;
+		string errors;
+		istringstream lines;
+		string line;
+		vector< size_t > nextLines( 8, 0 );
+		size_t threadIndex = UNSET;
+		size_t lineIndex = UNSET;
+		boost::thread_group threads;
+
+	// Redirect standard output and error to temporary files.
+
+		dup2( fileno( files[ 0 ] ), STDOUT_FILENO );
+		dup2( fileno( files[ 1 ] ), STDERR_FILENO );
+
+	// Perform unit test for 'startAsync', 'isAsync', and 'flush' methods, with a queue small enough for producers to wait for room.
+
+		ConsoleIO::startAsync( 16 );
+
+		for( size_t index = 0; index < nextLines.size(); index++ )
+			threads.add_thread( ( new boost::thread( ConsoleIOTest::logMain, index, 200 ) ) );
+
+		threads.join_all();
+		ConsoleIO::flush();
+		output = ConsoleIOTest::readFile( files[ 0 ] );
+		errors = ConsoleIOTest::readFile( files[ 1 ] );
+
+	// Restore standard output and error.
+
+		dup2( descriptorBackups[ 0 ], STDOUT_FILENO );
+		dup2( descriptorBackups[ 1 ], STDERR_FILENO );
+		close( descriptorBackups[ 0 ] );
+		close( descriptorBackups[ 1 ] );
+		fclose( files[ 0 ] );
+		fclose( files[ 1 ] );
+
+	// Check that every record was written whole, and that the records of each thread kept their order.
+
+		ASSERT_TRUE( ConsoleIO::isAsync() );
+		ASSERT_THROW( ConsoleIO::startAsync(), QMXException );
+		ConsoleIO::stopAsync();
+		ASSERT_FALSE( ConsoleIO::isAsync() );
+		ASSERT_THROW( ConsoleIO::stopAsync(), QMXException );
+		ASSERT_EQ( ( 8u * 200u * 2u ), count( errors.begin(), errors.end(), '\n' ) );
+		lines.str( output );
+
+		while( getline( lines, line ) )
+		{
+			ASSERT_EQ( 2, sscanf( line.c_str(), "Thread %zu line %zu", &threadIndex, &lineIndex ) );
+			ASSERT_LT( threadIndex, nextLines.size() );
+			ASSERT_EQ( nextLines[ threadIndex ]++, lineIndex );
+		}
+
+		for( auto lineCount : nextLines )
+			ASSERT_EQ( 200u, lineCount );
+}
+
+TEST( ConsoleIOTest, AsyncRedirectionWorks )
+{
+	// Create local variables.
+
+		streambuf* bufferBackup = cout.rdbuf();
+		ostringstream buffer;
+
+	// Change stream buffer for output stream to output buffer stream.
+
+		cout.rdbuf( buffer.rdbuf() );
+
+	// Perform unit test for writing queued records through a stream buffer set with 'rdbuf'.
+
+		ConsoleIO::startAsync();
+		COUT << "Redirected " << 1 << '\n';
+		COUT << "Redirected " << 2 << '\n';
+		ConsoleIO::stopAsync();
+
+	// Restore stream buffer for output stream.
+
+		cout.rdbuf( bufferBackup );
+		ASSERT_EQ( "Redirected 1\nRedirected 2\n", buffer.str() );
+}
+
+TEST( ConsoleIOTest, AsyncOverflowWorks )
+{
+	// Create local variables.
+
+		int descriptors[ 2 ] = { -1, -1 };
+		int descriptorBackup = dup( STDERR_FILENO );
+		string record( 4095, 'X' );
+		uint64_t droppedCount = UNSET;
+		size_t readCount = UNSET;
+		size_t recordCount = 200;
+
+	// Redirect standard error to a pipe nobody reads yet, so the writer blocks once the pipe is full.
+
+		ASSERT_EQ( 0, pipe( descriptors ) );
+		dup2( descriptors[ 1 ], STDERR_FILENO );
+		close( descriptors[ 1 ] );
+		record += '\n';
+
+	// Perform unit test for the 'DROP' overflow policy and the 'getDroppedCount' method.
+
+		ConsoleIO::startAsync( 4, ConsoleIO::DROP );
+		droppedCount = ConsoleIO::getDroppedCount();
+
+		for( size_t index = 0; index < recordCount; index++ )
+			CLOG << record;
+
+		droppedCount = ( ConsoleIO::getDroppedCount() - droppedCount );
+
+		boost::thread reader( [ & ]() {
+			char buffer[ 4096 ];
+			ssize_t count = UNSET;
+
+			while( ( count = read( descriptors[ 0 ], buffer, sizeof( buffer ) ) ) > 0 )
+				readCount += count;
+		} );
+
+		ConsoleIO::stopAsync();
+
+	// Restore standard error, which closes the pipe, and check that every record was either written or counted as dropped.
+
+		dup2( descriptorBackup, STDERR_FILENO );
+		close( descriptorBackup );
+		reader.join();
+		close( descriptors[ 0 ] );
+		ASSERT_GT( droppedCount, 0u );
+		ASSERT_EQ( ( ( recordCount - droppedCount ) * record.size() ), readCount );
+}
+
 TEST( ConsoleIOTest, GetInputMinimumWorks )
 {
 	// Create local variables.
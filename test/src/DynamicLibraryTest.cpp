@@ -85,6 +85,24 @@ TEST( DynamicLibraryTest, GetSymbolWorks )
 		instance->unload();
 }
 
+TEST( DynamicLibraryTest, TryGetSymbolWorks )
+{
+	// Create local variables.
+
+		DynamicLibrary::InstancePtr instance = DynamicLibrary::create();
+		string dynLibPath = "TestLibrary";
+
+	// Perform unit test for 'tryGetSymbol' method.
+
+		ASSERT_STREQ( "00000004", instance->tryGetSymbol( "libraryFunction1" ).getError().getEventIndex() );
+		instance->load( ( PLUGINS_PATH + dynLibPath + DYNLIB_EXTENSION ) );
+		ASSERT_STREQ( "00000005", instance->tryGetSymbol( "nonExistent" ).getError().getEventIndex() );
+		ASSERT_STREQ( "DynamicLibrary::getSymbol", instance->tryGetSymbol( "nonExistent" ).getError().getModuleID() );
+		ASSERT_EQ( instance->getSymbol( "libraryFunction1" ), instance->tryGetSymbol( "libraryFunction1" ).getValue() );
+		ASSERT_TRUE( ( instance->tryGetSymbol( "libraryFunction2" ).getValueOr( nullptr ) != nullptr ) );
+		instance->unload();
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // End of 'DynamicLibraryTest.cpp'
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
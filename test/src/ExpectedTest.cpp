@@ -0,0 +1,160 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// ExpectedTest.cpp
+// Robert M. Baker | Created : 17OCT26 | Last Modified : 17OCT26 by Robert M. Baker
+// Version : 2.3.0
+// This is a source file for 'QMXStdLibTest'; it defines a set of unit tests for the 'QMXStdLib::Expected' class.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+//
+// This file is part of 'QMXStdLib'.
+//
+// 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option) any later version.
+//
+// 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Header Files
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../include/ExpectedTest.hpp"
+
+using namespace std;
+using namespace QMXStdLib;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Start of the 'ExpectedTest' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ExpectedTest
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Function Definitions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Expected< int > checkValue( int value )
+{
+	// Check specified value.
+
+		QMX_EXPECT( ( value >= 0 ), "QMXStdLibTest", "ExpectedTest::checkValue", "00000000" );
+
+	// Return result to calling routine.
+
+		return value;
+}
+
+void assertValue( int value )
+{
+	// Create local variables.
+
+		Expected< int > result = checkValue( value );
+
+	// Check specified value.
+
+		QMX_ASSERT_RESULT_X( result, "value = " << value );
+}
+
+} // 'ExpectedTest' Namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of the 'ExpectedTest' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// 'QMXStdLib::Expected' Test Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST( ExpectedTest, ValueWorks )
+{
+	// Create local variables.
+
+		Expected< string > instance( string( "FooBar" ) );
+
+	// Perform unit test for value results.
+
+		ASSERT_TRUE( instance.hasValue() );
+		ASSERT_TRUE( static_cast< bool >( instance ) );
+		ASSERT_EQ( "FooBar", instance.getValue() );
+		ASSERT_EQ( "FooBar", instance.getValueOr( "BarFoo" ) );
+		ASSERT_THROW( instance.getError(), QMXException );
+		instance.getValue() += "Baz";
+		ASSERT_EQ( "FooBarBaz", instance.getValue() );
+}
+
+TEST( ExpectedTest, ErrorWorks )
+{
+	// Create local variables.
+
+		Expected< string > instance( Error( "QMXStdLibTest", "ExpectedTest::ErrorWorks", "00000001" ) );
+
+	// Perform unit test for error results.
+
+		ASSERT_FALSE( instance.hasValue() );
+		ASSERT_FALSE( static_cast< bool >( instance ) );
+		ASSERT_EQ( "BarFoo", instance.getValueOr( "BarFoo" ) );
+		ASSERT_STREQ( "QMXStdLibTest", instance.getError().getRootID() );
+		ASSERT_STREQ( "ExpectedTest::ErrorWorks", instance.getError().getModuleID() );
+		ASSERT_STREQ( "00000001", instance.getError().getEventIndex() );
+		ASSERT_TRUE( ( instance.getError() == Error( "Other", "ExpectedTest::ErrorWorks", "00000001" ) ) );
+		ASSERT_FALSE( ( instance.getError() == Error( "QMXStdLibTest", "ExpectedTest::ErrorWorks", "00000002" ) ) );
+
+		try
+		{
+			instance.getValue();
+			FAIL();
+		}
+		catch( const QMXException& except )
+		{
+			ASSERT_STREQ( "QMXStdLibTest", except.getRootID() );
+			ASSERT_STREQ( "ExpectedTest::ErrorWorks", except.getModuleID() );
+			ASSERT_STREQ( "00000001", except.getEventIndex() );
+		}
+}
+
+TEST( ExpectedTest, VoidWorks )
+{
+	// Create local variables.
+
+		Expected< void > success;
+		Expected< void > failure( Error( "QMXStdLibTest", "ExpectedTest::VoidWorks", "00000001" ) );
+
+	// Perform unit test for results which carry no value.
+
+		ASSERT_TRUE( success.hasValue() );
+		ASSERT_NO_THROW( success.getValue() );
+		ASSERT_THROW( success.getError(), QMXException );
+		ASSERT_FALSE( failure.hasValue() );
+		ASSERT_THROW( failure.getValue(), QMXException );
+		ASSERT_STREQ( "00000001", failure.getError().getEventIndex() );
+}
+
+TEST( ExpectedTest, MacrosWork )
+{
+	// Perform unit test for 'QMX_EXPECT' and 'QMX_ASSERT_RESULT' macros.
+
+		ASSERT_EQ( 7, ExpectedTest::checkValue( 7 ).getValue() );
+		ASSERT_FALSE( ExpectedTest::checkValue( -1 ) );
+		ASSERT_STREQ( "ExpectedTest::checkValue", ExpectedTest::checkValue( -1 ).getError().getModuleID() );
+		ASSERT_NO_THROW( ExpectedTest::assertValue( 7 ) );
+
+		try
+		{
+			ExpectedTest::assertValue( -1 );
+			FAIL();
+		}
+		catch( const QMXException& except )
+		{
+			ASSERT_STREQ( "ExpectedTest::checkValue", except.getModuleID() );
+			ASSERT_STREQ( "00000000", except.getEventIndex() );
+			ASSERT_STREQ( "value = -1", except.getEventData() );
+		}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of 'ExpectedTest.cpp'
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1,6 +1,6 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // FileSystemTest.cpp
-// Robert M. Baker | Created : 12MAR12 | Last Modified : 29AUG19 by Robert M. Baker
+// Robert M. Baker | Created : 12MAR12 | Last Modified : 17OCT26 by Robert M. Baker
 // Version : 2.3.0
 // This is a source file for 'QMXStdLibTest'; it defines a set of unit tests for the 'QMXStdLib::FileSystem' functions.
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -371,6 +371,120 @@ TEST( FileSystemTest, CopyNonRecursiveWorks )
 		}
 }
 
+TEST( FileSystemTest, TryCopyWorks )
+{
+	// Create local variables.
+
+		ScopedPathChange testPath( BASE_PATH );
+
+		Path sourcePathsBad[] = {
+			TEST_OTHER,
+		   "NonEmptyTestDirectory",
+			"NonEmptyTestFile.txt",
+			"TestFileSymlink"
+		};
+
+		Path destinationPathsBad[] = {
+			"TestOtherCopy",
+		   "EmptyTestDirectory",
+			"EmptyTestFile.txt",
+			"TestFileHardlink"
+		};
+
+		Path sourcePathsGood[] = {
+		   "NonEmptyTestFile.txt",
+		   "TestFileHardlink",
+		   "TestFileSymlink"
+		};
+
+		Path destinationPathsGood[] = {
+			"NonEmptyTestFileCopy.txt",
+			"TestFileHardlinkCopy",
+			"TestFileSymlinkCopy"
+		};
+
+		Expected< void > result;
+
+	// Perform unit test for 'tryCopy' function.
+
+		for( size_t index = 0; index < ARRAY_SIZE( sourcePathsBad ); index++ )
+		{
+			result = FileSystem::tryCopy( sourcePathsBad[ index ], destinationPathsBad[ index ], false, FileSystem::FAIL_IF_EXISTS );
+			ASSERT_FALSE( result );
+			ASSERT_STREQ( "FileSystem::copy", result.getError().getModuleID() );
+			ASSERT_STREQ( "0000000F", result.getError().getEventIndex() );
+		}
+
+		result = FileSystem::tryCopy( "NonExistent", "NonExistentCopy", false, FileSystem::OVERWRITE_IF_EXISTS );
+		ASSERT_FALSE( result );
+		ASSERT_STREQ( "0000000E", result.getError().getEventIndex() );
+		result = FileSystem::tryCopy( "NonExistent", "NonExistentCopy", false, FileSystem::FAIL_IF_EXISTS );
+		ASSERT_FALSE( result );
+		ASSERT_STREQ( "0000000F", result.getError().getEventIndex() );
+
+		for( size_t index = 0; index < ARRAY_SIZE( sourcePathsGood ); index++ )
+		{
+			ASSERT_TRUE( FileSystem::tryCopy( sourcePathsGood[ index ], destinationPathsGood[ index ], false ) );
+			ASSERT_TRUE( FileSystem::tryCopy( sourcePathsGood[ index ], destinationPathsGood[ index ], false ) );
+			ASSERT_TRUE( FileSystem::tryCopy( sourcePathsGood[ index ], destinationPathsGood[ index ], false, FileSystem::OVERWRITE_IF_EXISTS ) );
+			boost::filesystem::remove( destinationPathsGood[ index ] );
+		}
+}
+
+TEST( FileSystemTest, CopyStatisticsWorks )
+{
+	// Create local variables.
+
+		ScopedPathChange testPath( BASE_PATH );
+
+		FileSystem::CopyStatistics statistics;
+		FileSystem::CopyStatistics lastProgress;
+		uint64_t progressCount = 0;
+		string contents;
+		Path sourcePath = "CopyStatisticsTestDirectory";
+		Path destinationPath = "CopyStatisticsTestDirectoryCopy";
+		FileSystem::CopyHandler progressHandler = [ & ]( const FileSystem::CopyStatistics& current ) { progressCount++; lastProgress = current; };
+
+	// Perform unit test for the statistics and progress reported by the 'copy' function.
+
+		for( size_t index = 0; index < 8; index++ )
+		{
+			boost::filesystem::create_directories( sourcePath / ( "Directory" + to_string( index ) ) / "Subdirectory" );
+
+			for( size_t subindex = 0; subindex < 16; subindex++ )
+			{
+				contents.assign( ( ( index * 16 ) + subindex ), static_cast< char >( 'A' + index ) );
+				boost::filesystem::ofstream( sourcePath / ( "Directory" + to_string( index ) ) / "Subdirectory" / ( to_string( subindex ) + ".txt" ) ) << contents;
+			}
+		}
+
+		FileSystem::createLink( "Directory0", ( sourcePath / "DirectorySymlink" ) );
+		FileSystem::copy( sourcePath, destinationPath, true, FileSystem::SKIP_IF_EXISTS, &statistics, progressHandler );
+		ASSERT_EQ( 128u, statistics.fileCount );
+		ASSERT_EQ( 17u, statistics.directoryCount );
+		ASSERT_EQ( 1u, statistics.symlinkCount );
+		ASSERT_EQ( 0u, statistics.skippedCount );
+		ASSERT_EQ( 8128u, statistics.byteCount );
+		ASSERT_EQ( 146u, progressCount );
+		ASSERT_EQ( 8128u, lastProgress.byteCount );
+		ASSERT_LE( lastProgress.elapsed, statistics.elapsed );
+		ASSERT_TRUE( boost::filesystem::is_symlink( destinationPath / "DirectorySymlink" ) );
+		ASSERT_EQ( 127u, boost::filesystem::file_size( destinationPath / "Directory7" / "Subdirectory" / "15.txt" ) );
+		FileSystem::copy( sourcePath, destinationPath, true, FileSystem::SKIP_IF_EXISTS, &statistics );
+		ASSERT_EQ( 0u, statistics.fileCount );
+		ASSERT_EQ( 129u, statistics.skippedCount );
+		ASSERT_EQ( 0u, statistics.byteCount );
+		ASSERT_EQ( 0.0, statistics.getBytesPerSecond() );
+		FileSystem::copy( sourcePath, destinationPath, true, FileSystem::OVERWRITE_IF_EXISTS, &statistics );
+		ASSERT_EQ( 128u, statistics.fileCount );
+		ASSERT_EQ( 1u, statistics.symlinkCount );
+		ASSERT_EQ( 8128u, statistics.byteCount );
+		ASSERT_GT( statistics.getBytesPerSecond(), 0.0 );
+		ASSERT_THROW( FileSystem::copy( sourcePath, destinationPath, true, FileSystem::FAIL_IF_EXISTS ), QMXException );
+		boost::filesystem::remove_all( destinationPath );
+		boost::filesystem::remove_all( sourcePath );
+}
+
 TEST( FileSystemTest, RunCommandWorks )
 {
 	// Perform unit test for 'runCommand' function.
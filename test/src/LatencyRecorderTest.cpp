@@ -0,0 +1,203 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// LatencyRecorderTest.cpp
+// Robert M. Baker | Created : 17OCT26 | Last Modified : 17OCT26 by Robert M. Baker
+// Version : 2.3.0
+// This is a source file for 'QMXStdLibTest'; it defines a set of unit tests for the 'QMXStdLib::LatencyRecorder' class.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+//
+// This file is part of 'QMXStdLib'.
+//
+// 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option) any later version.
+//
+// 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Header Files
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../include/LatencyRecorderTest.hpp"
+
+using namespace std;
+using namespace QMXStdLib;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// 'QMXStdLib::LatencyRecorder' Test Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST( LatencyRecorderTest, RecordWorks )
+{
+	// Create local variables.
+
+		Timer::InstancePtr timer = Timer::create();
+		LatencyRecorder::InstancePtr instance = LatencyRecorder::create();
+		LatencyRecorder::InstancePtr copy = LatencyRecorder::create();
+
+	// Perform unit test for 'record', 'reset', 'getCount', 'getMinimum', 'getMaximum', and 'getMean' methods.
+
+		ASSERT_EQ( 0u, instance->getCount() );
+		ASSERT_EQ( 0, instance->getMinimum() );
+		ASSERT_EQ( 0, instance->getMaximum() );
+		ASSERT_EQ( 0.0l, instance->getMean() );
+
+		for( int64_t value = 1; value <= 1000; value++ )
+			instance->record( value );
+
+		ASSERT_EQ( 1000u, instance->getCount() );
+		ASSERT_EQ( 1, instance->getMinimum() );
+		ASSERT_EQ( 1000, instance->getMaximum() );
+		ASSERT_DOUBLE_EQ( 500.5, instance->getMean() );
+		instance->clone( copy );
+		instance->reset();
+		ASSERT_EQ( 0u, instance->getCount() );
+		ASSERT_EQ( 0, instance->getMinimum() );
+		ASSERT_EQ( 1000u, copy->getCount() );
+		ASSERT_EQ( 1000, copy->getPercentile( 100.0l ) );
+		instance->record( -5 );
+		ASSERT_EQ( 0, instance->getMaximum() );
+		instance->reset();
+		timer->toggle();
+
+		while( timer->getNanoseconds() < 1000000 );
+			// Empty Loop
+
+		timer->toggle();
+		instance->record( *timer );
+		ASSERT_EQ( timer->getNanoseconds(), instance->getMaximum() );
+}
+
+TEST( LatencyRecorderTest, GetPercentileWorks )
+{
+	// Create local variables.
+
+		LatencyRecorder::InstancePtr instance = LatencyRecorder::create();
+		vector< int64_t > results;
+
+	// Perform unit test for 'getPercentile' and 'getPercentiles' methods.
+
+		ASSERT_EQ( 0, instance->getPercentile( 50.0l ) );
+
+		for( int64_t value = 1; value <= 100000; value++ )
+			instance->record( value );
+
+		ASSERT_EQ( 1, instance->getPercentile( 0.0l ) );
+		ASSERT_EQ( 100, instance->getPercentile( 0.1l ) );
+		ASSERT_NEAR( 50000, instance->getPercentile( 50.0l ), 400 );
+		ASSERT_NEAR( 99000, instance->getPercentile( 99.0l ), 800 );
+		ASSERT_NEAR( 99900, instance->getPercentile( 99.9l ), 800 );
+		ASSERT_EQ( 100000, instance->getPercentile( 100.0l ) );
+		ASSERT_GE( instance->getPercentile( 50.0l ), 50000 );
+		results = instance->getPercentiles( { 0.0l, 50.0l, 99.0l, 99.9l, 100.0l } );
+		ASSERT_EQ( 5u, results.size() );
+		ASSERT_EQ( instance->getPercentile( 50.0l ), results[ 1 ] );
+		ASSERT_EQ( instance->getPercentile( 99.9l ), results[ 3 ] );
+		ASSERT_EQ( 100000, results[ 4 ] );
+		ASSERT_THROW( instance->getPercentile( -1.0l ), QMXException );
+		ASSERT_THROW( instance->getPercentile( 100.5l ), QMXException );
+		ASSERT_THROW( instance->getPercentiles( { 50.0l, 101.0l } ), QMXException );
+		instance->reset();
+		instance->record( 1LL << 50 );
+		instance->record( 1000 );
+		ASSERT_NEAR( 1000, instance->getPercentile( 50.0l ), 8 );
+		ASSERT_EQ( ( 1LL << 50 ), instance->getPercentile( 100.0l ) );
+}
+
+TEST( LatencyRecorderTest, ShardsWork )
+{
+	// Create local variables.
+
+		LatencyRecorder::InstancePtr instance = LatencyRecorder::create();
+		LatencyRecorder::InstancePtr reference = LatencyRecorder::create();
+		vector< thread > threads;
+
+	// Perform unit test for recording from several threads, which merges their shards when read.
+
+		for( size_t index = 0; index < 8; index++ )
+		{
+			threads.emplace_back( [ instance ]() {
+				for( int64_t value = 1; value <= 10000; value++ )
+					instance->record( value );
+			} );
+		}
+
+		for( auto& worker : threads )
+			worker.join();
+
+		for( size_t index = 0; index < 8; index++ )
+		{
+			for( int64_t value = 1; value <= 10000; value++ )
+				reference->record( value );
+		}
+
+		ASSERT_EQ( 80000u, instance->getCount() );
+		ASSERT_EQ( 1, instance->getMinimum() );
+		ASSERT_EQ( 10000, instance->getMaximum() );
+		ASSERT_EQ( reference->getMean(), instance->getMean() );
+		ASSERT_EQ( reference->getPercentiles( { 50.0l, 99.0l, 99.9l } ), instance->getPercentiles( { 50.0l, 99.0l, 99.9l } ) );
+}
+
+TEST( LatencyRecorderTest, DumpWorks )
+{
+	// Create local variables.
+
+		LatencyRecorder::InstancePtr instance = LatencyRecorder::create();
+		LatencyRecorder::InstancePtr target = LatencyRecorder::create();
+		string data;
+
+	// Perform unit test for 'dump' and 'load' methods.
+
+		for( int64_t value = 1; value <= 100000; value++ )
+			instance->record( value * 37 );
+
+		data = instance->dump();
+		ASSERT_LT( data.size(), 4096u );
+		target->load( data );
+		ASSERT_EQ( instance->getCount(), target->getCount() );
+		ASSERT_EQ( instance->getMinimum(), target->getMinimum() );
+		ASSERT_EQ( instance->getMaximum(), target->getMaximum() );
+		ASSERT_EQ( instance->getMean(), target->getMean() );
+		ASSERT_EQ( instance->getPercentiles( { 0.0l, 50.0l, 99.0l, 99.9l, 100.0l } ), target->getPercentiles( { 0.0l, 50.0l, 99.0l, 99.9l, 100.0l } ) );
+		ASSERT_EQ( data, target->dump() );
+		target->load( data );
+		ASSERT_EQ( ( 2 * instance->getCount() ), target->getCount() );
+		ASSERT_EQ( instance->getPercentile( 99.0l ), target->getPercentile( 99.0l ) );
+		target->reset();
+		target->load( LatencyRecorder::create()->dump() );
+		ASSERT_EQ( 0u, target->getCount() );
+		ASSERT_THROW( target->load( "" ), QMXException );
+		ASSERT_THROW( target->load( ( "QMXM" + data.substr( 4 ) ) ), QMXException );
+		ASSERT_THROW( target->load( data.substr( 0, ( data.size() - 1 ) ) ), QMXException );
+		ASSERT_THROW( target->load( ( data + data.substr( data.size() - 2 ) ) ), QMXException );
+		ASSERT_EQ( 0u, target->getCount() );
+}
+
+TEST( LatencyRecorderTest, ScopedLatencyWorks )
+{
+	// Create local variables.
+
+		LatencyRecorder::InstancePtr instance = LatencyRecorder::create();
+		int64_t startTime = UNSET;
+
+	// Perform unit test for 'ScopedLatency' class.
+
+		for( size_t index = 0; index < 4; index++ )
+		{
+			SCOPED_LATENCY( *instance, 0000 );
+			startTime = Timer::now();
+
+			while( ( Timer::now() - startTime ) < 2000000 );
+				// Empty Loop
+		}
+
+		ASSERT_EQ( 4u, instance->getCount() );
+		ASSERT_NEAR( 2000000, instance->getMinimum(), 500000 );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of 'LatencyRecorderTest.cpp'
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
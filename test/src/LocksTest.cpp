@@ -0,0 +1,241 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// LocksTest.cpp
+// Robert M. Baker | Created : 16OCT26 | Last Modified : 16OCT26 by Robert M. Baker
+// Version : 2.3.0
+// This is a source file for 'QMXStdLibTest'; it defines a set of unit tests for the lock policy classes.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+//
+// This file is part of 'QMXStdLib'.
+//
+// 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option) any later version.
+//
+// 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Header Files
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../include/LocksTest.hpp"
+
+using namespace std;
+using namespace QMXStdLib;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Start of the 'LocksTest' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace LocksTest
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Type Definitions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct Counters
+{
+	size_t first = 0;
+	size_t second = 0;
+};
+
+template< typename LType > class Guarded : public Object< Guarded< LType >, Counters, LType >
+{
+public:
+
+	// Public Methods
+
+		void increment()
+		{
+			// Obtain locks.
+
+				SCOPED_WRITE_LOCK;
+
+			// Increment both counters, reading them through a nested read lock.
+
+				this->properties.first = ( getFirst() + 1 );
+				this->properties.second++;
+		}
+
+		size_t getFirst() const
+		{
+			// Obtain locks.
+
+				SCOPED_READ_LOCK;
+
+			// Return first counter to calling routine.
+
+				return this->properties.first;
+		}
+
+		bool isConsistent() const
+		{
+			// Obtain locks.
+
+				SCOPED_READ_LOCK;
+
+			// Report whether or not both counters match to calling routine.
+
+				return( getFirst() == this->properties.second );
+		}
+
+private:
+
+	// Private Constructors
+
+		friend class Object< Guarded< LType >, Counters, LType >;
+
+		Guarded()
+		{
+			// Do nothing.
+		}
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Function Definitions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template< typename LType > void hammer( LType* target, atomic< size_t >* inconsistentCount )
+{
+	// Alternate between writes and reads, recording any read which observes a partial write.
+
+		for( size_t index = 0; index < ITERATION_COUNT; index++ )
+		{
+			if( index % 4 )
+			{
+				if( !target->isConsistent() )
+					inconsistentCount->fetch_add( 1 );
+			}
+			else
+				target->increment();
+		}
+}
+
+template< typename LType > void runHammer()
+{
+	// Create local variables.
+
+		typename Guarded< LType >::InstancePtr target = Guarded< LType >::create();
+		boost::thread_group threads;
+		atomic< size_t > inconsistentCount( 0 );
+		Counters result;
+
+	// Run all threads against the same object, and verify every write was observed atomically.
+
+		for( size_t index = 0; index < THREAD_COUNT; index++ )
+			threads.add_thread( ( new boost::thread( hammer< Guarded< LType > >, target.get(), &inconsistentCount ) ) );
+
+		threads.join_all();
+		target->get( result );
+		ASSERT_EQ( 0u, inconsistentCount.load() );
+		ASSERT_EQ( ( THREAD_COUNT * ( ITERATION_COUNT / 4 ) ), result.first );
+		ASSERT_EQ( result.first, result.second );
+}
+
+} // 'LocksTest' Namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of the 'LocksTest' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// 'QMXStdLib::Locks' Test Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST( LocksTest, NullLockWorks )
+{
+	// Create local variables.
+
+		NullLock target;
+		LocksTest::Guarded< NullLock >::InstancePtr guarded = LocksTest::Guarded< NullLock >::create();
+
+	// Perform unit test for 'NullLock' class.
+
+		{
+			ScopedLock writeLock( ScopedLock::WRITE, target );
+			ScopedLock readLock( ScopedLock::READ, target );
+		}
+
+		guarded->increment();
+		guarded->increment();
+		ASSERT_EQ( 2u, guarded->getFirst() );
+		ASSERT_TRUE( guarded->isConsistent() );
+}
+
+TEST( LocksTest, SpinLockWorks )
+{
+	// Create local variables.
+
+		SpinLock target;
+		bool isLocked = false;
+
+	// Perform unit test for 'SpinLock' class.
+
+		ASSERT_FALSE( target.isOwner() );
+		target.lock();
+		target.lock();
+		ASSERT_TRUE( target.tryLock() );
+		ASSERT_TRUE( target.isOwner() );
+		boost::thread( [ & ]() { isLocked = target.tryLock(); } ).join();
+		ASSERT_FALSE( isLocked );
+		target.unlock();
+		target.unlock();
+		ASSERT_TRUE( target.isOwner() );
+		target.unlock();
+		ASSERT_FALSE( target.isOwner() );
+		boost::thread( [ & ]() { isLocked = target.tryLock();  if( isLocked ) target.unlock(); } ).join();
+		ASSERT_TRUE( isLocked );
+		LocksTest::runHammer< SpinLock >();
+}
+
+TEST( LocksTest, SharedLockWorks )
+{
+	// Create local variables.
+
+		SharedLock target;
+		atomic< size_t > readerCount( 0 );
+		atomic< bool > isShared( false );
+		boost::thread_group threads;
+
+	// Perform unit test for 'SharedLock' class.
+
+		target.lockShared();
+		target.lockShared();
+		ASSERT_THROW( target.lock(), QMXException );
+		target.unlockShared();
+		target.unlockShared();
+		target.lock();
+		target.lock();
+		target.lockShared();
+		ASSERT_TRUE( target.isOwner() );
+		target.unlockShared();
+		target.unlock();
+		target.unlock();
+		ASSERT_FALSE( target.isOwner() );
+
+		for( size_t index = 0; index < 2; index++ )
+		{
+			threads.add_thread( ( new boost::thread( [ & ]() {
+				ScopedLock readLock( ScopedLock::READ, target );
+				readerCount++;
+
+				for( size_t spinCount = 0; ( spinCount < 1000 ) && ( readerCount.load() < 2 ); spinCount++ )
+					boost::this_thread::sleep_for( boost::chrono::milliseconds( 1 ) );
+
+				if( readerCount.load() == 2 )
+					isShared = true;
+			} ) ) );
+		}
+
+		threads.join_all();
+		ASSERT_TRUE( isShared.load() );
+		LocksTest::runHammer< SharedLock >();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of 'LocksTest.cpp'
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
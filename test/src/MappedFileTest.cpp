@@ -0,0 +1,246 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// MappedFileTest.cpp
+// Robert M. Baker | Created : 17OCT26 | Last Modified : 17OCT26 by Robert M. Baker
+// Version : 2.3.0
+// This is a source file for 'QMXStdLibTest'; it defines a set of unit tests for the 'QMXStdLib::MappedFile' class.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+//
+// This file is part of 'QMXStdLib'.
+//
+// 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option) any later version.
+//
+// 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Header Files
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../include/MappedFileTest.hpp"
+
+using namespace std;
+using namespace QMXStdLib;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Start of the 'MappedFileTest' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace MappedFileTest
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Function Definitions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Path getPath()
+{
+	// Return a unique path in the temporary directory to calling routine.
+
+		return ( boost::filesystem::temp_directory_path() / boost::filesystem::unique_path( "QMXStdLibMapped-%%%%-%%%%.bin" ) );
+}
+
+void writeFile( const Path& target, const string& contents )
+{
+	// Create local variables.
+
+		ofstream file( target.string(), ( ios::out | ios::binary | ios::trunc ) );
+
+	// Write specified contents to the file.
+
+		file << contents;
+}
+
+string readFile( const Path& source )
+{
+	// Create local variables.
+
+		ifstream file( source.string(), ( ios::in | ios::binary ) );
+
+	// Return contents of the file to calling routine.
+
+		return string( istreambuf_iterator< char >( file ), istreambuf_iterator< char >() );
+}
+
+} // 'MappedFileTest' Namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of the 'MappedFileTest' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// 'QMXStdLib::MappedFile' Test Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST( MappedFileTest, OpenWorks )
+{
+	// Create local variables.
+
+		Path path = MappedFileTest::getPath();
+		MappedFile::InstancePtr instance = MappedFile::create();
+		MappedFile::InstancePtr copy = MappedFile::create();
+		MappedFile::View< const char > view;
+
+	// Perform unit test for 'open', 'close', 'isOpen', 'getPath', 'getMode', and 'getSize' methods.
+
+		ASSERT_FALSE( instance->isOpen() );
+		ASSERT_EQ( 0u, instance->getSize() );
+		ASSERT_THROW( instance->close(), QMXException );
+		ASSERT_THROW( instance->getView(), QMXException );
+		ASSERT_THROW( instance->open( path ), QMXException );
+		ASSERT_FALSE( instance->isOpen() );
+		MappedFileTest::writeFile( path, "Hello, mapped world!" );
+		instance->open( path );
+		ASSERT_TRUE( instance->isOpen() );
+		ASSERT_EQ( path, instance->getPath() );
+		ASSERT_EQ( MappedFile::READ_ONLY, instance->getMode() );
+		ASSERT_EQ( 20u, instance->getSize() );
+		view = instance->getView();
+		ASSERT_EQ( "Hello, mapped world!", string( view.begin(), view.end() ) );
+		instance->clone( copy );
+		ASSERT_TRUE( copy->isOpen() );
+		ASSERT_EQ( "Hello", string( copy->getView().data(), 5 ) );
+		instance->close();
+		ASSERT_FALSE( instance->isOpen() );
+		ASSERT_TRUE( instance->getPath().empty() );
+		ASSERT_EQ( 0u, instance->getSize() );
+		copy->deallocate();
+		ASSERT_FALSE( copy->isOpen() );
+		MappedFileTest::writeFile( path, "" );
+		instance->open( path );
+		ASSERT_EQ( 0u, instance->getSize() );
+		ASSERT_TRUE( instance->getView().empty() );
+		instance->close();
+		boost::filesystem::remove( path );
+}
+
+TEST( MappedFileTest, ModesWork )
+{
+	// Create local variables.
+
+		Path path = MappedFileTest::getPath();
+		MappedFile::InstancePtr instance = MappedFile::create();
+		MappedFile::View< char > view;
+
+	// Perform unit test for writing through 'COPY_ON_WRITE' and 'READ_WRITE' mappings, and for 'flush' method.
+
+		MappedFileTest::writeFile( path, "abcdef" );
+		instance->open( path );
+		ASSERT_THROW( instance->getView< char >(), QMXException );
+		ASSERT_THROW( instance->resize( 12 ), QMXException );
+		instance->flush();
+		instance->open( path, MappedFile::COPY_ON_WRITE );
+		ASSERT_FALSE( instance->getView< char >().empty() );
+		view = instance->getView< char >();
+		view[ 0 ] = 'X';
+		ASSERT_EQ( 'X', instance->getView()[ 0 ] );
+		ASSERT_THROW( instance->resize( 12 ), QMXException );
+		instance->close();
+		ASSERT_EQ( "abcdef", MappedFileTest::readFile( path ) );
+		instance->open( path, MappedFile::READ_WRITE );
+		view = instance->getView< char >( 2, 2 );
+		view[ 0 ] = 'C';
+		view[ 1 ] = 'D';
+		instance->flush();
+		ASSERT_EQ( "abCDef", MappedFileTest::readFile( path ) );
+		instance->close();
+		boost::filesystem::remove( path );
+}
+
+TEST( MappedFileTest, ResizeWorks )
+{
+	// Create local variables.
+
+		Path path = MappedFileTest::getPath();
+		MappedFile::InstancePtr instance = MappedFile::create();
+		MappedFile::View< uint32_t > view;
+
+	// Perform unit test for 'resize' method, growing a new file from empty and then shrinking it.
+
+		instance->open( path, MappedFile::READ_WRITE );
+		ASSERT_TRUE( boost::filesystem::exists( path ) );
+		ASSERT_EQ( 0u, instance->getSize() );
+
+		for( size_t size = 4096; size <= 1048576; size *= 4 )
+		{
+			instance->resize( size );
+			view = instance->getView< uint32_t >();
+			ASSERT_EQ( ( size / sizeof( uint32_t ) ), view.size() );
+			ASSERT_EQ( 0u, view[ view.size() - 1 ] );
+			iota( view.begin(), view.end(), 0u );
+		}
+
+		instance->resize( 64 );
+		ASSERT_EQ( 16u, instance->getView< const uint32_t >().size() );
+		ASSERT_EQ( 15u, instance->getView< const uint32_t >()[ 15 ] );
+		instance->resize( 0 );
+		ASSERT_TRUE( instance->getView().empty() );
+		instance->resize( 8 );
+		ASSERT_EQ( 0u, instance->getView< const uint32_t >()[ 1 ] );
+		instance->close();
+		ASSERT_EQ( 8u, boost::filesystem::file_size( path ) );
+		boost::filesystem::remove( path );
+}
+
+TEST( MappedFileTest, GetViewWorks )
+{
+	// Create local variables.
+
+		Path path = MappedFileTest::getPath();
+		MappedFile::InstancePtr instance = MappedFile::create();
+		MappedFile::View< const uint16_t > view;
+		MappedFile::View< const uint16_t > part;
+
+	// Perform unit test for 'getView' method and the 'View' class.
+
+		MappedFileTest::writeFile( path, string( "\x01\x00\x02\x00\x03\x00\x04\x00\x05", 9 ) );
+		instance->open( path );
+		view = instance->getView< const uint16_t >();
+		ASSERT_EQ( 4u, view.size() );
+		ASSERT_EQ( 10u, accumulate( view.begin(), view.end(), 0u ) );
+		part = view.subview( 1, 2 );
+		ASSERT_EQ( 2u, part.size() );
+		ASSERT_EQ( 2u, part[ 0 ] );
+		ASSERT_EQ( 3u, part[ 1 ] );
+		ASSERT_EQ( 2u, view.subview( 2 ).size() );
+		ASSERT_TRUE( view.subview( 10 ).empty() );
+		ASSERT_EQ( 3u, instance->getView< const uint16_t >( 2 ).size() );
+		ASSERT_EQ( 1u, instance->getView( 8 ).size() );
+		ASSERT_TRUE( instance->getView( 9 ).empty() );
+		ASSERT_THROW( instance->getView< const uint16_t >( 1 ), QMXException );
+		ASSERT_THROW( instance->getView< const uint16_t >( 0, 5 ), QMXException );
+		ASSERT_THROW( instance->getView( 10 ), QMXException );
+		instance->close();
+		boost::filesystem::remove( path );
+}
+
+TEST( MappedFileTest, AdviseWorks )
+{
+	// Create local variables.
+
+		Path path = MappedFileTest::getPath();
+		MappedFile::InstancePtr instance = MappedFile::create();
+
+	// Perform unit test for 'advise' method.
+
+		ASSERT_THROW( instance->advise( MappedFile::SEQUENTIAL_ACCESS ), QMXException );
+		MappedFileTest::writeFile( path, string( 65536, 'A' ) );
+		instance->open( path );
+		ASSERT_TRUE( instance->advise( MappedFile::SEQUENTIAL_ACCESS ) );
+		ASSERT_TRUE( instance->advise( MappedFile::RANDOM_ACCESS, 5000, 10000 ) );
+		ASSERT_TRUE( instance->advise( MappedFile::WILL_NEED, 60000 ) );
+		ASSERT_TRUE( instance->advise( MappedFile::NORMAL_ACCESS ) );
+		ASSERT_FALSE( instance->advise( MappedFile::NORMAL_ACCESS, 70000 ) );
+		instance->advise( MappedFile::HUGE_PAGES );
+		ASSERT_EQ( string( 65536, 'A' ), string( instance->getView().begin(), instance->getView().end() ) );
+		instance->close();
+		boost::filesystem::remove( path );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of 'MappedFileTest.cpp'
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1,6 +1,6 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // NumericTest.cpp
-// Robert M. Baker | Created : 10FEB12 | Last Modified : 29AUG19 by Robert M. Baker
+// Robert M. Baker | Created : 10FEB12 | Last Modified : 17OCT26 by Robert M. Baker
 // Version : 2.3.0
 // This is a source file for 'QMXStdLibTest'; it defines a set of unit tests for the 'QMXStdLib::Numeric' functions.
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -26,6 +26,140 @@
 using namespace std;
 using namespace QMXStdLib;
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Start of the 'NumericTest' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace NumericTest
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Function Definitions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template< typename NType > string toStringStream( NType value, const Stringizable::StringFormat& format )
+{
+	// Create local variables.
+
+		ostringstream result;
+
+	// Construct a string representation of the specified value, exactly as the stream-based 'toString' did.
+
+		if( typeid( NType ) == typeid( bool ) )
+		{
+			if( format.useYesNo )
+				result << ( value ? "yes" : "no" );
+			else
+				result << boolalpha << value;
+		}
+		else
+		{
+			if( format.usePrefix && ( format.base != Stringizable::DECIMAL ) )
+				result << ( ( format.base == Stringizable::BINARY ) ? "0b" : ( ( format.base == Stringizable::OCTAL ) ? "0" : "0x" ) );
+
+			result << ( format.useUpperCase ? uppercase : nouppercase );
+
+			if( format.filler )
+				result << setfill( format.filler ) << setw( format.width );
+			else
+				result << setw( 0 );
+
+			if( format.base == Stringizable::DECIMAL )
+				result << dec << setprecision( format.precision ) << fixed;
+			else if( format.base != Stringizable::BINARY )
+				result << ( ( format.base == Stringizable::OCTAL ) ? oct : hex );
+
+			if( format.base == Stringizable::BINARY )
+				result << bitset< ( sizeof( NType ) * 8 ) >( static_cast< unsigned long long >( value ) ).to_string();
+			else
+			{
+				if( format.charsAsInts && ( ( typeid( NType ) == typeid( int8_t ) ) || ( typeid( NType ) == typeid( uint8_t ) ) ) )
+					result << static_cast< int32_t >( value );
+				else
+					result << value;
+			}
+		}
+
+	// Return result to calling routine.
+
+		return result.str();
+}
+
+template< typename NType > void checkFormats( initializer_list< NType > values )
+{
+	// Create local variables.
+
+		Stringizable::StringFormat format;
+		Stringizable::NumericBase bases[] = { Stringizable::BINARY, Stringizable::OCTAL, Stringizable::DECIMAL, Stringizable::HEXIDECIMAL };
+		char fillers[] = { '\0', '0', ' ' };
+		int32_t widths[] = { 0, 3, 24 };
+		int32_t precisions[] = { 0, 2, 5 };
+
+	// Compare every value against the stream-based formatter, under every combination of format settings.
+
+		for( NType value : values )
+		{
+			for( auto base : bases )
+			{
+				for( int32_t flags = 0; flags < 16; flags++ )
+				{
+					for( char filler : fillers )
+					{
+						for( int32_t width : widths )
+						{
+							for( int32_t precision : precisions )
+							{
+								format = { bool( flags & 1 ), bool( flags & 2 ), bool( flags & 4 ), bool( flags & 8 ), filler, width, precision, base };
+								ASSERT_EQ( toStringStream( value, format ), Numeric::toString( value, Stringizable::NONE, &format ) )
+									<< "value " << +value << ", base " << base << ", flags " << flags << ", filler " << int( filler ) << ", width " << width;
+							}
+						}
+					}
+				}
+			}
+		}
+}
+
+template< typename NType > void checkBatch( initializer_list< NType > values )
+{
+	// Create local variables.
+
+		Stringizable::StringFormat format;
+		Stringizable::NumericBase bases[] = { Stringizable::BINARY, Stringizable::OCTAL, Stringizable::DECIMAL, Stringizable::HEXIDECIMAL };
+		int32_t widths[] = { 0, 4, 8, 16, 80 };
+		string result;
+		string expectedResult;
+
+	// Compare the batch output against joining the output of 'toString', with both fixed-width and variable-width formats.
+
+		for( auto base : bases )
+		{
+			for( int32_t width : widths )
+			{
+				for( bool useUpperCase : { false, true } )
+				{
+					Stringizable::setStringFormat( format, base );
+					format.width = width;
+					format.useUpperCase = useUpperCase;
+					expectedResult = "[";
+
+					for( NType value : values )
+						expectedResult += ( ( ( expectedResult.size() > 1 ) ? ", " : "" ) + Numeric::toString( value, Stringizable::NONE, &format ) );
+
+					result = "[";
+					Numeric::toStringBatch( values.begin(), values.size(), format, ", ", result );
+					ASSERT_EQ( expectedResult, result ) << "base " << base << ", width " << width;
+				}
+			}
+		}
+}
+
+} // 'NumericTest' Namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of the 'NumericTest' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // 'QMXStdLib::Numeric' Test Functions
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -331,6 +465,76 @@ TEST( NumericTest, ToStringWorks )
 		ASSERT_EQ( string( "0x00000000DEADBEEF" ), Numeric::toString< uint64_t >( 3735928559u, Stringizable::NONE, &format ) );
 }
 
+TEST( NumericTest, ToStringMatchesStreams )
+{
+	// Perform unit test for 'toString' function against the stream-based formatter it replaced.
+
+		NumericTest::checkFormats< bool >( { false, true } );
+		NumericTest::checkFormats< char >( { 'A', 'z' } );
+		NumericTest::checkFormats< int8_t >( { -128, -1, 0, 65, 127 } );
+		NumericTest::checkFormats< uint8_t >( { 0, 65, 255 } );
+		NumericTest::checkFormats< int16_t >( { -32768, -1, 0, 12345 } );
+		NumericTest::checkFormats< uint16_t >( { 0, 65535 } );
+		NumericTest::checkFormats< int32_t >( { numeric_limits< int32_t >::min(), -1337, 0, 48879 } );
+		NumericTest::checkFormats< uint32_t >( { 0, 3735928559u } );
+		NumericTest::checkFormats< int64_t >( { numeric_limits< int64_t >::min(), -1, numeric_limits< int64_t >::max() } );
+		NumericTest::checkFormats< uint64_t >( { 0, numeric_limits< uint64_t >::max() } );
+		NumericTest::checkFormats< float >( { 0.0f, -2.71828f, 1.5e-7f, 3.4e12f, numeric_limits< float >::infinity() } );
+		NumericTest::checkFormats< double >(
+			{ 0.0, -3.14159, 0.000123456789, 1.0e21, -numeric_limits< double >::infinity(), numeric_limits< double >::quiet_NaN() }
+		);
+}
+
+TEST( NumericTest, ToStringBufferWorks )
+{
+	// Create local variables.
+
+		char buffer[ 32 ];
+		Stringizable::StringFormat format;
+		Expected< size_t > result = size_t( UNSET );
+
+	// Perform unit test for the buffer variant of the 'toString' function.
+
+		result = Numeric::toString< uint64_t >( 3735928559u, buffer, sizeof( buffer ), Stringizable::HEXIDECIMAL );
+		ASSERT_TRUE( result.hasValue() );
+		ASSERT_EQ( string( "0x00000000DEADBEEF" ), string( buffer, result.getValue() ) );
+		result = Numeric::toString< int32_t >( -1337, buffer, 5 );
+		ASSERT_EQ( string( "-1337" ), string( buffer, result.getValue() ) );
+		ASSERT_EQ( Error( "QMXStdLib", "Numeric::toString", "00000033" ), Numeric::toString< int32_t >( -1337, buffer, 4 ).getError() );
+		ASSERT_EQ( Error( "QMXStdLib", "Numeric::toString", "00000033" ), Numeric::toString< uint64_t >( 1, buffer, 17, Stringizable::HEXIDECIMAL ).getError() );
+		ASSERT_EQ( Error( "QMXStdLib", "Numeric::toString", "00000033" ), Numeric::toString< double >( 1.0e30, buffer, sizeof( buffer ) ).getError() );
+		ASSERT_EQ(
+			Error( "QMXStdLib", "Numeric::toString", "00000010" ),
+			Numeric::toString< int32_t >( 1, buffer, sizeof( buffer ), Stringizable::NONE ).getError()
+		);
+		Stringizable::setStringFormat( format, Stringizable::DECIMAL );
+		format.precision = 1000;
+		ASSERT_EQ( size_t( 1002 ), Numeric::toString< double >( 0.5, Stringizable::NONE, &format ).size() );
+}
+
+TEST( NumericTest, ToStringBatchWorks )
+{
+	// Create local variables.
+
+		Stringizable::StringFormat format;
+		string result = "xyzzy";
+
+	// Perform unit test for 'toStringBatch' function.
+
+		Stringizable::setStringFormat( format, Stringizable::HEXIDECIMAL );
+		Numeric::toStringBatch< uint32_t >( nullptr, 0, format, ",", result );
+		ASSERT_EQ( string( "xyzzy" ), result );
+		NumericTest::checkBatch< bool >( { true, false } );
+		NumericTest::checkBatch< uint8_t >( { 0, 255 } );
+		NumericTest::checkBatch< int16_t >( { -32768, -1, 0, 0x1234 } );
+		NumericTest::checkBatch< uint16_t >( { 0, 0xABCD } );
+		NumericTest::checkBatch< int32_t >( { numeric_limits< int32_t >::min(), -1337, 0, 48879 } );
+		NumericTest::checkBatch< uint32_t >( { 0, 3735928559u } );
+		NumericTest::checkBatch< int64_t >( { numeric_limits< int64_t >::min(), -1, 0x0123456789ABCDEF } );
+		NumericTest::checkBatch< uint64_t >( { 0, numeric_limits< uint64_t >::max(), 0xFEDCBA9876543210 } );
+		NumericTest::checkBatch< double >( { -3.14159, 1.0e100, 0.0 } );
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // End of 'NumericTest.cpp'
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,223 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// ObjectPoolTest.cpp
+// Robert M. Baker | Created : 16OCT26 | Last Modified : 17OCT26 by Robert M. Baker
+// Version : 2.3.0
+// This is a source file for 'QMXStdLibTest'; it defines a set of unit tests for the 'QMXStdLib::ObjectPool' class.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+//
+// This file is part of 'QMXStdLib'.
+//
+// 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option) any later version.
+//
+// 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Header Files
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../include/ObjectPoolTest.hpp"
+
+using namespace std;
+using namespace QMXStdLib;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Start of the 'ObjectPoolTest' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ObjectPoolTest
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Type Definitions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct Payload
+{
+	size_t value = 0;
+};
+
+class Widget : public Object< Widget, Payload >
+{
+public:
+
+	// Public Methods
+
+		size_t getValue() const
+		{
+			// Obtain locks.
+
+				SCOPED_READ_LOCK;
+
+			// Return value to calling routine.
+
+				return properties.value;
+		}
+
+private:
+
+	// Private Constructors
+
+		friend class Object< Widget, Payload >;
+
+		Widget()
+		{
+			// Do nothing.
+		}
+};
+
+class SharedWidget : public Object< SharedWidget >
+{
+private:
+
+	// Private Constructors
+
+		friend class Object< SharedWidget >;
+
+		SharedWidget()
+		{
+			// Do nothing.
+		}
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Function Definitions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void churn()
+{
+	// Create local variables.
+
+		SharedWidget::InstancePtrVector instances;
+
+	// Repeatedly create more instances than a thread may cache, then release them all.
+
+		for( size_t index = 0; index < ( ITERATION_COUNT / HELD_COUNT ); index++ )
+		{
+			for( size_t count = 0; count < HELD_COUNT; count++ )
+				instances.push_back( SharedWidget::create() );
+
+			instances.clear();
+		}
+}
+
+} // 'ObjectPoolTest' Namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of the 'ObjectPoolTest' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// 'QMXStdLib::ObjectPool' Test Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST( ObjectPoolTest, PoolAllocatorWorks )
+{
+	// Create local variables.
+
+		shared_ptr< ObjectPoolTest::Payload > instance;
+		ObjectPoolStatistics before = ObjectPool< ObjectPoolTest::Payload >::getStatistics();
+		ObjectPoolStatistics after;
+
+	// Perform unit test for 'PoolAllocator' class with a directly constructible type.
+
+		for( size_t index = 0; index < ITERATION_COUNT; index++ )
+		{
+			instance = allocate_shared< ObjectPoolTest::Payload >( PoolAllocator< ObjectPoolTest::Payload >() );
+			instance->value = index;
+			ASSERT_EQ( index, instance->value );
+			instance.reset();
+		}
+
+		after = ObjectPool< ObjectPoolTest::Payload >::getStatistics();
+		ASSERT_LE( after.missCount, ( before.missCount + 1 ) );
+		ASSERT_EQ( ( before.hitCount + before.missCount + ITERATION_COUNT ), ( after.hitCount + after.missCount ) );
+}
+
+TEST( ObjectPoolTest, CreateReusesBlocks )
+{
+	// Create local variables.
+
+		ObjectPoolTest::Widget::InstancePtr instance = ObjectPoolTest::Widget::create();
+		ObjectPoolStatistics before = ObjectPoolTest::Widget::getPoolStatistics();
+		ObjectPoolStatistics after;
+
+	// Perform unit test for 'create' method, verifying that steady-state creation never falls through to the heap.
+
+		instance->set( { 42 } );
+		ASSERT_EQ( 42u, instance->getValue() );
+		instance.reset();
+
+		for( size_t index = 0; index < ITERATION_COUNT; index++ )
+		{
+			instance = ObjectPoolTest::Widget::create();
+			ASSERT_TRUE( instance->isObjectInitialized() );
+			ASSERT_EQ( 0u, instance->getValue() );
+			instance.reset();
+		}
+
+		after = ObjectPoolTest::Widget::getPoolStatistics();
+		ASSERT_EQ( before.missCount, after.missCount );
+		ASSERT_EQ( ( before.hitCount + ITERATION_COUNT ), after.hitCount );
+}
+
+TEST( ObjectPoolTest, SetPoolEnabledWorks )
+{
+	// Create local variables.
+
+		ObjectPoolTest::Widget::InstancePtr instance;
+		ObjectPoolStatistics before;
+		ObjectPoolStatistics after;
+
+	// Perform unit test for 'setPoolEnabled' method.
+
+		ObjectPoolTest::Widget::setPoolEnabled( false );
+		before = ObjectPoolTest::Widget::getPoolStatistics();
+
+		for( size_t index = 0; index < ITERATION_COUNT; index++ )
+		{
+			instance = ObjectPoolTest::Widget::create();
+			instance.reset();
+		}
+
+		after = ObjectPoolTest::Widget::getPoolStatistics();
+		ObjectPoolTest::Widget::setPoolEnabled( true );
+		ASSERT_EQ( before.missCount, after.missCount );
+		ASSERT_EQ( before.hitCount, after.hitCount );
+		instance = ObjectPoolTest::Widget::create();
+		ASSERT_EQ( ( after.hitCount + 1 ), ObjectPoolTest::Widget::getPoolStatistics().hitCount );
+}
+
+TEST( ObjectPoolTest, ThreadsShareBlocks )
+{
+	// Create local variables.
+
+		boost::thread_group threads;
+		ObjectPoolStatistics before = ObjectPool< ObjectPoolTest::SharedWidget >::getStatistics();
+		ObjectPoolStatistics after;
+
+	// Perform unit test for exchanging blocks between threads through the shared free list.
+
+		for( size_t index = 0; index < THREAD_COUNT; index++ )
+			threads.add_thread( ( new boost::thread( ObjectPoolTest::churn ) ) );
+
+		threads.join_all();
+		after = ObjectPool< ObjectPoolTest::SharedWidget >::getStatistics();
+		ASSERT_EQ(
+			( THREAD_COUNT * ( ITERATION_COUNT / HELD_COUNT ) * HELD_COUNT ),
+			( ( after.hitCount + after.missCount ) - ( before.hitCount + before.missCount ) )
+		);
+		ASSERT_LE( ( after.missCount - before.missCount ), ( THREAD_COUNT * ( HELD_COUNT + OBJECTPOOL_CACHE_SIZE ) ) );
+		ASSERT_GE( after.sharedCount, ( after.missCount - before.missCount ) );
+		ObjectPool< ObjectPoolTest::SharedWidget >::trim();
+		ASSERT_EQ( 0u, ObjectPool< ObjectPoolTest::SharedWidget >::getStatistics().sharedCount );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of 'ObjectPoolTest.cpp'
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -87,6 +87,22 @@ TEST( ProgramOptionsTest, SaveConfigFileWorks )
 		boost::filesystem::remove( testSaveFile );
 }
 
+TEST( ProgramOptionsTest, TryParseConfigFileWorks )
+{
+	// Create local variables.
+
+		ProgramOptions::InstancePtr instance = ProgramOptions::create();
+		Expected< void > result = PROGRAM_OPTIONS.tryParseConfigFile( ( BASE_PATH + "NonExistent" ) );
+
+	// Perform unit test for 'tryParseConfigFile' method.
+
+		ASSERT_FALSE( result );
+		ASSERT_STREQ( "ProgramOptions::parseConfigFile", result.getError().getModuleID() );
+		ASSERT_STREQ( "00000011", result.getError().getEventIndex() );
+		ASSERT_TRUE( PROGRAM_OPTIONS.tryParseConfigFile( ( BASE_PATH + "Test.cfg" ) ) );
+		ASSERT_EQ( "FooBar", PROGRAM_OPTIONS.getConfigOption( "alpha" ) );
+}
+
 TEST( ProgramOptionsTest, IsToggleOptionPresentWorks )
 {
 	// Create local variables.
@@ -1,6 +1,6 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // QMXExceptionTest.cpp
-// Robert M. Baker | Created : 29FEB12 | Last Modified : 29AUG19 by Robert M. Baker
+// Robert M. Baker | Created : 29FEB12 | Last Modified : 17OCT26 by Robert M. Baker
 // Version : 2.3.0
 // This is a source file for 'QMXStdLibTest'; it defines a set of unit tests for the 'QMXStdLib::QMXException' class.
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -107,6 +107,68 @@ TEST( QMXExceptionTest, CustomConstructedWorks )
 		}
 }
 
+TEST( QMXExceptionTest, CopiesShareFormattedData )
+{
+	// Create local variables.
+
+		QMXException original( "QMXStdLib", "Class::method", "DEADBEEF", "12345" );
+		QMXException copy = original;
+
+	// Perform unit test for copying, verifying that all copies share a single formatted message.
+
+		ASSERT_EQ( original.getEventData(), copy.getEventData() );
+		ASSERT_EQ( original.what(), copy.what() );
+		ASSERT_EQ( original.getMessage(), copy.getMessage() );
+		ASSERT_STREQ( "QMXStdLib.EventMessages.<LL>_<CC>.DEADBEEF", copy.getMessage() );
+}
+
+TEST( QMXExceptionTest, ThrowMacrosWork )
+{
+	// Create local variables.
+
+		auto formatNested = []() -> string {
+			try
+			{
+				QMX_THROW_X( "QMXStdLib", "Class::inner", "DEADBEEF", "inner" );
+			}
+			catch( const QMXException& except )
+			{
+				return except.getEventData();
+			}
+
+			return "";
+		};
+
+	// Perform unit test for 'QMX_THROW_X' macro, verifying that formatting state does not leak between throws and that nested throws are isolated.
+
+		try
+		{
+			QMX_THROW_X( "QMXStdLib", "Class::method", "DEADBEEF", boolalpha << true << ", " << hex << 255 );
+		}
+		catch( const QMXException& except )
+		{
+			ASSERT_STREQ( "true, ff", except.getEventData() );
+		}
+
+		try
+		{
+			QMX_THROW_X( "QMXStdLib", "Class::method", "DEADBEEF", true << ", " << 255 );
+		}
+		catch( const QMXException& except )
+		{
+			ASSERT_STREQ( "1, 255", except.getEventData() );
+		}
+
+		try
+		{
+			QMX_THROW_X( "QMXStdLib", "Class::method", "DEADBEEF", "outer, " << formatNested() << ", outer" );
+		}
+		catch( const QMXException& except )
+		{
+			ASSERT_STREQ( "outer, inner, outer", except.getEventData() );
+		}
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // End of 'QMXExceptionTest.cpp'
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
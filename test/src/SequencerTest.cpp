@@ -1,6 +1,6 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // SequencerTest.cpp
-// Robert M. Baker | Created : 29FEB12 | Last Modified : 31AUG19 by Robert M. Baker
+// Robert M. Baker | Created : 29FEB12 | Last Modified : 16OCT26 by Robert M. Baker
 // Version : 2.3.0
 // This is a source file for 'QMXStdLibTest'; it defines a set of unit tests for the 'QMXStdLib::Sequencer' class.
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -510,6 +510,48 @@ TEST( SequencerTest, OperatorPostDecrementFloatingPointLoopedOscillateWorks )
 		}
 }
 
+TEST( SequencerTest, LockPoliciesWork )
+{
+	// Create local variables.
+
+		int expectedResults[] = {
+			0,
+			2,
+			4,
+			6,
+			7,
+			0,
+			2,
+			4,
+			6,
+			7
+		};
+
+		Sequencer< int, NullLock >::InstancePtr nullInstance = Sequencer< int, NullLock >::create();
+		Sequencer< int, SpinLock >::InstancePtr spinInstance = Sequencer< int, SpinLock >::create();
+		Sequencer< int, SharedLock >::InstancePtr sharedInstance = Sequencer< int, SharedLock >::create();
+		Sequencer< int, NullLock >::InstancePtr cloneInstance = Sequencer< int, NullLock >::create();
+
+	// Perform unit test for each lock policy, verifying the sequence is identical regardless of the policy used.
+
+		nullInstance->set( { true, Sequencer< int, NullLock >::LINEAR, 0, 7, 2, 0 } );
+		spinInstance->set( { true, Sequencer< int, SpinLock >::LINEAR, 0, 7, 2, 0 } );
+		sharedInstance->set( { true, Sequencer< int, SharedLock >::LINEAR, 0, 7, 2, 0 } );
+
+		for( size_t index = 0; index < ARRAY_SIZE( expectedResults ); index++ )
+		{
+			ASSERT_EQ( expectedResults[ index ], nullInstance->getValue() );
+			ASSERT_EQ( expectedResults[ index ], spinInstance->getValue() );
+			ASSERT_EQ( expectedResults[ index ], sharedInstance->getValue() );
+			(*nullInstance)++;
+			(*spinInstance)++;
+			(*sharedInstance)++;
+		}
+
+		nullInstance->clone( cloneInstance );
+		ASSERT_EQ( nullInstance->getValue(), cloneInstance->getValue() );
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // End of 'SequencerTest.cpp'
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
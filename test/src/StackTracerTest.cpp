@@ -1,6 +1,6 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // StackTracerTest.cpp
-// Robert M. Baker | Created : 04MAR12 | Last Modified : 29AUG19 by Robert M. Baker
+// Robert M. Baker | Created : 04MAR12 | Last Modified : 16OCT26 by Robert M. Baker
 // Version : 2.3.0
 // This is a source file for 'QMXStdLibTest'; it defines a set of unit tests for the 'QMXStdLib::StackTracer' class.
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -124,6 +124,17 @@ void threadMain( const string& targetID, uint32_t targetIndex )
 
 				break;
 			}
+
+			case 6:
+			{
+				StackTracer::setThreadID( targetID );
+				StackTracer::addThread( ( targetID + "Main" ) );
+				StackTracer::push( "Class::method" );
+				StackTracer::push( "Class::otherMethod" );
+				StackTracer::pop();
+
+				break;
+			}
 		}
 }
 
@@ -273,6 +284,44 @@ TEST( StackTracerTest, GetStackTraceWorks )
 		StackTracer::reset();
 }
 
+TEST( StackTracerTest, GetAllStackTracesWorks )
+{
+	// Create local variables.
+
+		boost::thread_group threads;
+		StringMap result;
+		string separator = STACKTRACER_ENTRY_SEPARATOR;
+
+	// Prepare stack tracer for testing.
+
+		StackTracer::setEnabled( true );
+
+	// Perform unit test for 'getAllStackTraces' method.
+
+		ASSERT_TRUE( StackTracer::getAllStackTraces().empty() );
+		threads.add_thread( ( new boost::thread( StackTracerTest::threadMain, "ThreadA", 6 ) ) );
+		threads.add_thread( ( new boost::thread( StackTracerTest::threadMain, "ThreadB", 6 ) ) );
+		threads.add_thread( ( new boost::thread( StackTracerTest::threadMain, "ThreadC", 6 ) ) );
+		threads.add_thread( ( new boost::thread( StackTracerTest::threadMain, "ThreadD", 6 ) ) );
+		threads.add_thread( ( new boost::thread( StackTracerTest::threadMain, "ThreadE", 6 ) ) );
+		threads.join_all();
+		result = StackTracer::getAllStackTraces();
+		ASSERT_EQ( 5u, result.size() );
+
+		for( const auto& id : { "ThreadA", "ThreadB", "ThreadC", "ThreadD", "ThreadE" } )
+			ASSERT_EQ( ( string( id ) + "Main" + separator + "Class::method" ), result[ id ] );
+
+		StackTracer::setEnabled( false );
+		ASSERT_TRUE( StackTracer::getAllStackTraces().empty() );
+
+	// Cleanup stack tracer.
+
+		StackTracer::reset();
+		StackTracer::setEnabled( true );
+		ASSERT_TRUE( StackTracer::getAllStackTraces().empty() );
+		StackTracer::reset();
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // End of 'StackTracerTest.cpp'
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
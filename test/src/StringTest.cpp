@@ -1,6 +1,6 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // StringTest.cpp
-// Robert M. Baker | Created : 20FEB12 | Last Modified : 10SEP19 by Robert M. Baker
+// Robert M. Baker | Created : 20FEB12 | Last Modified : 17OCT26 by Robert M. Baker
 // Version : 2.3.0
 // This is a source file for 'QMXStdLibTest'; it defines a set of unit tests for the 'QMXStdLib::String' functions.
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -26,6 +26,89 @@
 using namespace std;
 using namespace QMXStdLib;
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Start of the 'StringTest' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace StringTest
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Function Definitions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void encode( const u32string& source, string& utf8, u16string& utf16 )
+{
+	// Encode the specified code points as UTF-8 and UTF-16, independently of the library's transcoder.
+
+		utf8.clear();
+		utf16.clear();
+
+		for( char32_t codePoint : source )
+		{
+			if( codePoint < 0x80 )
+				utf8 += static_cast< char >( codePoint );
+			else if( codePoint < 0x800 )
+			{
+				utf8 += static_cast< char >( 0xC0 | ( codePoint >> 6 ) );
+				utf8 += static_cast< char >( 0x80 | ( codePoint & 0x3F ) );
+			}
+			else if( codePoint < 0x10000 )
+			{
+				utf8 += static_cast< char >( 0xE0 | ( codePoint >> 12 ) );
+				utf8 += static_cast< char >( 0x80 | ( ( codePoint >> 6 ) & 0x3F ) );
+				utf8 += static_cast< char >( 0x80 | ( codePoint & 0x3F ) );
+			}
+			else
+			{
+				utf8 += static_cast< char >( 0xF0 | ( codePoint >> 18 ) );
+				utf8 += static_cast< char >( 0x80 | ( ( codePoint >> 12 ) & 0x3F ) );
+				utf8 += static_cast< char >( 0x80 | ( ( codePoint >> 6 ) & 0x3F ) );
+				utf8 += static_cast< char >( 0x80 | ( codePoint & 0x3F ) );
+			}
+
+			if( codePoint < 0x10000 )
+				utf16 += static_cast< char16_t >( codePoint );
+			else
+			{
+				utf16 += static_cast< char16_t >( 0xD800 + ( ( codePoint - 0x10000 ) >> 10 ) );
+				utf16 += static_cast< char16_t >( 0xDC00 + ( ( codePoint - 0x10000 ) & 0x3FF ) );
+			}
+		}
+}
+
+u32string makeText( size_t length, size_t seed )
+{
+	// Create local variables.
+
+		const char32_t alphabet[] = { U'a', U'Z', U' ', U'.', 0xE9, 0x3B2, 0x4E2D, 0x6587, 0x8A9E, 0xFF01, 0xE000, 0xFFFD, 0x1F600, 0x10FFFF };
+		u32string result;
+
+	// Build a text of the specified length out of long ASCII and CJK runs, broken up by code points of every encoded length.
+
+		for( size_t index = 0; index < length; index++ )
+		{
+			seed = ( ( seed * 1103515245 ) + 12345 );
+
+			if( ( ( seed >> 16 ) % 8 ) == 0 )
+				result += alphabet[ ( ( seed >> 8 ) % ARRAY_SIZE( alphabet ) ) ];
+			else
+				result += (
+					( ( index / 40 ) % 2 ) ? static_cast< char32_t >( 0x4E00 + ( ( seed >> 12 ) % 0x5000 ) ) : static_cast< char32_t >( U'a' + ( index % 26 ) )
+				);
+		}
+
+	// Return result to calling routine.
+
+		return result;
+}
+
+} // 'StringTest' Namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of the 'StringTest' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // 'QMXStdLib::String' Test Functions
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -142,6 +225,140 @@ TEST( StringTest, ToUTF32Works )
 		}
 }
 
+TEST( StringTest, TranscoderISAsAgree )
+{
+	// Create local variables.
+
+		String::TranscoderISA supportedISA = String::setTranscoderISA( String::AVX2 );
+		u32string utf32;
+		u16string utf16;
+		string utf8;
+
+	// Perform unit test for the UTF transcoding functions with every supported instruction set, across block boundaries.
+
+		for( int isa = String::SCALAR; isa <= supportedISA; isa++ )
+		{
+			ASSERT_EQ( isa, String::setTranscoderISA( static_cast< String::TranscoderISA >( isa ) ) );
+			ASSERT_EQ( isa, String::getTranscoderISA() );
+
+			for( size_t length = 0; length < 200; length += 7 )
+			{
+				for( size_t seed = 1; seed < 6; seed++ )
+				{
+					utf32 = StringTest::makeText( length, seed );
+					StringTest::encode( utf32, utf8, utf16 );
+					ASSERT_EQ( utf16, String::toUTF16( utf8 ) );
+					ASSERT_EQ( utf32, String::toUTF32( utf8 ) );
+					ASSERT_EQ( utf8, String::toUTF8( utf16 ) );
+					ASSERT_EQ( utf8, String::toUTF8( utf32 ) );
+				}
+			}
+		}
+
+		String::setTranscoderISA( supportedISA );
+}
+
+TEST( StringTest, TranscoderValidationWorks )
+{
+	// Create local variables.
+
+		string invalidUTF8[] = {
+			"\x80",
+			"\xC0\xAF",
+			"\xC1\xBF",
+			"\xE0\x9F\xBF",
+			"\xED\xA0\x80",
+			"\xE4\xB8",
+			"\xF0\x8F\xBF\xBF",
+			"\xF4\x90\x80\x80",
+			"\xF5\x80\x80\x80",
+			"\xFF"
+		};
+
+		u16string invalidUTF16[] = { u16string( 1, 0xD800 ), u16string( 1, 0xDC00 ), u16string( { 0xD800, u'a' } ), u16string( { 0xDC00, 0xD800 } ) };
+		u32string invalidUTF32[] = { u32string( 1, 0xD800 ), u32string( 1, 0xDFFF ), u32string( 1, 0x110000 ), u32string( 1, 0xFFFFFFFF ) };
+		String::TranscoderISA supportedISA = String::setTranscoderISA( String::AVX2 );
+		u32string prefixes[] = { U"", u32string( 40, U'a' ), u32string( 40, 0x4E2D ) };
+		u32string suffix( 40, 0x6587 );
+		u16string prefix16;
+		string prefix8;
+		u16string ignored;
+
+	// Perform unit test for the UTF transcoding functions with malformed input, both alone and following runs the vector kernels handle.
+
+		for( int isa = String::SCALAR; isa <= supportedISA; isa++ )
+		{
+			String::setTranscoderISA( static_cast< String::TranscoderISA >( isa ) );
+
+			for( auto& prefix : prefixes )
+			{
+				StringTest::encode( prefix, prefix8, prefix16 );
+
+				for( auto& value : invalidUTF8 )
+				{
+					ASSERT_THROW( String::toUTF16( ( prefix8 + value + prefix8 ) ), QMXException );
+					ASSERT_THROW( String::toUTF32( ( prefix8 + value + prefix8 ) ), QMXException );
+				}
+
+				for( auto& value : invalidUTF16 )
+				{
+					ASSERT_THROW( String::toUTF8( ( prefix16 + value + prefix16 ) ), QMXException );
+				}
+
+				for( auto& value : invalidUTF32 )
+				{
+					ASSERT_THROW( String::toUTF8( ( prefix + value + suffix ) ), QMXException );
+				}
+			}
+		}
+
+		String::setTranscoderISA( supportedISA );
+
+		try
+		{
+			String::toUTF16( "\xC0\xAF" );
+			FAIL();
+		}
+		catch( const QMXException& except )
+		{
+			ASSERT_STREQ( "String::toUTF16", except.getModuleID() );
+			ASSERT_STREQ( "0000002F", except.getEventIndex() );
+		}
+}
+
+TEST( StringTest, TranscoderBuffersWork )
+{
+	// Create local variables.
+
+		u32string utf32 = StringTest::makeText( 100, 7 );
+		u16string utf16;
+		string utf8;
+		char buffer8[ 512 ];
+		char16_t buffer16[ 512 ];
+		char32_t buffer32[ 512 ];
+		Expected< size_t > result( 0 );
+
+	// Perform unit test for the UTF transcoding functions which write into a caller-provided buffer.
+
+		StringTest::encode( utf32, utf8, utf16 );
+		result = String::toUTF16( utf8, buffer16, ARRAY_SIZE( buffer16 ) );
+		ASSERT_EQ( utf16, u16string( buffer16, result.getValue() ) );
+		result = String::toUTF32( utf8, buffer32, ARRAY_SIZE( buffer32 ) );
+		ASSERT_EQ( utf32, u32string( buffer32, result.getValue() ) );
+		result = String::toUTF8( utf16, buffer8, ARRAY_SIZE( buffer8 ) );
+		ASSERT_EQ( utf8, string( buffer8, result.getValue() ) );
+		result = String::toUTF8( utf32, buffer8, ARRAY_SIZE( buffer8 ) );
+		ASSERT_EQ( utf8, string( buffer8, result.getValue() ) );
+		ASSERT_EQ( utf8.size(), String::toUTF8( utf32, buffer8, utf8.size() ).getValue() );
+		ASSERT_EQ( utf16.size(), String::toUTF16( utf8, buffer16, utf16.size() ).getValue() );
+		ASSERT_STREQ( "00000030", String::toUTF8( utf32, buffer8, ( utf8.size() - 1 ) ).getError().getEventIndex() );
+		ASSERT_STREQ( "00000030", String::toUTF8( utf16, buffer8, ( utf8.size() - 1 ) ).getError().getEventIndex() );
+		ASSERT_STREQ( "00000030", String::toUTF16( utf8, buffer16, ( utf16.size() - 1 ) ).getError().getEventIndex() );
+		ASSERT_STREQ( "00000030", String::toUTF32( utf8, buffer32, ( utf32.size() - 1 ) ).getError().getEventIndex() );
+		ASSERT_STREQ( "0000002F", String::toUTF32( "\xE4\xB8", buffer32, ARRAY_SIZE( buffer32 ) ).getError().getEventIndex() );
+		ASSERT_EQ( 0u, String::toUTF16( "", buffer16, 0 ).getValue() );
+}
+
 TEST( StringTest, IsAllWhitespaceWorks )
 {
 	// Perform unit test for 'isAllWhitespace' function.
@@ -224,6 +441,97 @@ TEST( StringTest, FindReplaceWorks )
 		ASSERT_EQ( string( "Things without all remedy should be without regard." ), testValue );
 }
 
+TEST( StringTest, StripInPlaceWorks )
+{
+	// Create local variables.
+
+		string testValue = "How now brown cow!";
+
+	// Perform unit test for 'stripInPlace' function.
+
+		String::stripInPlace( testValue, "xyzzy" );
+		ASSERT_EQ( string( "How now brown cow!" ), testValue );
+		String::stripInPlace( testValue, "" );
+		ASSERT_EQ( string( "How now brown cow!" ), testValue );
+		String::stripInPlace( testValue, "ow" );
+		ASSERT_EQ( string( "H n brn c!" ), testValue );
+		String::stripInPlace( testValue, "H n brn c!" );
+		ASSERT_EQ( string( "" ), testValue );
+}
+
+TEST( StringTest, CaseInPlaceWorks )
+{
+	// Create local variables.
+
+		string testValue;
+		string expectedValue;
+		boost::locale::generator localeGenerator;
+
+	// Set global locale.
+
+		locale::global( localeGenerator( "en_US.UTF-8" ) );
+
+	// Perform unit test for 'toUpperInPlace' and 'toLowerInPlace' functions on every ASCII character, at every offset of a vector block.
+
+		for( int index = 0; index < 128; index++ )
+			testValue += static_cast< char >( index );
+
+		for( size_t offset = 0; offset < 16; offset++ )
+		{
+			expectedValue = boost::algorithm::to_upper_copy( testValue.substr( offset ), locale::classic() );
+			string upperValue = testValue.substr( offset );
+			String::toUpperInPlace( upperValue );
+			ASSERT_EQ( expectedValue, upperValue );
+
+			expectedValue = boost::algorithm::to_lower_copy( testValue.substr( offset ), locale::classic() );
+			string lowerValue = testValue.substr( offset );
+			String::toLowerInPlace( lowerValue );
+			ASSERT_EQ( expectedValue, lowerValue );
+		}
+
+	// Perform unit test for the 'boost::locale' fallback on a string with non-ASCII characters past the first vector block.
+
+		testValue = u8"Whose woods these are I think I know; βετα/ΒΕΤΑ";
+		String::toUpperInPlace( testValue );
+		ASSERT_EQ( string( u8"WHOSE WOODS THESE ARE I THINK I KNOW; ΒΕΤΑ/ΒΕΤΑ" ), testValue );
+		String::toLowerInPlace( testValue );
+		ASSERT_EQ( string( u8"whose woods these are i think i know; βετα/βετα" ), testValue );
+}
+
+TEST( StringTest, FindReplaceInPlaceWorks )
+{
+	// Create local variables.
+
+		string testValue = "Things without all remedy should be without regard.";
+		string expectedValue;
+		string finds[] = { "a", "aa", "ab", "aab", "b" };
+		string replaces[] = { "", "b", "ba", "aaa", "abab" };
+
+	// Perform unit test for 'findReplaceInPlace' function.
+
+		String::findReplaceInPlace( testValue, "", "#" );
+		ASSERT_EQ( string( "Things without all remedy should be without regard." ), testValue );
+		String::findReplaceInPlace( testValue, "without", "with" );
+		ASSERT_EQ( string( "Things with all remedy should be with regard." ), testValue );
+		String::findReplaceInPlace( testValue, "with", "without" );
+		ASSERT_EQ( string( "Things without all remedy should be without regard." ), testValue );
+		String::findReplaceInPlace( testValue, " ", "" );
+		ASSERT_EQ( string( "Thingswithoutallremedyshouldbewithoutregard." ), testValue );
+
+	// Perform unit test for 'findReplaceInPlace' function against 'boost::algorithm::replace_all_copy', on strings with overlapping matches.
+
+		for( const auto& find : finds )
+		{
+			for( const auto& replace : replaces )
+			{
+				testValue = "aaabaabbaaaabababaa";
+				expectedValue = boost::algorithm::replace_all_copy( testValue, find, replace );
+				String::findReplaceInPlace( testValue, find, replace );
+				ASSERT_EQ( expectedValue, testValue );
+			}
+		}
+}
+
 TEST( StringTest, TokenizeWorks )
 {
 	// Create local variables.
@@ -245,6 +553,58 @@ TEST( StringTest, TokenizeWorks )
 		ASSERT_EQ( string( "faces!" ), tokens[ 3 ] );
 }
 
+TEST( StringTest, TokenizerWorks )
+{
+	// Create local variables.
+
+		string delimiterSets[] = { ",", ",;|", string( String::Tokenizer::WHITESPACE ), "abcdefghij" };
+		string alphabet = "xy,;| \tabj";
+		string source;
+		StringDeque expectedTokens;
+		vector< string_view > tokens;
+		String::Tokenizer tokenizer( "Bitches,love;;smiley|faces!", ",;|" );
+		String::Tokenizer::Iterator iterator;
+		mt19937 generator( 1 );
+
+	// Perform unit test for 'Tokenizer' class on the edge cases 'boost::algorithm::split' defines.
+
+		for( string_view token : String::Tokenizer( "" ) )
+			tokens.push_back( token );
+
+		ASSERT_EQ( vector< string_view >( { "" } ), tokens );
+		String::tokenize( tokens, "  Bitches \t love  " );
+		ASSERT_EQ( vector< string_view >( { "", "Bitches", "love", "" } ), tokens );
+		iterator = tokenizer.begin();
+		ASSERT_EQ( string_view( "Bitches" ), *iterator++ );
+		ASSERT_EQ( size_t( 4 ), iterator->size() );
+		ASSERT_EQ( string_view( "smiley" ), *( ++iterator ) );
+		ASSERT_EQ( string_view( "faces!" ), *( ++iterator ) );
+		ASSERT_TRUE( ++iterator == tokenizer.end() );
+
+	// Perform unit test for 'Tokenizer' class against 'boost::algorithm::split', on random strings long enough to take the vector scan.
+
+		for( const auto& delimiters : delimiterSets )
+		{
+			for( size_t index = 0; index < 200; index++ )
+			{
+				source.clear();
+
+				for( size_t length = ( generator() % 80 ); length; length-- )
+					source += alphabet[ generator() % alphabet.size() ];
+
+				boost::algorithm::split( expectedTokens, source, boost::algorithm::is_any_of( delimiters ), boost::algorithm::token_compress_on );
+				String::tokenize( tokens, source, delimiters );
+				ASSERT_EQ( expectedTokens.size(), tokens.size() );
+
+				for( size_t token = 0; token < tokens.size(); token++ )
+				{
+					ASSERT_EQ( expectedTokens[ token ], tokens[ token ] );
+					ASSERT_TRUE( ( tokens[ token ].data() >= source.data() ) && ( tokens[ token ].data() <= ( source.data() + source.size() ) ) );
+				}
+			}
+		}
+}
+
 TEST( StringTest, ToValueWorks )
 {
 	// Perform unit test for 'ToValue' function.
@@ -323,6 +683,69 @@ TEST( StringTest, ToValueWorks )
 		ASSERT_DOUBLE_EQ( 3.14159, String::toValue< double >( "3.14159" ) );
 }
 
+TEST( StringTest, TryToValueWorks )
+{
+	// Create local variables.
+
+		Error malformedError( "QMXStdLib", "String::toValue", "00000031" );
+		Error rangeError( "QMXStdLib", "String::toValue", "00000032" );
+
+	// Perform unit test for 'tryToValue' function on well-formed input.
+
+		ASSERT_EQ( 42, String::tryToValue< int >( " \t42\n" ).getValue() );
+		ASSERT_EQ( 42, String::tryToValue< int >( "+42" ).getValue() );
+		ASSERT_EQ( -128, String::tryToValue< int8_t >( "-128" ).getValue() );
+		ASSERT_EQ( 255, String::tryToValue< uint8_t >( "0XfF", Stringizable::HEXIDECIMAL ).getValue() );
+		ASSERT_EQ( 5, String::tryToValue< uint8_t >( "101", Stringizable::BINARY ).getValue() );
+		ASSERT_EQ( -1, String::tryToValue< int64_t >( "-1", Stringizable::OCTAL ).getValue() );
+		ASSERT_EQ( 0U, String::tryToValue< uint32_t >( "-0", Stringizable::HEXIDECIMAL ).getValue() );
+		ASSERT_DOUBLE_EQ( -0.5, String::tryToValue< double >( "-5e-1" ).getValue() );
+		ASSERT_FALSE( String::tryToValue< bool >( "no" ).getValue() );
+
+	// Perform unit test for 'tryToValue' function on malformed input.
+
+		ASSERT_EQ( malformedError, String::tryToValue< int >( "" ).getError() );
+		ASSERT_EQ( malformedError, String::tryToValue< int >( "12abc" ).getError() );
+		ASSERT_EQ( malformedError, String::tryToValue< int >( "1 2" ).getError() );
+		ASSERT_EQ( malformedError, String::tryToValue< int >( "0x", Stringizable::HEXIDECIMAL ).getError() );
+		ASSERT_EQ( malformedError, String::tryToValue< int >( "0b102", Stringizable::BINARY ).getError() );
+		ASSERT_EQ( malformedError, String::tryToValue< int >( "-101", Stringizable::BINARY ).getError() );
+		ASSERT_EQ( malformedError, String::tryToValue< int >( "8", Stringizable::OCTAL ).getError() );
+		ASSERT_EQ( malformedError, String::tryToValue< float >( "2.5f" ).getError() );
+		ASSERT_EQ( malformedError, String::tryToValue< bool >( "maybe" ).getError() );
+
+	// Perform unit test for 'tryToValue' function on out-of-range input.
+
+		ASSERT_EQ( rangeError, String::tryToValue< int8_t >( "128" ).getError() );
+		ASSERT_EQ( rangeError, String::tryToValue< uint64_t >( "18446744073709551616" ).getError() );
+		ASSERT_EQ( rangeError, String::tryToValue< uint8_t >( "0x100", Stringizable::HEXIDECIMAL ).getError() );
+		ASSERT_EQ( rangeError, String::tryToValue< int8_t >( "-0x81", Stringizable::HEXIDECIMAL ).getError() );
+		ASSERT_EQ( rangeError, String::tryToValue< uint8_t >( "-1", Stringizable::OCTAL ).getError() );
+		ASSERT_EQ( rangeError, String::tryToValue< uint8_t >( "0b100000000", Stringizable::BINARY ).getError() );
+		ASSERT_EQ( rangeError, String::tryToValue< uint64_t >( "0x10000000000000000", Stringizable::HEXIDECIMAL ).getError() );
+		ASSERT_EQ( rangeError, String::tryToValue< double >( "1e999" ).getError() );
+		ASSERT_EQ( 0, String::toValue< int8_t >( "128" ) );
+}
+
+TEST( StringTest, ToValuesWorks )
+{
+	// Create local variables.
+
+		vector< string_view > fields;
+		int32_t values[ 5 ] = { UNSET };
+
+	// Perform unit test for 'toValues' function.
+
+		String::tokenize( fields, "7, -3, 127, 2147483647, 9", "," );
+		ASSERT_EQ( size_t( 5 ), String::toValues( fields.data(), fields.size(), values ) );
+		ASSERT_EQ( numeric_limits< int32_t >::max(), values[ 3 ] );
+		ASSERT_EQ( 9, values[ 4 ] );
+		String::tokenize( fields, "0x7,-3,xyz,10,9", "," );
+		ASSERT_EQ( size_t( 2 ), String::toValues( fields.data(), fields.size(), values, Stringizable::HEXIDECIMAL ) );
+		ASSERT_EQ( -3, values[ 1 ] );
+		ASSERT_EQ( 127, values[ 2 ] );
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // End of 'StringTest.cpp'
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,223 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// TaskPoolTest.cpp
+// Robert M. Baker | Created : 16OCT26 | Last Modified : 17OCT26 by Robert M. Baker
+// Version : 2.3.0
+// This is a source file for 'QMXStdLibTest'; it defines a set of unit tests for the 'QMXStdLib::TaskPool' class.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+//
+// This file is part of 'QMXStdLib'.
+//
+// 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option) any later version.
+//
+// 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Header Files
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../include/TaskPoolTest.hpp"
+
+using namespace std;
+using namespace QMXStdLib;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Start of the 'TaskPoolTest' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace TaskPoolTest
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Function Definitions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void sumRange( TaskPool* pool, const TaskGroupPtr& group, const uint64_t first, const uint64_t last, atomic< uint64_t >* total )
+{
+	// Create local variables.
+
+		uint64_t result = UNSET;
+		uint64_t middle = ( first + ( ( last - first ) / 2 ) );
+
+	// Sum range directly if it is small, otherwise split it and submit both halves back to the pool.
+
+		if( ( last - first ) <= 64 )
+		{
+			for( uint64_t index = first; index < last; index++ )
+				result += index;
+
+			total->fetch_add( result );
+		}
+		else
+		{
+			pool->submit( group, sumRange, pool, group, first, middle, total );
+			pool->submit( group, sumRange, pool, group, middle, last, total );
+		}
+}
+
+void spinUntilInterrupted( atomic< size_t >* enterCount )
+{
+	// Execute main code.
+
+		enterCount->fetch_add( 1 );
+
+		while( true )
+			boost::this_thread::interruption_point();
+}
+
+void submitUntilStopped( TaskPool* pool, const TaskGroupPtr& group, vector< future< void > >* results )
+{
+	// Submit empty tasks until the pool rejects one.
+
+		try
+		{
+			while( true )
+				results->push_back( pool->submit( group, [](){} ) );
+		}
+		catch( const QMXException& except )
+		{
+			// Do nothing.
+		}
+}
+
+} // 'TaskPoolTest' Namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of the 'TaskPoolTest' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// 'QMXStdLib::TaskPool' Test Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST( TaskPoolTest, StartWorks )
+{
+	// Create local variables.
+
+		TaskPool::InstancePtr instance = TaskPool::create();
+
+	// Perform unit test for 'start' method.
+
+		ASSERT_EQ( 0, instance->getWorkerCount() );
+		instance->start( 3 );
+		ASSERT_EQ( 3, instance->getWorkerCount() );
+		ASSERT_THROW( instance->start(), QMXException );
+		instance->stop();
+		instance->start();
+		ASSERT_LT( 0, instance->getWorkerCount() );
+}
+
+TEST( TaskPoolTest, StopWorks )
+{
+	// Create local variables.
+
+		TaskPool::InstancePtr instance = TaskPool::create();
+		TaskGroupPtr group = make_shared< TaskGroup >();
+		atomic< size_t > enterCount( UNSET );
+		future< void > result;
+
+	// Perform unit test for 'stop' method.
+
+		ASSERT_THROW( instance->stop(), QMXException );
+		instance->start( 1 );
+		result = instance->submit( group, TaskPoolTest::spinUntilInterrupted, &enterCount );
+
+		while( !enterCount.load() );
+			// Empty Loop
+
+		instance->stop();
+		ASSERT_EQ( 0, instance->getWorkerCount() );
+		ASSERT_EQ( 0, group->getPendingCount() );
+		ASSERT_THROW( result.get(), ThreadInterrupted );
+		ASSERT_THROW( instance->submit( group, TaskPoolTest::spinUntilInterrupted, &enterCount ), QMXException );
+
+		for( size_t index = 0; index < 100; index++ )
+		{
+			vector< future< void > > results;
+
+			instance->start( 2 );
+			boost::thread submitter( TaskPoolTest::submitUntilStopped, instance.get(), group, &results );
+			boost::this_thread::yield();
+			instance->stop( false );
+			submitter.join();
+			ASSERT_EQ( 0, group->getPendingCount() );
+
+			for( auto& entry : results )
+				ASSERT_NO_THROW( entry.get() );
+		}
+}
+
+TEST( TaskPoolTest, SubmitWorks )
+{
+	// Create local variables.
+
+		TaskPool::InstancePtr instance = TaskPool::create();
+		TaskGroupPtr group = make_shared< TaskGroup >();
+		vector< future< size_t > > results;
+		atomic< uint64_t > total( UNSET );
+
+	// Perform unit test for 'submit' method.
+
+		ASSERT_THROW( instance->submit( group, []( size_t value ){ return value; }, 0 ), QMXException );
+		instance->start( 4 );
+
+		for( size_t index = 0; index < 1000; index++ )
+			results.push_back( instance->submit( group, []( size_t value ){ return ( value * 2 ); }, index ) );
+
+		group->wait();
+		ASSERT_EQ( 0, group->getPendingCount() );
+
+		for( size_t index = 0; index < results.size(); index++ )
+		{
+			ASSERT_EQ( ( index * 2 ), results[ index ].get() );
+		}
+
+		instance->submit( group, TaskPoolTest::sumRange, instance.get(), group, 0ull, 1000000ull, &total );
+		group->wait();
+		ASSERT_EQ( 499999500000ull, total.load() );
+		ASSERT_THROW( instance->submit( group, [](){ throw runtime_error( "Task failed." ); } ).get(), runtime_error );
+}
+
+TEST( TaskPoolTest, InterruptWorks )
+{
+	// Create local variables.
+
+		TaskPool::InstancePtr instance = TaskPool::create();
+		TaskGroupPtr groupA = make_shared< TaskGroup >();
+		TaskGroupPtr groupB = make_shared< TaskGroup >();
+		atomic< size_t > enterCount( UNSET );
+		vector< future< void > > results;
+
+	// Perform unit test for 'interrupt' method.
+
+		instance->start( 2 );
+
+		for( size_t index = 0; index < 4; index++ )
+			results.push_back( instance->submit( groupA, TaskPoolTest::spinUntilInterrupted, &enterCount ) );
+
+		while( enterCount.load() < 2 );
+			// Empty Loop
+
+		ASSERT_FALSE( groupA->tryWait( DELAY ) );
+		instance->interrupt( groupB );
+		ASSERT_FALSE( groupA->tryWait( DELAY ) );
+		instance->interrupt( groupA );
+		ASSERT_TRUE( groupA->tryWait( boost::chrono::seconds( 5 ) ) );
+		ASSERT_EQ( 2, enterCount.load() );
+
+		for( auto& index : results )
+		{
+			ASSERT_THROW( index.get(), ThreadInterrupted );
+		}
+
+		ASSERT_EQ( 42, instance->submit( groupA, [](){ return 42; } ).get() );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of 'TaskPoolTest.cpp'
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
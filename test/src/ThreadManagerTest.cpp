@@ -1,6 +1,6 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // ThreadManagerTest.cpp
-// Robert M. Baker | Created : 26FEB16 | Last Modified : 31AUG19 by Robert M. Baker
+// Robert M. Baker | Created : 26FEB16 | Last Modified : 17OCT26 by Robert M. Baker
 // Version : 2.3.0
 // This is a source file for 'QMXStdLibTest'; it defines a set of unit tests for the 'ThreadManager' class.
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -274,6 +274,25 @@ void threadMainC( const string& groupID, bool doWait, Variables::InstancePtr var
 		}
 }
 
+size_t taskMain( Variables::InstancePtr vars )
+{
+	// Execute main code.
+
+		vars->incCount( ENTER_COUNT );
+
+		try
+		{
+			while( true )
+				THREAD_MANAGER.interruptionPoint();
+		}
+		catch( const ThreadInterrupted& except )
+		{
+			vars->incCount( EXIT_COUNT );
+
+			throw;
+		}
+}
+
 } // 'ThreadManagerTest' Namespace
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -422,19 +441,41 @@ TEST( ThreadManagerTest, TryJoinWorks )
 
 	// Perform unit test for 'tryJoin' method.
 
-		ASSERT_THROW( THREAD_MANAGER.tryJoin( "TestGroup", "TestThreadA", Seconds( 1 ) ), QMXException );
+		ASSERT_STREQ( "0000001F", THREAD_MANAGER.tryJoin( "TestGroup", "TestThreadA", Seconds( 1 ) ).getError().getEventIndex() );
+		THREAD_MANAGER.createGroup( "TestGroup" );
+		ASSERT_STREQ( "00000020", THREAD_MANAGER.tryJoin( "TestGroup", "TestThreadA", Seconds( 1 ) ).getError().getEventIndex() );
+		THREAD_MANAGER.createThread( "TestGroup", "TestThreadA", ThreadManagerTest::threadMainA, "TestGroup", false, vars );
+		THREAD_MANAGER.createThread( "TestGroup", "TestThreadB", ThreadManagerTest::threadMainB, "TestGroup", false, vars );
+		THREAD_MANAGER.createThread( "TestGroup", "TestThreadC", ThreadManagerTest::threadMainC, "TestGroup", false, vars );
+		ASSERT_FALSE( THREAD_MANAGER.tryJoin( "TestGroup", "TestThreadA", Seconds( 1 ) ).getValue() );
+		ASSERT_FALSE( THREAD_MANAGER.tryJoin( "TestGroup", "TestThreadB", Seconds( 1 ) ).getValue() );
+		ASSERT_FALSE( THREAD_MANAGER.tryJoin( "TestGroup", "TestThreadC", Seconds( 1 ) ).getValue() );
+		THREAD_MANAGER.interruptAll( "TestGroup" );
+		ASSERT_TRUE( THREAD_MANAGER.tryJoin( "TestGroup", "TestThreadA", Seconds( 1 ) ).getValue() );
+		ASSERT_TRUE( THREAD_MANAGER.tryJoin( "TestGroup", "TestThreadB", Seconds( 1 ) ).getValue() );
+		ASSERT_TRUE( THREAD_MANAGER.tryJoin( "TestGroup", "TestThreadC", Seconds( 1 ) ).getValue() );
+		ASSERT_EQ( 3, vars->getCount( ThreadManagerTest::EXIT_COUNT ) );
+}
+
+TEST( ThreadManagerTest, TryJoinResultWorks )
+{
+	// Create local variables.
+
+		ThreadManager::InstancePtr instance = ThreadManager::create();
+		ThreadManagerTest::Variables::InstancePtr vars = make_shared< ThreadManagerTest::Variables >();
+
+	// Perform unit test for 'tryJoin' method without a timeout duration.
+
+		ASSERT_STREQ( "0000001F", THREAD_MANAGER.tryJoin( "TestGroup", "TestThreadA" ).getError().getEventIndex() );
 		THREAD_MANAGER.createGroup( "TestGroup" );
-		ASSERT_THROW( THREAD_MANAGER.tryJoin( "TestGroup", "TestThreadA", Seconds( 1 ) ), QMXException );
+		ASSERT_STREQ( "00000020", THREAD_MANAGER.tryJoin( "TestGroup", "TestThreadA" ).getError().getEventIndex() );
 		THREAD_MANAGER.createThread( "TestGroup", "TestThreadA", ThreadManagerTest::threadMainA, "TestGroup", false, vars );
 		THREAD_MANAGER.createThread( "TestGroup", "TestThreadB", ThreadManagerTest::threadMainB, "TestGroup", false, vars );
 		THREAD_MANAGER.createThread( "TestGroup", "TestThreadC", ThreadManagerTest::threadMainC, "TestGroup", false, vars );
-		ASSERT_FALSE( THREAD_MANAGER.tryJoin( "TestGroup", "TestThreadA", Seconds( 1 ) ) );
-		ASSERT_FALSE( THREAD_MANAGER.tryJoin( "TestGroup", "TestThreadB", Seconds( 1 ) ) );
-		ASSERT_FALSE( THREAD_MANAGER.tryJoin( "TestGroup", "TestThreadC", Seconds( 1 ) ) );
 		THREAD_MANAGER.interruptAll( "TestGroup" );
-		ASSERT_TRUE( THREAD_MANAGER.tryJoin( "TestGroup", "TestThreadA", Seconds( 1 ) ) );
-		ASSERT_TRUE( THREAD_MANAGER.tryJoin( "TestGroup", "TestThreadB", Seconds( 1 ) ) );
-		ASSERT_TRUE( THREAD_MANAGER.tryJoin( "TestGroup", "TestThreadC", Seconds( 1 ) ) );
+		ASSERT_TRUE( THREAD_MANAGER.tryJoin( "TestGroup", "TestThreadA" ) );
+		ASSERT_TRUE( THREAD_MANAGER.tryJoin( "TestGroup", "TestThreadB" ) );
+		ASSERT_TRUE( THREAD_MANAGER.tryJoin( "TestGroup", "TestThreadC" ) );
 		ASSERT_EQ( 3, vars->getCount( ThreadManagerTest::EXIT_COUNT ) );
 }
 
@@ -466,14 +507,35 @@ TEST( ThreadManagerTest, TryJoinAllWorks )
 
 	// Perform unit test for 'tryJoinAll' method.
 
-		ASSERT_THROW( THREAD_MANAGER.tryJoinAll( "TestGroup", Seconds( 1 ) ), QMXException );
+		ASSERT_STREQ( "00000021", THREAD_MANAGER.tryJoinAll( "TestGroup", Seconds( 1 ) ).getError().getEventIndex() );
 		THREAD_MANAGER.createGroup( "TestGroup" );
 		THREAD_MANAGER.createThread( "TestGroup", "TestThreadA", ThreadManagerTest::threadMainA, "TestGroup", false, vars );
 		THREAD_MANAGER.createThread( "TestGroup", "TestThreadB", ThreadManagerTest::threadMainB, "TestGroup", false, vars );
 		THREAD_MANAGER.createThread( "TestGroup", "TestThreadC", ThreadManagerTest::threadMainC, "TestGroup", false, vars );
-		ASSERT_FALSE( THREAD_MANAGER.tryJoinAll( "TestGroup", Seconds( 1 ) ) );
+		ASSERT_FALSE( THREAD_MANAGER.tryJoinAll( "TestGroup", Seconds( 1 ) ).getValue() );
 		THREAD_MANAGER.interruptAll( "TestGroup" );
-		ASSERT_TRUE( THREAD_MANAGER.tryJoinAll( "TestGroup", Seconds( 1 ) ) );
+		ASSERT_TRUE( THREAD_MANAGER.tryJoinAll( "TestGroup", Seconds( 1 ) ).getValue() );
+		ASSERT_TRUE( THREAD_MANAGER.tryJoinAll( "TestGroup", Seconds( 1 ) ).getValue() );
+		ASSERT_EQ( 3, vars->getCount( ThreadManagerTest::EXIT_COUNT ) );
+}
+
+TEST( ThreadManagerTest, TryJoinAllResultWorks )
+{
+	// Create local variables.
+
+		ThreadManager::InstancePtr instance = ThreadManager::create();
+		ThreadManagerTest::Variables::InstancePtr vars = make_shared< ThreadManagerTest::Variables >();
+
+	// Perform unit test for 'tryJoinAll' method without a timeout duration.
+
+		ASSERT_STREQ( "00000021", THREAD_MANAGER.tryJoinAll( "TestGroup" ).getError().getEventIndex() );
+		THREAD_MANAGER.createGroup( "TestGroup" );
+		ASSERT_TRUE( THREAD_MANAGER.tryJoinAll( "TestGroup" ) );
+		THREAD_MANAGER.createThread( "TestGroup", "TestThreadA", ThreadManagerTest::threadMainA, "TestGroup", false, vars );
+		THREAD_MANAGER.createThread( "TestGroup", "TestThreadB", ThreadManagerTest::threadMainB, "TestGroup", false, vars );
+		THREAD_MANAGER.createThread( "TestGroup", "TestThreadC", ThreadManagerTest::threadMainC, "TestGroup", false, vars );
+		THREAD_MANAGER.interruptAll( "TestGroup" );
+		ASSERT_TRUE( THREAD_MANAGER.tryJoinAll( "TestGroup" ) );
 		ASSERT_EQ( 3, vars->getCount( ThreadManagerTest::EXIT_COUNT ) );
 }
 
@@ -495,7 +557,29 @@ TEST( ThreadManagerTest, InterruptWorks )
 		THREAD_MANAGER.interrupt( "TestGroup", "TestThreadA" );
 		THREAD_MANAGER.interrupt( "TestGroup", "TestThreadB" );
 		THREAD_MANAGER.interrupt( "TestGroup", "TestThreadC" );
-		ASSERT_TRUE( THREAD_MANAGER.tryJoinAll( "TestGroup", Seconds( 5 ) ) );
+		ASSERT_TRUE( THREAD_MANAGER.tryJoinAll( "TestGroup", Seconds( 5 ) ).getValue() );
+		ASSERT_EQ( 3, vars->getCount( ThreadManagerTest::EXIT_COUNT ) );
+}
+
+TEST( ThreadManagerTest, TryInterruptWorks )
+{
+	// Create local variables.
+
+		ThreadManager::InstancePtr instance = ThreadManager::create();
+		ThreadManagerTest::Variables::InstancePtr vars = make_shared< ThreadManagerTest::Variables >();
+
+	// Perform unit test for 'tryInterrupt' method.
+
+		ASSERT_STREQ( "00000022", THREAD_MANAGER.tryInterrupt( "TestGroup", "TestThreadA" ).getError().getEventIndex() );
+		THREAD_MANAGER.createGroup( "TestGroup" );
+		ASSERT_STREQ( "00000023", THREAD_MANAGER.tryInterrupt( "TestGroup", "TestThreadA" ).getError().getEventIndex() );
+		THREAD_MANAGER.createThread( "TestGroup", "TestThreadA", ThreadManagerTest::threadMainA, "TestGroup", false, vars );
+		THREAD_MANAGER.createThread( "TestGroup", "TestThreadB", ThreadManagerTest::threadMainB, "TestGroup", false, vars );
+		THREAD_MANAGER.createThread( "TestGroup", "TestThreadC", ThreadManagerTest::threadMainC, "TestGroup", false, vars );
+		ASSERT_TRUE( THREAD_MANAGER.tryInterrupt( "TestGroup", "TestThreadA" ) );
+		ASSERT_TRUE( THREAD_MANAGER.tryInterrupt( "TestGroup", "TestThreadB" ) );
+		ASSERT_TRUE( THREAD_MANAGER.tryInterrupt( "TestGroup", "TestThreadC" ) );
+		ASSERT_TRUE( THREAD_MANAGER.tryJoinAll( "TestGroup", Seconds( 5 ) ).getValue() );
 		ASSERT_EQ( 3, vars->getCount( ThreadManagerTest::EXIT_COUNT ) );
 }
 
@@ -514,7 +598,26 @@ TEST( ThreadManagerTest, InterruptAllWorks )
 		THREAD_MANAGER.createThread( "TestGroup", "TestThreadB", ThreadManagerTest::threadMainB, "TestGroup", false, vars );
 		THREAD_MANAGER.createThread( "TestGroup", "TestThreadC", ThreadManagerTest::threadMainC, "TestGroup", false, vars );
 		THREAD_MANAGER.interruptAll( "TestGroup" );
-		ASSERT_TRUE( THREAD_MANAGER.tryJoinAll( "TestGroup", Seconds( 5 ) ) );
+		ASSERT_TRUE( THREAD_MANAGER.tryJoinAll( "TestGroup", Seconds( 5 ) ).getValue() );
+		ASSERT_EQ( 3, vars->getCount( ThreadManagerTest::EXIT_COUNT ) );
+}
+
+TEST( ThreadManagerTest, TryInterruptAllWorks )
+{
+	// Create local variables.
+
+		ThreadManager::InstancePtr instance = ThreadManager::create();
+		ThreadManagerTest::Variables::InstancePtr vars = make_shared< ThreadManagerTest::Variables >();
+
+	// Perform unit test for 'tryInterruptAll' method.
+
+		ASSERT_STREQ( "00000024", THREAD_MANAGER.tryInterruptAll( "TestGroup" ).getError().getEventIndex() );
+		THREAD_MANAGER.createGroup( "TestGroup" );
+		THREAD_MANAGER.createThread( "TestGroup", "TestThreadA", ThreadManagerTest::threadMainA, "TestGroup", false, vars );
+		THREAD_MANAGER.createThread( "TestGroup", "TestThreadB", ThreadManagerTest::threadMainB, "TestGroup", false, vars );
+		THREAD_MANAGER.createThread( "TestGroup", "TestThreadC", ThreadManagerTest::threadMainC, "TestGroup", false, vars );
+		ASSERT_TRUE( THREAD_MANAGER.tryInterruptAll( "TestGroup" ) );
+		ASSERT_TRUE( THREAD_MANAGER.tryJoinAll( "TestGroup", Seconds( 5 ) ).getValue() );
 		ASSERT_EQ( 3, vars->getCount( ThreadManagerTest::EXIT_COUNT ) );
 }
 
@@ -534,7 +637,7 @@ TEST( ThreadManagerTest, WaitWorks )
 		THREAD_MANAGER.createThread( "TestGroup", "TestThreadB", ThreadManagerTest::threadMainB, "TestGroup", true, vars );
 		THREAD_MANAGER.createThread( "TestGroup", "TestThreadC", ThreadManagerTest::threadMainC, "TestGroup", true, vars );
 		THREAD_MANAGER.interruptAll( "TestGroup" );
-		ASSERT_TRUE( THREAD_MANAGER.tryJoinAll( "TestGroup", Seconds( 5 ) ) );
+		ASSERT_TRUE( THREAD_MANAGER.tryJoinAll( "TestGroup", Seconds( 5 ) ).getValue() );
 		ASSERT_EQ( 3, vars->getCount( ThreadManagerTest::WAIT_COUNT ) );
 }
 
@@ -595,6 +698,81 @@ TEST( ThreadManagerTest, DestroyGroupWorks )
 		ASSERT_EQ( 3, vars->getCount( ThreadManagerTest::EXIT_COUNT ) );
 }
 
+TEST( ThreadManagerTest, StartPoolWorks )
+{
+	// Create local variables.
+
+		ThreadManager::InstancePtr instance = ThreadManager::create();
+
+	// Perform unit test for 'startPool' method.
+
+		ASSERT_EQ( 0, THREAD_MANAGER.getPoolSize() );
+		THREAD_MANAGER.startPool( 2 );
+		ASSERT_EQ( 2, THREAD_MANAGER.getPoolSize() );
+		ASSERT_THROW( THREAD_MANAGER.startPool(), QMXException );
+}
+
+TEST( ThreadManagerTest, StopPoolWorks )
+{
+	// Create local variables.
+
+		ThreadManager::InstancePtr instance = ThreadManager::create();
+
+	// Perform unit test for 'stopPool' method.
+
+		ASSERT_THROW( THREAD_MANAGER.stopPool(), QMXException );
+		THREAD_MANAGER.startPool( 2 );
+		THREAD_MANAGER.stopPool();
+		ASSERT_EQ( 0, THREAD_MANAGER.getPoolSize() );
+}
+
+TEST( ThreadManagerTest, SubmitWorks )
+{
+	// Create local variables.
+
+		ThreadManager::InstancePtr instance = ThreadManager::create();
+		ThreadManagerTest::Variables::InstancePtr vars = make_shared< ThreadManagerTest::Variables >();
+		vector< future< size_t > > results;
+
+	// Perform unit test for 'submit' method.
+
+		ASSERT_THROW( THREAD_MANAGER.submit( "TestGroup", []( size_t value ){ return value; }, 0 ), QMXException );
+		THREAD_MANAGER.createGroup( "TestGroup" );
+		ASSERT_THROW( THREAD_MANAGER.submit( "TestGroup", []( size_t value ){ return value; }, 0 ), QMXException );
+		THREAD_MANAGER.startPool( 2 );
+
+		for( size_t index = 0; index < 100; index++ )
+			results.push_back( THREAD_MANAGER.submit( "TestGroup", []( size_t value ){ return ( value + 1 ); }, index ) );
+
+		THREAD_MANAGER.joinAll( "TestGroup" );
+
+		for( size_t index = 0; index < results.size(); index++ )
+		{
+			ASSERT_EQ( ( index + 1 ), results[ index ].get() );
+		}
+
+		results.clear();
+		results.push_back( THREAD_MANAGER.submit( "TestGroup", []( size_t value ){ THREAD_MANAGER.createGroup( "TaskGroup" ); return value; }, 0 ) );
+		ASSERT_TRUE( THREAD_MANAGER.tryJoinAll( "TestGroup", Seconds( 5 ) ).getValue() );
+		ASSERT_EQ( 0, results.front().get() );
+		results.clear();
+
+		for( size_t index = 0; index < 3; index++ )
+			results.push_back( THREAD_MANAGER.submit( "TestGroup", ThreadManagerTest::taskMain, vars ) );
+
+		boost::this_thread::sleep_for( DELAY );
+		ASSERT_EQ( 2, vars->getCount( ThreadManagerTest::ENTER_COUNT ) );
+		ASSERT_FALSE( THREAD_MANAGER.tryJoinAll( "TestGroup", DELAY ).getValue() );
+		THREAD_MANAGER.interruptAll( "TestGroup" );
+		THREAD_MANAGER.joinAll( "TestGroup" );
+		ASSERT_EQ( 2, vars->getCount( ThreadManagerTest::EXIT_COUNT ) );
+
+		for( auto& index : results )
+		{
+			ASSERT_THROW( index.get(), ThreadInterrupted );
+		}
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // End of 'ThreadManagerTest.cpp'
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
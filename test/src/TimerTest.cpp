@@ -1,6 +1,6 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // TimerTest.cpp
-// Robert M. Baker | Created : 19FEB12 | Last Modified : 29AUG19 by Robert M. Baker
+// Robert M. Baker | Created : 19FEB12 | Last Modified : 17OCT26 by Robert M. Baker
 // Version : 2.3.0
 // This is a source file for 'QMXStdLibTest'; it defines a set of unit tests for the 'QMXStdLib::Timer' class.
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -70,6 +70,8 @@ TEST( TimerTest, GetTimeWorks )
 			// Empty Loop
 
 		instance->toggle();
+		ASSERT_NEAR( 250000000.0, instance->getTime( Timer::NANOSECONDS ), 50000000.0 );
+		ASSERT_NEAR( 250000.0, instance->getTime( Timer::MICROSECONDS ), 50000.0 );
 		ASSERT_NEAR( 250.0, instance->getTime( Timer::MILLISECONDS ), 50.0 );
 		ASSERT_NEAR( 0.25, instance->getTime( Timer::SECONDS ), 0.05 );
 		ASSERT_NEAR( 0.004167, instance->getTime( Timer::MINUTES ), 0.0008333 );
@@ -95,6 +97,104 @@ TEST( TimerTest, ResetWorks )
 		ASSERT_NEAR( 0.0, instance->getTime(), 0.05 );
 }
 
+TEST( TimerTest, GetNanosecondsWorks )
+{
+	// Create local variables.
+
+		int64_t stopped = UNSET;
+		Timer::InstancePtr instance = Timer::create();
+
+	// Perform unit test for 'getNanoseconds' method.
+
+		ASSERT_EQ( 0, instance->getNanoseconds() );
+		instance->toggle();
+
+		while( instance->getNanoseconds() < 250000000 );
+			// Empty Loop
+
+		instance->toggle();
+		stopped = instance->getNanoseconds();
+		ASSERT_NEAR( 250000000, stopped, 50000000 );
+		ASSERT_EQ( stopped, instance->getNanoseconds() );
+		ASSERT_DOUBLE_EQ( ( stopped / 1000000000.0 ), instance->getTime() );
+		instance->toggle();
+
+		while( instance->getNanoseconds() < ( stopped + 100000000 ) );
+			// Empty Loop
+
+		instance->toggle();
+		ASSERT_NEAR( ( stopped + 100000000 ), instance->getNanoseconds(), 50000000 );
+}
+
+TEST( TimerTest, ClockSourceWorks )
+{
+	// Create local variables.
+
+		int64_t steadyStart = UNSET;
+		int64_t tscStart = UNSET;
+		int64_t steadyStop = UNSET;
+		int64_t tscStop = UNSET;
+		Timer::InstancePtr instance = Timer::create();
+
+	// Perform unit test for 'setClockSource', 'getClockSource', 'now', and 'isTscAvailable' methods.
+
+		ASSERT_EQ( Timer::STEADY, instance->getClockSource() );
+		instance->setClockSource( Timer::TSC );
+		ASSERT_EQ( ( Timer::isTscAvailable() ? Timer::TSC : Timer::STEADY ), instance->getClockSource() );
+		steadyStart = Timer::now( Timer::STEADY );
+		tscStart = Timer::now( Timer::TSC );
+
+		while( ( Timer::now( Timer::STEADY ) - steadyStart ) < 100000000 );
+			// Empty Loop
+
+		steadyStop = Timer::now( Timer::STEADY );
+		tscStop = Timer::now( Timer::TSC );
+		ASSERT_NEAR( ( steadyStop - steadyStart ), ( tscStop - tscStart ), 25000000 );
+		instance->toggle();
+
+		while( instance->getNanoseconds() < 100000000 );
+			// Empty Loop
+
+		instance->setClockSource( Timer::STEADY );
+		ASSERT_TRUE( instance->isRunning() );
+
+		while( instance->getNanoseconds() < 200000000 );
+			// Empty Loop
+
+		instance->toggle();
+		ASSERT_EQ( Timer::STEADY, instance->getClockSource() );
+		ASSERT_NEAR( 200000000, instance->getNanoseconds(), 50000000 );
+}
+
+TEST( TimerTest, CpuTimeWorks )
+{
+	// Create local variables.
+
+		Timer::InstancePtr instance = Timer::create();
+
+	// Perform unit test for 'setCpuTimeEnabled', 'isCpuTimeEnabled', and 'getCpuNanoseconds' methods.
+
+		ASSERT_FALSE( instance->isCpuTimeEnabled() );
+		instance->toggle();
+
+		while( instance->getNanoseconds() < 50000000 );
+			// Empty Loop
+
+		ASSERT_EQ( 0, instance->getCpuNanoseconds() );
+		instance->setCpuTimeEnabled( true );
+		ASSERT_TRUE( instance->isCpuTimeEnabled() );
+
+		while( instance->getCpuNanoseconds() < 100000000 );
+			// Empty Loop
+
+		instance->toggle();
+		ASSERT_NEAR( 100000000, instance->getCpuNanoseconds(), 50000000 );
+		ASSERT_GE( instance->getNanoseconds(), 150000000 );
+		instance->reset();
+		ASSERT_EQ( 0, instance->getCpuNanoseconds() );
+		ASSERT_EQ( 0, instance->getNanoseconds() );
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // End of 'TimerTest.cpp'
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,284 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// TraceLogTest.cpp
+// Robert M. Baker | Created : 17OCT26 | Last Modified : 17OCT26 by Robert M. Baker
+// Version : 2.3.0
+// This is a source file for 'QMXStdLibTest'; it defines a set of unit tests for the 'QMXStdLib::TraceLog' class.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+//
+// This file is part of 'QMXStdLib'.
+//
+// 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option) any later version.
+//
+// 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Header Files
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../include/TraceLogTest.hpp"
+
+using namespace std;
+using namespace QMXStdLib;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Start of the 'TraceLogTest' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace TraceLogTest
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Type Definitions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+enum Color
+{
+	RED,
+	GREEN,
+	BLUE
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Function Definitions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+string getPath()
+{
+	// Return a unique path in the temporary directory to calling routine.
+
+		return ( boost::filesystem::temp_directory_path() / boost::filesystem::unique_path( "QMXStdLibTrace-%%%%-%%%%.bin" ) ).string();
+}
+
+vector< string > decodeMessages( const string& path, size_t& recordCount )
+{
+	// Create local variables.
+
+		vector< string > result;
+		ostringstream output;
+		istringstream lines;
+		istringstream fields;
+		string line;
+		string date;
+		string time;
+		string threadID;
+		string level;
+		string message;
+
+	// Decode specified file, keeping the level and message of each line.
+
+		recordCount = TraceLog::decode( path, output );
+		lines.str( output.str() );
+
+		while( getline( lines, line ) )
+		{
+			fields.clear();
+			fields.str( line );
+			fields >> date >> time >> threadID >> level;
+			getline( ( fields >> ws ), message );
+			result.push_back( ( level + ' ' + message ) );
+		}
+
+	// Return result to calling routine.
+
+		return result;
+}
+
+void writeMain( size_t threadIndex, size_t recordCount )
+{
+	// Write numbered records.
+
+		for( size_t index = 0; index < recordCount; index++ )
+			TRACE_LOG( DEBUG_LEVEL, "Thread {} record {}", threadIndex, index );
+}
+
+} // 'TraceLogTest' Namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of the 'TraceLogTest' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// 'QMXStdLib::TraceLog' Test Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST( TraceLogTest, OpenWorks )
+{
+	// Create local variables.
+
+		string path = TraceLogTest::getPath();
+		ofstream malformed;
+		ostringstream output;
+
+	// Perform unit test for 'open', 'close', 'isOpen', and 'flush' methods.
+
+		ASSERT_FALSE( TraceLog::isOpen() );
+		ASSERT_THROW( TraceLog::close(), QMXException );
+		ASSERT_THROW( TraceLog::open( ( path + ".missing/trace.bin" ) ), QMXException );
+		ASSERT_FALSE( TraceLog::isOpen() );
+		TraceLog::open( path, 16 );
+		ASSERT_TRUE( TraceLog::isOpen() );
+		ASSERT_THROW( TraceLog::open( path ), QMXException );
+		TraceLog::flush();
+		TraceLog::close();
+		ASSERT_FALSE( TraceLog::isOpen() );
+		ASSERT_EQ( 0u, TraceLog::decode( path, output ) );
+		ASSERT_TRUE( output.str().empty() );
+
+	// Perform unit test for 'decode' method with missing and malformed files.
+
+		ASSERT_THROW( TraceLog::decode( ( path + ".missing" ), output ), QMXException );
+		malformed.open( path, ( ios::out | ios::binary | ios::trunc ) );
+		malformed << "QMXTRACE, but not really.";
+		malformed.close();
+		ASSERT_THROW( TraceLog::decode( path, output ), QMXException );
+		boost::filesystem::remove( path );
+}
+
+TEST( TraceLogTest, WriteWorks )
+{
+	// Create local variables.
+
+		string path = TraceLogTest::getPath();
+		int value = 42;
+		vector< string > messages;
+		vector< size_t > nextRecords( 4, 0 );
+		vector< thread > threads;
+		size_t recordCount = UNSET;
+		size_t threadIndex = UNSET;
+		size_t recordIndex = UNSET;
+
+	// Perform unit test for 'write' method with every argument type; records written while no file is open are discarded.
+
+		TRACE_LOG( INFO_LEVEL, "Discarded {}", 1 );
+		TraceLog::open( path, 1024 );
+		TRACE_LOG( INFO_LEVEL, "Started" );
+		TRACE_LOG( WARNING_LEVEL, "Values {}, {}, {}, and {}", -7, 7u, 2.5, 'x' );
+		TRACE_LOG( ERROR_LEVEL, "Flags {} {}, color {}", true, false, TraceLogTest::BLUE );
+		TRACE_LOG( FATAL_LEVEL, "Pointer {}", &value );
+		TRACE_LOG( DEBUG_LEVEL, "Too few {} {} {}", static_cast< int64_t >( -1 ) );
+		TRACE_LOG( DEBUG_LEVEL, "Too many {}", 1, 2 );
+
+	// Perform unit test for 'write' method from several threads.
+
+		for( size_t index = 0; index < nextRecords.size(); index++ )
+			threads.emplace_back( TraceLogTest::writeMain, index, 200 );
+
+		for( auto& element : threads )
+			element.join();
+
+		TraceLog::close();
+
+	// Check that every record was decoded, and that the records of each thread kept their order.
+
+		messages = TraceLogTest::decodeMessages( path, recordCount );
+		ASSERT_EQ( ( 6u + 800u ), recordCount );
+		ASSERT_EQ( recordCount, messages.size() );
+		ASSERT_EQ( "INFO Started", messages[ 0 ] );
+		ASSERT_EQ( "WARNING Values -7, 7, 2.5, and x", messages[ 1 ] );
+		ASSERT_EQ( "ERROR Flags true false, color 2", messages[ 2 ] );
+		ASSERT_EQ( 0u, messages[ 3 ].find( "FATAL Pointer 0x" ) );
+		ASSERT_EQ( "DEBUG Too few -1 {} {}", messages[ 4 ] );
+		ASSERT_EQ( "DEBUG Too many 1 2", messages[ 5 ] );
+
+		for( size_t index = 6; index < messages.size(); index++ )
+		{
+			ASSERT_EQ( 2, sscanf( messages[ index ].c_str(), "DEBUG Thread %zu record %zu", &threadIndex, &recordIndex ) );
+			ASSERT_LT( threadIndex, nextRecords.size() );
+			ASSERT_EQ( nextRecords[ threadIndex ]++, recordIndex );
+		}
+
+		for( auto element : nextRecords )
+			ASSERT_EQ( 200u, element );
+
+		boost::filesystem::remove( path );
+}
+
+TEST( TraceLogTest, RingWorks )
+{
+	// Create local variables.
+
+		string path = TraceLogTest::getPath();
+		vector< string > messages;
+		size_t recordCount = UNSET;
+
+	// Perform unit test for wrapping around the ring, and for 'getMinimumLevel' and 'setMinimumLevel' methods.
+
+		TraceLog::open( path, 10 );
+		ASSERT_EQ( TraceLog::DEBUG_LEVEL, TraceLog::getMinimumLevel() );
+
+		for( int index = 0; index < 100; index++ )
+			TRACE_LOG( INFO_LEVEL, "Record {}", index );
+
+		TraceLog::setMinimumLevel( TraceLog::WARNING_LEVEL );
+		ASSERT_EQ( TraceLog::WARNING_LEVEL, TraceLog::getMinimumLevel() );
+		TRACE_LOG( INFO_LEVEL, "Filtered" );
+		TRACE_LOG( ERROR_LEVEL, "Kept" );
+		TraceLog::setMinimumLevel( TraceLog::DEBUG_LEVEL );
+		TraceLog::close();
+		messages = TraceLogTest::decodeMessages( path, recordCount );
+		ASSERT_EQ( 16u, recordCount );
+
+		for( size_t index = 0; index < 15; index++ )
+			ASSERT_EQ( ( "INFO Record " + to_string( 85 + index ) ), messages[ index ] );
+
+		ASSERT_EQ( "ERROR Kept", messages[ 15 ] );
+		boost::filesystem::remove( path );
+}
+
+TEST( TraceLogTest, CrashSurvivalWorks )
+{
+	// Create local variables.
+
+		string path = TraceLogTest::getPath();
+		vector< string > messages;
+		size_t recordCount = UNSET;
+		int status = UNSET;
+		uint64_t recordOffset = UNSET;
+		fstream file;
+		pid_t child = fork();
+
+	// Perform unit test for decoding the file of a program killed without closing it.
+
+		if( !child )
+		{
+			TraceLog::open( path, 64 );
+
+			for( int index = 0; index < 10; index++ )
+				TRACE_LOG( ERROR_LEVEL, "Before crash {}", index );
+
+			raise( SIGKILL );
+		}
+
+		ASSERT_GT( child, 0 );
+		ASSERT_EQ( child, waitpid( child, &status, 0 ) );
+		ASSERT_TRUE( WIFSIGNALED( status ) );
+		messages = TraceLogTest::decodeMessages( path, recordCount );
+		ASSERT_EQ( 10u, recordCount );
+		ASSERT_EQ( "ERROR Before crash 0", messages[ 0 ] );
+		ASSERT_EQ( "ERROR Before crash 9", messages[ 9 ] );
+
+	// Perform unit test for dropping a torn record, by changing the first argument of the sixth record behind its checksum; the offset of the records is
+	// the eighth field of the header.
+
+		file.open( path, ( ios::in | ios::out | ios::binary ) );
+		file.seekg( 48 );
+		file.read( reinterpret_cast< char* >( &recordOffset ), sizeof( recordOffset ) );
+		file.seekp( ( recordOffset + ( 5 * 64 ) + 32 ) );
+		file.put( 'X' );
+		file.close();
+		messages = TraceLogTest::decodeMessages( path, recordCount );
+		ASSERT_EQ( 9u, recordCount );
+		ASSERT_EQ( "ERROR Before crash 4", messages[ 4 ] );
+		ASSERT_EQ( "ERROR Before crash 6", messages[ 5 ] );
+		boost::filesystem::remove( path );
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of 'TraceLogTest.cpp'
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
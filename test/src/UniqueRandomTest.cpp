@@ -1,6 +1,6 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // UniqueRandomTest.cpp
-// Robert M. Baker | Created : 10FEB12 | Last Modified : 29AUG19 by Robert M. Baker
+// Robert M. Baker | Created : 10FEB12 | Last Modified : 17OCT26 by Robert M. Baker
 // Version : 2.3.0
 // This is a source file for 'QMXStdLibTest'; it defines a set of unit tests for the 'QMXStdLib::UniqueRandom' functions.
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -26,6 +26,37 @@
 using namespace std;
 using namespace QMXStdLib;
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Start of the 'UniqueRandomTest' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace UniqueRandomTest
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Function Definitions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template< typename NType > void checkUnique( const vector< NType >& values, size_t quantity, NType min, NType max )
+{
+	// Create local variables.
+
+		set< NType > numbers( values.begin(), values.end() );
+
+	// Check that the expected number of distinct values was produced, all of them within the range.
+
+		ASSERT_EQ( quantity, values.size() );
+		ASSERT_EQ( quantity, numbers.size() );
+		ASSERT_LE( min, *numbers.begin() );
+		ASSERT_GE( max, *numbers.rbegin() );
+}
+
+} // 'UniqueRandomTest' Namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of the 'UniqueRandomTest' Namespace
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // 'UniqueRandom' Test Functions
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -51,11 +82,76 @@ TEST( UniqueRandomTest, GenerateIntegralWorks )
 		ASSERT_EQ( 10u, numbers.size() );
 }
 
+TEST( UniqueRandomTest, GenerateIntegralMethodsWork )
+{
+	// Create local variables.
+
+		const UniqueRandom::SamplingMethod METHODS[] = { UniqueRandom::AUTOMATIC, UniqueRandom::SHUFFLE, UniqueRandom::FLOYD, UniqueRandom::SELECTION };
+
+		Int64Vector result;
+		UInt32Vector unsignedResult;
+		vector< size_t > counts;
+		vector< size_t > firstCounts;
+
+	// Initialize random number generator using the current time for the seed.
+
+		Utility::setRandomSeed();
+
+	// Perform unit test for 'generateInt' function using every sampling method across dense, sparse, and huge ranges.
+
+		for( auto method : METHODS )
+		{
+			UniqueRandom::generateInt< int64_t >( result, 0, 0, 100, method );
+			ASSERT_TRUE( result.empty() );
+			UniqueRandom::generateInt< int64_t >( result, 1, 5, 5, method );
+			UniqueRandomTest::checkUnique< int64_t >( result, 1, 4, 5 );
+			UniqueRandom::generateInt< int64_t >( result, 200, -50, 49, method );
+			UniqueRandomTest::checkUnique< int64_t >( result, 100, -50, 49 );
+			UniqueRandom::generateInt< int64_t >( result, 30, -50, 49, method );
+			UniqueRandomTest::checkUnique< int64_t >( result, 30, -50, 49 );
+			UniqueRandom::generateInt< int64_t >( result, 10000, 0, 1000000, method );
+			UniqueRandomTest::checkUnique< int64_t >( result, 10000, 0, 1000000 );
+			UniqueRandom::generateInt< int64_t >( result, 10000, -( 1ll << 50 ), ( 1ll << 50 ), method );
+			UniqueRandomTest::checkUnique< int64_t >( result, 10000, -( 1ll << 50 ), ( 1ll << 50 ) );
+			UniqueRandom::generateInt< int64_t >( result, 1000, numeric_limits< int64_t >::min(), numeric_limits< int64_t >::max(), method );
+			UniqueRandomTest::checkUnique< int64_t >( result, 1000, numeric_limits< int64_t >::min(), numeric_limits< int64_t >::max() );
+			UniqueRandom::generateInt< uint32_t >( unsignedResult, 5000, 0, numeric_limits< uint32_t >::max(), method );
+			UniqueRandomTest::checkUnique< uint32_t >( unsignedResult, 5000, 0, numeric_limits< uint32_t >::max() );
+		}
+
+	// Check that every value is equally likely to be chosen and to come first, which also covers the shuffle of the ascending selection sample.
+
+		for( auto method : METHODS )
+		{
+			for( size_t quantity : { 5, 20 } )
+			{
+				counts.assign( 100, 0 );
+				firstCounts.assign( 100, 0 );
+
+				for( size_t index = 0; index < 20000; index++ )
+				{
+					UniqueRandom::generateInt< int64_t >( result, quantity, 0, 99, method );
+					firstCounts[ result.front() ]++;
+
+					for( auto value : result )
+						counts[ value ]++;
+				}
+
+				for( size_t index = 0; index < 100; index++ )
+				{
+					ASSERT_NEAR( ( 200.0 * quantity ), static_cast< real_t >( counts[ index ] ), ( 40.0 * quantity ) );
+					ASSERT_NEAR( 200.0, static_cast< real_t >( firstCounts[ index ] ), 100.0 );
+				}
+			}
+		}
+}
+
 TEST( UniqueRandomTest, GenerateFloatingPointWorks )
 {
 	// Create local variables.
 
 		RealVector result;
+		DoubleVector doubleResult;
 		set< real_t > numbers;
 
 	// Initialize random number generator using the current time for the seed.
@@ -70,6 +166,26 @@ TEST( UniqueRandomTest, GenerateFloatingPointWorks )
 			numbers.insert( index );
 
 		ASSERT_EQ( 10u, numbers.size() );
+
+	// Perform unit test for 'generate' function using intervals with few representable values, and an empty interval.
+
+		UniqueRandom::generateFloat< real_t >( result, 10, 1.0, nextafter( nextafter( nextafter( 1.0l, 2.0l ), 2.0l ), 2.0l ) );
+		numbers.clear();
+
+		for( const auto& index : result )
+			numbers.insert( index );
+
+		ASSERT_EQ( 3u, numbers.size() );
+		ASSERT_EQ( 1.0, *numbers.begin() );
+		UniqueRandom::generateFloat< real_t >( result, 100000, -1.0, 1.0 );
+		numbers.clear();
+
+		for( const auto& index : result )
+			numbers.insert( index );
+
+		ASSERT_EQ( 100000u, numbers.size() );
+		ASSERT_THROW( UniqueRandom::generateFloat< double >( doubleResult, 10, 1e20, 1e20 ), QMXException );
+		ASSERT_THROW( UniqueRandom::generateFloat< double >( doubleResult, 10, 0.0, numeric_limits< double >::quiet_NaN() ), QMXException );
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1,6 +1,6 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // UtilityTest.cpp
-// Robert M. Baker | Created : 22FEB12 | Last Modified : 29AUG19 by Robert M. Baker
+// Robert M. Baker | Created : 22FEB12 | Last Modified : 17OCT26 by Robert M. Baker
 // Version : 2.3.0
 // This is a source file for 'QMXStdLibTest'; it defines a set of unit tests for the 'QMXStdLib::Utility' class.
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -215,6 +215,208 @@ TEST( UtilityTest, PauseWorks )
 		ASSERT_NEAR( 1, ( currentTime - baseTime ), 1 );
 }
 
+TEST( UtilityTest, PauseModesWork )
+{
+	// Create local variables.
+
+		const Utility::PauseMode MODES[] = { Utility::HYBRID, Utility::SLEEP, Utility::SPIN };
+
+		int64_t margin = Utility::getPauseMargin();
+		int64_t jitter = UNSET;
+		chrono::steady_clock::time_point start;
+		Utility::PauseStatistics statistics;
+
+	// Perform unit test for 'pause' method with every waiting strategy, checking that it never returns early.
+
+		Utility::resetPauseStatistics();
+
+		for( auto mode : MODES )
+		{
+			start = chrono::steady_clock::now();
+			jitter = Utility::pause( 2.0, Timer::MILLISECONDS, mode );
+			ASSERT_GE( ( chrono::steady_clock::now() - start ), chrono::milliseconds( 2 ) );
+			ASSERT_GE( jitter, 0 );
+			start = chrono::steady_clock::now();
+			Utility::pause( 500.0, Timer::NANOSECONDS, mode );
+			ASSERT_GE( ( chrono::steady_clock::now() - start ), chrono::nanoseconds( 500 ) );
+		}
+
+		statistics = Utility::getPauseStatistics();
+		ASSERT_EQ( 6u, statistics.count );
+		ASSERT_LE( 0, statistics.minimum );
+		ASSERT_LE( statistics.minimum, statistics.maximum );
+		ASSERT_LE( statistics.total, ( statistics.maximum * 6 ) );
+
+	// Perform unit test for the pause margin and its calibration, which must leave the statistics alone.
+
+		Utility::setPauseMargin( 12345 );
+		ASSERT_EQ( 12345, Utility::getPauseMargin() );
+		jitter = Utility::calibratePause( 8 );
+		ASSERT_EQ( jitter, Utility::getPauseMargin() );
+		ASSERT_LE( 0, jitter );
+		ASSERT_EQ( 6u, Utility::getPauseStatistics().count );
+		Utility::setPauseMargin( margin );
+		Utility::resetPauseStatistics();
+		ASSERT_EQ( 0u, Utility::getPauseStatistics().count );
+}
+
+TEST( UtilityTest, RandomEnginesWork )
+{
+	// Create local variables.
+
+		const uint64_t XOSHIRO_VALUES[] = { 0x99EC5F36CB75F2B4ull, 0xBF6E1F784956452Aull, 0x1A5F849D4933E6E0ull, 0x6AA594F1262D2D2Cull };
+		const uint32_t PCG_VALUES[] = { 0xA15C02B7u, 0x7B47F409u, 0xBA1D3330u, 0x83D2F293u, 0xBFA4784Bu, 0xCBED606Eu };
+
+		uint64_t mixer = UNSET;
+		Utility::Xoshiro256Engine xoshiro( 0 );
+		Utility::PCG32Engine pcg( 42, 54 );
+
+	// Perform unit test for the engines against the sequences of their reference implementations.
+
+		ASSERT_EQ( 0xE220A8397B1DCDAFull, Utility::splitMix64( mixer ) );
+		ASSERT_EQ( 0x6E789E6AA1B965F4ull, Utility::splitMix64( mixer ) );
+
+		for( auto value : XOSHIRO_VALUES )
+			ASSERT_EQ( value, xoshiro() );
+
+		for( auto value : PCG_VALUES )
+			ASSERT_EQ( value, pcg() );
+}
+
+TEST( UtilityTest, RandomNumbersWork )
+{
+	// Create local variables.
+
+		const Utility::RandomEngine ENGINES[] = { Utility::XOSHIRO, Utility::PCG, Utility::MERSENNE_TWISTER };
+
+		auto draw = []() {
+			vector< uint64_t > result;
+
+			for( size_t index = 0; index < 16; index++ )
+				result.push_back( Utility::randInt< uint64_t >( 0, numeric_limits< uint64_t >::max() ) );
+
+			return result;
+		};
+
+		auto drawStream = [ &draw ]( uint64_t stream, vector< uint64_t >& target ) {
+			Utility::setRandomStream( stream );
+			target = draw();
+		};
+
+		int64_t integer = UNSET;
+		real_t real = UNSET;
+		vector< uint64_t > first;
+		vector< uint64_t > second;
+		vector< uint64_t > third;
+
+	// Perform unit test for 'randInt' and 'randFloat' methods with every engine.
+
+		for( auto engine : ENGINES )
+		{
+			Utility::setRandomEngine( engine );
+			Utility::setRandomSeed();
+
+			for( size_t index = 0; index < 1000; index++ )
+			{
+				integer = Utility::randInt< int64_t >( -10, 10 );
+				real = Utility::randFloat< real_t >( -1.0, 1.0 );
+				ASSERT_TRUE( ( integer >= -10 ) && ( integer <= 10 ) );
+				ASSERT_TRUE( ( real >= -1.0 ) && ( real <= 1.0 ) );
+			}
+
+	// Check that a thread's sequence depends only on the seed and its stream, whichever thread draws it.
+
+			Utility::setRandomSeed( 42 );
+			drawStream( 7, first );
+			Utility::setRandomSeed( 42 );
+			second = draw();
+			ASSERT_EQ( first, second );
+			drawStream( 8, second );
+			ASSERT_NE( first, second );
+			thread( drawStream, 7, ref( second ) ).join();
+			thread( drawStream, 7, ref( third ) ).join();
+			ASSERT_EQ( first, second );
+			ASSERT_EQ( first, third );
+			Utility::setRandomSeed( 43 );
+			drawStream( 7, second );
+			ASSERT_NE( first, second );
+		}
+}
+
+TEST( UtilityTest, FillWorks )
+{
+	// Create local variables.
+
+		const Utility::RandomEngine ENGINES[] = { Utility::XOSHIRO, Utility::PCG, Utility::MERSENNE_TWISTER };
+
+		vector< int64_t > integers( 11000 );
+		vector< uint8_t > bytes( 25600 );
+		vector< int32_t > words( 1000 );
+		vector< uint64_t > dwords( 1000 );
+		vector< double > doubles( 10000 );
+		vector< float > floats( 1000 );
+		RealVector reals( 1000 );
+		vector< size_t > counts;
+		vector< double > repeated( 10000 );
+		double sum = 0.0;
+
+	// Perform unit test for 'fill' method with every engine, over small, byte-sized, word-sized, and full 64-bit ranges.
+
+		for( auto engine : ENGINES )
+		{
+			Utility::setRandomEngine( engine );
+			Utility::setRandomSeed( 42 );
+			Utility::fill< int64_t >( integers, -5, 5 );
+			counts.assign( 11, 0 );
+
+			for( auto value : integers )
+			{
+				ASSERT_TRUE( ( value >= -5 ) && ( value <= 5 ) );
+				counts[ value + 5 ]++;
+			}
+
+			for( auto count : counts )
+				ASSERT_NEAR( 1000.0, static_cast< double >( count ), 200.0 );
+
+			Utility::fill< uint8_t >( bytes, 0, 255 );
+			counts.assign( 256, 0 );
+
+			for( auto value : bytes )
+				counts[ value ]++;
+
+			ASSERT_EQ( 0u, count( counts.begin(), counts.end(), 0u ) );
+			Utility::fill< int32_t >( words, numeric_limits< int32_t >::min(), numeric_limits< int32_t >::max() );
+			ASSERT_LT( *min_element( words.begin(), words.end() ), ( numeric_limits< int32_t >::min() / 2 ) );
+			ASSERT_GT( *max_element( words.begin(), words.end() ), ( numeric_limits< int32_t >::max() / 2 ) );
+			Utility::fill< uint64_t >( dwords, 0, numeric_limits< uint64_t >::max() );
+			ASSERT_GT( *max_element( dwords.begin(), dwords.end() ), ( numeric_limits< uint64_t >::max() / 2 ) );
+			Utility::fill< uint64_t >( dwords.data(), 10, 100, 100 );
+			ASSERT_EQ( 10, count( dwords.begin(), dwords.end(), 100u ) );
+			Utility::fill< double >( doubles, -1.0, 1.0 );
+			sum = 0.0;
+
+			for( auto value : doubles )
+			{
+				ASSERT_TRUE( ( value >= -1.0 ) && ( value < 1.0 ) );
+				sum += value;
+			}
+
+			ASSERT_NEAR( 0.0, ( sum / doubles.size() ), 0.05 );
+			Utility::fill< float >( floats, 2.0f, 3.0f );
+			ASSERT_TRUE( all_of( floats.begin(), floats.end(), []( float value ) { return ( ( value >= 2.0f ) && ( value < 3.0f ) ); } ) );
+			Utility::fill< real_t >( reals, -100.0, 100.0 );
+			ASSERT_TRUE( all_of( reals.begin(), reals.end(), []( real_t value ) { return ( ( value >= -100.0 ) && ( value < 100.0 ) ); } ) );
+
+	// Check that filling is reproducible from the seed.
+
+			Utility::setRandomSeed( 7 );
+			Utility::fill< double >( doubles, 0.0, 1.0 );
+			Utility::setRandomSeed( 7 );
+			Utility::fill< double >( repeated, 0.0, 1.0 );
+			ASSERT_EQ( doubles, repeated );
+		}
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // End of 'UtilityTest.cpp'
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
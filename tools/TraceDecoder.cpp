@@ -0,0 +1,77 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// TraceDecoder.cpp
+// Robert M. Baker | Created : 17OCT26 | Last Modified : 17OCT26 by Robert M. Baker
+// Version : 2.3.0
+// This is the main source file for the trace log decoder of 'QMXStdLib'; it renders each trace log file named on the command line as text.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2011-2019 QuantuMatriX Software, a QuantuMatriX Technologies Cooperative Partnership
+//
+// This file is part of 'QMXStdLib'.
+//
+// 'QMXStdLib' is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option) any later version.
+//
+// 'QMXStdLib' is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License along with 'QMXStdLib'.  If not, see <http://www.gnu.org/licenses/>.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Header Files
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <iostream>
+
+#include "../include/QMXException.hpp"
+#include "../include/TraceLog.hpp"
+
+using namespace std;
+using namespace QMXStdLib;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// The 'MAIN' Function
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main( int argumentCount, char* argumentValues[] )
+{
+	// Create local variables.
+
+		int result = EXIT_SUCCESS;
+
+	// Print usage if no file was specified.
+
+		if( argumentCount < 2 )
+		{
+			cerr << "Usage: " << argumentValues[ 0 ] << " FILE...\n";
+
+			return EXIT_FAILURE;
+		}
+
+	// Decode each specified trace log file to standard output, oldest record first, reporting any file which could not be decoded.
+
+		for( int index = 1; index < argumentCount; index++ )
+		{
+			try
+			{
+				TraceLog::decode( argumentValues[ index ], cout );
+			}
+			catch( const QMXException& except )
+			{
+				cerr << argumentValues[ index ] << ": " << except.what() << '\n';
+				result = EXIT_FAILURE;
+			}
+		}
+
+	// Return result to calling routine.
+
+		return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of the 'MAIN' Function
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of 'TraceDecoder.cpp'
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////